@@ -78,6 +78,8 @@ namespace castor3d
 	*	Updated to submesh components system.
 	*\version 1.7
 	*	Moved to little endian, added support for Mikkelsen tangent space.
+	*\version 1.8
+	*	Added submeshes levels of detail.
 	*\~french
 	*	La version actuelle du format.
 	*\version 1.2
@@ -90,8 +92,10 @@ namespace castor3d
 	*	Mise à jour pour les composants de submesh.
 	*\version 1.7
 	*	Passage à little endian, ajout du support de l'espace tangent de Mikkelsen.
+	*\version 1.8
+	*	Ajout des niveaux de détail des sous-maillages.
 	*/
-	uint32_t constexpr CurrentCmshVersion = makeCmshVersion( 0x01u, 0x07u, 0x0000u );
+	uint32_t constexpr CurrentCmshVersion = makeCmshVersion( 0x01u, 0x08u, 0x0000u );
 	/**
 	*\~english
 	*\brief		Creates a chunk ID.
@@ -213,6 +217,11 @@ namespace castor3d
 		eMorphTargetTangentsMikkt = makeChunkID( 'S', 'M', 'S', 'M', 'K', 'M', 'T', 'A' ),
 		eSubmeshBitangents = makeChunkID( 'S', 'M', 'S', 'M', 'K', 'B', 'I', 'T' ),
 		eMorphTargetBitangents = makeChunkID( 'S', 'M', 'S', 'M', 'K', 'M', 'B', 'I' ),
+		// Version 1.8
+		// Submeshes levels of detail.
+		eSubmeshLodError = makeChunkID( 'S', 'M', 'S', 'H', 'L', 'O', 'D', 'E' ),
+		eSubmeshLodIndexCount = makeChunkID( 'S', 'M', 'S', 'H', 'L', 'O', 'D', 'C' ),
+		eSubmeshLodIndices = makeChunkID( 'S', 'M', 'S', 'H', 'L', 'O', 'D', 'I' ),
 	};
 	/**
 	 *\~english
@@ -346,6 +355,17 @@ namespace castor3d
 		 *\return		\p false si une erreur quelconque est arrivée
 		 */
 		C3D_API bool read( castor::BinaryFile & file );
+		/**
+		 *\~english
+		 *\brief		From memory reader function
+		 *\param[in]	data	The file content, starting with the chunk
+		 *\return		\p false if any error occured
+		 *\~french
+		 *\brief		Fonction de lecture à partir de la mémoire
+		 *\param[in]	data	Le contenu du fichier, commençant par le chunk
+		 *\return		\p false si une erreur quelconque est arrivée
+		 */
+		C3D_API bool read( castor::ByteArray const & data );
 		/**
 		 *\~english
 		 *\brief		Retrieves the remaining data
@@ -222,6 +222,15 @@ namespace castor3d
 	*\remark
 	*/
 	class StagedUploadData;
+	/**
+	*\~english
+	*\brief
+	*	Upload using a persistently mapped staging ring, partitioned per frame.
+	*\~french
+	*\brief
+	*	Upload utilisant un anneau de staging mappé en permanence, partitionné par frame.
+	*/
+	class RingUploadData;
 
 	template< typename DataT >
 	class GpuLinearAllocatorT;
@@ -274,6 +283,38 @@ namespace castor3d
 	{
 		return lhs.offset < rhs.offset;
 	}
+	/**
+	*\~english
+	*\brief
+	*	A modified memory range, in bytes, [begin, end).
+	*\~french
+	*\brief
+	*	Un intervalle mémoire modifié, en octets, [begin, end).
+	*/
+	struct MemRange
+	{
+		VkDeviceSize begin;
+		VkDeviceSize end;
+	};
+	using MemRangeArray = std::vector< MemRange >;
+	/**
+	*\~english
+	*\brief
+	*	Sorts the given ranges, and merges the ones that overlap or are close enough.
+	*\param[in,out] ranges
+	*	The ranges.
+	*\param[in] mergeDistance
+	*	The maximum gap between two ranges for them to be merged.
+	*\~french
+	*\brief
+	*	Trie les intervalles donnés, et fusionne ceux qui se chevauchent ou sont suffisamment proches.
+	*\param[in,out] ranges
+	*	Les intervalles.
+	*\param[in] mergeDistance
+	*	L'écart maximal entre deux intervalles pour qu'ils soient fusionnés.
+	*/
+	C3D_API void mergeRanges( MemRangeArray & ranges
+		, VkDeviceSize mergeDistance );
 
 	C3D_API void copyBuffer( ashes::CommandBuffer const & commandBuffer
 		, ashes::BufferBase const & src
@@ -10,6 +10,7 @@ See LICENSE file in root folder
 
 #include <CastorUtils/Design/ArrayView.hpp>
 #include <CastorUtils/Design/Signal.hpp>
+#include <CastorUtils/Multithreading/SpinMutex.hpp>
 
 #include <ashespp/Buffer/UniformBuffer.hpp>
 
@@ -62,10 +63,29 @@ namespace castor3d
 		/**
 		 *\~english
 		 *\brief		Makes current local modifications available in VRAM.
+		 *\remarks		Only the ranges marked as modified are flushed.
 		 *\~french
 		 *\brief		Rend disponible en VRAM les modifications locales.
+		 *\remarks		Seuls les intervalles marqués comme modifiés sont flushés.
 		 */
 		C3D_API void flush();
+		/**
+		 *\~english
+		 *\brief		Marks a range of the buffer as modified.
+		 *\param[in]	offset, size	The modified range, in bytes.
+		 *\~french
+		 *\brief		Marque un intervalle du tampon comme modifié.
+		 *\param[in]	offset, size	L'intervalle modifié, en octets.
+		 */
+		C3D_API void markDirty( VkDeviceSize offset
+			, VkDeviceSize size );
+		/**
+		 *\~english
+		 *\return		\p true if some ranges have been modified since last flush.
+		 *\~french
+		 *\return		\p true si des intervalles ont été modifiés depuis le dernier flush.
+		 */
+		C3D_API bool hasDirty()const;
 		/**
 		 *\~english
 		 *\param		size	The size wanted.
@@ -122,18 +142,19 @@ namespace castor3d
 		/**
 		*\~english
 		*\return
-		*	The N-th instance of the data.
+		*	The N-th instance of the data, marked as modified.
 		 *\param[in] offset
 		 *	The memory chunk offset.
 		*\~french
 		*\return
-		*	La n-ème instance des données.
+		*	La n-ème instance des données, marquée comme modifiée.
 		 *\param[in] offset
 		*	L'offset de la zone mémoire.
 		*/
 		template< typename DataT >
 		DataT & getData( VkDeviceSize offset )
 		{
+			markDirty( offset, sizeof( DataT ) );
 			return *reinterpret_cast< DataT * >( m_data.data() + offset );
 		}
 		/**
@@ -258,6 +279,8 @@ namespace castor3d
 		ashes::UniformBufferPtr m_buffer;
 		castor::String m_debugName;
 		castor::ByteArrayView m_data;
+		mutable castor::SpinMutex m_dirtyMutex;
+		MemRangeArray m_dirtyRanges;
 	};
 
 	inline PoolUniformBufferUPtr makePoolUniformBuffer( RenderSystem const & renderSystem
@@ -0,0 +1,117 @@
+/*
+See LICENSE file in root folder
+*/
+#ifndef ___C3D_RingUploadData_H___
+#define ___C3D_RingUploadData_H___
+
+#include "Castor3D/Buffer/UploadData.hpp"
+
+#include <RenderGraph/FramePassTimer.hpp>
+
+#include <ashespp/Command/CommandBuffer.hpp>
+#include <ashespp/Sync/Fence.hpp>
+#include <ashespp/Sync/Semaphore.hpp>
+
+namespace castor3d
+{
+	class RingUploadData
+		: public UploadData
+	{
+	public:
+		static VkDeviceSize constexpr DefaultFrameSize = 16ull * 1024ull * 1024ull;
+		static uint32_t constexpr DefaultFrameCount = 2u;
+		/**
+		 *\~english
+		 *\brief		Constructor.
+		 *\param[in]	device		The GPU device.
+		 *\param[in]	debugName	The uploader debug name.
+		 *\param[in]	commandPool	The pool used to create one command buffer per ring frame.
+		 *\param[in]	frameSize	The staging size available for one frame.
+		 *\param[in]	frameCount	The number of frames in the staging ring.
+		 *\~french
+		 *\brief		Constructeur.
+		 *\param[in]	device		Le device GPU.
+		 *\param[in]	debugName	Le nom debug de l'uploader.
+		 *\param[in]	commandPool	Le pool utilisé pour créer un command buffer par frame de l'anneau.
+		 *\param[in]	frameSize	La taille de staging disponible pour une frame.
+		 *\param[in]	frameCount	Le nombre de frames dans l'anneau de staging.
+		 */
+		C3D_API RingUploadData( RenderDevice const & device
+			, std::string debugName
+			, ashes::CommandPool const & commandPool
+			, VkDeviceSize frameSize = DefaultFrameSize
+			, uint32_t frameCount = DefaultFrameCount );
+		C3D_API ~RingUploadData()noexcept override;
+
+		uint32_t getFrameIndex()const noexcept
+		{
+			return m_frameIndex;
+		}
+
+		VkDeviceSize getFrameSize()const noexcept
+		{
+			return m_frameSize;
+		}
+
+	private:
+		void doBegin()override;
+		void doPreprocess( std::vector< BufferDataRange > *& pendingBuffers
+			, std::vector< ImageDataRange > *& pendingImages )override;
+		VkDeviceSize doUpload( BufferDataRange & data )override;
+		VkDeviceSize doUpload( ImageDataRange & data )override;
+		void doPostprocess()override;
+		SemaphoreUsed doEnd( ashes::Queue const & queue
+			, ashes::Fence const * fence
+			, castor::Milliseconds timeout )override;
+
+		struct StagingRange
+		{
+			ashes::BufferBase const * buffer{};
+			VkDeviceSize offset{};
+		};
+
+		struct BufferCopy
+		{
+			BufferDataRange const * data{};
+			StagingRange src{};
+		};
+
+		struct ImageCopy
+		{
+			ImageDataRange * data{};
+			StagingRange src{};
+		};
+
+		struct Frame
+		{
+			ashes::CommandBufferPtr commandBuffer{};
+			ashes::SemaphorePtr semaphore{};
+			ashes::FencePtr fence{};
+			VkDeviceSize begin{};
+			VkDeviceSize current{};
+			bool used{ true };
+			bool submitted{};
+			std::vector< ashes::BufferBasePtr > overflow{};
+			std::vector< BufferCopy > bufferCopies{};
+			std::vector< ImageCopy > imageCopies{};
+			VkDeviceSize uploadSize{};
+		};
+
+		StagingRange doAllocate( Frame & frame
+			, void const * srcData
+			, VkDeviceSize srcSize
+			, VkDeviceSize alignment );
+		void doCopyBuffers( Frame const & frame );
+
+		VkDeviceSize m_frameSize;
+		VkDeviceSize m_alignment;
+		ashes::BufferBasePtr m_ring;
+		uint8_t * m_mapped{};
+		std::vector< Frame > m_frames;
+		uint32_t m_frameIndex{};
+		FramePassTimerUPtr m_timer{};
+		std::unique_ptr< crg::FramePassTimerBlock > m_cpuBlock{};
+	};
+}
+
+#endif
@@ -50,7 +50,7 @@ namespace castor3d
 
 		DataT const & getData()const
 		{
-			return buffer->getData< DataT >( offset * buffer->getAlignedSize() );
+			return getPool().getData< DataT >( offset * buffer->getAlignedSize() );
 		}
 
 		DataT & getData()
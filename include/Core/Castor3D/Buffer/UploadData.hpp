@@ -42,6 +42,13 @@ namespace castor3d
 			, VkImageSubresourceRange dstRange
 			, VkImageLayout dstImageLayout
 			, VkPipelineStageFlags dstPipelineFlags );
+		C3D_API void pushUpload( void const * srcData
+			, VkDeviceSize srcSize
+			, ashes::Image const & dstImage
+			, VkOffset3D dstOffset
+			, VkExtent3D dstExtent
+			, VkImageLayout dstImageLayout
+			, VkPipelineStageFlags dstPipelineFlags );
 		C3D_API void process();
 		C3D_API SemaphoreUsed end( ashes::Queue const & queue
 			, ashes::Fence const * fence = nullptr
@@ -122,6 +129,17 @@ namespace castor3d
 			return m_debugName;
 		}
 
+		/**
+		 *\~english
+		 *\return		The bytes count pushed for upload during the last process, per destination buffer or image.
+		 *\~french
+		 *\return		Le nombre d'octets envoyés en upload durant le dernier traitement, par tampon ou image destination.
+		 */
+		castor::UInt64StrMap const & getUploadSizes()const noexcept
+		{
+			return m_uploadSizes;
+		}
+
 	protected:
 		struct BufferDataRange
 		{
@@ -142,6 +160,10 @@ namespace castor3d
 			VkImageSubresourceRange dstRange{};
 			VkImageLayout dstImageLayout{};
 			VkPipelineStageFlags dstPipelineFlags{};
+			// When dstExtent is not empty, only this region of the first layer and level is updated,
+			// the other texels being preserved.
+			VkOffset3D dstOffset{};
+			VkExtent3D dstExtent{};
 		};
 
 		C3D_API UploadData( RenderDevice const & device
@@ -164,6 +186,8 @@ namespace castor3d
 		ashes::CommandBuffer const * m_commandBuffer;
 		std::vector< BufferDataRange > m_pendingBuffers;
 		std::vector< ImageDataRange > m_pendingImages;
+		castor::UInt64StrMap m_pendingUploadSizes;
+		castor::UInt64StrMap m_uploadSizes;
 
 	private:
 		virtual VkDeviceSize doUpload( BufferDataRange & data ) = 0;
@@ -48,6 +48,7 @@ See LICENSE file in root folder
 #include <CastorUtils/Math/Length.hpp>
 #include <CastorUtils/Miscellaneous/CpuInformations.hpp>
 #include <CastorUtils/Multithreading/AsyncJobQueue.hpp>
+#include <CastorUtils/Multithreading/TaskPool.hpp>
 
 #include <ashespp/Core/RendererList.hpp>
 
@@ -888,6 +889,11 @@ namespace castor3d
 			return m_cpuInformations;
 		}
 
+		castor::TaskPool & getTaskPool()noexcept
+		{
+			return m_taskPool;
+		}
+
 		LightingModelID getDefaultLightingModel()const noexcept
 		{
 			return m_lightingModelId;
@@ -1172,6 +1178,7 @@ namespace castor3d
 		uint32_t m_lpvGridSize{ 32u };
 		uint32_t m_maxImageSize{ 0xFFFFFFFF };
 		castor::AsyncJobQueue m_cpuJobs;
+		castor::TaskPool m_taskPool;
 		crg::ResourceHandler m_resourceHandler;
 		crg::ResourcesCache m_resources;
 		LightingModelFactoryUPtr m_lightingModelFactory;
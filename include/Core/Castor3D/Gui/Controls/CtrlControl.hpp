@@ -128,6 +128,7 @@ namespace castor3d
 		{
 			m_flags |= ControlFlagType( flag );
 			doUpdateFlags();
+			doMarkDirty();
 		}
 
 		/** Adds a flag.
@@ -137,6 +138,7 @@ namespace castor3d
 		{
 			m_flags |= ControlFlagType( flag );
 			doUpdateFlags();
+			doMarkDirty();
 		}
 
 		/** Removes a flag.
@@ -146,6 +148,7 @@ namespace castor3d
 		{
 			m_flags &= ~ControlFlagType( flag );
 			doUpdateFlags();
+			doMarkDirty();
 		}
 
 		/** Removes a flag.
@@ -155,6 +158,7 @@ namespace castor3d
 		{
 			m_flags &= ~ControlFlagType( flag );
 			doUpdateFlags();
+			doMarkDirty();
 		}
 
 		/**@name Getters */
@@ -353,6 +357,14 @@ namespace castor3d
 			, std::vector< Control * > & topControls );
 		void adjustZIndex( uint32_t offset );
 
+		/** Tells the manager its hit-test index must be rebuilt.
+		 */
+		void doMarkIndexDirty()const;
+
+		/** Tells the manager its z-order must be recomputed (children or flags changed).
+		 */
+		C3D_API void doMarkDirty()const;
+
 		/** Event when mouse enters the control
 		 *\param[in]	event		The mouse event
 		 */
@@ -0,0 +1,133 @@
+/*
+See LICENSE file in root folder
+*/
+#ifndef ___C3D_ControlsIndex_H___
+#define ___C3D_ControlsIndex_H___
+
+#include "Castor3D/Gui/GuiModule.hpp"
+
+#include <CastorUtils/Graphics/Position.hpp>
+#include <CastorUtils/Graphics/Size.hpp>
+
+#include <CastorUtils/Config/BeginExternHeaderGuard.hpp>
+#include <vector>
+#include <CastorUtils/Config/EndExternHeaderGuard.hpp>
+
+namespace castor3d
+{
+	/**
+	*\brief
+	*	Uniform grid over z-ordered rectangles, used to hit-test the controls.
+	*\remarks
+	*	The rectangles are given back to front, each grid cell lists the ones overlapping it, in the same order.
+	*	The index is immutable, it is rebuilt when the rectangles change.
+	*/
+	class ControlsIndex
+	{
+	public:
+		//! The default cells dimension, in pixels.
+		static uint32_t constexpr DefaultCellSize = 64u;
+		//! The maximum cells count on each axis, the cells grow to fit.
+		static uint32_t constexpr MaxCellsPerAxis = 256u;
+		//! The index returned when no rectangle is hit.
+		static uint32_t constexpr InvalidIndex = ~0u;
+
+		struct Rect
+		{
+			castor::Position position;
+			castor::Size size;
+		};
+
+	public:
+		ControlsIndex() = default;
+
+		/** Builds the grid.
+		*\param[in] rects
+		*	The rectangles, back to front.
+		*\param[in] cellSize
+		*	The wanted cells dimension.
+		*/
+		C3D_API explicit ControlsIndex( std::vector< Rect > rects
+			, uint32_t cellSize = DefaultCellSize );
+
+		/** Retrieves the frontmost rectangle containing a position.
+		*\param[in] position
+		*	The position.
+		*\param[in] filter
+		*	Tells if the rectangle at given index can be hit.
+		*\return
+		*	The rectangle index, \p InvalidIndex if none is hit.
+		*/
+		template< typename FilterT >
+		uint32_t pick( castor::Position const & position
+			, FilterT filter )const
+		{
+			auto cell = doGetCell( position );
+
+			if ( cell == InvalidIndex )
+			{
+				return InvalidIndex;
+			}
+
+			for ( auto it = m_cellStarts[cell + 1u]; it > m_cellStarts[cell]; --it )
+			{
+				auto index = m_cellItems[it - 1u];
+
+				if ( contains( m_rects[index], position )
+					&& filter( index ) )
+				{
+					return index;
+				}
+			}
+
+			return InvalidIndex;
+		}
+
+		/** \return
+		*	\p true if the rectangle contains the position.
+		*/
+		static bool contains( Rect const & rect
+			, castor::Position const & position )
+		{
+			return rect.position.x() <= position.x()
+				&& rect.position.x() + int32_t( rect.size.getWidth() ) > position.x()
+				&& rect.position.y() <= position.y()
+				&& rect.position.y() + int32_t( rect.size.getHeight() ) > position.y();
+		}
+
+		uint32_t getSize()const noexcept
+		{
+			return uint32_t( m_rects.size() );
+		}
+
+		Rect const & getRect( uint32_t index )const noexcept
+		{
+			return m_rects[index];
+		}
+
+		uint32_t getCellSize()const noexcept
+		{
+			return m_cellSize;
+		}
+
+		uint32_t getCellsCount()const noexcept
+		{
+			return m_columns * m_rows;
+		}
+
+	private:
+		uint32_t doGetCell( castor::Position const & position )const;
+
+	private:
+		std::vector< Rect > m_rects;
+		uint32_t m_cellSize{ DefaultCellSize };
+		castor::Position m_origin;
+		uint32_t m_columns{};
+		uint32_t m_rows{};
+		// For each cell, the range of its rectangles indices in m_cellItems.
+		std::vector< uint32_t > m_cellStarts;
+		std::vector< uint32_t > m_cellItems;
+	};
+}
+
+#endif
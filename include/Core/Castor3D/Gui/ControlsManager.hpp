@@ -5,6 +5,7 @@ See LICENSE file in root folder
 #define ___C3D_ControlsManager_H___
 
 #include "Castor3D/Gui/GuiModule.hpp"
+#include "Castor3D/Gui/ControlsIndex.hpp"
 #include "Castor3D/Gui/Theme/Theme.hpp"
 
 #include "Castor3D/Event/UserInput/UserInputListener.hpp"
@@ -218,6 +219,15 @@ namespace castor3d
 		C3D_API static void * createContext( castor::FileParserContext & context );
 
 	private:
+		/** The z-ordered controls and their spatial index, immutable once published.
+		*/
+		struct ControlsSnapshot
+		{
+			std::vector< ControlRPtr > controls;
+			ControlsIndex index;
+		};
+		using ControlsSnapshotPtr = std::shared_ptr< ControlsSnapshot const >;
+
 		/** Sets the control that is currently moved (only one at a time is allowed).
 		*/
 		bool setMovedControl( ControlRPtr control
@@ -327,28 +337,32 @@ namespace castor3d
 		*/
 		EventHandlerRPtr doGetMouseTargetableHandler( castor::Position const & position )const override;
 
-		/** Updates the z-index ordered controls array
+		/** Updates the z-index ordered controls array, if needed, and rebuilds the hit-test index.
 		*/
 		void doUpdate();
 
 		/** \return
-		*	The controls by z-index.
+		*	The last published hit-test index.
 		*/
-		std::vector< ControlRPtr > doGetControlsByZIndex()const;
+		ControlsSnapshotPtr doLoadSnapshot()const;
 
-		/** Sets the controls by z-index.
+		/** Publishes a hit-test index.
 		*/
-		void doSetControlsByZIndex( std::vector< ControlRPtr > v );
+		void doStoreSnapshot( ControlsSnapshotPtr snapshot );
 
 		/** \return
 		*	The controls by ID.
 		*/
 		std::map< ControlID, ControlRPtr > doGetControlsById()const;
 
-		/** Marks the manager as to be updated.
+		/** Marks the manager as to be updated, when the controls hierarchy changed.
 		*/
 		void doMarkDirty();
 
+		/** Marks the hit-test index as to be rebuilt, when a control moved, was resized, shown or hidden.
+		*/
+		void doMarkIndexDirty();
+
 	public:
 		C3D_API static castor::String Name;
 
@@ -356,8 +370,15 @@ namespace castor3d
 		mutable std::mutex m_mutexControlsById;
 		std::map< ControlID, ControlRPtr > m_controlsById;
 		std::vector< ControlRPtr > m_rootControls;
-		mutable std::mutex m_mutexControlsByZIndex;
-		mutable std::vector< ControlRPtr > m_controlsByZIndex;
+		// Only accessed from the update event.
+		std::vector< ControlRPtr > m_controlsByZIndex;
+		std::atomic_bool m_zIndexDirty{};
+		// Replaced as a whole on each update, so that hit-tests don't lock.
+#if defined( __cpp_lib_atomic_shared_ptr )
+		std::atomic< ControlsSnapshotPtr > m_snapshot;
+#else
+		ControlsSnapshotPtr m_snapshot;
+#endif
 		mutable std::atomic< CpuFrameEvent * > m_event{};
 		std::map< castor::String, ThemeUPtr > m_themes;
 		std::map< Control const *, OnButtonEventConnection > m_onButtonClicks;
@@ -260,6 +260,10 @@ namespace castor3d
 	*/
 	struct LayoutItemFlags;
 	/**
+	*\brief		Spatial index of the z-ordered controls, for mouse hit-tests.
+	*/
+	class ControlsIndex;
+	/**
 	*\brief		Class used to to manage the controls: events and all GUI related stuff.
 	*/
 	class ControlsManager;
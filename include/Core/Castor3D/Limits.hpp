@@ -193,6 +193,25 @@ namespace castor3d
 	//@}
 	/**
 	*\name
+	*	Levels of detail.
+	*/
+	//@{
+	// Max reduced levels of detail in a submesh.
+	static uint32_t constexpr MaxSubmeshLods = 8u;
+	// The tolerated projected simplification error, in pixels, for a null bias.
+	static float constexpr LodPixelError = 1.0f;
+	//@}
+	/**
+	*\name
+	*	Occlusion culling.
+	*/
+	//@{
+	// The CPU occlusion buffer dimensions.
+	static uint32_t constexpr OcclusionBufferWidth = 256u;
+	static uint32_t constexpr OcclusionBufferHeight = 128u;
+	//@}
+	/**
+	*\name
 	*	Clustered rendering.
 	*/
 	//@{
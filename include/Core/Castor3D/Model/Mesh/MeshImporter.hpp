@@ -85,6 +85,23 @@ namespace castor3d
 		 *\return		\p false si un problème quelconque est survenu.
 		 */
 		C3D_API virtual bool doImportMesh( Mesh & mesh ) = 0;
+		/**
+		 *\~english
+		 *\brief		Queues the tangent space computation of a submesh.
+		 *\remarks		The queued submeshes are processed in parallel, once doImportMesh has returned.
+		 *\param[in]	submesh	The submesh.
+		 *\param[in]	normals	Tells if the normals must also be computed.
+		 *\~french
+		 *\brief		Met en attente le calcul de l'espace tangent d'un sous-maillage.
+		 *\remarks		Les sous-maillages en attente sont traités en parallèle, une fois que doImportMesh a retourné.
+		 *\param[in]	submesh	Le sous-maillage.
+		 *\param[in]	normals	Dit si les normales doivent aussi être calculées.
+		 */
+		C3D_API void doComputeTangentSpace( Submesh & submesh
+			, bool normals );
+
+	private:
+		void doFlushTangentSpaces();
 
 	protected:
 		ImporterFile * m_file{};
@@ -94,6 +111,9 @@ namespace castor3d
 		//!\~english Import configuration parameters.
 		//!\~french Paramètres de configuration de l'import.
 		Parameters m_parameters;
+
+	private:
+		std::map< Submesh *, bool > m_tangentSpaces;
 	};
 }
 
@@ -7,6 +7,8 @@ See LICENSE file in root folder
 #include "Castor3D/Miscellaneous/MiscellaneousModule.hpp"
 #include "Castor3D/Model/Mesh/Submesh/Component/SubmeshComponent.hpp"
 
+#include <CastorUtils/Math/Point.hpp>
+
 namespace castor3d
 {
 	class IndexMapping
@@ -60,6 +62,55 @@ namespace castor3d
 		 *\remarks		Cette fonction suppose que les normales sont définies.
 		 */
 		C3D_API virtual void computeTangents() = 0;
+		/**
+		 *\~english
+		 *\return		The reduced levels of detail count, the full detail level excluded.
+		 *\~french
+		 *\return		Le nombre de niveaux de détail réduits, le niveau de détail complet exclu.
+		 */
+		virtual uint32_t getLodsCount()const
+		{
+			return 0u;
+		}
+		/**
+		 *\~english
+		 *\return		The elements count of all the reduced levels of detail, stored after the full detail elements.
+		 *\~french
+		 *\return		Le nombre d'éléments de tous les niveaux de détail réduits, stockés après les éléments du niveau complet.
+		 */
+		virtual uint32_t getLodsElementsCount()const
+		{
+			return 0u;
+		}
+		/**
+		 *\~english
+		 *\brief		Selects the coarsest level of detail whose error is tolerable.
+		 *\param[in]	pixelsPerUnit	The object space units to screen pixels scale.
+		 *\param[in]	pixelError		The tolerated error, in pixels.
+		 *\return		The level index, 0 for the full detail.
+		 *\~french
+		 *\brief		Sélectionne le niveau de détail le plus grossier dont l'erreur est tolérable.
+		 *\param[in]	pixelsPerUnit	L'échelle unités de l'espace objet vers pixels écran.
+		 *\param[in]	pixelError		L'erreur tolérée, en pixels.
+		 *\return		L'indice du niveau, 0 pour le niveau complet.
+		 */
+		virtual uint32_t selectLod( float pixelsPerUnit
+			, float pixelError )const
+		{
+			return 0u;
+		}
+		/**
+		 *\~english
+		 *\param[in]	level	The level of detail index, 0 for the full detail.
+		 *\return		The level first index and indices count, relative to the submesh index buffer chunk.
+		 *\~french
+		 *\param[in]	level	L'indice du niveau de détail, 0 pour le niveau complet.
+		 *\return		Le premier indice et le nombre d'indices du niveau, relatifs au morceau de buffer d'indices du sous-maillage.
+		 */
+		virtual castor::Point2ui getLodIndexRange( uint32_t level )const
+		{
+			return castor::Point2ui{ 0u, getCount() * getComponentsCount() };
+		}
 		/**
 		 *\copydoc		castor3d::SubmeshComponent::gather
 		 */
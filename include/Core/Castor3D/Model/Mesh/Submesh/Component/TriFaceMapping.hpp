@@ -14,6 +14,23 @@ namespace castor3d
 	class TriFaceMapping
 		: public IndexMapping
 	{
+	public:
+		/**
+		\~english
+		\brief		A reduced level of detail, sharing the vertices of the full detail level.
+		\~french
+		\brief		Un niveau de détail réduit, partageant les sommets du niveau de détail complet.
+		*/
+		struct Lod
+		{
+			//!\~english	The level faces.
+			//!\~french		Les faces du niveau.
+			FaceArray faces;
+			//!\~english	The simplification error, in object space units.
+			//!\~french		L'erreur de simplification, en unités de l'espace objet.
+			float error{};
+		};
+
 	public:
 		/**
 		 *\~english
@@ -142,6 +159,23 @@ namespace castor3d
 		 *\copydoc		castor3d::IndexMapping::computeTangents
 		 */
 		C3D_API void computeTangents()override;
+		/**
+		 *\copydoc		castor3d::IndexMapping::getLodsCount
+		 */
+		C3D_API uint32_t getLodsCount()const override;
+		/**
+		 *\copydoc		castor3d::IndexMapping::getLodsElementsCount
+		 */
+		C3D_API uint32_t getLodsElementsCount()const override;
+		/**
+		 *\copydoc		castor3d::IndexMapping::selectLod
+		 */
+		C3D_API uint32_t selectLod( float pixelsPerUnit
+			, float pixelError )const override;
+		/**
+		 *\copydoc		castor3d::IndexMapping::getLodIndexRange
+		 */
+		C3D_API castor::Point2ui getLodIndexRange( uint32_t level )const override;
 		/**
 		 *\copydoc		castor3d::SubmeshComponent::clone
 		 */
@@ -206,6 +240,23 @@ namespace castor3d
 			m_faces = std::move( faces );
 		}
 
+		std::vector< Lod > const & getLods()const
+		{
+			return m_lods;
+		}
+		/**
+		 *\~english
+		 *\brief		Sets the reduced levels of detail.
+		 *\param[in]	lods	The levels, sorted by increasing error.
+		 *\~french
+		 *\brief		Définit les niveaux de détail réduits.
+		 *\param[in]	lods	Les niveaux, triés par erreur croissante.
+		 */
+		void setLods( std::vector< Lod > lods )
+		{
+			m_lods = std::move( lods );
+		}
+
 	private:
 		void doCleanup( RenderDevice const & device )override;
 		void doUpload( UploadData & uploader )override;
@@ -217,6 +268,9 @@ namespace castor3d
 		//!\~english	The faces in the submesh.
 		//!\~french		Le tableau de faces.
 		FaceArray m_faces;
+		//!\~english	The reduced levels of detail, their faces are stored after the full detail ones in the index buffer.
+		//!\~french		Les niveaux de détail réduits, leurs faces sont stockées après celles du niveau complet dans le buffer d'indices.
+		std::vector< Lod > m_lods;
 		//!\~english	Tells if normals exist or need to be computed.
 		//!\~french		Dit si les normales existent ou doivent être calculées.
 		bool m_hasNormals{ false };
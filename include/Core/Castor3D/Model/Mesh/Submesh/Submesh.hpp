@@ -23,6 +23,7 @@ See LICENSE file in root folder
 #include <CastorUtils/Graphics/BoundingBox.hpp>
 #include <CastorUtils/Graphics/BoundingSphere.hpp>
 
+#include <mutex>
 #include <unordered_map>
 
 namespace castor3d
@@ -118,6 +119,17 @@ namespace castor3d
 		 *\return		Le nombre de vertices de ce sous-maillage
 		 */
 		C3D_API uint32_t getPointsCount()const;
+		/**
+		 *\~english
+		 *\brief		Retrieves the triangles BVH, built from the positions and faces on first call.
+		 *\remarks		Thread safe, the BVH is rebuilt after the containers are computed again.
+		 *\n			Skinned or morphed submeshes are represented in their bind pose.
+		 *\~french
+		 *\brief		Récupère le BVH des triangles, construit depuis les positions et les faces au premier appel.
+		 *\remarks		Thread safe, le BVH est reconstruit après que les conteneurs sont recalculés.
+		 *\n			Les sous-maillages skinnés ou morphés sont représentés dans leur pose de référence.
+		 */
+		C3D_API TriangleBvh const & getBvh()const;
 		/**
 		 *\~english
 		 *\brief		Tests if the given Point3f is in mine
@@ -373,6 +385,8 @@ namespace castor3d
 		mutable std::unordered_map< size_t, GeometryBuffers > m_geometryBuffers;
 		bool m_needsNormalsCompute{ false };
 		bool m_disableSceneUpdate{ false };
+		mutable std::mutex m_bvhMutex;
+		mutable TriangleBvhUPtr m_bvh;
 
 		friend class BinaryWriter< Submesh >;
 		friend class BinaryParser< Submesh >;
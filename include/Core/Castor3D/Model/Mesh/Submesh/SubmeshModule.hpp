@@ -334,6 +334,15 @@ namespace castor3d
 	*	Un sous-maillage est sous partie d'un maillage. Il possede ses propres tampons (vertex, normales et texture coords) et ses combobox.
 	*/
 	class Submesh;
+	/**
+	*\~english
+	*\brief
+	*	Bounding volumes hierarchy over a submesh triangles, for CPU ray casts.
+	*\~french
+	*\brief
+	*	Hiérarchie de volumes englobants sur les triangles d'un sous-maillage, pour les lancers de rayons CPU.
+	*/
+	class TriangleBvh;
 
 	struct SubmeshAnimationBuffer
 	{
@@ -373,6 +382,7 @@ namespace castor3d
 	};
 
 	CU_DeclareSmartPtr( castor3d, Submesh, C3D_API );
+	CU_DeclareSmartPtr( castor3d, TriangleBvh, C3D_API );
 
 	//! Submesh pointer array
 	CU_DeclareVector( SubmeshUPtr, SubmeshPtr );
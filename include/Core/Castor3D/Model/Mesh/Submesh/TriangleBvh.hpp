@@ -0,0 +1,131 @@
+/*
+See LICENSE file in root folder
+*/
+#ifndef ___C3D_TriangleBvh_H___
+#define ___C3D_TriangleBvh_H___
+
+#include "SubmeshModule.hpp"
+#include "Castor3D/Model/Mesh/Submesh/Component/ComponentModule.hpp"
+
+#include <CastorUtils/Graphics/BoundingBox.hpp>
+#include <CastorUtils/Math/Point.hpp>
+
+namespace castor3d
+{
+	class TriangleBvh
+	{
+	public:
+		//!\~english	The maximum triangles count in a leaf.
+		//!\~french		Le nombre maximal de triangles dans une feuille.
+		static uint32_t constexpr MaxLeafTriangles = 4u;
+		//!\~english	The bins count used to evaluate the split planes.
+		//!\~french		Le nombre de paniers utilisés pour évaluer les plans de séparation.
+		static uint32_t constexpr BinsCount = 12u;
+
+		/**
+		\~english
+		\brief		The nearest triangle hit by a ray.
+		\~french
+		\brief		Le triangle le plus proche touché par un rayon.
+		*/
+		struct Hit
+		{
+			//!\~english	The face index, in the faces given to the constructor.
+			//!\~french		L'indice de la face, dans les faces données au constructeur.
+			uint32_t face{};
+			//!\~english	The hit distance, in ray direction length units.
+			//!\~french		La distance de l'intersection, en unités de longueur de la direction du rayon.
+			float distance{};
+			//!\~english	The hit barycentric coordinates, relative to the face's second and third vertices.
+			//!\~french		Les coordonnées barycentriques de l'intersection, relatives aux deuxième et troisième sommets de la face.
+			castor::Point2f barycentrics{};
+		};
+
+	public:
+		/**
+		 *\~english
+		 *\brief		Constructor, builds the hierarchy (binned SAH).
+		 *\param[in]	positions	The vertices positions.
+		 *\param[in]	faces		The triangles.
+		 *\~french
+		 *\brief		Constructeur, construit la hiérarchie (SAH par paniers).
+		 *\param[in]	positions	Les positions des sommets.
+		 *\param[in]	faces		Les triangles.
+		 */
+		C3D_API TriangleBvh( castor::Point3fArray const & positions
+			, FaceArray const & faces );
+		/**
+		 *\~english
+		 *\brief		Looks for the nearest triangle hit by a ray.
+		 *\remarks		The direction doesn't need to be normalised, the distances are expressed in its length units.
+		 *\param[in]	origin		The ray origin.
+		 *\param[in]	direction	The ray direction.
+		 *\param[in]	maxDistance	Only the hits nearer than this distance are reported.
+		 *\param[out]	hit			Receives the nearest hit.
+		 *\return		\p false if no triangle is hit.
+		 *\~french
+		 *\brief		Recherche le triangle le plus proche touché par un rayon.
+		 *\remarks		La direction n'a pas besoin d'être normalisée, les distances sont exprimées dans ses unités de longueur.
+		 *\param[in]	origin		L'origine du rayon.
+		 *\param[in]	direction	La direction du rayon.
+		 *\param[in]	maxDistance	Seules les intersections plus proches que cette distance sont retournées.
+		 *\param[out]	hit			Reçoit l'intersection la plus proche.
+		 *\return		\p false si aucun triangle n'est touché.
+		 */
+		C3D_API bool intersect( castor::Point3f const & origin
+			, castor::Point3f const & direction
+			, float maxDistance
+			, Hit & hit )const;
+		/**
+		*\~english
+		*name
+		*	Getters.
+		*\~french
+		*name
+		*	Accesseurs.
+		*/
+		/**@{*/
+		C3D_API castor::BoundingBox getBoundingBox()const;
+
+		uint32_t getNodesCount()const
+		{
+			return uint32_t( m_nodes.size() );
+		}
+
+		uint32_t getTrianglesCount()const
+		{
+			return uint32_t( m_triangles.size() );
+		}
+
+		bool isEmpty()const
+		{
+			return m_triangles.empty();
+		}
+		/**@}*/
+
+	private:
+		struct Node
+		{
+			castor::Point3f min;
+			// First child index for an inner node, first triangle index for a leaf.
+			uint32_t index;
+			castor::Point3f max;
+			// Triangles count, 0 for an inner node.
+			uint32_t count;
+		};
+
+		struct Triangle
+		{
+			castor::Point3f v0;
+			castor::Point3f e1;
+			castor::Point3f e2;
+			uint32_t face;
+		};
+
+	private:
+		std::vector< Node > m_nodes;
+		std::vector< Triangle > m_triangles;
+	};
+}
+
+#endif
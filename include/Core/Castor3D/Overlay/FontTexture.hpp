@@ -16,6 +16,9 @@ See LICENSE file in root folder
 #include <CastorUtils/Graphics/FontCache.hpp>
 #include <CastorUtils/Graphics/Position.hpp>
 
+#include <mutex>
+#include <unordered_map>
+
 namespace castor3d
 {
 	C3D_API void postPreRenderGpuEvent( Engine & engine
@@ -214,6 +217,21 @@ namespace castor3d
 		 *\brief		Convertit un texte en tableau d'index de glyphe.
 		 */
 		C3D_API castor::UInt32Array convert( castor::U32String const & text )const;
+		/**
+		 *\~english
+		 *\brief		Makes sure the glyphs of the given text are resident in the atlas.
+		 *\remarks		Missing glyphs are rasterised and packed in the atlas, evicting the least recently used ones if needed.
+		 *\n			If the atlas has to grow, the texture is refreshed.
+		 *\param[in]	text	The text.
+		 *\return		\p true if at least one glyph has been added to the atlas.
+		 *\~french
+		 *\brief		S'assure que les glyphes du texte donné sont présentes dans l'atlas.
+		 *\remarks		Les glyphes manquantes sont rastérisées et rangées dans l'atlas, en évinçant les moins récemment utilisées si besoin.
+		 *\n			Si l'atlas doit grandir, la texture est rafraîchie.
+		 *\param[in]	text	Le texte.
+		 *\return		\p true si au moins une glyphe a été ajoutée à l'atlas.
+		 */
+		C3D_API bool loadGlyphs( castor::U32String const & text );
 		/**
 		 *\~english
 		 *\brief		Retrieves the font name.
@@ -226,14 +244,51 @@ namespace castor3d
 		/**
 		 *\~english
 		 *\brief		Retrieves the wanted glyph position.
+		 *\remarks		If the glyph is not resident in the texture, the position of '?' is returned.
 		 *\param[in]	glyphChar	The glyph index.
 		 *\return		The position.
 		 *\~french
 		 *\brief		Récupère la position de la glyphe voulue.
+		 *\remarks		Si la glyphe n'est pas présente dans la texture, la position de '?' est retournée.
 		 *\param[in]	glyphChar	L'indice de la glyphe.
 		 *\return		La position.
 		 */
-		C3D_API castor::Position const & getGlyphPosition( char32_t glyphChar )const;
+		C3D_API castor::Position getGlyphPosition( char32_t glyphChar )const;
+		/**
+		 *\~english
+		 *\return		The number of glyph requests that were not resident in the atlas.
+		 *\~french
+		 *\return		Le nombre de demandes de glyphes qui n'étaient pas présentes dans l'atlas.
+		 */
+		C3D_API uint32_t getGlyphMisses()const;
+		/**
+		 *\~english
+		 *\return		The number of glyphs evicted from the atlas.
+		 *\~french
+		 *\return		Le nombre de glyphes évincées de l'atlas.
+		 */
+		C3D_API uint32_t getEvictedGlyphs()const;
+		/**
+		 *\~english
+		 *\return		The number of glyphs resident in the atlas.
+		 *\~french
+		 *\return		Le nombre de glyphes présentes dans l'atlas.
+		 */
+		C3D_API uint32_t getResidentGlyphs()const;
+		/**
+		 *\~english
+		 *\return		The ratio of the atlas area used by the resident glyphs.
+		 *\~french
+		 *\return		La proportion de l'aire de l'atlas utilisée par les glyphes présentes.
+		 */
+		C3D_API float getOccupancy()const;
+		/**
+		 *\~english
+		 *\return		The atlas dimensions.
+		 *\~french
+		 *\return		Les dimensions de l'atlas.
+		 */
+		C3D_API castor::Size getAtlasSize()const;
 		/**
 		 *\~english
 		 *name Getters.
@@ -283,14 +338,67 @@ namespace castor3d
 			, bool front )override;
 		void swapResources()override;
 
+		void doLoadGlyphs( castor::U32String const & text
+			, std::vector< char32_t > & added
+			, bool & moved
+			, bool & grown );
+		bool doPlaceGlyph( castor::Glyph const & glyph
+			, bool & moved
+			, bool & grown );
+		uint32_t doAllocateShelf( uint32_t width
+			, uint32_t height );
+		uint32_t doEvictShelf( uint32_t height
+			, bool staleOnly );
+		castor::Position doGetGlyphPosition( char32_t glyphChar )const;
+		void doMarkDirty( uint32_t begin
+			, uint32_t end );
+
 	private:
+		/**
+		 *\~english
+		 *\brief		A horizontal band of the atlas, filled from left to right.
+		 *\~french
+		 *\brief		Une bande horizontale de l'atlas, remplie de gauche à droite.
+		 */
+		struct AtlasShelf
+		{
+			uint32_t top{};
+			uint32_t height{};
+			uint32_t left{};
+			uint32_t area{};
+			uint64_t lastUse{};
+			std::vector< char32_t > glyphs;
+		};
+
 		castor::FontResPtr m_font{};
 		SamplerObs m_sampler{};
-		GlyphPositionMap m_frontGlyphsPositions;
-		GlyphPositionMap m_backGlyphsPositions;
 		uint32_t m_id;
 		FontGlyphBufferUPtr m_buffer;
+		mutable std::mutex m_atlasMutex;
 		std::map< char32_t, uint32_t > m_charIndices;
+		//!\~english	The CPU copy of the atlas.
+		//!\~french		La copie CPU de l'atlas.
+		castor::ByteArray m_atlas;
+		castor::Size m_atlasSize;
+		//!\~english	The dimensions of the front texture.
+		//!\~french		Les dimensions de la texture de devant.
+		castor::Size m_textureSize;
+		castor::Size m_pendingSize;
+		std::vector< AtlasShelf > m_shelves;
+		uint32_t m_shelvesEnd{};
+		//!\~english	The resident glyphs, and the index of the shelf holding them.
+		//!\~french		Les glyphes présentes, et l'indice de l'étagère les contenant.
+		std::unordered_map< char32_t, uint32_t > m_residents;
+		GlyphPositionMap m_glyphsPositions;
+		//!\~english	The atlas rows modified since last upload.
+		//!\~french		Les lignes de l'atlas modifiées depuis le dernier upload.
+		uint32_t m_dirtyBegin{ ~0u };
+		uint32_t m_dirtyEnd{};
+		castor::ByteArray m_staging;
+		uint64_t m_frameIndex{};
+		uint64_t m_usedArea{};
+		uint32_t m_glyphMisses{};
+		uint32_t m_evictedGlyphs{};
 	};
 }
 
@@ -251,6 +251,15 @@ namespace castor3d
 	/**
 	*\~english
 	*\brief
+	*	Computes and caches the layout of a text, for a given font.
+	*\~french
+	*\brief
+	*	Calcule et garde en cache la disposition d'un texte, pour une police donnée.
+	*/
+	class TextLayout;
+	/**
+	*\~english
+	*\brief
 	*	An overlay with a text.
 	*\~french
 	*\brief
@@ -0,0 +1,166 @@
+/*
+See LICENSE file in root folder
+*/
+#ifndef ___C3D_TextLayout_H___
+#define ___C3D_TextLayout_H___
+
+#include "Castor3D/Overlay/OverlayModule.hpp"
+
+#include <CastorUtils/Graphics/Font.hpp>
+
+#include <CastorUtils/Config/BeginExternHeaderGuard.hpp>
+#include <string>
+#include <vector>
+#include <CastorUtils/Config/EndExternHeaderGuard.hpp>
+
+namespace castor3d
+{
+	/**
+	\~english
+	\brief		Splits a text in lines, words and characters, using a font's glyphs metrics.
+	\remarks	The layout is kept between updates, it is recomputed only for the paragraphs (the text between two line breaks) whose text changed.
+	\n			All the paragraphs are recomputed when the font or an option changing the lines changes,
+	\n			or, in TextLineSpacingMode::eMaxFontHeight mode, when the font's max range changes.
+	\n			The glyphs used by the text must be loaded in the font.
+	\~french
+	\brief		Découpe un texte en lignes, mots et caractères, à partir des métriques des glyphes d'une police.
+	\remarks	La disposition est conservée entre les mises à jour, elle n'est recalculée que pour les paragraphes (le texte entre deux retours à la ligne) dont le texte a changé.
+	\n			Tous les paragraphes sont recalculés quand la police ou une option modifiant les lignes change,
+	\n			ou, en mode TextLineSpacingMode::eMaxFontHeight, quand l'intervalle maximal de la police change.
+	\n			Les glyphes utilisées par le texte doivent être chargées dans la police.
+	*/
+	class TextLayout
+	{
+	public:
+		/**
+		\~english
+		\brief		The layout options.
+		\~french
+		\brief		Les options de disposition.
+		*/
+		struct Config
+		{
+			//!\~english	The text area dimensions, in pixels.
+			//!\~french		Les dimensions de la zone de texte, en pixels.
+			castor::Point2f size{};
+			TextWrappingMode wrappingMode{ TextWrappingMode::eNone };
+			TextLineSpacingMode lineSpacingMode{ TextLineSpacingMode::eOwnHeight };
+			HAlign hAlign{ HAlign::eLeft };
+			VAlign vAlign{ VAlign::eCenter };
+		};
+
+	public:
+		/**
+		 *\~english
+		 *\brief		Updates the layout.
+		 *\param[in]	font	The font.
+		 *\param[in]	caption	The text.
+		 *\param[in]	config	The layout options.
+		 *\return		\p true if the characters, words or lines changed.
+		 *\~french
+		 *\brief		Met à jour la disposition.
+		 *\param[in]	font	La police.
+		 *\param[in]	caption	Le texte.
+		 *\param[in]	config	Les options de disposition.
+		 *\return		\p true si les caractères, mots ou lignes ont changé.
+		 */
+		C3D_API bool update( castor::Font const & font
+			, std::u32string const & caption
+			, Config const & config );
+		/**
+		 *\~english
+		 *\brief		Forgets the cached layout.
+		 *\~french
+		 *\brief		Oublie la disposition en cache.
+		 */
+		C3D_API void clear();
+		/**
+		*\~english
+		*\name
+		*	Getters.
+		*\~french
+		*\name
+		*	Accesseurs.
+		*/
+		/**@{*/
+		castor::ArrayView< TextChar const > getChars()const noexcept
+		{
+			return castor::makeArrayView( m_chars.data(), m_chars.data() + m_chars.size() );
+		}
+
+		castor::ArrayView< TextWord const > getWords()const noexcept
+		{
+			return castor::makeArrayView( m_words.data(), m_words.data() + m_words.size() );
+		}
+
+		castor::ArrayView< TextLine const > getLines()const noexcept
+		{
+			return castor::makeArrayView( m_lines.data(), m_lines.data() + m_lines.size() );
+		}
+
+		std::u32string const & getCharCodes()const noexcept
+		{
+			return m_codes;
+		}
+
+		castor::Point2f const & getMaxRange()const noexcept
+		{
+			return m_maxRange;
+		}
+
+		float getTopOffset()const noexcept
+		{
+			return m_topOffset;
+		}
+		/**
+		 *\~english
+		 *\return		The number of paragraphs laid out during the last update.
+		 *\~french
+		 *\return		Le nombre de paragraphes disposés lors de la dernière mise à jour.
+		 */
+		uint32_t getLaidOutParagraphs()const noexcept
+		{
+			return m_laidOutParagraphs;
+		}
+		/**@}*/
+
+	private:
+		struct Paragraph
+		{
+			std::u32string text;
+			std::vector< TextChar > chars;
+			std::u32string codes;
+			std::vector< TextWord > words;
+			std::vector< TextLine > lines;
+			castor::Point2f maxRange;
+			float height{};
+			// The paragraph's position, and first char, word and line indices in the whole text.
+			float top{};
+			uint32_t charBase{};
+			uint32_t wordBase{};
+			uint32_t lineBase{};
+		};
+
+		void doLayout( castor::Font const & font
+			, Paragraph & paragraph )const;
+		void doAppend( Paragraph & paragraph );
+		void doFinish();
+
+	private:
+		castor::Font const * m_font{};
+		castor::Point2i m_fontRange{};
+		Config m_config{};
+		float m_width{};
+		float m_height{};
+		std::vector< Paragraph > m_paragraphs;
+		std::vector< TextChar > m_chars;
+		std::u32string m_codes;
+		std::vector< TextWord > m_words;
+		std::vector< TextLine > m_lines;
+		castor::Point2f m_maxRange{};
+		float m_topOffset{};
+		uint32_t m_laidOutParagraphs{};
+	};
+}
+
+#endif
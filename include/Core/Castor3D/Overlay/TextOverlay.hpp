@@ -6,6 +6,7 @@ See LICENSE file in root folder
 
 #include "Castor3D/Overlay/OverlayCategory.hpp"
 #include "Castor3D/Overlay/FontTexture.hpp"
+#include "Castor3D/Overlay/TextLayout.hpp"
 
 #include <CastorUtils/Design/ArrayView.hpp>
 
@@ -164,17 +165,22 @@ namespace castor3d
 
 		uint32_t getCharCount()const noexcept
 		{
-			return m_charsCount;
+			return uint32_t( m_layout.getChars().size() );
 		}
 
 		uint32_t getWordCount()const noexcept
 		{
-			return m_words.count;
+			return uint32_t( m_layout.getWords().size() );
 		}
 
 		uint32_t getLineCount()const noexcept
 		{
-			return m_lines.count;
+			return uint32_t( m_layout.getLines().size() );
+		}
+
+		TextLayout const & getLayout()const noexcept
+		{
+			return m_layout;
 		}
 		/**@}*/
 		/**
@@ -244,10 +250,16 @@ namespace castor3d
 		 *\param[in]	renderSize	Les dimensions de la zone de rendu.
 		 */
 		void doPrepareText( castor::Size const & renderSize );
+		/**
+		 *\~english
+		 *\brief		Retrieves the chars positions in the font texture, for the chars that changed.
+		 *\~french
+		 *\brief		Récupère les positions des caractères dans la texture de police, pour les caractères qui ont changé.
+		 */
+		void doUpdateUvPositions();
 
 	private:
 		std::u32string m_currentCaption;
-		std::u32string m_previousCaption;
 		FontTextureRPtr m_fontTexture{};
 		TextWrappingMode m_wrappingMode{ TextWrappingMode::eNone };
 		TextLineSpacingMode m_lineSpacingMode{ TextLineSpacingMode::eOwnHeight };
@@ -256,10 +268,11 @@ namespace castor3d
 		bool m_textChanged{ true };
 		FontTexture::OnChanged::connection m_connection;
 		TextTexturingMode m_texturingMode{ TextTexturingMode::eText };
-		std::array< TextChar, MaxCharsPerOverlay > m_text;
-		uint32_t m_charsCount{};
-		OverlayWords m_words;
-		OverlayLines m_lines;
+		TextLayout m_layout;
+		// The chars whose position in the font texture is known, and these positions.
+		std::u32string m_uvCodes;
+		std::vector< castor::Point2f > m_uvPositions;
+		std::atomic_bool m_fontTextureChanged{ true };
 	};
 }
 
@@ -37,6 +37,15 @@ namespace castor3d
 	/**
 	*\~english
 	*\brief
+	*	CPU depth buffer filled with occluders, to cull the nodes hidden behind them.
+	*\~french
+	*\brief
+	*	Tampon de profondeur CPU rempli avec les occulteurs, pour éliminer les noeuds cachés derrière eux.
+	*/
+	class OcclusionBuffer;
+	/**
+	*\~english
+	*\brief
 	*	Base class to cull nodes, before adding them to the render queue.
 	*\~french
 	*\brief
@@ -44,6 +53,7 @@ namespace castor3d
 	*/
 	class SceneCuller;
 
+	CU_DeclareSmartPtr( castor3d, OcclusionBuffer, C3D_API );
 	CU_DeclareSmartPtr( castor3d, SceneCuller, C3D_API );
 
 	using SceneCullerSignalFunction = std::function< void( SceneCuller const & ) >;
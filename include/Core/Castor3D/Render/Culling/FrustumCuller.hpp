@@ -25,6 +25,9 @@ namespace castor3d
 		C3D_API void updateFrustum( castor::Matrix4x4f const & projection
 			, castor::Matrix4x4f const & view );
 
+	protected:
+		Frustum const * getLodFrustum()const override;
+
 	private:
 		bool isSubmeshVisible( SubmeshRenderNode const & node )const override;
 		bool isBillboardVisible( BillboardRenderNode const & node )const override;
@@ -0,0 +1,150 @@
+/*
+See LICENSE file in root folder
+*/
+#ifndef ___C3D_OcclusionBuffer_H___
+#define ___C3D_OcclusionBuffer_H___
+
+#include "CullingModule.hpp"
+#include "Castor3D/Model/Mesh/Submesh/Component/ComponentModule.hpp"
+
+#include <CastorUtils/Graphics/BoundingBox.hpp>
+#include <CastorUtils/Math/SquareMatrix.hpp>
+
+#include <CastorUtils/Config/BeginExternHeaderGuard.hpp>
+#include <vector>
+#include <CastorUtils/Config/EndExternHeaderGuard.hpp>
+
+namespace castor3d
+{
+	/**
+	\~english
+	\brief		Low resolution CPU depth buffer, filled with occluder triangles, and its hierarchical Z pyramid.
+	\remarks	The depths are the inverse of the clip space W, so that they don't depend on the depth range convention, 0 meaning no occluder.
+	\n			The pixels whose center is covered by a triangle are written with the farthest depth the triangle reaches in the pixel, so the depth tests are conservative.
+	\n			The triangles crossing the camera plane are ignored.
+	\~french
+	\brief		Tampon de profondeur CPU basse résolution, rempli avec les triangles des occulteurs, et sa pyramide Z hiérarchique.
+	\remarks	Les profondeurs sont l'inverse du W en espace de découpe, afin qu'elles ne dépendent pas de la convention d'intervalle de profondeur, 0 signifiant aucun occulteur.
+	\n			Les pixels dont le centre est couvert par un triangle sont écrits avec la profondeur la plus lointaine que le triangle atteint dans le pixel, les tests de profondeur sont donc conservatifs.
+	\n			Les triangles traversant le plan de la caméra sont ignorés.
+	*/
+	class OcclusionBuffer
+	{
+	public:
+		/**
+		 *\~english
+		 *\brief		Constructor.
+		 *\param[in]	width, height	The buffer dimensions.
+		 *\~french
+		 *\brief		Constructeur.
+		 *\param[in]	width, height	Les dimensions du tampon.
+		 */
+		C3D_API OcclusionBuffer( uint32_t width
+			, uint32_t height );
+		/**
+		 *\~english
+		 *\brief		Removes all the occluders.
+		 *\param[in]	viewProj	The camera view projection matrix.
+		 *\~french
+		 *\brief		Supprime tous les occulteurs.
+		 *\param[in]	viewProj	La matrice vue projection de la caméra.
+		 */
+		C3D_API void clear( castor::Matrix4x4f const & viewProj );
+		/**
+		 *\~english
+		 *\brief		Rasterises an occluder's triangles.
+		 *\param[in]	positions	The occluder vertices positions.
+		 *\param[in]	faces		The occluder triangles.
+		 *\param[in]	transform	The occluder world matrix.
+		 *\~french
+		 *\brief		Rastérise les triangles d'un occulteur.
+		 *\param[in]	positions	Les positions des sommets de l'occulteur.
+		 *\param[in]	faces		Les triangles de l'occulteur.
+		 *\param[in]	transform	La matrice monde de l'occulteur.
+		 */
+		C3D_API void addOccluder( castor::Point3fArray const & positions
+			, FaceArray const & faces
+			, castor::Matrix4x4f const & transform );
+		/**
+		 *\~english
+		 *\brief		Builds the hierarchical Z pyramid, once all the occluders are rasterised.
+		 *\~french
+		 *\brief		Construit la pyramide Z hiérarchique, une fois que tous les occulteurs sont rastérisés.
+		 */
+		C3D_API void buildPyramid();
+		/**
+		 *\~english
+		 *\param[in]	box			An object bounding box.
+		 *\param[in]	transform	The object world matrix.
+		 *\return		\p true if the box is entirely behind the occluders.
+		 *\~french
+		 *\param[in]	box			La bounding box d'un objet.
+		 *\param[in]	transform	La matrice monde de l'objet.
+		 *\return		\p true si la boîte est entièrement derrière les occulteurs.
+		 */
+		C3D_API bool isOccluded( castor::BoundingBox const & box
+			, castor::Matrix4x4f const & transform )const;
+		/**
+		*\~english
+		*name
+		*	Getters.
+		*\~french
+		*name
+		*	Accesseurs.
+		*/
+		/**@{*/
+		uint32_t getWidth()const noexcept
+		{
+			return m_levels.front().width;
+		}
+
+		uint32_t getHeight()const noexcept
+		{
+			return m_levels.front().height;
+		}
+
+		uint32_t getLevelsCount()const noexcept
+		{
+			return uint32_t( m_levels.size() );
+		}
+
+		uint32_t getTrianglesCount()const noexcept
+		{
+			return m_trianglesCount;
+		}
+
+		bool hasOccluders()const noexcept
+		{
+			return m_trianglesCount != 0u;
+		}
+
+		float getDepth( uint32_t level
+			, uint32_t x
+			, uint32_t y )const
+		{
+			auto & data = m_levels[level];
+			return data.depths[y * data.width + x];
+		}
+		/**@}*/
+
+	private:
+		void doRasterise( castor::Point4f const & a
+			, castor::Point4f const & b
+			, castor::Point4f const & c );
+
+	private:
+		struct Level
+		{
+			uint32_t width;
+			uint32_t height;
+			std::vector< float > depths;
+		};
+
+		std::vector< Level > m_levels;
+		castor::Matrix4x4f m_viewProj;
+		uint32_t m_trianglesCount{};
+		std::vector< castor::Point4f > m_clipPositions;
+	};
+}
+
+#endif
@@ -39,6 +39,16 @@ namespace castor3d
 		C3D_API void removeCulled( SubmeshRenderNode const & node );
 		C3D_API void removeCulled( BillboardRenderNode const & node );
 		C3D_API void resetCamera( Camera * camera );
+		/**
+		 *\~english
+		 *\brief		Tells the culler it feeds shadow passes, which use the scene's shadow level of detail bias.
+		 *\~french
+		 *\brief		Indique que le culler alimente des passes d'ombres, qui utilisent le biais de niveau de détail des ombres de la scène.
+		 */
+		void setShadowCuller( bool value )
+		{
+			m_shadowCuller = value;
+		}
 		/**
 		*\~english
 		*name
@@ -58,6 +68,11 @@ namespace castor3d
 			return m_camera != nullptr;
 		}
 
+		bool isShadowCuller()const
+		{
+			return m_shadowCuller;
+		}
+
 		bool hasNodes()const
 		{
 			return !m_culledSubmeshes.empty()
@@ -100,19 +115,39 @@ namespace castor3d
 	public:
 		mutable SceneCullerSignal onCompute;
 
+	protected:
+		/**
+		 *\~english
+		 *\return		The frustum used to select the submeshes levels of detail, \p nullptr to always use the full detail.
+		 *\~french
+		 *\return		Le frustum utilisé pour sélectionner les niveaux de détail des sous-maillages, \p nullptr pour toujours utiliser le niveau complet.
+		 */
+		C3D_API virtual Frustum const * getLodFrustum()const;
+		/**
+		 *\~english
+		 *\return		\p true if the node is hidden behind the scene's occluders, as seen from the culler's camera.
+		 *\~french
+		 *\return		\p true si le noeud est caché derrière les occulteurs de la scène, vus depuis la caméra du culler.
+		 */
+		C3D_API bool isOccluded( SubmeshRenderNode const & node )const;
+
 	private:
 		void doInitialiseCulled();
-		void doUpdateChanged( CpuUpdater::DirtyObjects & sceneObjs );
+		void doBuildOcclusion();
+		bool doUpdateOcclusion( CpuUpdater::DirtyObjects const & sceneObjs );
+		void doUpdateChanged( CpuUpdater::DirtyObjects & sceneObjs
+			, bool occlusionChanged );
 		void doUpdateCulled( CpuUpdater::DirtyObjects & sceneObjs );
 		void doMarkDirty( CpuUpdater::DirtyObjects & sceneObjs
-			, std::vector< SubmeshRenderNode const * > & dirtySubmeshes
-			, std::vector< BillboardRenderNode const * > & dirtyBillboards );
-		void duUpdateCulledSubmeshes( std::vector< SubmeshRenderNode const * > const & dirtySubmeshes );
-		void duUpdateCulledBillboards( std::vector< BillboardRenderNode const * > const & dirtyBillboards );
+			, std::pmr::vector< SubmeshRenderNode const * > & dirtySubmeshes
+			, std::pmr::vector< BillboardRenderNode const * > & dirtyBillboards );
+		void duUpdateCulledSubmeshes( std::pmr::vector< SubmeshRenderNode const * > const & dirtySubmeshes );
+		void duUpdateCulledBillboards( std::pmr::vector< BillboardRenderNode const * > const & dirtyBillboards );
+		uint32_t doSelectLod( SubmeshRenderNode const & node )const;
 		void doMakeDirty( Geometry const & object
-			, std::vector< SubmeshRenderNode const * > & dirtySubmeshes )const;
+			, std::pmr::vector< SubmeshRenderNode const * > & dirtySubmeshes )const;
 		void doMakeDirty( BillboardBase const & object
-			, std::vector< BillboardRenderNode const * > & dirtyBillboards )const;
+			, std::pmr::vector< BillboardRenderNode const * > & dirtyBillboards )const;
 		virtual bool isSubmeshVisible( SubmeshRenderNode const & node )const = 0;
 		virtual bool isBillboardVisible( BillboardRenderNode const & node )const = 0;
 
@@ -129,6 +164,8 @@ namespace castor3d
 		FramePassTimerUPtr m_timerDirty;
 		FramePassTimerUPtr m_timerCompute;
 		std::optional< bool > m_isStatic;
+		bool m_shadowCuller{};
+		OcclusionBufferUPtr m_occlusion;
 
 		NodeArrayT< SubmeshRenderNode > m_culledSubmeshes;
 		NodeArrayT< BillboardRenderNode > m_culledBillboards;
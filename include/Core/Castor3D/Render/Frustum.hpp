@@ -91,6 +91,17 @@ namespace castor3d
 		 *\return		\p false si le point en dehors du frustum de vue.
 		 */
 		C3D_API bool isVisible( castor::Point3f const & point )const;
+		/**
+		 *\~english
+		 *\brief		Computes the viewport pixels count covered by a world space unit, at given position.
+		 *\param[in]	position	The world space position.
+		 *\return		The scale, huge for a position on or behind the view plane.
+		 *\~french
+		 *\brief		Calcule le nombre de pixels du viewport couverts par une unité de l'espace monde, à la position donnée.
+		 *\param[in]	position	La position dans l'espace monde.
+		 *\return		L'échelle, énorme pour une position sur ou derrière le plan de vue.
+		 */
+		C3D_API float getPixelsPerUnit( castor::Point3f const & position )const;
 
 		std::array< InterleavedVertex, 8u > const & getPoints()const
 		{
@@ -110,6 +121,8 @@ namespace castor3d
 	private:
 		Viewport * m_viewport;
 		Planes m_planes;
+		castor::Matrix4x4f m_viewProjection;
+		float m_projectionScale{};
 		std::array< InterleavedVertex, 8u > m_points;
 		castor::BoundingBox m_boundingBox;
 	};
@@ -23,6 +23,9 @@ namespace castor3d
 		C3D_API BillboardRenderNode & operator=( BillboardRenderNode const & ) = delete;
 		C3D_API BillboardRenderNode & operator=( BillboardRenderNode && ) = delete;
 
+		C3D_API static void * operator new( size_t size );
+		C3D_API static void operator delete( void * memory, size_t size );
+
 		C3D_API BillboardRenderNode( Pass & pass
 			, DataType & data
 			, ModelBufferConfiguration & modelData
@@ -15,6 +15,8 @@ See LICENSE file in root folder
 
 #include <CastorUtils/Design/OwnedBy.hpp>
 
+#include <memory_resource>
+
 namespace castor3d
 {
 	struct QueueRenderNodes
@@ -91,11 +93,13 @@ namespace castor3d
 		void doAddSubmesh( ShadowMapLightTypeArray & shadowMaps
 			, ShadowBuffer const * shadowBuffer
 			, SubmeshRenderNode const & node
-			, bool frontCulled );
+			, bool frontCulled
+			, uint32_t lod );
 		void doAddInstancedSubmesh( ShadowMapLightTypeArray & shadowMaps
 			, ShadowBuffer const * shadowBuffer
 			, SubmeshRenderNode const & node
-			, bool frontCulled );
+			, bool frontCulled
+			, uint32_t lod );
 		void doAddBillboard( ShadowMapLightTypeArray & shadowMaps
 			, ShadowBuffer const * shadowBuffer
 			, BillboardRenderNode const & node );
@@ -121,6 +125,9 @@ namespace castor3d
 
 		PipelineMap m_pipelines;
 
+		//!\~english	Recycles the sorted nodes containers memory, from one sort to the next.
+		//!\~french		Recycle la mémoire des conteneurs de noeuds triés, d'un tri à l'autre.
+		std::pmr::unsynchronized_pool_resource m_nodesResource;
 		//!\~english	The submesh render nodes, sorted by shader program.
 		//!\~french		Les noeuds de rendu de submesh, triés par programme shader.
 		NodePtrByPipelineMapT< SubmeshRenderNode > m_submeshNodes;
@@ -108,32 +108,34 @@ namespace castor3d
 		NodeT const * node{};
 		uint32_t instanceCount{};
 		bool visibleOrFrontCulled{};
+		// The selected level of detail, 0 for the full detail.
+		uint32_t lod{};
 	};
 
 	template< typename NodeT >
-	using NodeArrayT = std::vector< CountedNodeT< NodeT > >;
+	using NodeArrayT = std::pmr::vector< CountedNodeT< NodeT > >;
 
 	template< typename NodeT >
-	using NodePtrByBufferMapT = std::unordered_map< ashes::BufferBase const *, NodeArrayT< NodeT > >;
+	using NodePtrByBufferMapT = std::pmr::unordered_map< ashes::BufferBase const *, NodeArrayT< NodeT > >;
 
 	template< typename NodeT >
-	using NodePtrByPipelineMapT = std::unordered_map< RenderPipeline *, NodePtrByBufferMapT< NodeT > >;
+	using NodePtrByPipelineMapT = std::pmr::unordered_map< RenderPipeline *, NodePtrByBufferMapT< NodeT > >;
 
 	//@}
 	/**@name Instanced */
 	//@{
 
 	template< typename NodeT >
-	using ObjectNodesPtrMapT = std::unordered_map< NodeObjectT< NodeT > *, NodeArrayT< NodeT > >;
+	using ObjectNodesPtrMapT = std::pmr::unordered_map< NodeObjectT< NodeT > *, NodeArrayT< NodeT > >;
 
 	template< typename NodeT >
-	using ObjectNodesPtrByPassT = std::unordered_map< PassRPtr, ObjectNodesPtrMapT< NodeT > >;
+	using ObjectNodesPtrByPassT = std::pmr::unordered_map< PassRPtr, ObjectNodesPtrMapT< NodeT > >;
 
 	template< typename NodeT >
-	using ObjectNodesPtrByBufferMapT = std::unordered_map< ashes::BufferBase const *, ObjectNodesPtrByPassT< NodeT > >;
+	using ObjectNodesPtrByBufferMapT = std::pmr::unordered_map< ashes::BufferBase const *, ObjectNodesPtrByPassT< NodeT > >;
 
 	template< typename NodeT >
-	using ObjectNodesPtrByPipelineMapT = std::unordered_map< RenderPipeline *, ObjectNodesPtrByBufferMapT< NodeT > >;
+	using ObjectNodesPtrByPipelineMapT = std::pmr::unordered_map< RenderPipeline *, ObjectNodesPtrByBufferMapT< NodeT > >;
 
 	//@}
 	//@}
@@ -31,6 +31,9 @@ namespace castor3d
 		C3D_API SubmeshRenderNode & operator=( SubmeshRenderNode const & ) = delete;
 		C3D_API SubmeshRenderNode & operator=( SubmeshRenderNode && ) = delete;
 
+		C3D_API static void * operator new( size_t size );
+		C3D_API static void operator delete( void * memory, size_t size );
+
 		C3D_API SubmeshRenderNode( Pass & pass
 			, DataType & data
 			, InstanceType & instance
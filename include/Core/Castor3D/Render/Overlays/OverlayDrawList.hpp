@@ -0,0 +1,107 @@
+/*
+See LICENSE file in root folder
+*/
+#ifndef ___C3D_OverlayDrawList_H___
+#define ___C3D_OverlayDrawList_H___
+
+#include "Castor3D/Render/Overlays/OverlaysModule.hpp"
+
+#include <CastorUtils/Design/ArrayView.hpp>
+
+#include <CastorUtils/Config/BeginExternHeaderGuard.hpp>
+#include <unordered_map>
+#include <vector>
+#include <CastorUtils/Config/EndExternHeaderGuard.hpp>
+
+namespace castor3d
+{
+	/**
+	*\brief
+	*	Flat list of the overlays draws, grouped in batches sharing the same pipeline data.
+	*\remarks
+	*	The draws are ordered by level, and inside a level by pipeline data,
+	*	the pipeline data drawn last in the previous level coming first, so that its batch carries on.
+	*	A batch is drawn with a single indirect multi-draw, its draws being contiguous in the pipeline data's indirect buffer.
+	*	The storage is kept between frames, and the list tells if its batches changed since the previous frame.
+	*/
+	class OverlayDrawList
+	{
+	public:
+		struct Batch
+		{
+			//! The pipeline data shared by the batch draws.
+			OverlayPipelineData const * pipelineData{};
+			//! The index of the batch first draw, in the list.
+			uint32_t first{};
+			//! The index of the batch first draw, in the pipeline data's indirect buffer.
+			uint32_t offset{};
+			//! The draws count.
+			uint32_t count{};
+
+			//! The recorded draw commands only depend on these.
+			bool operator==( Batch const & rhs )const noexcept
+			{
+				return pipelineData == rhs.pipelineData
+					&& offset == rhs.offset
+					&& count == rhs.count;
+			}
+		};
+
+	public:
+		/** Empties the list, keeping its storage and the previous frame batches.
+		*/
+		C3D_API void clear();
+		/** Adds a draw.
+		*\param[in] level
+		*	The overlay level.
+		*\param[in] data
+		*	The draw data, its pipeline data must be set.
+		*/
+		C3D_API void add( uint32_t level
+			, OverlayDrawData data );
+		/** Orders the draws and builds the batches.
+		*\return
+		*	\p true if the batches differ from the ones of the previous call.
+		*/
+		C3D_API bool sort();
+		/** Forces the next sort() to report a change.
+		*\remarks
+		*	To be called when a pipeline data or one of its descriptor sets is destroyed,
+		*	its address may then be reused by another one.
+		*/
+		void invalidate()noexcept
+		{
+			m_invalidated = true;
+		}
+
+		castor::ArrayView< OverlayDrawData > getDraws()noexcept
+		{
+			return castor::makeArrayView( m_draws.data(), m_draws.data() + m_draws.size() );
+		}
+
+		castor::ArrayView< Batch const > getBatches()const noexcept
+		{
+			return castor::makeArrayView( m_batches.data(), m_batches.data() + m_batches.size() );
+		}
+
+	private:
+		struct Entry
+		{
+			uint32_t level{};
+			uint32_t rank{};
+			uint32_t index{};
+		};
+
+	private:
+		std::vector< Entry > m_entries;
+		std::vector< OverlayDrawData > m_pending;
+		std::vector< OverlayDrawData > m_draws;
+		std::vector< OverlayPipelineData const * > m_levelPipelines;
+		std::unordered_map< OverlayPipelineData const *, uint32_t > m_offsets;
+		std::vector< Batch > m_batches;
+		std::vector< Batch > m_previous;
+		bool m_invalidated{ true };
+	};
+}
+
+#endif
@@ -51,7 +51,7 @@ namespace castor3d
 			, ashes::DescriptorSetCRefArray const & descriptorSets
 			, ashes::BufferBase const & indirectCommands
 			, uint32_t drawCount
-			, uint32_t & offset
+			, uint32_t offset
 			, ashes::CommandBuffer & commandBuffer );
 		void doUpdateUbo( OverlayUboConfiguration & data
 			, PanelOverlay const & overlay
@@ -76,13 +76,9 @@ namespace castor3d
 		OverlayRenderer & m_renderer;
 		RenderDevice const & m_device;
 		crg::Fence & m_fence;
-		using OverlayDataArray = std::vector< OverlayDrawData >;
-		using OverlayDatasMap = std::map< OverlayPipelineData *, OverlayDataArray >;
-		std::map< uint32_t, OverlayDatasMap > m_levelsOverlays;
 		VkRenderPass m_renderPass;
 		VkFramebuffer m_framebuffer;
-		std::vector< OverlayDrawData > m_overlays;
-		std::map< size_t, uint32_t > m_descriptorsCounts{};
+		bool m_drawsChanged{};
 		uint32_t * m_drawCounts{};
 	};
 }
@@ -5,6 +5,7 @@ See LICENSE file in root folder
 #define ___C3D_OverlayRenderer_H___
 
 #include "Castor3D/Overlay/TextOverlay.hpp"
+#include "Castor3D/Render/Overlays/OverlayDrawList.hpp"
 #include "Castor3D/Render/Overlays/OverlayVertexBufferPool.hpp"
 
 #include "Castor3D/Render/Passes/CommandsSemaphore.hpp"
@@ -221,6 +222,9 @@ namespace castor3d
 			ashes::DescriptorSetLayoutPtr textDescriptorLayout;
 			ashes::DescriptorSetPoolPtr textDescriptorPool;
 			std::map< FontTexture const *, FontTextureDescriptorConnection > textDescriptorSets;
+			OverlayDrawList drawList;
+			VkRenderPass recordedRenderPass{};
+			VkFramebuffer recordedFramebuffer{};
 
 			OverlaysDrawData( RenderDevice const & device
 				, VkCommandBufferLevel level
@@ -279,6 +283,9 @@ namespace castor3d
 			, VkFramebuffer framebuffer
 			, crg::Fence & fence );
 		void doEndPrepare();
+		bool doIsRecordNeeded( VkRenderPass renderPass
+			, VkFramebuffer framebuffer
+			, bool drawsChanged )const;
 		std::pair< OverlayDrawNode *, OverlayPipelineData * > doGetDrawNodeData( RenderDevice const & device
 			, VkRenderPass renderPass
 			, Overlay const & overlay
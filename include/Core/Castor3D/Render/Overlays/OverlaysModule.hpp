@@ -65,6 +65,15 @@ namespace castor3d
 	/**
 	*\~english
 	*\brief
+	*	The overlays draws, batched by pipeline.
+	*\~french
+	*\brief
+	*	Les dessins des overlays, regroupés par pipeline.
+	*/
+	class OverlayDrawList;
+	/**
+	*\~english
+	*\brief
 	*	Pool for the overlays texts using a specific FontTexture.
 	*\~french
 	*\brief
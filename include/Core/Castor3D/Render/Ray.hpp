@@ -69,6 +69,29 @@ namespace castor3d
 			, castor::Point3f const & pt2
 			, castor::Point3f const & pt3
 			, float & distance )const;
+		/**
+		 *\~english
+		 *\brief		Tells if the ray intersects the given triangle of vertices.
+		 *\param[in]	pt1				The first triangle vertex.
+		 *\param[in]	pt2				The second triangle vertex.
+		 *\param[in]	pt3				The third triangle vertex.
+		 *\param[out]	distance		Receives the distance.
+		 *\param[out]	barycentrics	Receives the hit barycentric coordinates, relative to \p pt2 and \p pt3.
+		 *\return		\p castor::Intersection::eIn or \p castor::Intersection::eOut.
+		 *\~french
+		 *\brief		Dit si le rayon croise un triangle donné.
+		 *\param[in]	pt1				Le premier sommet du triangle.
+		 *\param[in]	pt2				Le second sommet du triangle.
+		 *\param[in]	pt3				Le troisième sommet du triangle.
+		 *\param[out]	distance		Reçoit la distance.
+		 *\param[out]	barycentrics	Reçoit les coordonnées barycentriques de l'intersection, relatives à \p pt2 et \p pt3.
+		 *\return		\p castor::Intersection::eIn ou \p castor::Intersection::eOut.
+		 */
+		C3D_API castor::Intersection intersects( castor::Point3f const & pt1
+			, castor::Point3f const & pt2
+			, castor::Point3f const & pt3
+			, float & distance
+			, castor::Point2f & barycentrics )const;
 		/**
 		 *\~english
 		 *\brief		Tells if the ray intersects the given face.
@@ -151,6 +174,25 @@ namespace castor3d
 			, Face & nearestFace
 			, SubmeshRPtr & nearestSubmesh
 			, float & distance )const;
+		/**
+		 *\~english
+		 *\brief		Looks for a triangle of the given Geometry nearer than the given hit.
+		 *\remarks		The submeshes are tested through their triangles BVH, in their bind pose.
+		 *\param[in]	geometry			The geometry to test.
+		 *\param[in]	inverseTransform	The inverse of the geometry's world matrix.
+		 *\param[in,out]	hit				Its distance is the maximum distance, updated if a nearer triangle is hit.
+		 *\return		\p true if the hit was updated.
+		 *\~french
+		 *\brief		Recherche un triangle de la géométrie donnée plus proche que l'intersection donnée.
+		 *\remarks		Les sous-maillages sont testés via leur BVH de triangles, dans leur pose de référence.
+		 *\param[in]	geometry			La géométrie à tester.
+		 *\param[in]	inverseTransform	L'inverse de la matrice monde de la géométrie.
+		 *\param[in,out]	hit				Sa distance est la distance maximale, mise à jour si un triangle plus proche est touché.
+		 *\return		\p true si l'intersection a été mise à jour.
+		 */
+		C3D_API bool intersects( Geometry const & geometry
+			, castor::Matrix4x4f const & inverseTransform
+			, RaycastHit & hit )const;
 		/**
 		 *\~english
 		 *\brief		Projects the given vertex on the ray.
@@ -169,6 +211,30 @@ namespace castor3d
 		//!\~french		La direction du rayon.
 		castor::Point3f m_direction;
 	};
+
+	struct RaycastHit
+	{
+		explicit operator bool()const noexcept
+		{
+			return geometry != nullptr;
+		}
+
+		//!\~english	The hit geometry, \p nullptr if nothing was hit.
+		//!\~french		La géométrie touchée, \p nullptr si rien n'a été touché.
+		Geometry const * geometry{};
+		//!\~english	The hit submesh.
+		//!\~french		Le sous-maillage touché.
+		Submesh const * submesh{};
+		//!\~english	The hit face index, in the submesh faces.
+		//!\~french		L'indice de la face touchée, dans les faces du sous-maillage.
+		uint32_t face{};
+		//!\~english	The hit barycentric coordinates, relative to the face's second and third vertices.
+		//!\~french		Les coordonnées barycentriques de l'intersection, relatives aux deuxième et troisième sommets de la face.
+		castor::Point2f barycentrics{};
+		//!\~english	The distance from the ray origin, in world units.
+		//!\~french		La distance depuis l'origine du rayon, en unités monde.
+		float distance{ std::numeric_limits< float >::max() };
+	};
 }
 
 #endif
@@ -49,9 +49,30 @@ namespace castor3d
 		//!\~english	The binary size of uploads.
 		//!\~french		La taille binaire des uploads.
 		uint32_t uploadSize{};
+		//!\~english	The binary size of uploads, per destination buffer or image.
+		//!\~french		La taille binaire des uploads, par tampon ou image destination.
+		castor::UInt32StrMap buffersUploadSize{};
 		//!\~english	The upload staging buffers count.
 		//!\~french		Le nombre de staging buffers pour l'upload.
 		uint32_t stagingBuffersCount{};
+		//!\~english	The allocations count in the frame arena.
+		//!\~french		Le nombre d'allocations dans l'arène de la frame.
+		uint32_t frameAllocationsCount{};
+		//!\~english	The binary size of the allocations in the frame arena.
+		//!\~french		La taille binaire des allocations dans l'arène de la frame.
+		uint32_t frameAllocatedSize{};
+		//!\~english	The shadow map layers count.
+		//!\~french		Le nombre de couches de textures d'ombres.
+		uint32_t shadowMapsCount{};
+		//!\~english	The shadow map layers redrawn in the frame.
+		//!\~french		Le nombre de couches de textures d'ombres redessinées dans la frame.
+		uint32_t shadowMapsRendered{};
+		//!\~english	The out of date shadow map layers whose redraw was deferred.
+		//!\~french		Le nombre de couches de textures d'ombres pas à jour dont le dessin a été différé.
+		uint32_t shadowMapsDeferred{};
+		//!\~english	The up to date shadow map layers, kept as they are.
+		//!\~french		Le nombre de couches de textures d'ombres à jour, gardées telles quelles.
+		uint32_t shadowMapsCached{};
 	};
 }
 
@@ -12,6 +12,7 @@ See LICENSE file in root folder
 #include "Castor3D/Render/Passes/CommandsSemaphore.hpp"
 
 #include <CastorUtils/Multithreading/AsyncJobQueue.hpp>
+#include <CastorUtils/Pool/FrameArena.hpp>
 
 #include <RenderGraph/FramePassTimer.hpp>
 
@@ -262,6 +263,9 @@ namespace castor3d
 		std::array< FramePassTimerUPtr, size_t( GpuEventType::eCount ) > m_timerGpuEvents;
 		UploadDataUPtr m_uploadData{};
 		ashes::FencePtr m_uploadFence{};
+		//!\~english	Holds the CpuUpdater and GpuUpdater temporaries, reset at each frame.
+		//!\~french		Contient les temporaires des CpuUpdater et GpuUpdater, remise à zéro à chaque frame.
+		castor::FrameArena m_frameArena;
 	};
 }
 
@@ -21,6 +21,7 @@ See LICENSE file in root folder
 #include <ashespp/Descriptor/WriteDescriptorSet.hpp>
 
 #include <functional>
+#include <memory_resource>
 
 namespace castor3d
 {
@@ -529,6 +530,15 @@ namespace castor3d
 	/**
 	*\~english
 	*\brief
+	*	The nearest geometry hit by a ray.
+	*\~french
+	*\brief
+	*	La géométrie la plus proche touchée par un rayon.
+	*/
+	struct RaycastHit;
+	/**
+	*\~english
+	*\brief
 	*	Holds instance and physical devices.
 	*\~french
 	*\brief
@@ -808,10 +818,20 @@ namespace castor3d
 
 	struct CpuUpdater
 	{
-		CpuUpdater()
+		/**
+		 *\~english
+		 *\param[in]	resource	The memory resource used by the frame temporaries.
+		 *\~french
+		 *\param[in]	resource	La ressource mémoire utilisée par les temporaires de la frame.
+		 */
+		explicit CpuUpdater( std::pmr::memory_resource * resource = std::pmr::get_default_resource() )
+			: resource{ resource }
+			, techniquesQueues{ resource }
+			, dirtyScenes{ resource }
 		{
 		}
 
+		std::pmr::memory_resource * resource;
 		RenderQueueArray * queues{ nullptr };
 		Scene * scene{ nullptr };
 		Camera * camera{ nullptr };
@@ -828,7 +848,7 @@ namespace castor3d
 		castor::Milliseconds tslf{};
 		castor::Milliseconds time{};
 		castor::Milliseconds total{};
-		std::vector< TechniqueQueues > techniquesQueues{};
+		std::pmr::vector< TechniqueQueues > techniquesQueues;
 		castor::Point2f bandRatio{};
 		castor::Matrix4x4f bgMtxModl{};
 		castor::Matrix4x4f bgMtxView{};
@@ -837,6 +857,29 @@ namespace castor3d
 		crg::ImageViewIdArray targetImage{};
 		struct DirtyObjects
 		{
+			using allocator_type = std::pmr::polymorphic_allocator< std::byte >;
+
+			explicit DirtyObjects( allocator_type const & allocator = {} )
+				: dirtyNodes{ allocator }
+				, dirtyGeometries{ allocator }
+				, dirtyBillboards{ allocator }
+				, dirtyLights{ allocator }
+				, dirtyCameras{ allocator }
+			{
+			}
+
+			DirtyObjects( DirtyObjects && rhs
+				, allocator_type const & allocator )
+				: dirtyNodes{ std::move( rhs.dirtyNodes ), allocator }
+				, dirtyGeometries{ std::move( rhs.dirtyGeometries ), allocator }
+				, dirtyBillboards{ std::move( rhs.dirtyBillboards ), allocator }
+				, dirtyLights{ std::move( rhs.dirtyLights ), allocator }
+				, dirtyCameras{ std::move( rhs.dirtyCameras ), allocator }
+			{
+			}
+
+			DirtyObjects( DirtyObjects && rhs )noexcept = default;
+
 			bool isEmpty()const
 			{
 				return dirtyNodes.empty()
@@ -846,26 +889,39 @@ namespace castor3d
 					&& dirtyCameras.empty();
 			}
 
-			std::vector< SceneNode * > dirtyNodes;
-			std::vector< Geometry * > dirtyGeometries;
-			std::vector< BillboardBase * > dirtyBillboards;
-			std::vector< Light * > dirtyLights;
-			std::vector< Camera * > dirtyCameras;
+			std::pmr::vector< SceneNode * > dirtyNodes;
+			std::pmr::vector< Geometry * > dirtyGeometries;
+			std::pmr::vector< BillboardBase * > dirtyBillboards;
+			std::pmr::vector< Light * > dirtyLights;
+			std::pmr::vector< Camera * > dirtyCameras;
 		};
-		std::map< Scene const *, DirtyObjects > dirtyScenes;
+		std::pmr::map< Scene const *, DirtyObjects > dirtyScenes;
 	};
 
 	struct GpuUpdater
 	{
+		/**
+		 *\~english
+		 *\param[in]	device		The GPU device.
+		 *\param[in]	info		Receives the render statistics.
+		 *\param[in]	resource	The memory resource used by the frame temporaries.
+		 *\~french
+		 *\param[in]	device		Le device GPU.
+		 *\param[in]	info		Reçoit les statistiques de rendu.
+		 *\param[in]	resource	La ressource mémoire utilisée par les temporaires de la frame.
+		 */
 		GpuUpdater( RenderDevice const & device
-			, RenderInfo & info )
+			, RenderInfo & info
+			, std::pmr::memory_resource * resource = std::pmr::get_default_resource() )
 			: device{ device }
 			, info{ info }
+			, resource{ resource }
 		{
 		}
 
 		RenderDevice const & device;
 		RenderInfo & info;
+		std::pmr::memory_resource * resource;
 		castor::Point2f jitter;
 		Scene * scene{ nullptr };
 		Camera * camera{ nullptr };
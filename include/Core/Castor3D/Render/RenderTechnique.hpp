@@ -14,6 +14,7 @@ See LICENSE file in root folder
 #include "Castor3D/Render/Opaque/OpaqueModule.hpp"
 #include "Castor3D/Render/Prepass/PrepassModule.hpp"
 #include "Castor3D/Render/ShadowMap/ShadowMap.hpp"
+#include "Castor3D/Render/ShadowMap/ShadowMapScheduler.hpp"
 #include "Castor3D/Render/Ssao/SsaoModule.hpp"
 #include "Castor3D/Render/Transparent/TransparentModule.hpp"
 #include "Castor3D/Scene/Background/BackgroundModule.hpp"
@@ -405,6 +406,7 @@ namespace castor3d
 		void doInitialiseLpv();
 		void doUpdateShadowMaps( CpuUpdater & updater );
 		void doUpdateShadowMaps( GpuUpdater & updater );
+		void doScheduleShadowMaps( CpuUpdater & updater );
 		void doUpdateLpv( CpuUpdater & updater );
 		void doUpdateLpv( GpuUpdater & updater );
 
@@ -457,6 +459,9 @@ namespace castor3d
 		crg::RunnableGraphPtr m_clearLpvRunnable;
 		ShadowMapLightTypeArray m_allShadowMaps;
 		ShadowMapLightArray m_activeShadowMaps;
+		ShadowMapScheduler m_shadowScheduler;
+		// One request per active shadow map layer, in m_activeShadowMaps order.
+		ShadowMapScheduler::RequestArray m_shadowRequests;
 		LightPropagationVolumesLightType m_lightPropagationVolumes;
 		LayeredLightPropagationVolumesLightType m_layeredLightPropagationVolumes;
 		LightPropagationVolumesGLightType m_lightPropagationVolumesG;
@@ -165,6 +165,15 @@ namespace castor3d
 		C3D_API crg::SemaphoreWaitArray render( crg::SemaphoreWaitArray const & toWait
 			, ashes::Queue const & queue
 			, uint32_t index );
+		/**
+		 *\~english
+		 *\param[in]	index	The layer index.
+		 *\return		\p true if the layer doesn't need to be redrawn.
+		 *\~french
+		 *\param[in]	index	L'index de la layer.
+		 *\return		\p true si la layer n'a pas besoin d'être redessinée.
+		 */
+		C3D_API bool isUpToDate( uint32_t index )const;
 		/**
 		*\~english
 		*name
@@ -103,6 +103,15 @@ namespace castor3d
 	/**
 	*\~english
 	*\brief
+	*	Chooses the shadow map layers to redraw in a frame.
+	*\~french
+	*\brief
+	*	Choisit les couches de shadow maps à redessiner dans une frame.
+	*/
+	class ShadowMapScheduler;
+	/**
+	*\~english
+	*\brief
 	*	Shadow mapping implementation for spot lights.
 	*\~french
 	*\brief
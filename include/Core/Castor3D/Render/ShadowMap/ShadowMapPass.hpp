@@ -96,6 +96,11 @@ namespace castor3d
 		*/
 		/**@{*/
 		void setUpToDate();
+
+		void setOutOfDate()
+		{
+			m_outOfDate = true;
+		}
 		/**@}*/
 
 	private:
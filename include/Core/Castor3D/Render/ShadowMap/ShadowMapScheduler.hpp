@@ -0,0 +1,149 @@
+/*
+See LICENSE file in root folder
+*/
+#ifndef ___C3D_ShadowMapScheduler_H___
+#define ___C3D_ShadowMapScheduler_H___
+
+#include "ShadowMapModule.hpp"
+
+#include <CastorUtils/Config/BeginExternHeaderGuard.hpp>
+#include <unordered_map>
+#include <vector>
+#include <CastorUtils/Config/EndExternHeaderGuard.hpp>
+
+namespace castor3d
+{
+	/**
+	\~english
+	\brief		Chooses the shadow map layers to redraw in a frame.
+	\remarks	Up to date layers are kept as they are, the out of date ones are redrawn within a per frame budget, by decreasing priority.
+	\n			A layer's priority grows with the frames it has waited, and a layer can't wait more than MaxDeferredFrames.
+	\~french
+	\brief		Choisit les couches de textures d'ombres à redessiner dans une frame.
+	\remarks	Les couches à jour sont gardées telles quelles, celles qui ne le sont pas sont redessinées dans un budget par frame, par priorité décroissante.
+	\n			La priorité d'une couche augmente avec les frames qu'elle a attendu, et une couche ne peut pas attendre plus de MaxDeferredFrames.
+	*/
+	class ShadowMapScheduler
+	{
+	public:
+		//!\~english	The maximum frames count a redraw can be deferred.
+		//!\~french		Le nombre maximal de frames pendant lesquelles un dessin peut être différé.
+		static uint32_t constexpr MaxDeferredFrames = 8u;
+		/**
+		\~english
+		\brief		A shadow map layer, for one frame.
+		\~french
+		\brief		Une couche de texture d'ombres, pour une frame.
+		*/
+		struct Request
+		{
+			//!\~english	The layer identifier, stable across frames.
+			//!\~french		L'identifiant de la couche, stable d'une frame à l'autre.
+			uint64_t id{};
+			//!\~english	The redraw cost, in rendered views.
+			//!\~french		Le coût d'un dessin, en vues dessinées.
+			uint32_t cost{ 1u };
+			//!\~english	The layer importance, a positive value.
+			//!\~french		L'importance de la couche, une valeur positive.
+			float priority{ 1.0f };
+			//!\~english	Tells if the layer content is out of date.
+			//!\~french		Dit si le contenu de la couche n'est plus à jour.
+			bool outOfDate{};
+			//!\~english	Tells if an out of date layer must be redrawn this frame (its light moved, for instance).
+			//!\~french		Dit si une couche pas à jour doit être redessinée dans cette frame (sa source lumineuse a bougé, par exemple).
+			bool mandatory{};
+			//!\~english	Receives the scheduling decision.
+			//!\~french		Reçoit la décision d'ordonnancement.
+			bool render{};
+		};
+		using RequestArray = std::vector< Request >;
+		/**
+		\~english
+		\brief		The last scheduling counters.
+		\~french
+		\brief		Les compteurs du dernier ordonnancement.
+		*/
+		struct Counts
+		{
+			uint32_t requested{};
+			uint32_t rendered{};
+			uint32_t deferred{};
+			uint32_t cached{};
+		};
+
+	public:
+		/**
+		 *\~english
+		 *\brief		Constructor.
+		 *\param[in]	budget	The views count that can be redrawn in a frame, 0 for no limit.
+		 *\~french
+		 *\brief		Constructeur.
+		 *\param[in]	budget	Le nombre de vues pouvant être redessinées dans une frame, 0 pour aucune limite.
+		 */
+		C3D_API explicit ShadowMapScheduler( uint32_t budget = 0u );
+		/**
+		 *\~english
+		 *\brief			Chooses the layers to redraw this frame.
+		 *\remarks			The layers that were never drawn, the mandatory ones, and those which waited too long are always redrawn.
+		 *\n				At least one out of date layer is redrawn each frame, even if it exceeds the budget.
+		 *\n				The layers missing from the requests are forgotten.
+		 *\param[in,out]	requests	The frame's layers, receive the decisions.
+		 *\~french
+		 *\brief			Choisit les couches à redessiner dans cette frame.
+		 *\remarks			Les couches jamais dessinées, les obligatoires, et celles ayant trop attendu sont toujours redessinées.
+		 *\n				Au moins une couche pas à jour est redessinée à chaque frame, même si elle dépasse le budget.
+		 *\n				Les couches absentes des requêtes sont oubliées.
+		 *\param[in,out]	requests	Les couches de la frame, reçoivent les décisions.
+		 */
+		C3D_API void schedule( RequestArray & requests );
+		/**
+		*\~english
+		*name
+		*	Getters.
+		*\~french
+		*name
+		*	Accesseurs.
+		*/
+		/**@{*/
+		uint32_t getBudget()const noexcept
+		{
+			return m_budget;
+		}
+
+		Counts const & getCounts()const noexcept
+		{
+			return m_counts;
+		}
+		/**@}*/
+		/**
+		*\~english
+		*name
+		*	Mutators.
+		*\~french
+		*name
+		*	Mutateurs.
+		*/
+		/**@{*/
+		void setBudget( uint32_t value )noexcept
+		{
+			m_budget = value;
+		}
+		/**@}*/
+
+	private:
+		struct State
+		{
+			uint32_t waited{};
+			uint64_t frame{};
+		};
+
+	private:
+		uint32_t m_budget;
+		uint64_t m_frame{};
+		std::unordered_map< uint64_t, State > m_states;
+		std::vector< uint32_t > m_candidates;
+		Counts m_counts;
+	};
+}
+
+#endif
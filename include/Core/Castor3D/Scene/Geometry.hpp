@@ -63,6 +63,20 @@ namespace castor3d
 		C3D_API Geometry( castor::String const & name
 			, Scene & scene
 			, MeshResPtr mesh = {} );
+		/**
+		 *\~english
+		 *\brief		Allocates the geometry memory from the geometries pool.
+		 *\~french
+		 *\brief		Alloue la mémoire de la géométrie depuis le pool de géométries.
+		 */
+		C3D_API static void * operator new( size_t size );
+		/**
+		 *\~english
+		 *\brief		Gives the geometry memory back to the geometries pool.
+		 *\~french
+		 *\brief		Rend la mémoire de la géométrie au pool de géométries.
+		 */
+		C3D_API static void operator delete( void * memory, size_t size );
 		/**
 		 *\~english
 		 *brief			Creates the mesh buffers
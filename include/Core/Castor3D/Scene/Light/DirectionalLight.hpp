@@ -6,6 +6,7 @@ See LICENSE file in root folder
 
 #include "Castor3D/Scene/Light/LightCategory.hpp"
 
+#include <CastorUtils/Graphics/BoundingBox.hpp>
 #include <CastorUtils/Math/SquareMatrix.hpp>
 
 namespace castor3d
@@ -16,6 +17,23 @@ namespace castor3d
 		castor::Matrix4x4f projMatrix;
 		castor::Matrix4x4f viewProjMatrix;
 		castor::Point2f splitDepthScale;
+		castor::Point3f minExtents;
+		castor::Point3f maxExtents;
+	};
+	/**
+	\~english
+	\brief		The directional shadow cascades computation options.
+	\~french
+	\brief		Les options de calcul des cascades d'ombres directionnelles.
+	*/
+	struct DirectionalCascadesConfig
+	{
+		//!\~english	Fits each cascade to the shadow receivers in its slice, and its depth range to the casters above them.
+		//!\~french		Ajuste chaque cascade aux receveurs d'ombres dans sa tranche, et son intervalle de profondeur aux projeteurs au dessus d'eux.
+		bool fitToBounds{};
+		//!\~english	The cascades margin, relative to their radius, within which a cascade is kept unchanged while the camera moves.
+		//!\~french		La marge des cascades, relative à leur rayon, dans laquelle une cascade est gardée inchangée pendant que la caméra bouge.
+		float reuseTolerance{};
 	};
 
 	C3D_API bool operator==( DirectionalLightCascade const & lhs
@@ -26,6 +44,49 @@ namespace castor3d
 	{
 		return !( lhs == rhs );
 	}
+	/**
+	 *\~english
+	 *\return		The view matrix of a directional light's cascades.
+	 *\~french
+	 *\return		La matrice de vue des cascades d'une source lumineuse directionnelle.
+	 */
+	C3D_API castor::Matrix4x4f getDirectionalLightView( castor::Point3f const & lightDirection );
+	/**
+	 *\~english
+	 *\brief			Computes the shadow cascades of a directional light.
+	 *\remarks			The cascades are bounded by the spheres around the camera frustum slices, and snapped to the shadow map texels.
+	 *\n				When \p cascades already holds as many cascades and the reuse tolerance isn't 0, a cascade still containing its slice is kept.
+	 *\param[in]		cameraView, cameraProjection	The viewer camera matrices.
+	 *\param[in]		nearClip, farClip				The viewer camera clip planes.
+	 *\param[in]		lightDirection					The light direction.
+	 *\param[in]		textureSize						The shadow map dimension.
+	 *\param[in]		config							The computation options.
+	 *\param[in]		casters, receivers				The bounding boxes of the shadow casters and receivers, in light view space (see getDirectionalLightView), used if \p config.fitToBounds is \p true.
+	 *\param[in,out]	cascades						The previous cascades, their count is kept, receives the new ones.
+	 *\return			A bitmask of the modified cascades.
+	 *\~french
+	 *\brief			Calcule les cascades d'ombres d'une source lumineuse directionnelle.
+	 *\remarks			Les cascades sont bornées par les sphères autour des tranches du frustum de la caméra, et alignées sur les texels de la texture d'ombres.
+	 *\n				Quand \p cascades contient déjà autant de cascades et que la tolérance de réutilisation n'est pas 0, une cascade contenant toujours sa tranche est gardée.
+	 *\param[in]		cameraView, cameraProjection	Les matrices de la caméra.
+	 *\param[in]		nearClip, farClip				Les plans de découpe de la caméra.
+	 *\param[in]		lightDirection					La direction de la source.
+	 *\param[in]		textureSize						La dimension de la texture d'ombres.
+	 *\param[in]		config							Les options de calcul.
+	 *\param[in]		casters, receivers				Les bounding boxes des projeteurs et receveurs d'ombres, dans l'espace vue de la source (cf. getDirectionalLightView), utilisées si \p config.fitToBounds vaut \p true.
+	 *\param[in,out]	cascades						Les cascades précédentes, leur nombre est gardé, reçoit les nouvelles.
+	 *\return			Un masque de bits des cascades modifiées.
+	 */
+	C3D_API uint32_t computeDirectionalCascades( castor::Matrix4x4f const & cameraView
+		, castor::Matrix4x4f const & cameraProjection
+		, float nearClip
+		, float farClip
+		, castor::Point3f const & lightDirection
+		, uint32_t textureSize
+		, DirectionalCascadesConfig const & config
+		, std::vector< castor::BoundingBox > const & casters
+		, std::vector< castor::BoundingBox > const & receivers
+		, std::vector< DirectionalLightCascade > & cascades );
 
 	class DirectionalLight
 		: public LightCategory
@@ -74,10 +135,12 @@ namespace castor3d
 		/**
 		 *\~english
 		 *\brief		Updates the shadow cascades informations.
+		 *\remarks		Uses the scene's directional shadow fitting and reuse tolerance options.
 		 *\param[in]	sceneCamera		The viewer camera.
 		 *\return		\p false if nothing changed.
 		 *\~french
 		 *\brief		Met à jour les information de shadow cascades.
+		 *\remarks		Utilise les options d'ajustement et de tolérance de réutilisation des ombres directionnelles de la scène.
 		 *\param[in]	sceneCamera		La caméra de la scène.
 		 *\return		\p false si rien n'a changé.
 		 */
@@ -129,6 +192,11 @@ namespace castor3d
 		{
 			return m_cascades[cascadeIndex].viewProjMatrix;
 		}
+
+		bool isCascadeModified( uint32_t cascadeIndex )const
+		{
+			return ( m_modifiedCascades & ( 1u << cascadeIndex ) ) != 0u;
+		}
 		/**@}*/
 
 	private:
@@ -140,7 +208,9 @@ namespace castor3d
 	private:
 		castor::Point3f m_direction;
 		std::vector< Cascade > m_cascades;
-		std::vector< Cascade > m_prvCascades;
+		uint32_t m_modifiedCascades{};
+		std::vector< castor::BoundingBox > m_casters;
+		std::vector< castor::BoundingBox > m_receivers;
 	};
 }
 
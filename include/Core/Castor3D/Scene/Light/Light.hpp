@@ -47,6 +47,20 @@ namespace castor3d
 			, SceneNode & node
 			, LightFactory & factory
 			, LightType lightType );
+		/**
+		 *\~english
+		 *\brief		Allocates the light memory from the lights pool.
+		 *\~french
+		 *\brief		Alloue la mémoire de la source lumineuse depuis le pool de sources lumineuses.
+		 */
+		C3D_API static void * operator new( size_t size );
+		/**
+		 *\~english
+		 *\brief		Gives the light memory back to the lights pool.
+		 *\~french
+		 *\brief		Rend la mémoire de la source lumineuse au pool de sources lumineuses.
+		 */
+		C3D_API static void operator delete( void * memory, size_t size );
 		/**
 		 *\~english
 		 *\brief			CPU Update.
@@ -43,10 +43,6 @@ namespace castor3d
 		 *\copydoc		castor3d::ParticleSystemImpl::cleanup
 		 */
 		C3D_API void cleanup( RenderDevice const & device )override;
-		/**
-		 *\copydoc		castor3d::ParticleSystemImpl::update
-		 */
-		C3D_API void update( CpuUpdater & updater )override;
 		/**
 		 *\copydoc		castor3d::ParticleSystemImpl::update
 		 */
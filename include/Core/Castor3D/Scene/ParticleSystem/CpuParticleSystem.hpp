@@ -6,13 +6,20 @@ See LICENSE file in root folder
 
 #include "Castor3D/Scene/ParticleSystem/Particle.hpp"
 #include "Castor3D/Scene/ParticleSystem/ParticleEmitter.hpp"
+#include "Castor3D/Scene/ParticleSystem/ParticlePool.hpp"
 #include "Castor3D/Scene/ParticleSystem/ParticleSystemImpl.hpp"
+#include "Castor3D/Scene/ParticleSystem/ParticleUpdater.hpp"
 
 namespace castor3d
 {
 	class CpuParticleSystem
 		: public ParticleSystemImpl
 	{
+	public:
+		//!\~english	The particles count per update chunk, fixed so the results don't depend on the threads count.
+		//!\~french		Le nombre de particules par groupe de mise à jour, fixe pour que les résultats ne dépendent pas du nombre de threads.
+		static uint32_t constexpr ChunkSize = 4096u;
+
 	public:
 		/**
 		 *\~english
@@ -32,9 +39,17 @@ namespace castor3d
 		 */
 		C3D_API void cleanup( RenderDevice const & device )override;
 		/**
-		 *\copydoc		castor3d::ParticleSystemImpl::update
+		 *\copydoc		castor3d::ParticleSystemImpl::beginUpdate
 		 */
-		C3D_API void update( castor3d::CpuUpdater & updater )override;
+		C3D_API uint32_t beginUpdate( castor::Milliseconds const & time )override;
+		/**
+		 *\copydoc		castor3d::ParticleSystemImpl::updateChunk
+		 */
+		C3D_API void updateChunk( uint32_t index )override;
+		/**
+		 *\copydoc		castor3d::ParticleSystemImpl::endUpdate
+		 */
+		C3D_API void endUpdate()override;
 		/**
 		 *\copydoc		castor3d::ParticleSystemImpl::update
 		 */
@@ -69,6 +84,9 @@ namespace castor3d
 		 */
 		C3D_API void onEmit( Particle const & particle );
 
+	private:
+		void doEmplace( Particle const & particle );
+
 	private:
 		/**
 		 *\~english
@@ -109,21 +127,28 @@ namespace castor3d
 		//!\~english	The particle's elements description.
 		//!\~french		La description des éléments d'une particule.
 		ParticleDeclaration m_inputs;
-		//!\~english	The particles.
-		//!\~french		Les particules.
-		ParticleArray m_particles;
+		//!\~english	The particles, stored as one array per element, the alive ones being at the beginning.
+		//!\~french		Les particules, stockées sous forme d'un tableau par élément, les vivantes étant au début.
+		ParticlePool m_particles;
 		//!\~english	The particles emitters.
 		//!\~french		Les émetteurs de particules.
 		ParticleEmitterArray m_emitters;
 		//!\~english	The particles updaters.
 		//!\~french		Les updaters de particules.
 		ParticleUpdaterArray m_updaters;
-		//!\~english	The first unused particle data.
-		//!\~french		La première particule inutilisée.
-		uint32_t m_firstUnused{ 1u };
 
 	private:
+		struct Chunk
+		{
+			ParticleArray emitted;
+			ParticleRandom random;
+		};
+
 		std::vector< ParticleEmitter::OnEmitConnection > m_onEmits;
+		std::vector< Chunk > m_chunks;
+		castor::Milliseconds m_time{};
+		uint32_t m_updatedCount{};
+		uint32_t m_frameIndex{};
 	};
 }
 
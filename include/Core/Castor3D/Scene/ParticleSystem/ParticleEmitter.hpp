@@ -21,12 +21,27 @@ namespace castor3d
 		/**
 		 *\~english
 		 *\brief		Emits a particle with given values.
+		 *\remarks		If an array has been set through setThreadEmitted, the particle is added to it, and onEmit is not raised.
 		 *\param[in]	value	The particle values.
 		 *\~french
 		 *\brief		Emet une particle ayant les valeurs données.
+		 *\remarks		Si un tableau a été défini via setThreadEmitted, la particule y est ajoutée, et onEmit n'est pas émis.
 		 *\param[in]	value	Les valeurs de la particule.
 		 */
 		C3D_API castor3d::Particle emit( ParticleValues const & value );
+		/**
+		 *\~english
+		 *\brief		Sets the array receiving the particles emitted by all emitters, on the calling thread.
+		 *\remarks		Used by parallel updates, which can't go through the onEmit signal.
+		 *\param[in]	emitted	The array, nullptr to use onEmit again.
+		 *\return		The previous array.
+		 *\~french
+		 *\brief		Définit le tableau recevant les particules émises par tous les émetteurs, sur le thread appelant.
+		 *\remarks		Utilisé par les mises à jour parallèles, qui ne peuvent pas passer par le signal onEmit.
+		 *\param[in]	emitted	Le tableau, nullptr pour utiliser à nouveau onEmit.
+		 *\return		Le tableau précédent.
+		 */
+		C3D_API static ParticleArray * setThreadEmitted( ParticleArray * emitted );
 
 		using OnEmitFunction = std::function< void( Particle const & particle ) >;
 		using OnEmitSignal = castor::SignalT< OnEmitFunction >;
@@ -141,6 +141,15 @@ namespace castor3d
 	/**
 	*\~english
 	*\brief
+	*	Holds the particles data, as one array per particle element.
+	*\~french
+	*\brief
+	*	Contient les données des particules, sous forme d'un tableau par élément de particule.
+	*/
+	class ParticlePool;
+	/**
+	*\~english
+	*\brief
 	*	Particle system implementation.
 	*\~french
 	*\brief
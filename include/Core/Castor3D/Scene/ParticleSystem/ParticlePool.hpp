@@ -0,0 +1,164 @@
+/*
+See LICENSE file in root folder
+*/
+#ifndef ___C3D_ParticlePool_H___
+#define ___C3D_ParticlePool_H___
+
+#include "ParticleModule.hpp"
+
+#include "Castor3D/Scene/ParticleSystem/ParticleDeclaration.hpp"
+
+namespace castor3d
+{
+	class ParticlePool
+	{
+	public:
+		/**
+		 *\~english
+		 *\brief		Constructor.
+		 *\param[in]	description	The particles elements description.
+		 *\~french
+		 *\brief		Constructeur.
+		 *\param[in]	description	La description des éléments des particules.
+		 */
+		C3D_API explicit ParticlePool( ParticleDeclaration const & description );
+		/**
+		 *\~english
+		 *\brief		Allocates one array per particle element, and fills them with the default values.
+		 *\param[in]	capacity		The maximum particles count.
+		 *\param[in]	defaultValues	The default values for the particle's elements.
+		 *\~french
+		 *\brief		Alloue un tableau par élément de particule, et les remplit avec les valeurs par défaut.
+		 *\param[in]	capacity		Le nombre maximal de particules.
+		 *\param[in]	defaultValues	Les valeurs par défaut des éléments de la particule.
+		 */
+		C3D_API void initialise( uint32_t capacity
+			, castor::StrStrMap const & defaultValues );
+		/**
+		 *\~english
+		 *\brief		Releases the elements arrays.
+		 *\~french
+		 *\brief		Libère les tableaux d'éléments.
+		 */
+		C3D_API void cleanup();
+		/**
+		 *\~english
+		 *\brief		Adds a particle at the end of the pool.
+		 *\param[in]	particle	The particle.
+		 *\return		\p false if the pool is full.
+		 *\~french
+		 *\brief		Ajoute une particule à la fin du pool.
+		 *\param[in]	particle	La particule.
+		 *\return		\p false si le pool est plein.
+		 */
+		C3D_API bool emplace( Particle const & particle );
+		/**
+		 *\~english
+		 *\brief		Removes the particle at given index, replacing it with the last one.
+		 *\param[in]	index	The particle index.
+		 *\~french
+		 *\brief		Supprime la particule à l'index donné, en la remplaçant par la dernière.
+		 *\param[in]	index	L'index de la particule.
+		 */
+		C3D_API void remove( uint32_t index );
+		/**
+		 *\~english
+		 *\brief		Sets the alive particles count.
+		 *\param[in]	count	The new count, clamped to the capacity.
+		 *\~french
+		 *\brief		Définit le nombre de particules vivantes.
+		 *\param[in]	count	Le nouveau nombre, limité à la capacité.
+		 */
+		C3D_API void resize( uint32_t count );
+		/**
+		 *\~english
+		 *\brief		Gathers the elements of the particle at given index.
+		 *\param[in]	index		The particle index.
+		 *\param[out]	particle	Receives the particle data.
+		 *\~french
+		 *\brief		Rassemble les éléments de la particule à l'index donné.
+		 *\param[in]	index		L'index de la particule.
+		 *\param[out]	particle	Reçoit les données de la particule.
+		 */
+		C3D_API void load( uint32_t index
+			, Particle & particle )const;
+		/**
+		 *\~english
+		 *\brief		Scatters the given particle elements at given index.
+		 *\param[in]	index		The particle index.
+		 *\param[in]	particle	The particle data.
+		 *\~french
+		 *\brief		Disperse les éléments de la particule donnée à l'index donné.
+		 *\param[in]	index		L'index de la particule.
+		 *\param[in]	particle	Les données de la particule.
+		 */
+		C3D_API void store( uint32_t index
+			, Particle const & particle );
+		/**
+		 *\~english
+		 *\brief		Writes the alive particles, interleaved, to the given buffer.
+		 *\param[out]	dst	The destination buffer, must be able to hold size() * stride bytes.
+		 *\~french
+		 *\brief		Ecrit les particules vivantes, entrelacées, dans le tampon donné.
+		 *\param[out]	dst	Le tampon de destination, doit pouvoir contenir size() * stride octets.
+		 */
+		C3D_API void pack( uint8_t * dst )const;
+		/**
+		 *\~english
+		 *\brief		Retrieves the array for the element at given index.
+		 *\param[in]	element	The element index in the particle declaration.
+		 *\return		The array, holding capacity() values.
+		 *\~french
+		 *\brief		Récupère le tableau de l'élément à l'index donné.
+		 *\param[in]	element	L'index de l'élément dans la déclaration de particule.
+		 *\return		Le tableau, contenant capacity() valeurs.
+		 */
+		template< typename DataT >
+		DataT * getData( uint32_t element )
+		{
+			CU_Require( element < m_arrays.size() );
+			return reinterpret_cast< DataT * >( m_arrays[element].data() );
+		}
+
+		template< typename DataT >
+		DataT const * getData( uint32_t element )const
+		{
+			CU_Require( element < m_arrays.size() );
+			return reinterpret_cast< DataT const * >( m_arrays[element].data() );
+		}
+		/**
+		 *\~english
+		 *\return		The alive particles count.
+		 *\~french
+		 *\return		Le nombre de particules vivantes.
+		 */
+		uint32_t size()const noexcept
+		{
+			return m_count;
+		}
+		/**
+		 *\~english
+		 *\return		The maximum particles count.
+		 *\~french
+		 *\return		Le nombre maximal de particules.
+		 */
+		uint32_t capacity()const noexcept
+		{
+			return m_capacity;
+		}
+
+		ParticleDeclaration const & getDescription()const noexcept
+		{
+			return m_description;
+		}
+
+	private:
+		ParticleDeclaration const & m_description;
+		std::vector< castor::ByteArray > m_arrays;
+		std::vector< uint32_t > m_sizes;
+		uint32_t m_capacity{};
+		uint32_t m_count{};
+	};
+}
+
+#endif
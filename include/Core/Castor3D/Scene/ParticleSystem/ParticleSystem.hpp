@@ -65,6 +65,35 @@ namespace castor3d
 		 *\param[in, out]	updater	Les données d'update.
 		 */
 		C3D_API void update( CpuUpdater & updater );
+		/**
+		 *\~english
+		 *\brief			Prepares the CPU update.
+		 *\remarks			The update is then done by calling updateChunk for each chunk, and then endUpdate.
+		 *\param[in, out]	updater	The update data.
+		 *\return			The number of chunks to update.
+		 *\~french
+		 *\brief			Prépare la mise à jour CPU.
+		 *\remarks			La mise à jour est ensuite faite en appelant updateChunk pour chaque groupe, puis endUpdate.
+		 *\param[in, out]	updater	Les données d'update.
+		 *\return			Le nombre de groupes à mettre à jour.
+		 */
+		C3D_API uint32_t beginUpdate( CpuUpdater & updater );
+		/**
+		 *\~english
+		 *\brief		Updates a chunk of particles, can be called concurrently for different chunks.
+		 *\param[in]	index	The chunk index.
+		 *\~french
+		 *\brief		Met à jour un groupe de particules, peut être appelée en parallèle pour des groupes différents.
+		 *\param[in]	index	L'index du groupe.
+		 */
+		C3D_API void updateChunk( uint32_t index );
+		/**
+		 *\~english
+		 *\brief		Ends the CPU update.
+		 *\~french
+		 *\brief		Termine la mise à jour CPU.
+		 */
+		C3D_API void endUpdate();
 		/**
 		 *\~english
 		 *\brief			GPU Update.
@@ -101,6 +130,18 @@ namespace castor3d
 		 *\param[in]	value	La nouvelle valeur.
 		 */
 		C3D_API void setParticleType( castor::String const & value );
+		/**
+		 *\~english
+		 *\brief		Sets the seed used for the particles random generation.
+		 *\param[in]	value	The new value.
+		 *\~french
+		 *\brief		Definit la graine utilisée pour la génération aléatoire des particules.
+		 *\param[in]	value	La nouvelle valeur.
+		 */
+		void setSeed( uint32_t value )noexcept
+		{
+			m_seed = value;
+		}
 		/**
 		 *\~english
 		 *\return		The material.
@@ -168,6 +209,16 @@ namespace castor3d
 		{
 			return m_particlesCount;
 		}
+		/**
+		 *\~english
+		 *\return		The seed used for the particles random generation.
+		 *\~french
+		 *\return		La graine utilisée pour la génération aléatoire des particules.
+		 */
+		uint32_t getSeed()const noexcept
+		{
+			return m_seed;
+		}
 		/**
 		 *\~english
 		 *\return		The billboards.
@@ -244,6 +295,9 @@ namespace castor3d
 		//!\~english	The active particles count.
 		//!\~french		Le nombre de particules actives.
 		uint32_t m_activeParticlesCount{ 0u };
+		//!\~english	The seed for the particles random generation.
+		//!\~french		La graine pour la génération aléatoire des particules.
+		uint32_t m_seed{ 0u };
 		//!\~english	The timer, for the particles update.
 		//!\~french		Le timer, pour la mise à jour des particules.
 		castor::PreciseTimer m_timer;
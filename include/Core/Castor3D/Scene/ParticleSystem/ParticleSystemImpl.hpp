@@ -88,13 +88,40 @@ namespace castor3d
 			, castor::String const & defaultValue ) = 0;
 		/**
 		 *\~english
-		 *\brief			Updates the render pass, CPU wise.
-		 *\param[in, out]	updater	The update data.
+		 *\brief		Prepares the CPU update, splitting the particles in chunks.
+		 *\param[in]	time	The time elapsed since last update.
+		 *\return		The chunks count, 0 if there is nothing to update on CPU.
 		 *\~french
-		 *\brief			Met à jour la passe de rendu, au niveau CPU.
-		 *\param[in, out]	updater	Les données d'update.
+		 *\brief		Prépare la mise à jour CPU, en séparant les particules en groupes.
+		 *\param[in]	time	Le temps écoulé depuis la dernière mise à jour.
+		 *\return		Le nombre de groupes, 0 s'il n'y a rien à mettre à jour sur le CPU.
+		 */
+		C3D_API virtual uint32_t beginUpdate( castor::Milliseconds const & time )
+		{
+			return 0u;
+		}
+		/**
+		 *\~english
+		 *\brief		Updates a chunk of particles, CPU wise.
+		 *\remarks		Different chunks may be updated concurrently.
+		 *\param[in]	index	The chunk index.
+		 *\~french
+		 *\brief		Met à jour un groupe de particules, au niveau CPU.
+		 *\remarks		Des groupes différents peuvent être mis à jour en parallèle.
+		 *\param[in]	index	L'index du groupe.
 		 */
-		C3D_API virtual void update( CpuUpdater & updater ) = 0;
+		C3D_API virtual void updateChunk( uint32_t index )
+		{
+		}
+		/**
+		 *\~english
+		 *\brief		Ends the CPU update, once all chunks are updated.
+		 *\~french
+		 *\brief		Termine la mise à jour CPU, une fois que tous les groupes sont mis à jour.
+		 */
+		C3D_API virtual void endUpdate()
+		{
+		}
 		/**
 		 *\~english
 		 *\brief			Updates the render pass, GPU wise.
@@ -6,8 +6,20 @@ See LICENSE file in root folder
 
 #include "ParticleModule.hpp"
 
+#include <random>
+
 namespace castor3d
 {
+	/**
+	*\~english
+	*\brief
+	*	The random engine given to particle updaters, seeded per update chunk.
+	*\~french
+	*\brief
+	*	Le moteur aléatoire donné aux updaters de particules, initialisé pour chaque groupe de mise à jour.
+	*/
+	using ParticleRandom = std::minstd_rand;
+
 	class ParticleUpdater
 	{
 	public:
@@ -27,6 +39,31 @@ namespace castor3d
 		 */
 		C3D_API virtual void update( castor::Milliseconds const & time
 			, Particle & particle );
+		/**
+		 *\~english
+		 *\brief			Updates a range of particles.
+		 *\remarks			The default implementation gathers each particle and calls the single particle update.
+		 *\n				Ranges of a same pool may be updated concurrently, so this must only touch the given range.
+		 *\param[in]		time		The time elapsed since last update.
+		 *\param[in]		particles	The particles pool.
+		 *\param[in]		first		The first particle index.
+		 *\param[in]		count		The particles count.
+		 *\param[in,out]	random		The random engine to use, for deterministic results.
+		 *\~french
+		 *\brief			Met à jour un intervalle de particules.
+		 *\remarks			L'implémentation par défaut rassemble chaque particule et appelle la mise à jour d'une particule.
+		 *\n				Des intervalles d'un même pool peuvent être mis à jour en parallèle, seul l'intervalle donné doit donc être modifié.
+		 *\param[in]		time		Le temps écoulé depuis la denière mise à jour.
+		 *\param[in]		particles	Le pool de particules.
+		 *\param[in]		first		L'index de la première particule.
+		 *\param[in]		count		Le nombre de particules.
+		 *\param[in,out]	random		Le moteur aléatoire à utiliser, pour des résultats déterministes.
+		 */
+		C3D_API virtual void update( castor::Milliseconds const & time
+			, ParticlePool & particles
+			, uint32_t first
+			, uint32_t count
+			, ParticleRandom & random );
 
 	protected:
 		ParticleSystem const & m_system;
@@ -45,6 +45,11 @@ namespace castor3d
 			m_cullable = value;
 		}
 
+		void setOccluder( bool value )
+		{
+			m_occluder = value;
+		}
+
 		bool isVisible()const
 		{
 			return m_visible;
@@ -65,6 +70,11 @@ namespace castor3d
 			return m_cullable;
 		}
 
+		bool isOccluder()const
+		{
+			return m_occluder;
+		}
+
 	private:
 		struct Offsets
 		{
@@ -78,6 +88,7 @@ namespace castor3d
 		bool m_castsShadows{ true };
 		bool m_receivesShadows{ true };
 		bool m_cullable{ true };
+		bool m_occluder{ false };
 		uint32_t m_firstUpdate{ 5u };
 		std::unordered_map< uint32_t, std::pair< ModelBufferConfiguration *, Offsets > > m_modelsDataOffsets{};
 	};
@@ -282,6 +282,40 @@ namespace castor3d
 		 *\param[in]	object	L'objet.
 		 */
 		C3D_API void markDirty( MovableObject & object );
+		/**
+		 *\~english
+		 *\brief		Looks for the nearest visible geometry triangle hit by a ray, on CPU.
+		 *\remarks		The submeshes are tested in their bind pose, through their triangles BVH.
+		 *\param[in]	ray			The ray, in world space.
+		 *\param[out]	hit			Receives the nearest hit.
+		 *\param[in]	maxDistance	Only the hits nearer than this distance are reported.
+		 *\return		\p false if nothing was hit.
+		 *\~french
+		 *\brief		Recherche le triangle de géométrie visible le plus proche touché par un rayon, sur CPU.
+		 *\remarks		Les sous-maillages sont testés dans leur pose de référence, via leur BVH de triangles.
+		 *\param[in]	ray			Le rayon, dans l'espace monde.
+		 *\param[out]	hit			Reçoit l'intersection la plus proche.
+		 *\param[in]	maxDistance	Seules les intersections plus proches que cette distance sont retournées.
+		 *\return		\p false si rien n'a été touché.
+		 */
+		C3D_API bool raycast( Ray const & ray
+			, RaycastHit & hit
+			, float maxDistance = std::numeric_limits< float >::max() )const;
+		/**
+		 *\~english
+		 *\brief		Looks for the nearest visible geometry triangle hit by each ray, on CPU, in parallel.
+		 *\param[in]	rays		The rays, in world space.
+		 *\param[out]	hits		Receives the nearest hit for each ray.
+		 *\param[in]	maxDistance	Only the hits nearer than this distance are reported.
+		 *\~french
+		 *\brief		Recherche le triangle de géométrie visible le plus proche touché par chaque rayon, sur CPU, en parallèle.
+		 *\param[in]	rays		Les rayons, dans l'espace monde.
+		 *\param[out]	hits		Reçoit l'intersection la plus proche pour chaque rayon.
+		 *\param[in]	maxDistance	Seules les intersections plus proches que cette distance sont retournées.
+		 */
+		C3D_API void raycast( std::vector< Ray > const & rays
+			, std::vector< RaycastHit > & hits
+			, float maxDistance = std::numeric_limits< float >::max() )const;
 		/**
 		*\~english
 		*\name
@@ -389,6 +423,31 @@ namespace castor3d
 			return m_lpvIndirectAttenuation;
 		}
 
+		float getLodBias()const noexcept
+		{
+			return m_lodBias;
+		}
+
+		float getShadowLodBias()const noexcept
+		{
+			return m_shadowLodBias;
+		}
+
+		uint32_t getShadowUpdateBudget()const noexcept
+		{
+			return m_shadowUpdateBudget;
+		}
+
+		bool isDirectionalShadowFitted()const noexcept
+		{
+			return m_directionalShadowFitted;
+		}
+
+		float getDirectionalShadowReuseTolerance()const noexcept
+		{
+			return m_directionalShadowReuseTolerance;
+		}
+
 		VctConfig const & getVoxelConeTracingConfig()const noexcept
 		{
 			return m_voxelConfig;
@@ -441,6 +500,56 @@ namespace castor3d
 		{
 			m_ambientLight = value;
 		}
+		/**
+		 *\~english
+		 *\brief		Sets the levels of detail bias, the tolerated error is multiplied by 2^bias.
+		 *\~french
+		 *\brief		Définit le biais des niveaux de détail, l'erreur tolérée est multipliée par 2^biais.
+		 */
+		void setLodBias( float value )noexcept
+		{
+			m_lodBias = value;
+		}
+		/**
+		 *\~english
+		 *\brief		Sets the levels of detail bias used by the shadow passes.
+		 *\~french
+		 *\brief		Définit le biais des niveaux de détail utilisé par les passes d'ombres.
+		 */
+		void setShadowLodBias( float value )noexcept
+		{
+			m_shadowLodBias = value;
+		}
+		/**
+		 *\~english
+		 *\brief		Sets the shadow map views count that can be redrawn in a frame, 0 for no limit.
+		 *\~french
+		 *\brief		Définit le nombre de vues de textures d'ombres pouvant être redessinées dans une frame, 0 pour aucune limite.
+		 */
+		void setShadowUpdateBudget( uint32_t value )noexcept
+		{
+			m_shadowUpdateBudget = value;
+		}
+		/**
+		 *\~english
+		 *\brief		Defines if the directional shadow cascades are fitted to the shadow casters and receivers bounds.
+		 *\~french
+		 *\brief		Définit si les cascades d'ombres directionnelles sont ajustées aux bornes des projeteurs et receveurs d'ombres.
+		 */
+		void setDirectionalShadowFitting( bool value )noexcept
+		{
+			m_directionalShadowFitted = value;
+		}
+		/**
+		 *\~english
+		 *\brief		Sets the margin, relative to their radius, within which the directional shadow cascades are kept while the camera moves, 0 to recompute them each frame.
+		 *\~french
+		 *\brief		Définit la marge, relative à leur rayon, dans laquelle les cascades d'ombres directionnelles sont gardées pendant que la caméra bouge, 0 pour les recalculer à chaque frame.
+		 */
+		void setDirectionalShadowReuseTolerance( float value )noexcept
+		{
+			m_directionalShadowReuseTolerance = value;
+		}
 
 		GeometryCache::ElementObsT addGeometry( GeometryCache::ElementPtrT element )
 		{
@@ -518,6 +627,12 @@ namespace castor3d
 		std::array< std::set< GlobalIlluminationType >, size_t( LightType::eCount ) > m_giTypes;
 		std::atomic_bool m_hasAnyShadows;
 		float m_lpvIndirectAttenuation{ 1.7f };
+		float m_lodBias{ 0.0f };
+		// Shadow maps are lower resolution and less sensitive to silhouette changes.
+		float m_shadowLodBias{ 1.0f };
+		uint32_t m_shadowUpdateBudget{ 0u };
+		bool m_directionalShadowFitted{ false };
+		float m_directionalShadowReuseTolerance{ 0.0f };
 		VctConfig m_voxelConfig;
 		SceneRenderNodesUPtr m_renderNodes;
 		FramePassTimerUPtr m_timerSceneNodes;
@@ -530,6 +645,7 @@ namespace castor3d
 		FramePassTimerUPtr m_timerMovables;
 		CpuFrameEvent * m_cleanBackground{};
 		mutable DebugConfig m_debugConfig;
+		std::vector< std::pair< ParticleSystem *, uint32_t > > m_particleJobs;
 
 	public:
 		//!\~english	The cameras root node name.
@@ -217,6 +217,7 @@ namespace castor3d
 		castor::Size size{};
 		castor::Point2f point2f{};
 		uint32_t particleCount{};
+		uint32_t particleSeed{};
 		int16_t fontHeight{};
 		ScenePtrStrMap mapScenes{};
 		SceneFileParser * parser{};
@@ -81,10 +81,15 @@ namespace castor3d
 	CU_DeclareAttributeParser( parserSceneSkybox )
 	CU_DeclareAttributeParser( parserSceneFogType )
 	CU_DeclareAttributeParser( parserSceneFogDensity )
+	CU_DeclareAttributeParser( parserSceneLodBias )
+	CU_DeclareAttributeParser( parserSceneShadowLodBias )
+	CU_DeclareAttributeParser( parserSceneShadowUpdateBudget )
 	CU_DeclareAttributeParser( parserSceneParticleSystem )
 	CU_DeclareAttributeParser( parserSkeleton )
 	CU_DeclareAttributeParser( parserMesh )
 	CU_DeclareAttributeParser( parserDirectionalShadowCascades )
+	CU_DeclareAttributeParser( parserDirectionalShadowFitting )
+	CU_DeclareAttributeParser( parserDirectionalShadowReuseTolerance )
 	CU_DeclareAttributeParser( parserVoxelConeTracing )
 	CU_DeclareAttributeParser( parserTexture )
 	CU_DeclareAttributeParser( parserSceneEnd )
@@ -107,6 +112,7 @@ namespace castor3d
 	// ParticleSystem parsers
 	CU_DeclareAttributeParser( parserParticleSystemParent )
 	CU_DeclareAttributeParser( parserParticleSystemCount )
+	CU_DeclareAttributeParser( parserParticleSystemSeed )
 	CU_DeclareAttributeParser( parserParticleSystemMaterial )
 	CU_DeclareAttributeParser( parserParticleSystemDimensions )
 	CU_DeclareAttributeParser( parserParticleSystemParticle )
@@ -149,6 +155,7 @@ namespace castor3d
 	CU_DeclareAttributeParser( parserObjectCastShadows )
 	CU_DeclareAttributeParser( parserObjectReceivesShadows )
 	CU_DeclareAttributeParser( parserObjectCullable )
+	CU_DeclareAttributeParser( parserObjectOccluder )
 	CU_DeclareAttributeParser( parserObjectEnd )
 
 	// Object Materials Parsers
@@ -74,6 +74,20 @@ namespace castor3d
 		 *\brief		Destructeur
 		 */
 		C3D_API ~SceneNode()override;
+		/**
+		 *\~english
+		 *\brief		Allocates the node memory from the scene nodes pool.
+		 *\~french
+		 *\brief		Alloue la mémoire du noeud depuis le pool de noeuds de scène.
+		 */
+		C3D_API static void * operator new( size_t size );
+		/**
+		 *\~english
+		 *\brief		Gives the node memory back to the scene nodes pool.
+		 *\~french
+		 *\brief		Rend la mémoire du noeud au pool de noeuds de scène.
+		 */
+		C3D_API static void operator delete( void * memory, size_t size );
 		/**
 		 *\~english
 		 *\brief		Updates the scene node matrices.
@@ -42,26 +42,45 @@ namespace castor3d
 			, crg::AccessState wantedState = { VK_ACCESS_SHADER_READ_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT } );
 		/**
 		 *\~english
-		 *\brief		Updates the buffer.
-		 *\param[in]	commandBuffer	The command buffer receiving upload commands.
+		 *\brief		Marks a range of the buffer data as modified.
+		 *\remarks		Only modified ranges are uploaded to the GPU.
+		 *\param[in]	offset, size	The modified range, relative to getPtr().
 		 *\~french
-		 *\brief		Met à jour le tampon.
-		 *\param[in]	commandBuffer	Le command buffer recevant les commandes d'upload.
+		 *\brief		Marque un intervalle des données du tampon comme modifié.
+		 *\remarks		Seuls les intervalles modifiés sont uploadés sur le GPU.
+		 *\param[in]	offset, size	L'intervalle modifié, relatif à getPtr().
+		 */
+		C3D_API void markDirty( VkDeviceSize offset
+			, VkDeviceSize size );
+		/**
+		 *\~english
+		 *\brief		Marks the whole buffer as modified.
+		 *\~french
+		 *\brief		Marque tout le tampon comme modifié.
+		 */
+		C3D_API void markDirty();
+		/**
+		 *\~english
+		 *\brief		Uploads the modified ranges of the buffer, after having merged the contiguous ones.
+		 *\param[in]	uploader	Receives the upload requests.
+		 *\~french
+		 *\brief		Uploade les intervalles modifiés du tampon, après avoir fusionné ceux qui sont contigus.
+		 *\param[in]	uploader	Reçoit les requêtes d'upload.
 		 */
 		C3D_API void upload( UploadData & uploader )const;
 		/**
 		 *\~english
-		 *\brief		Updates the buffer on GPU.
-		 *\param[in]	commandBuffer	The command buffer receiving upload commands.
-		 *\param[in]	offset, size	The updated range.
+		 *\brief		Marks the given range as modified, and uploads the modified ranges of the buffer.
+		 *\param[in]	uploader		Receives the upload requests.
+		 *\param[in]	offset, size	The updated range, relative to getPtr().
 		 *\~french
-		 *\brief		Met à jour le tampon sur le GPU.
-		 *\param[in]	commandBuffer	Le command buffer recevant les commandes d'upload.
-		 *\param[in]	offset, size	L'intervalle à mettre à jour.
+		 *\brief		Marque l'intervalle donné comme modifié, et uploade les intervalles modifiés du tampon.
+		 *\param[in]	uploader		Reçoit les requêtes d'upload.
+		 *\param[in]	offset, size	L'intervalle à mettre à jour, relatif à getPtr().
 		 */
 		C3D_API void upload( UploadData & uploader
 			, VkDeviceSize offset
-			, VkDeviceSize size )const;
+			, VkDeviceSize size );
 		/**
 		 *\~english
 		 *\brief		Creates the descriptor set layout binding at given point.
@@ -161,22 +180,22 @@ namespace castor3d
 		/**@{*/
 		void setFirstCount( uint32_t value )
 		{
-			m_counts[0] = value;
+			doSetCount( 0u, value );
 		}
 
 		void setSecondCount( uint32_t value )
 		{
-			m_counts[1] = value;
+			doSetCount( 1u, value );
 		}
 
 		void setThirdCount( uint32_t value )
 		{
-			m_counts[2] = value;
+			doSetCount( 2u, value );
 		}
 
 		void setFourthCount( uint32_t value )
 		{
-			m_counts[3] = value;
+			doSetCount( 3u, value );
 		}
 
 		void setCount( uint32_t value )
@@ -185,15 +204,24 @@ namespace castor3d
 		}
 		/**@}*/
 
+	private:
+		C3D_API void doSetCount( uint32_t index
+			, uint32_t value );
+		void doMarkDirty( VkDeviceSize begin
+			, VkDeviceSize end );
+
 	private:
 		RenderDevice const & m_device;
 		VkDeviceSize m_size;
+		VkDeviceSize m_mergeDistance;
 		crg::AccessState m_wantedState;
 		ashes::BufferBasePtr m_buffer;
 		castor::ByteArray m_ownData;
 		uint8_t * m_rawData;
 		uint8_t * m_data;
 		castor::ArrayView< uint32_t > m_counts;
+		mutable std::mutex m_dirtyMutex;
+		mutable MemRangeArray m_dirtyRanges;
 	};
 }
 
@@ -114,6 +114,11 @@ namespace castor3d
 			m_dirty = true;
 		}
 
+		void markDirty()
+		{
+			m_dirty = true;
+		}
+
 	public:
 		struct FontGlyphData
 			: ShaderBufferTypes
@@ -131,7 +136,7 @@ namespace castor3d
 		FontTexture const & m_texture;
 		ShaderBuffer m_buffer;
 		FontGlyphsData m_data;
-		std::vector< castor::Glyph const * > m_glyphs;
+		std::vector< char32_t > m_glyphs;
 		std::mutex m_mutex;
 		std::atomic_uint32_t m_count{ 0u };
 		std::atomic_bool m_dirty{};
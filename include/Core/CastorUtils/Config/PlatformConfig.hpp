@@ -43,4 +43,29 @@ See LICENSE file in root folder
 #	error "Yet unsupported OS"
 #endif
 
+// SIMD instruction sets available at compile time, each one can be forced to 0 from the build.
+#if !defined( CU_UseSSE2 )
+#	if defined( __SSE2__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && _M_IX86_FP >= 2 )
+#		define CU_UseSSE2 1
+#	else
+#		define CU_UseSSE2 0
+#	endif
+#endif
+
+#if !defined( CU_UseAVX )
+#	if CU_UseSSE2 && defined( __AVX__ )
+#		define CU_UseAVX 1
+#	else
+#		define CU_UseAVX 0
+#	endif
+#endif
+
+#if !defined( CU_UseNEON )
+#	if !CU_UseSSE2 && ( defined( __aarch64__ ) || defined( _M_ARM64 ) )
+#		define CU_UseNEON 1
+#	else
+#		define CU_UseNEON 0
+#	endif
+#endif
+
 #endif
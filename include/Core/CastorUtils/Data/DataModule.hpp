@@ -143,6 +143,13 @@ namespace castor
 	\brief		Classe de gestion d'archive zip
 	*/
 	class ZipArchive;
+	/**
+	\~english
+	\brief		Virtual file system, gives access to mounted folders and zip archives.
+	\~french
+	\brief		Système de fichiers virtuel, donne accès aux dossiers et archives zip montés.
+	*/
+	class VirtualFileSystem;
 
 	CU_DeclareVector( Path, Path );
 }
@@ -0,0 +1,190 @@
+/*
+See LICENSE file in root folder
+*/
+#ifndef ___CU_VirtualFileSystem_HPP___
+#define ___CU_VirtualFileSystem_HPP___
+
+#include "CastorUtils/Data/DataModule.hpp"
+
+#include "CastorUtils/Data/Path.hpp"
+#include "CastorUtils/Multithreading/MultithreadingModule.hpp"
+
+#include <memory>
+#include <mutex>
+
+namespace castor
+{
+	/**
+	\~english
+	\brief		Gives access to files through mounted folders and zip archives.
+	\remarks	Zip archives are read in place, their files are decompressed straight into memory.
+	\n			The latest mount has priority over the older ones, paths not covered by any mount are read from the disk.
+	\n			An archive mounted without mount point is mounted at its own path, so <tt>folder/scene.zip/scene.cscn</tt> designates a file inside <tt>folder/scene.zip</tt>.
+	\~french
+	\brief		Donne accès aux fichiers via des dossiers et des archives zip montés.
+	\remarks	Les archives zip sont lues sur place, leurs fichiers sont décompressés directement en mémoire.
+	\n			Le dernier montage a la priorité sur les précédents, les chemins qui ne sont couverts par aucun montage sont lus depuis le disque.
+	\n			Une archive montée sans point de montage est montée sur son propre chemin, <tt>dossier/scene.zip/scene.cscn</tt> désigne donc un fichier dans <tt>dossier/scene.zip</tt>.
+	*/
+	class VirtualFileSystem
+	{
+	public:
+		CU_API VirtualFileSystem();
+		CU_API ~VirtualFileSystem()noexcept;
+
+		VirtualFileSystem( VirtualFileSystem const & ) = delete;
+		VirtualFileSystem & operator=( VirtualFileSystem const & ) = delete;
+		VirtualFileSystem( VirtualFileSystem && ) = delete;
+		VirtualFileSystem & operator=( VirtualFileSystem && ) = delete;
+		/**
+		 *\~english
+		 *\return		The process wide file system.
+		 *\~french
+		 *\return		Le système de fichiers global au processus.
+		 */
+		CU_API static VirtualFileSystem & getSingleton();
+		/**
+		 *\~english
+		 *\brief		Mounts a disk folder.
+		 *\param[in]	mountPoint	The virtual path of the folder.
+		 *\param[in]	folder		The disk folder.
+		 *\~french
+		 *\brief		Monte un dossier du disque.
+		 *\param[in]	mountPoint	Le chemin virtuel du dossier.
+		 *\param[in]	folder		Le dossier sur le disque.
+		 */
+		CU_API void mountDirectory( Path const & mountPoint
+			, Path const & folder );
+		/**
+		 *\~english
+		 *\brief		Mounts a zip archive, and builds its entry index.
+		 *\remarks		Mounting twice the same archive at the same mount point does nothing.
+		 *\param[in]	mountPoint	The virtual path of the archive root.
+		 *\param[in]	archive		The archive path.
+		 *\return		\p false if the archive couldn't be opened.
+		 *\~french
+		 *\brief		Monte une archive zip, et construit son index d'entrées.
+		 *\remarks		Monter deux fois la même archive sur le même point de montage ne fait rien.
+		 *\param[in]	mountPoint	Le chemin virtuel de la racine de l'archive.
+		 *\param[in]	archive		Le chemin de l'archive.
+		 *\return		\p false si l'archive n'a pas pu être ouverte.
+		 */
+		CU_API bool mountArchive( Path const & mountPoint
+			, Path const & archive );
+		/**
+		 *\~english
+		 *\brief		Mounts a zip archive at its own path.
+		 *\param[in]	archive		The archive path.
+		 *\return		\p false if the archive couldn't be opened.
+		 *\~french
+		 *\brief		Monte une archive zip sur son propre chemin.
+		 *\param[in]	archive		Le chemin de l'archive.
+		 *\return		\p false si l'archive n'a pas pu être ouverte.
+		 */
+		CU_API bool mountArchive( Path const & archive );
+		/**
+		 *\~english
+		 *\brief		Removes the mounts at given mount point.
+		 *\~french
+		 *\brief		Supprime les montages sur le point de montage donné.
+		 */
+		CU_API void unmount( Path const & mountPoint );
+		/**
+		 *\~english
+		 *\return		\p true if something is mounted at given mount point.
+		 *\~french
+		 *\return		\p true si quelque chose est monté sur le point de montage donné.
+		 */
+		CU_API bool isMounted( Path const & mountPoint )const;
+		/**
+		 *\~english
+		 *\brief		Tests file existence, in the mounts, then on the disk.
+		 *\param[in]	path	The file path.
+		 *\~french
+		 *\brief		Teste l'existence d'un fichier, dans les montages, puis sur le disque.
+		 *\param[in]	path	Le chemin du fichier.
+		 */
+		CU_API bool fileExists( Path const & path )const;
+		/**
+		 *\~english
+		 *\brief		Reads a whole file.
+		 *\param[in]	path	The file path.
+		 *\param[out]	data	Receives the file content.
+		 *\return		\p false if the file wasn't found or couldn't be read.
+		 *\~french
+		 *\brief		Lit un fichier en entier.
+		 *\param[in]	path	Le chemin du fichier.
+		 *\param[out]	data	Reçoit le contenu du fichier.
+		 *\return		\p false si le fichier n'a pas été trouvé ou n'a pas pu être lu.
+		 */
+		CU_API bool readFile( Path const & path
+			, ByteArray & data )const;
+		/**
+		 *\~english
+		 *\brief		Reads a whole text file.
+		 *\param[in]	path	The file path.
+		 *\param[out]	text	Receives the file content, with Unix line endings.
+		 *\return		\p false if the file wasn't found or couldn't be read.
+		 *\~french
+		 *\brief		Lit un fichier texte en entier.
+		 *\param[in]	path	Le chemin du fichier.
+		 *\param[out]	text	Reçoit le contenu du fichier, avec des fins de ligne Unix.
+		 *\return		\p false si le fichier n'a pas été trouvé ou n'a pas pu être lu.
+		 */
+		CU_API bool readFile( Path const & path
+			, String & text )const;
+		/**
+		 *\~english
+		 *\brief		Reads whole files, decompressing the archived ones in parallel.
+		 *\param[in]	paths	The files paths.
+		 *\param[out]	data	Receives the files contents, in the same order as \p paths.
+		 *\param[in]	pool	The pool running the decompression jobs.
+		 *\return		\p false if one of the files wasn't found or couldn't be read.
+		 *\~french
+		 *\brief		Lit des fichiers en entier, en décompressant en parallèle ceux des archives.
+		 *\param[in]	paths	Les chemins des fichiers.
+		 *\param[out]	data	Reçoit les contenus des fichiers, dans le même ordre que \p paths.
+		 *\param[in]	pool	Le pool exécutant les tâches de décompression.
+		 *\return		\p false si un des fichiers n'a pas été trouvé ou n'a pas pu être lu.
+		 */
+		CU_API bool readFiles( PathArray const & paths
+			, std::vector< ByteArray > & data
+			, TaskPool & pool )const;
+		/**
+		 *\~english
+		 *\brief		Lists the files in a folder, from the mounts and from the disk.
+		 *\param[in]	folder		The folder path.
+		 *\param[out]	files		Receives the files paths.
+		 *\param[in]	recursive	Tells if the subfolders are listed too.
+		 *\return		\p true if the folder exists.
+		 *\~french
+		 *\brief		Liste les fichiers d'un dossier, depuis les montages et depuis le disque.
+		 *\param[in]	folder		Le chemin du dossier.
+		 *\param[out]	files		Reçoit les chemins des fichiers.
+		 *\param[in]	recursive	Dit si les sous-dossiers sont listés aussi.
+		 *\return		\p true si le dossier existe.
+		 */
+		CU_API bool listFiles( Path const & folder
+			, PathArray & files
+			, bool recursive )const;
+
+	private:
+		struct Mount;
+		using MountPtr = std::shared_ptr< Mount >;
+		using MountArray = std::vector< MountPtr >;
+
+		struct Location
+		{
+			MountPtr mount;
+			Path path;
+		};
+
+		Location doFind( Path const & path )const;
+
+	private:
+		mutable std::mutex m_mutex;
+		MountArray m_mounts;
+	};
+}
+
+#endif
@@ -7,8 +7,11 @@ See LICENSE file in root folder
 #include "CastorUtils/Data/DataModule.hpp"
 
 #include "CastorUtils/Data/File.hpp"
+#include "CastorUtils/Multithreading/MultithreadingModule.hpp"
 
 #include <list>
+#include <map>
+#include <mutex>
 
 namespace castor
 {
@@ -30,7 +33,25 @@ namespace castor
 			void addFile( Path const & path );
 			void removeFile( Path const & path );
 		};
-
+		/**
+		\~english
+		\brief		An entry of the archive index.
+		\~french
+		\brief		Une entrée de l'index de l'archive.
+		*/
+		struct Entry
+		{
+			//!\~english	The file path, relative to the archive root.
+			//!\~french		Le chemin du fichier, relatif à la racine de l'archive.
+			Path name;
+			//!\~english	The uncompressed size.
+			//!\~french		La taille décompressée.
+			uint64_t size{};
+			//!\~english	The compressed size.
+			//!\~french		La taille compressée.
+			uint64_t compressedSize{};
+		};
+		using EntryArray = std::vector< Entry >;
 
 		struct ZipImpl
 		{
@@ -41,6 +62,9 @@ namespace castor
 			virtual StringArray inflate( Path const & outFolder, Folder & folder ) = 0;
 			virtual bool findFolder( String const & folder ) = 0;
 			virtual bool findFile( String const & file ) = 0;
+			virtual EntryArray listEntries() = 0;
+			virtual void readEntry( size_t index, ByteArray & data ) = 0;
+			virtual std::unique_ptr< ZipImpl > openReader()const = 0;
 		};
 
 	public:
@@ -114,11 +138,68 @@ namespace castor
 		 *\param[in]	file	Le nom du fichier
 		 */
 		CU_API bool findFile( String const & file );
+		/**
+		 *\~english
+		 *\brief		Looks for a file into the archive index.
+		 *\param[in]	name	The file path, relative to the archive root.
+		 *\return		The entry, \p nullptr if not found.
+		 *\~french
+		 *\brief		Recherche un fichier dans l'index de l'archive.
+		 *\param[in]	name	Le chemin du fichier, relatif à la racine de l'archive.
+		 *\return		L'entrée, \p nullptr si non trouvée.
+		 */
+		CU_API Entry const * findEntry( Path const & name )const;
+		/**
+		 *\~english
+		 *\brief		Decompresses a file of the archive directly into memory.
+		 *\param[in]	name	The file path, relative to the archive root.
+		 *\param[out]	data	Receives the file content.
+		 *\return		\p false if the file was not found or could not be decompressed.
+		 *\~french
+		 *\brief		Décompresse un fichier de l'archive directement en mémoire.
+		 *\param[in]	name	Le chemin du fichier, relatif à la racine de l'archive.
+		 *\param[out]	data	Reçoit le contenu du fichier.
+		 *\return		\p false si le fichier n'a pas été trouvé ou n'a pas pu être décompressé.
+		 */
+		CU_API bool readFile( Path const & name
+			, ByteArray & data );
+		/**
+		 *\~english
+		 *\brief		Decompresses files of the archive into memory, in parallel.
+		 *\remarks		Each job reads through its own archive handle.
+		 *\param[in]	names	The files paths, relative to the archive root.
+		 *\param[out]	data	Receives the files contents, in the same order as \p names.
+		 *\param[in]	pool	The pool running the decompression jobs.
+		 *\return		\p false if one of the files was not found or could not be decompressed.
+		 *\~french
+		 *\brief		Décompresse des fichiers de l'archive en mémoire, en parallèle.
+		 *\remarks		Chaque tâche lit via son propre accès à l'archive.
+		 *\param[in]	names	Les chemins des fichiers, relatifs à la racine de l'archive.
+		 *\param[out]	data	Reçoit les contenus des fichiers, dans le même ordre que \p names.
+		 *\param[in]	pool	Le pool exécutant les tâches de décompression.
+		 *\return		\p false si un des fichiers n'a pas été trouvé ou n'a pas pu être décompressé.
+		 */
+		CU_API bool readFiles( PathArray const & names
+			, std::vector< ByteArray > & data
+			, TaskPool & pool );
+		/**
+		 *\~english
+		 *\return		The archive index, filled when the archive is opened for reading.
+		 *\~french
+		 *\return		L'index de l'archive, rempli lorsque l'archive est ouverte en lecture.
+		 */
+		EntryArray const & getEntries()const noexcept
+		{
+			return m_entries;
+		}
 
 	private:
 		std::unique_ptr< ZipImpl > m_impl;
 		Folder m_uncompressed;
 		Path m_rootFolder;
+		EntryArray m_entries;
+		std::map< Path, size_t > m_index;
+		std::mutex m_readMutex;
 	};
 }
 
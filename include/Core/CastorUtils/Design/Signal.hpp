@@ -8,9 +8,12 @@ See LICENSE file in root folder
 
 #include "CastorUtils/Exception/Assertion.hpp"
 
+#include <algorithm>
+#include <atomic>
 #include <functional>
-#include <map>
 #include <set>
+#include <thread>
+#include <vector>
 
 namespace castor
 {
@@ -127,8 +130,10 @@ namespace castor
 		/**
 		 *\~english
 		 *\brief		Disconnects the function from the signal.
+		 *\remarks		Must not be called while another thread emits the signal.
 		 *\~french
 		 *\brief		Déconnecte la fonction du signal.
+		 *\remarks		Ne doit pas être appelée pendant qu'un autre thread émet le signal.
 		 */
 		bool disconnect()
 		{
@@ -200,9 +205,42 @@ namespace castor
 	public:
 		SignalT( SignalT const & ) = delete;
 		SignalT & operator=( SignalT const & ) = delete;
-		SignalT( SignalT && ) = default;
-		SignalT & operator=( SignalT && ) = default;
 		SignalT() = default;
+		/**
+		 *\~english
+		 *\brief			Move constructor.
+		 *\param[in,out]	rhs	The object to move.
+		 *\~french
+		 *\brief			Constructeur par déplacement.
+		 *\param[in,out]	rhs	L'objet à déplacer.
+		 */
+		SignalT( SignalT && rhs )noexcept
+			: m_slots{ std::move( rhs.m_slots ) }
+			, m_pending{ std::move( rhs.m_pending ) }
+			, m_emitting{ rhs.m_emitting.load() }
+			, m_dirty{ rhs.m_dirty }
+			, m_nextIndex{ rhs.m_nextIndex }
+			, m_connections{ std::move( rhs.m_connections ) }
+		{
+		}
+		/**
+		 *\~english
+		 *\brief			Move assignment operator.
+		 *\param[in,out]	rhs	The object to move.
+		 *\~french
+		 *\brief			Opérateur d'affectation par déplacement.
+		 *\param[in,out]	rhs	L'objet à déplacer.
+		 */
+		SignalT & operator=( SignalT && rhs )noexcept
+		{
+			m_slots = std::move( rhs.m_slots );
+			m_pending = std::move( rhs.m_pending );
+			m_emitting = rhs.m_emitting.load();
+			m_dirty = rhs.m_dirty;
+			m_nextIndex = rhs.m_nextIndex;
+			m_connections = std::move( rhs.m_connections );
+			return *this;
+		}
 		/**
 		 *\~english
 		 *\brief		Destructor.
@@ -233,52 +271,76 @@ namespace castor
 		/**
 		 *\~english
 		 *\brief		Connects a new function that will be called if the signal is emitted.
+		 *\remarks		Must not be called while another thread emits the signal.
 		 *\param[in]	function	The function.
 		 *\return		The function index, in order to be able to disconnect it.
 		 *\~french
 		 *\brief		Connecte une nouvelle fonction, qui sera appelée lorsque le signal est émis.
+		 *\remarks		Ne doit pas être appelée pendant qu'un autre thread émet le signal.
 		 *\param[in]	function	La fonction.
 		 *\return		L'indice de la fonction, afin de pouvoir la déconnecter.
 		 */
 		my_connection connect( Function function )
 		{
-			uint32_t index = 1u;
+			uint32_t index = m_nextIndex++;
 
-			if ( !m_slots.empty() )
+			if ( m_emitting.load() )
+			{
+				m_pending.push_back( Slot{ index, std::move( function ) } );
+			}
+			else
 			{
-				index = m_slots.rbegin()->first + 1u;
+				doFlush();
+				m_slots.push_back( Slot{ index, std::move( function ) } );
 			}
 
-			m_slots.emplace( index, function );
 			return my_connection{ index, *this };
 		}
 		/**
 		 *\~english
 		 *\brief		Emits the signal, calls every connected function.
+		 *\remarks		The functions connected during the emission are called from the next one.
+		 *\n			Several threads can emit the signal at once, the slots list is updated when the last emission ends, before any new emission starts.
 		 *\~french
 		 *\brief		Emet le signal, appelant toutes les fonctions connectées.
+		 *\remarks		Les fonctions connectées pendant l'émission sont appelées à partir de la suivante.
+		 *\n			Plusieurs threads peuvent émettre le signal en même temps, la liste des fonctions est mise à jour à la fin de la dernière émission, avant que toute nouvelle émission commence.
 		 */
 		void operator()()const
 		{
-			for ( auto it : m_slots )
+			EmitGuard guard{ *this };
+
+			for ( size_t i = 0u; i < guard.count; ++i )
 			{
-				it.second();
+				if ( auto & slot = m_slots[i]; slot.connected )
+				{
+					slot.function();
+				}
 			}
 		}
 		/**
 		 *\~english
 		 *\brief		Emits the signal, calls every connected function.
+		 *\remarks		The functions connected during the emission are called from the next one.
+		 *\n			Several threads can emit the signal at once, the slots list is updated when the last emission ends, before any new emission starts.
 		 *\param[in]	params	The functions parameters.
 		 *\~french
 		 *\brief		Emet le signal, appelant toutes les fonctions connectées.
+		 *\remarks		Les fonctions connectées pendant l'émission sont appelées à partir de la suivante.
+		 *\n			Plusieurs threads peuvent émettre le signal en même temps, la liste des fonctions est mise à jour à la fin de la dernière émission, avant que toute nouvelle émission commence.
 		 *\param[in]	params	Les paramètres des fonctions.
 		 */
 		template< typename ... Params >
 		void operator()( Params && ... params )const
 		{
-			for ( auto it : m_slots )
+			EmitGuard guard{ *this };
+
+			for ( size_t i = 0u; i < guard.count; ++i )
 			{
-				it.second( std::forward< Params >( params )... );
+				if ( auto & slot = m_slots[i]; slot.connected )
+				{
+					slot.function( params... );
+				}
 			}
 		}
 
@@ -293,13 +355,77 @@ namespace castor
 		 */
 		void disconnect( uint32_t index )
 		{
-			auto it = m_slots.find( index );
+			if ( !m_emitting.load() )
+			{
+				doFlush();
+			}
+
+			auto it = std::lower_bound( m_slots.begin()
+				, m_slots.end()
+				, index
+				, []( Slot const & lhs, uint32_t rhs )
+				{
+					return lhs.index < rhs;
+				} );
 
-			if ( it != m_slots.end() )
+			if ( it != m_slots.end()
+				&& it->index == index )
 			{
-				m_slots.erase( it );
+				if ( m_emitting.load() )
+				{
+					// The function may be running, it is erased once the emission is over.
+					it->connected = false;
+					m_dirty = true;
+				}
+				else
+				{
+					m_slots.erase( it );
+				}
+			}
+			else
+			{
+				auto pendingIt = std::find_if( m_pending.begin()
+					, m_pending.end()
+					, [index]( Slot const & lookup )
+					{
+						return lookup.index == index;
+					} );
+
+				if ( pendingIt != m_pending.end() )
+				{
+					m_pending.erase( pendingIt );
+				}
 			}
 		}
+		/**
+		 *\~english
+		 *\brief		Removes the functions disconnected during an emission, and adds the ones connected during it.
+		 *\remarks		Only done while no emission is running, the emissions can't start before it ends.
+		 *\~french
+		 *\brief		Supprime les fonctions déconnectées pendant une émission, et ajoute celles connectées pendant celle-ci.
+		 *\remarks		Uniquement fait quand aucune émission n'est en cours, les émissions ne peuvent pas commencer avant qu'il se termine.
+		 */
+		void doFlush()const
+		{
+			if ( m_dirty )
+			{
+				m_slots.erase( std::remove_if( m_slots.begin()
+						, m_slots.end()
+						, []( Slot const & lookup )
+						{
+							return !lookup.connected;
+						} )
+					, m_slots.end() );
+				m_dirty = false;
+			}
+
+			for ( auto & slot : m_pending )
+			{
+				m_slots.push_back( std::move( slot ) );
+			}
+
+			m_pending.clear();
+		}
 		/**
 		 *\~english
 		 *\brief		adds a connection to the list.
@@ -344,9 +470,77 @@ namespace castor
 		}
 
 	private:
-		//!\~english	The connected functions list.
-		//!\~french		La liste des fonctions connectées.
-		std::map< uint32_t, Function > m_slots;
+		struct Slot
+		{
+			uint32_t index;
+			Function function;
+			bool connected{ true };
+		};
+
+		struct EmitGuard
+		{
+			explicit EmitGuard( SignalT const & signal )
+				: signal{ signal }
+			{
+				auto emitting = signal.m_emitting.load();
+
+				while ( emitting == Flushing
+					|| !signal.m_emitting.compare_exchange_weak( emitting, emitting + 1u ) )
+				{
+					if ( emitting == Flushing )
+					{
+						std::this_thread::yield();
+						emitting = signal.m_emitting.load();
+					}
+				}
+
+				count = signal.m_slots.size();
+			}
+
+			~EmitGuard()noexcept
+			{
+				auto emitting = signal.m_emitting.load();
+
+				while ( !signal.m_emitting.compare_exchange_weak( emitting
+					, ( emitting == 1u ? Flushing : emitting - 1u ) ) )
+				{
+				}
+
+				if ( emitting == 1u )
+				{
+					// The last emission updates the slots list, the new ones wait for it.
+					signal.doFlush();
+					signal.m_emitting.store( 0u );
+				}
+			}
+
+			EmitGuard( EmitGuard const & ) = delete;
+			EmitGuard & operator=( EmitGuard const & ) = delete;
+
+			SignalT const & signal;
+			size_t count{};
+		};
+
+		//!\~english	The m_emitting value while the slots list is updated.
+		//!\~french		La valeur de m_emitting pendant la mise à jour de la liste des fonctions.
+		static uint32_t constexpr Flushing = ~0u;
+
+	private:
+		//!\~english	The connected functions, sorted by index.
+		//!\~french		Les fonctions connectées, triées par indice.
+		mutable std::vector< Slot > m_slots;
+		//!\~english	The functions connected during an emission.
+		//!\~french		Les fonctions connectées pendant une émission.
+		mutable std::vector< Slot > m_pending;
+		//!\~english	The running emissions count, or Flushing.
+		//!\~french		Le nombre d'émissions en cours, ou Flushing.
+		mutable std::atomic< uint32_t > m_emitting{};
+		//!\~english	Tells if functions have been disconnected during an emission.
+		//!\~french		Dit si des fonctions ont été déconnectées pendant une émission.
+		mutable bool m_dirty{};
+		//!\~english	The next connection index.
+		//!\~french		L'indice de la prochaine connexion.
+		uint32_t m_nextIndex{ 1u };
 		//!\~english	The connections list.
 		//!\~french		La liste des connections à ce signal.
 		std::set< my_connection_ptr > m_connections;
@@ -9,11 +9,14 @@ See LICENSE file in root folder
 #include "CastorUtils/Exception/Assertion.hpp"
 #include "CastorUtils/Multithreading/SpinMutex.hpp"
 
+#include <algorithm>
 #include <functional>
-#include <map>
+#include <memory>
 #include <set>
+#include <vector>
 
 #include "CastorUtils/Config/BeginExternHeaderGuard.hpp"
+#include <atomic>
 #include <mutex>
 #include "CastorUtils/Config/EndExternHeaderGuard.hpp"
 
@@ -22,6 +25,8 @@ namespace castor
 	template< typename SignalT >
 	class TSConnectionT
 	{
+		friend SignalT;
+
 	private:
 		using my_signal = SignalT;
 		using my_signal_ptr = my_signal *;
@@ -118,7 +123,7 @@ namespace castor
 
 					try
 					{
-						disconnect();
+						doDisconnect();
 						m_connection = rhs.m_connection;
 						m_signal = rhs.m_signal;
 #if !defined( NDEBUG )
@@ -164,15 +169,7 @@ namespace castor
 		 */
 		~TSConnectionT()noexcept
 		{
-			if ( m_signal )
-			{
-				auto lock( makeUniqueLock( m_signal->m_mutex ) );
-				disconnect();
-			}
-			else
-			{
-				disconnect();
-			}
+			disconnect();
 		}
 		/**
 		 *\~english
@@ -186,8 +183,7 @@ namespace castor
 
 			if ( m_signal && m_connection )
 			{
-				m_signal->disconnect( m_connection );
-				m_signal->removeConnection( *this );
+				m_signal->disconnect( *this, m_connection );
 				m_signal = nullptr;
 				m_connection = 0u;
 				result = true;
@@ -202,6 +198,26 @@ namespace castor
 		}
 
 	private:
+		/**
+		 *\~english
+		 *\brief		Disconnects the function from the signal, the signal's mutex being already locked.
+		 *\~french
+		 *\brief		Déconnecte la fonction du signal, le mutex du signal étant déjà verrouillé.
+		 */
+		bool doDisconnect()
+		{
+			bool result{ false };
+
+			if ( m_signal && m_connection )
+			{
+				m_signal->doDisconnect( *this, m_connection );
+				m_signal = nullptr;
+				m_connection = 0u;
+				result = true;
+			}
+
+			return result;
+		}
 		/**
 		 *\~english
 		 *\brief		Swaps two connections.
@@ -246,6 +262,9 @@ namespace castor
 		friend class TSConnectionT< TSSignalT< Function > >;
 		using my_connection = TSConnectionT< TSSignalT< Function > >;
 		using my_connection_ptr = my_connection *;
+		using Slot = std::pair< uint32_t, Function >;
+		using SlotArray = std::vector< Slot >;
+		using SlotArrayPtr = std::shared_ptr< SlotArray const >;
 
 	public:
 		using connection = my_connection;
@@ -260,7 +279,8 @@ namespace castor
 			auto rhsLock( makeUniqueLock( rhs.m_mutex ) );
 			auto lhsLock( makeUniqueLock( m_mutex ) );
 			m_connections = std::move( rhs.m_connections );
-			m_slots = std::move( rhs.m_slots );
+			doStoreSlots( rhs.doLoadSlots() );
+			rhs.doStoreSlots( nullptr );
 		}
 
 		TSSignalT & operator=( TSSignalT && rhs )
@@ -268,7 +288,8 @@ namespace castor
 			auto rhsLock( makeUniqueLock( rhs.m_mutex ) );
 			auto lhsLock( makeUniqueLock( m_mutex ) );
 			m_connections = std::move( rhs.m_connections );
-			m_slots = std::move( rhs.m_slots );
+			doStoreSlots( rhs.doLoadSlots() );
+			rhs.doStoreSlots( nullptr );
 
 			return *this;
 		}
@@ -293,10 +314,10 @@ namespace castor
 			while ( it != m_connections.end() )
 			{
 #if !defined( NDEBUG )
-				auto disco = ( *it )->disconnect();
+				auto disco = ( *it )->doDisconnect();
 				CU_Require( disco );
 #else
-				( *it )->disconnect();
+				( *it )->doDisconnect();
 #endif
 				it = m_connections.begin();
 			}
@@ -315,46 +336,60 @@ namespace castor
 		{
 			auto lock( makeUniqueLock( m_mutex ) );
 			uint32_t index = 1u;
+			auto slots = std::make_shared< SlotArray >();
 
-			if ( !m_slots.empty() )
+			if ( auto current = doLoadSlots() )
 			{
-				index = m_slots.rbegin()->first + 1u;
+				index = current->back().first + 1u;
+				slots->reserve( current->size() + 1u );
+				*slots = *current;
 			}
 
-			m_slots.emplace( index, function );
+			slots->emplace_back( index, std::move( function ) );
+			doStoreSlots( std::move( slots ) );
 			return my_connection{ index, *this };
 		}
 		/**
 		 *\~english
 		 *\brief		Emits the signal, calls every connected function.
+		 *\remarks		The emission doesn't lock the signal: it calls the functions connected when it started,
+		 *\n			even if they are disconnected by another thread in the meantime.
 		 *\~french
 		 *\brief		Emet le signal, appelant toutes les fonctions connectées.
+		 *\remarks		L'émission ne verrouille pas le signal : elle appelle les fonctions connectées lors de son démarrage,
+		 *\n			même si elles sont déconnectées entre temps par un autre thread.
 		 */
 		void operator()()const
 		{
-			auto lock( makeUniqueLock( m_mutex ) );
-
-			for ( auto it : m_slots )
+			if ( auto slots = doLoadSlots() )
 			{
-				it.second();
+				for ( auto & slot : *slots )
+				{
+					slot.second();
+				}
 			}
 		}
 		/**
 		 *\~english
 		 *\brief		Emits the signal, calls every connected function.
+		 *\remarks		The emission doesn't lock the signal: it calls the functions connected when it started,
+		 *\n			even if they are disconnected by another thread in the meantime.
 		 *\param[in]	params	The functions parameters.
 		 *\~french
 		 *\brief		Emet le signal, appelant toutes les fonctions connectées.
+		 *\remarks		L'émission ne verrouille pas le signal : elle appelle les fonctions connectées lors de son démarrage,
+		 *\n			même si elles sont déconnectées entre temps par un autre thread.
 		 *\param[in]	params	Les paramètres des fonctions.
 		 */
 		template< typename ... Params >
 		void operator()( Params && ... params )const
 		{
-			auto lock( makeUniqueLock( m_mutex ) );
-
-			for ( auto it : m_slots )
+			if ( auto slots = doLoadSlots() )
 			{
-				it.second( std::forward< Params >( params )... );
+				for ( auto & slot : *slots )
+				{
+					slot.second( params... );
+				}
 			}
 		}
 
@@ -362,20 +397,93 @@ namespace castor
 		/**
 		 *\~english
 		 *\brief		Disconnects a function.
-		 *\param[in]	index	The function index.
+		 *\param[in]	connection	The connection.
+		 *\param[in]	index		The function index.
 		 *\~french
 		 *\brief		Déconnecte une fonction.
-		 *\param[in]	index	L'indice de la fonction.
+		 *\param[in]	connection	La connexion.
+		 *\param[in]	index		L'indice de la fonction.
 		 */
-		void disconnect( uint32_t index )
+		void disconnect( my_connection & connection
+			, uint32_t index )
 		{
-			auto it = m_slots.find( index );
+			auto lock( makeUniqueLock( m_mutex ) );
+			doDisconnect( connection, index );
+		}
+		/**
+		 *\~english
+		 *\brief		Disconnects a function, the mutex being already locked.
+		 *\param[in]	connection	The connection.
+		 *\param[in]	index		The function index.
+		 *\~french
+		 *\brief		Déconnecte une fonction, le mutex étant déjà verrouillé.
+		 *\param[in]	connection	La connexion.
+		 *\param[in]	index		L'indice de la fonction.
+		 */
+		void doDisconnect( my_connection & connection
+			, uint32_t index )
+		{
+			removeConnection( connection );
+			auto current = doLoadSlots();
+
+			if ( !current )
+			{
+				return;
+			}
 
-			if ( it != m_slots.end() )
+			auto it = std::lower_bound( current->begin()
+				, current->end()
+				, index
+				, []( Slot const & lhs, uint32_t rhs )
+				{
+					return lhs.first < rhs;
+				} );
+
+			if ( it != current->end()
+				&& it->first == index )
 			{
-				m_slots.erase( it );
+				SlotArrayPtr slots;
+
+				if ( current->size() > 1u )
+				{
+					auto result = std::make_shared< SlotArray >();
+					result->reserve( current->size() - 1u );
+					result->insert( result->end(), current->begin(), it );
+					result->insert( result->end(), std::next( it ), current->end() );
+					slots = std::move( result );
+				}
+
+				doStoreSlots( std::move( slots ) );
 			}
 		}
+		/**
+		 *\~english
+		 *\brief		Atomically retrieves the current functions list.
+		 *\~french
+		 *\brief		Récupère atomiquement la liste de fonctions courante.
+		 */
+		SlotArrayPtr doLoadSlots()const noexcept
+		{
+#if defined( __cpp_lib_atomic_shared_ptr )
+			return m_slots.load( std::memory_order_acquire );
+#else
+			return std::atomic_load_explicit( &m_slots, std::memory_order_acquire );
+#endif
+		}
+		/**
+		 *\~english
+		 *\brief		Atomically replaces the current functions list.
+		 *\~french
+		 *\brief		Remplace atomiquement la liste de fonctions courante.
+		 */
+		void doStoreSlots( SlotArrayPtr slots )noexcept
+		{
+#if defined( __cpp_lib_atomic_shared_ptr )
+			m_slots.store( std::move( slots ), std::memory_order_release );
+#else
+			std::atomic_store_explicit( &m_slots, std::move( slots ), std::memory_order_release );
+#endif
+		}
 		/**
 		 *\~english
 		 *\brief		adds a connection to the list.
@@ -420,10 +528,16 @@ namespace castor
 		}
 
 	private:
+		//!\~english	Serialises the modifications, the emissions don't lock it.
+		//!\~french		Sérialise les modifications, les émissions ne le verrouillent pas.
 		mutable SpinMutex m_mutex;
-		//!\~english	The connected functions list.
-		//!\~french		La liste des fonctions connectées.
-		std::map< uint32_t, Function > m_slots;
+		//!\~english	The connected functions list, sorted by index, replaced as a whole on each modification.
+		//!\~french		La liste des fonctions connectées, triée par indice, remplacée entièrement à chaque modification.
+#if defined( __cpp_lib_atomic_shared_ptr )
+		std::atomic< SlotArrayPtr > m_slots;
+#else
+		SlotArrayPtr m_slots;
+#endif
 		//!\~english	The connections list.
 		//!\~french		La liste des connections à ce signal.
 		std::set< my_connection_ptr > m_connections;
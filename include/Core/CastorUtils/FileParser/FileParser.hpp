@@ -202,12 +202,12 @@ namespace castor
 		/**
 		 *\~english
 		 *\brief		Parsing function.
-		 *\param[in]	appName			The application name, if a dezip is needed.
+		 *\param[in]	appName			The application name (unused, zip archives are read in place).
 		 *\param[in]	path			The file access path.
 		 *\param[in]	preprocessed	The preprocessed file.
 		 *\~french
 		 *\brief		Fonction de traitement.
-		 *\param[in]	appName			Le nom de l'application, si un dézip est nécessaire.
+		 *\param[in]	appName			Le nom de l'application (inutilisé, les archives zip sont lues sur place).
 		 *\param[in]	path			Le chemin d'accès au fichier.
 		 *\param[in]	preprocessed	Le fichier pré-traité.
 		 */
@@ -244,12 +244,12 @@ namespace castor
 		/**
 		 *\~english
 		 *\brief		Parsing function.
-		 *\param[in]	appName	The application name, if a dezip is needed.
+		 *\param[in]	appName	The application name (unused, zip archives are read in place).
 		 *\param[in]	path	The file access path.
 		 *\return		The preprocessed file.
 		 *\~french
 		 *\brief		Fonction de traitement.
-		 *\param[in]	appName	Le nom de l'application, si un dézip est nécessaire.
+		 *\param[in]	appName	Le nom de l'application (inutilisé, les archives zip sont lues sur place).
 		 *\param[in]	path	Le chemin d'accès au fichier.
 		 *\return		Le fichier pré-traité.
 		 */
@@ -283,12 +283,12 @@ namespace castor
 		/**
 		 *\~english
 		 *\brief		Parsing function.
-		 *\param[in]	appName	The application name, if a dezip is needed.
+		 *\param[in]	appName	The application name (unused, zip archives are read in place).
 		 *\param[in]	path	The file access path.
 		 *\return		\p true if OK.
 		 *\~french
 		 *\brief		Fonction de traitement.
-		 *\param[in]	appName	Le nom de l'application, si un dézip est nécessaire.
+		 *\param[in]	appName	Le nom de l'application (inutilisé, les archives zip sont lues sur place).
 		 *\param[in]	path	Le chemin d'accès au fichier.
 		 *\return		\p true si tout s'est bien passé.
 		 */
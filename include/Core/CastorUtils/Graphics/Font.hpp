@@ -10,6 +10,10 @@ See LICENSE file in root folder
 #include "CastorUtils/Graphics/Glyph.hpp"
 #include "CastorUtils/Math/Point.hpp"
 
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+
 namespace castor
 {
 	class Font
@@ -99,7 +103,8 @@ namespace castor
 			virtual Glyph loadGlyph( char32_t c ) = 0;
 		};
 
-		CU_DeclareVector( Glyph, Glyph );
+		// Glyphs are loaded on demand, the references to the already loaded ones must stay valid.
+		using GlyphArray = std::deque< Glyph >;
 
 	public:
 		/**
@@ -169,12 +174,8 @@ namespace castor
 		 */
 		bool hasGlyphAt( char32_t c )const
 		{
-			return m_loadedGlyphs.end() != std::find_if( m_loadedGlyphs.begin()
-				, m_loadedGlyphs.end()
-				, [c]( Glyph const & glyph )
-				{
-					return glyph.getCharacter() == c;
-				} );
+			auto lock( makeUniqueLock( m_glyphsMutex ) );
+			return m_glyphIndices.end() != m_glyphIndices.find( c );
 		}
 		/**
 		 *\~english
@@ -188,19 +189,15 @@ namespace castor
 		 */
 		Glyph const & getGlyphAt( char32_t c )const
 		{
-			auto it = std::find_if( m_loadedGlyphs.begin()
-				, m_loadedGlyphs.end()
-				, [c]( Glyph const & glyph )
-				{
-					return glyph.getCharacter() == c;
-				} );
+			auto lock( makeUniqueLock( m_glyphsMutex ) );
+			auto it = m_glyphIndices.find( c );
 
-			if ( it == m_loadedGlyphs.end() )
+			if ( it == m_glyphIndices.end() )
 			{
 				throw std::range_error( "Font subscript out of range" );
 			}
 
-			return *it;
+			return m_loadedGlyphs[it->second];
 		}
 		/**
 		 *\~english
@@ -214,19 +211,15 @@ namespace castor
 		 */
 		Glyph & getGlyphAt( char32_t c )
 		{
-			auto it = std::find_if( m_loadedGlyphs.begin()
-				, m_loadedGlyphs.end()
-				, [c]( Glyph const & glyph )
-				{
-					return glyph.getCharacter() == c;
-				} );
+			auto lock( makeUniqueLock( m_glyphsMutex ) );
+			auto it = m_glyphIndices.find( c );
 
-			if ( it == m_loadedGlyphs.end() )
+			if ( it == m_glyphIndices.end() )
 			{
 				throw std::range_error( "Font subscript out of range" );
 			}
 
-			return *it;
+			return m_loadedGlyphs[it->second];
 		}
 		/**
 		 *\~english
@@ -240,14 +233,10 @@ namespace castor
 		 */
 		Glyph const & operator[]( char32_t c )const
 		{
-			CU_Ensure( hasGlyphAt( c ) );
-
-			return *std::find_if( m_loadedGlyphs.begin()
-				, m_loadedGlyphs.end()
-				, [c]( Glyph const & glyph )
-				{
-					return glyph.getCharacter() == c;
-				} );
+			auto lock( makeUniqueLock( m_glyphsMutex ) );
+			auto it = m_glyphIndices.find( c );
+			CU_Ensure( it != m_glyphIndices.end() );
+			return m_loadedGlyphs[it->second];
 		}
 		/**
 		 *\~english
@@ -261,14 +250,10 @@ namespace castor
 		 */
 		Glyph & operator[]( char32_t c )
 		{
-			CU_Ensure( hasGlyphAt( c ) );
-
-			return *std::find_if( m_loadedGlyphs.begin()
-				, m_loadedGlyphs.end()
-				, [c]( Glyph const & glyph )
-				{
-					return glyph.getCharacter() == c;
-				} );
+			auto lock( makeUniqueLock( m_glyphsMutex ) );
+			auto it = m_glyphIndices.find( c );
+			CU_Ensure( it != m_glyphIndices.end() );
+			return m_loadedGlyphs[it->second];
 		}
 		/**
 		 *\~english
@@ -290,8 +275,9 @@ namespace castor
 		 *\brief		Récupère la hauteur maximale des glyphes
 		 *\return		La hauteur maximale des glyphes
 		 */
-		uint32_t getMaxHeight()const noexcept
+		uint32_t getMaxHeight()const
 		{
+			auto lock( makeUniqueLock( m_glyphsMutex ) );
 			return uint32_t( m_maxSize->x );
 		}
 		/**
@@ -302,8 +288,9 @@ namespace castor
 		 *\brief		Récupère la hauteur maximale des glyphes
 		 *\return		La hauteur maximale des glyphes
 		 */
-		castor::Point2i getMaxRange()const noexcept
+		castor::Point2i getMaxRange()const
 		{
+			auto lock( makeUniqueLock( m_glyphsMutex ) );
 			return m_maxRange;
 		}
 		/**
@@ -314,8 +301,9 @@ namespace castor
 		 *\brief		Récupère la largeur maximale des glyphes
 		 *\return		La largeur maximale des glyphes
 		 */
-		uint32_t getMaxWidth()const noexcept
+		uint32_t getMaxWidth()const
 		{
+			auto lock( makeUniqueLock( m_glyphsMutex ) );
 			return uint32_t( m_maxSize->x );
 		}
 		/**
@@ -469,6 +457,17 @@ namespace castor
 		 *\return		Le glyphe.
 		 */
 		Glyph const & doLoadGlyph( char32_t c );
+		/**
+		 *\~english
+		 *\brief		Retrieves the glyph of wanted character, loading it if needed.
+		 *\param[in]	c	The character.
+		 *\return		The glyph.
+		 *\~french
+		 *\brief		Récupère la glyphe du caractère voulu, en la chargeant si nécessaire.
+		 *\param[in]	c	Le caractère.
+		 *\return		La glyphe.
+		 */
+		Glyph const & doGetGlyph( char32_t c );
 
 	private:
 		//!\~english	The height of the font.
@@ -480,6 +479,12 @@ namespace castor
 		//!\~english	The array of loaded glyphs.
 		//!\~french		Le tableau de glyphes chargées.
 		GlyphArray m_loadedGlyphs;
+		//!\~english	The index of each loaded glyph in m_loadedGlyphs.
+		//!\~french		L'index de chaque glyphe chargée dans m_loadedGlyphs.
+		std::unordered_map< char32_t, size_t > m_glyphIndices;
+		//!\~english	Protects the glyphs, which can be loaded from several threads.
+		//!\~french		Protège les glyphes, qui peuvent être chargées depuis plusieurs threads.
+		mutable std::mutex m_glyphsMutex;
 		//!\~english	The max size of the glyphs.
 		//!\~french		La dimension maximale des glyphes.
 		castor::Point2i m_maxSize;
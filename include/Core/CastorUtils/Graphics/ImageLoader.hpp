@@ -215,6 +215,11 @@ namespace castor
 			m_options.support = std::move( support );
 		}
 
+		void setTaskPool( TaskPool * pool )
+		{
+			m_options.pool = pool;
+		}
+
 		PxBufferConvertOptions const & getOptions()const
 		{
 			return m_options;
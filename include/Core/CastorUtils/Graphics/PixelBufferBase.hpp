@@ -34,6 +34,7 @@ namespace castor
 
 		PxCompressionSupport support;
 		void * additionalOptions{ nullptr };
+		TaskPool * pool{ nullptr };
 	};
 
 	class PxBufferBase
@@ -9,6 +9,7 @@ See LICENSE file in root folder
 #include "CastorUtils/Graphics/Size.hpp"
 
 #include "CastorUtils/Exception/Exception.hpp"
+#include "CastorUtils/Multithreading/MultithreadingModule.hpp"
 
 #include <algorithm>
 #include <numeric>
@@ -283,6 +284,7 @@ namespace castor
 	 *\param[in]	dstFormat		The destination format.
 	 *\param[in]	dstBuffer		The destination buffer.
 	 *\param[in]	dstSize			The destination size.
+	 *\param[in]	pool			If not null, big buffers are converted by rows chunks, in parallel.
 	 *\~french
 	 *\brief		Fonction de conversion sans templates.
 	 *\param[in]	srcDimensions	Les dimensions de la source.
@@ -293,6 +295,7 @@ namespace castor
 	 *\param[in]	dstFormat		Le format de la destination.
 	 *\param[in]	dstBuffer		Le buffer destination.
 	 *\param[in]	dstSize			La taille de la destination.
+	 *\param[in]	pool			Si non nul, les gros buffers sont convertis par blocs de lignes, en parallèle.
 	 */
 	CU_API void convertBuffer( Size const & srcDimensions
 		, Size const & dstDimensions
@@ -301,7 +304,8 @@ namespace castor
 		, uint32_t srcSize
 		, PixelFormat dstFormat
 		, uint8_t * dstBuffer
-		, uint32_t dstSize );
+		, uint32_t dstSize
+		, TaskPool * pool = nullptr );
 	/**
 	 *\~english
 	 *\brief		Function to perform convertion without templates.
@@ -312,6 +316,7 @@ namespace castor
 	 *\param[in]	dstFormat	The destination format.
 	 *\param[in]	dstBuffer	The destination buffer.
 	 *\param[in]	dstSize		The destination size.
+	 *\param[in]	pool		If not null, big buffers are converted by rows chunks, in parallel.
 	 *\~french
 	 *\brief		Fonction de conversion sans templates.
 	 *\param[in]	dimensions	Les dimensions de la source.
@@ -321,6 +326,7 @@ namespace castor
 	 *\param[in]	dstFormat	Le format de la destination.
 	 *\param[in]	dstBuffer	Le buffer destination.
 	 *\param[in]	dstSize		La taille de la destination.
+	 *\param[in]	pool		Si non nul, les gros buffers sont convertis par blocs de lignes, en parallèle.
 	 */
 	static inline void convertBuffer( Size const & dimensions
 		, PixelFormat srcFormat
@@ -328,7 +334,8 @@ namespace castor
 		, uint32_t srcSize
 		, PixelFormat dstFormat
 		, uint8_t * dstBuffer
-		, uint32_t dstSize )
+		, uint32_t dstSize
+		, TaskPool * pool = nullptr )
 	{
 		convertBuffer( dimensions
 			, dimensions
@@ -337,7 +344,8 @@ namespace castor
 			, srcSize
 			, dstFormat
 			, dstBuffer
-			, dstSize );
+			, dstSize
+			, pool );
 	}
 	/**
 	 *\~english
@@ -10,6 +10,7 @@ See LICENSE file in root folder
 #include "ELogType.hpp"
 
 #include <deque>
+#include <string_view>
 
 namespace castor
 {
@@ -29,11 +30,43 @@ namespace castor
 		std::string m_message;
 		//! Tells if the new line character is printed.
 		bool m_newLine;
+		//! The message time, in nanoseconds since system clock epoch.
+		int64_t m_time{};
 	};
 	//! The message queue.
 	using MessageQueue = std::deque< Message >;
 	/**
 	\~english
+	\brief		A log record, the text is formatted only when the record is written.
+	\~french
+	\brief		Un enregistrement de log, le texte n'est formaté qu'à l'écriture de l'enregistrement.
+	*/
+	struct LogRecord
+	{
+		//!\~english	The record time, in nanoseconds since system clock epoch.
+		//!\~french		L'heure de l'enregistrement, en nanosecondes depuis l'epoch de l'horloge système.
+		int64_t time;
+		//!\~english	The message type.
+		//!\~french		Le type de message.
+		LogType type;
+		//!\~english	Tells if the new line character is printed.
+		//!\~french		Dit si le caractère de nouvelle ligne est écrit.
+		bool newLine;
+		//!\~english	The message text, not owned.
+		//!\~french		Le texte du message, non possédé.
+		std::string_view text;
+	};
+	//! The log records, as given to the writer.
+	using LogRecordArray = std::vector< LogRecord >;
+	/**
+	\~english
+	\brief		Lock free ring buffer of log records.
+	\~french
+	\brief		Tampon circulaire sans verrou d'enregistrements de log.
+	*/
+	class LogRecordBuffer;
+	/**
+	\~english
 	\brief		Log management class
 	\remarks	Implements log facilities. Create a Log with a filename, then write logs into that file
 	\~french
@@ -0,0 +1,225 @@
+/*
+See LICENSE file in root folder
+*/
+#ifndef ___CU_LogRecordBuffer_HPP___
+#define ___CU_LogRecordBuffer_HPP___
+
+#include "CastorUtils/Log/LogModule.hpp"
+
+#include "CastorUtils/Config/BeginExternHeaderGuard.hpp"
+#include <atomic>
+#include <cstring>
+#include <memory>
+#include <string_view>
+#include "CastorUtils/Config/EndExternHeaderGuard.hpp"
+
+namespace castor
+{
+	/**
+	\~english
+	\brief		Lock free single producer, single consumer ring buffer of binary log records.
+	\remarks	The producer never blocks, a record that doesn't fit is dropped and counted.
+	\n			The records are 16 bytes aligned, a record that would cross the buffer end is preceded by a padding record.
+	\~french
+	\brief		Tampon circulaire sans verrou, à un seul producteur et un seul consommateur, d'enregistrements de log binaires.
+	\remarks	Le producteur ne bloque jamais, un enregistrement qui ne rentre pas est abandonné et compté.
+	\n			Les enregistrements sont alignés sur 16 octets, un enregistrement qui dépasserait la fin du tampon est précédé d'un enregistrement de remplissage.
+	*/
+	class LogRecordBuffer
+	{
+	private:
+		struct Header
+		{
+			uint32_t size;
+			LogType type;
+			uint8_t newLine;
+			uint8_t padding;
+			uint8_t reserved;
+			int64_t time;
+		};
+		static_assert( sizeof( Header ) == 16u );
+		static size_t constexpr Alignment = sizeof( Header );
+
+		static size_t align( size_t size )noexcept
+		{
+			return ( size + Alignment - 1u ) & ~( Alignment - 1u );
+		}
+
+	public:
+		/**
+		 *\~english
+		 *\brief		Constructor.
+		 *\param[in]	capacity	The buffer size, in bytes, rounded up to a power of two.
+		 *\~french
+		 *\brief		Constructeur.
+		 *\param[in]	capacity	La taille du tampon, en octets, arrondie à la puissance de deux supérieure.
+		 */
+		explicit LogRecordBuffer( size_t capacity )
+			: m_capacity{ doGetCapacity( capacity ) }
+			, m_data{ std::make_unique< uint8_t[] >( m_capacity ) }
+		{
+		}
+		/**
+		 *\~english
+		 *\return		\p true if a record of given text size can be pushed into an empty buffer.
+		 *\~french
+		 *\return		\p true si un enregistrement de la taille de texte donnée peut être mis dans un tampon vide.
+		 */
+		bool fits( size_t textSize )const noexcept
+		{
+			return align( sizeof( Header ) + textSize ) <= m_capacity / 2u;
+		}
+		/**
+		 *\~english
+		 *\brief		Pushes a record, called by the producer thread only.
+		 *\return		\p false if the record was dropped, because the buffer is full.
+		 *\~french
+		 *\brief		Ajoute un enregistrement, appelé par le thread producteur uniquement.
+		 *\return		\p false si l'enregistrement a été abandonné, parce que le tampon est plein.
+		 */
+		bool push( LogRecord const & record )noexcept
+		{
+			auto recordSize = align( sizeof( Header ) + record.text.size() );
+			auto head = m_head.load( std::memory_order_relaxed );
+			auto tail = m_tail.load( std::memory_order_acquire );
+			auto offset = size_t( head & ( m_capacity - 1u ) );
+			auto contiguous = m_capacity - offset;
+			auto required = recordSize <= contiguous
+				? recordSize
+				: contiguous + recordSize;
+
+			if ( !fits( record.text.size() )
+				|| m_capacity - size_t( head - tail ) < required )
+			{
+				m_dropped.fetch_add( 1u, std::memory_order_relaxed );
+				return false;
+			}
+
+			if ( recordSize > contiguous )
+			{
+				doWriteHeader( offset, Header{ uint32_t( contiguous - sizeof( Header ) ), LogType::eCount, 0u, 1u, 0u, 0 } );
+				offset = 0u;
+			}
+
+			doWriteHeader( offset, Header{ uint32_t( record.text.size() )
+				, record.type
+				, uint8_t( record.newLine ? 1u : 0u )
+				, 0u
+				, 0u
+				, record.time } );
+			std::memcpy( m_data.get() + offset + sizeof( Header ), record.text.data(), record.text.size() );
+			m_head.store( head + required, std::memory_order_release );
+			return true;
+		}
+		/**
+		 *\~english
+		 *\brief		Reads the available records, called by the consumer thread only.
+		 *\remarks		The records text remains valid until release() is called.
+		 *\param[in]	function	Receives each record.
+		 *\return		The position to give to release().
+		 *\~french
+		 *\brief		Lit les enregistrements disponibles, appelé par le thread consommateur uniquement.
+		 *\remarks		Le texte des enregistrements reste valide jusqu'à l'appel à release().
+		 *\param[in]	function	Reçoit chaque enregistrement.
+		 *\return		La position à donner à release().
+		 */
+		template< typename FuncT >
+		uint64_t read( FuncT function )const
+		{
+			auto tail = m_tail.load( std::memory_order_relaxed );
+			auto head = m_head.load( std::memory_order_acquire );
+
+			while ( tail != head )
+			{
+				auto offset = size_t( tail & ( m_capacity - 1u ) );
+				Header header;
+				std::memcpy( &header, m_data.get() + offset, sizeof( Header ) );
+
+				if ( !header.padding )
+				{
+					function( LogRecord{ header.time
+						, header.type
+						, header.newLine != 0u
+						, std::string_view{ reinterpret_cast< char const * >( m_data.get() + offset + sizeof( Header ) ), header.size } } );
+				}
+
+				tail += align( sizeof( Header ) + header.size );
+			}
+
+			return head;
+		}
+		/**
+		 *\~english
+		 *\brief		Gives the memory of the records read by read() back to the producer.
+		 *\~french
+		 *\brief		Rend au producteur la mémoire des enregistrements lus par read().
+		 */
+		void release( uint64_t position )noexcept
+		{
+			m_tail.store( position, std::memory_order_release );
+		}
+		/**
+		 *\~english
+		 *\return		\p true if the buffer is more than half full.
+		 *\~french
+		 *\return		\p true si le tampon est rempli à plus de moitié.
+		 */
+		bool isHalfFull()const noexcept
+		{
+			return size_t( m_head.load( std::memory_order_relaxed ) - m_tail.load( std::memory_order_relaxed ) ) > m_capacity / 2u;
+		}
+		/**
+		 *\~english
+		 *\return		\p true if there is no record to read.
+		 *\~french
+		 *\return		\p true s'il n'y a aucun enregistrement à lire.
+		 */
+		bool isEmpty()const noexcept
+		{
+			return m_head.load( std::memory_order_acquire ) == m_tail.load( std::memory_order_relaxed );
+		}
+		/**
+		 *\~english
+		 *\return		The dropped records count, and resets it.
+		 *\~french
+		 *\return		Le nombre d'enregistrements abandonnés, et le remet à zéro.
+		 */
+		uint64_t exchangeDropped()noexcept
+		{
+			return m_dropped.exchange( 0u, std::memory_order_relaxed );
+		}
+
+		size_t getCapacity()const noexcept
+		{
+			return m_capacity;
+		}
+
+	private:
+		static size_t doGetCapacity( size_t capacity )noexcept
+		{
+			size_t result = Alignment * 4u;
+
+			while ( result < capacity )
+			{
+				result <<= 1u;
+			}
+
+			return result;
+		}
+
+		void doWriteHeader( size_t offset
+			, Header const & header )noexcept
+		{
+			std::memcpy( m_data.get() + offset, &header, sizeof( Header ) );
+		}
+
+	private:
+		size_t m_capacity;
+		std::unique_ptr< uint8_t[] > m_data;
+		alignas( 64 ) std::atomic< uint64_t > m_head{};
+		alignas( 64 ) std::atomic< uint64_t > m_tail{};
+		std::atomic< uint64_t > m_dropped{};
+	};
+}
+
+#endif
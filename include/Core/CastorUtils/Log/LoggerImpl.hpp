@@ -9,6 +9,7 @@ See LICENSE file in root folder
 #include "CastorUtils/Miscellaneous/StringUtils.hpp"
 
 #include "CastorUtils/Config/BeginExternHeaderGuard.hpp"
+#include <cstdio>
 #include <mutex>
 #include "CastorUtils/Config/EndExternHeaderGuard.hpp"
 
@@ -24,6 +25,7 @@ namespace castor
 		LoggerImpl & operator=( LoggerImpl const & ) = delete;
 		CU_API LoggerImpl( LoggerImpl && rhs );
 		CU_API LoggerImpl & operator=( LoggerImpl && rhs );
+		CU_API ~LoggerImpl()noexcept;
 		/**
 		 *\~english
 		 *\brief		Constructor
@@ -92,13 +94,13 @@ namespace castor
 		CU_API void printMessage( LogType logLevel, std::wstring const & message, bool newLine );
 		/**
 		 *\~english
-		 *\brief		Logs a message queue
-		 *\param[in]	queue	The message queue
+		 *\brief		Formats and writes log records, with one write per log file.
+		 *\param[in]	records	The records, sorted by time.
 		 *\~french
-		 *\brief		Logge une file de messages
-		 *\param[in]	queue	La file de messages
+		 *\brief		Formate et écrit des enregistrements de log, avec une écriture par fichier de log.
+		 *\param[in]	records	Les enregistrements, triés par date.
 		 */
-		CU_API void logMessageQueue( MessageQueue const & queue );
+		CU_API void logRecords( LogRecordArray const & records );
 
 	private:
 		/**
@@ -129,26 +131,42 @@ namespace castor
 		void doPrintLine( String const & line, LogType logLevel, bool newLine );
 		/**
 		 *\~english
-		 *\brief		Logs a line in the given stream
+		 *\brief		Logs a line in the given buffer
 		 *\param[in]	timestamp	The line timestamp
 		 *\param[in]	line		The line
-		 *\param[in]	stream		The stream
+		 *\param[in]	buffer		The buffer
 		 *\param[in]	logLevel	The log level
 		 *\param[in]	newLine		Tells if the new line character must be added
 		 *\~french
-		 *\brief		Affiche une ligne de texte dans le flux donné
+		 *\brief		Affiche une ligne de texte dans le tampon donné
 		 *\param[in]	timestamp	Le timestamp de la ligne
 		 *\param[in]	line		La ligne de texte
-		 *\param[in]	stream		Le flux
+		 *\param[in]	buffer		Le tampon
 		 *\param[in]	logLevel	Le niveau de log
 		 *\param[in]	newLine		Dit si le caractère de nouvelle ligne doit être ajouté
 		 */
-		void doLogLine( String const & timestamp, String const & line, StringStream & stream, LogType logLevel, bool newLine );
+		void doLogLine( String const & timestamp, std::string_view line, std::string & buffer, LogType logLevel, bool newLine );
+		/**
+		 *\~english
+		 *\return		The timestamp for given time, formatted once per second.
+		 *\~french
+		 *\return		Le timestamp pour l'heure donnée, formaté une fois par seconde.
+		 */
+		String const & doGetTimeStamp( int64_t time );
+		void doCloseFiles();
 
 	private:
 		LoggerInstance & m_parent;
 		ProgramConsole * m_console;
 		std::array< String, size_t( LogType::eCount ) > m_logFilePath;
+		//!\~english	For each log level, the first level sharing its file, the file handles and output buffers are indexed by it.
+		//!\~french		Pour chaque niveau de log, le premier niveau partageant son fichier, les fichiers et tampons de sortie sont indexés par lui.
+		std::array< size_t, size_t( LogType::eCount ) > m_fileIndex{ 0u, 1u, 2u, 3u, 4u };
+		std::array< FILE *, size_t( LogType::eCount ) > m_files{};
+		std::array< std::string, size_t( LogType::eCount ) > m_buffers;
+		int64_t m_timeStampSecond{ -1 };
+		String m_timeStamp;
+		String m_line;
 		std::mutex m_mutexFiles;
 		LoggerCallbackMap m_mapCallbacks;
 		std::mutex m_mutexCallbacks;
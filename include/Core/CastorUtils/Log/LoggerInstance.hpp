@@ -10,6 +10,8 @@ See LICENSE file in root folder
 
 #include "CastorUtils/Config/BeginExternHeaderGuard.hpp"
 #include <atomic>
+#include <condition_variable>
+#include <memory>
 #include <mutex>
 #include <thread>
 #include "CastorUtils/Config/EndExternHeaderGuard.hpp"
@@ -21,6 +23,9 @@ namespace castor
 	public:
 		using my_string = std::string;
 		using my_ostream = std::ostream;
+		//!\~english	The size of each thread's record buffer.
+		//!\~french		La taille du tampon d'enregistrements de chaque thread.
+		static size_t constexpr ThreadBufferSize = 128u * 1024u;
 
 		LoggerInstance( LoggerInstance const & ) = delete;
 		LoggerInstance & operator=( LoggerInstance const & ) = delete;
@@ -351,12 +356,14 @@ namespace castor
 		CU_API void logErrorNoLF( my_ostream const & msg );
 		/**
 		 *\~english
-		 *\brief		Pushes a message into the queue.
+		 *\brief		Pushes a message into the calling thread's record buffer.
+		 *\remarks		Never blocks on the writer, if the buffer is full the message is dropped and counted.
 		 *\param[in]	type	The message type.
 		 *\param[in]	message	The message.
 		 *\param[in]	addLF	Whether or not add a LF at the end.
 		 *\~french
-		 *\brief		Met un message dans la file.
+		 *\brief		Met un message dans le tampon d'enregistrements du thread appelant.
+		 *\remarks		Ne bloque jamais sur l'écrivain, si le tampon est plein le message est abandonné et compté.
 		 *\param[in]	type	Le type de message.
 		 *\param[in]	message	Le message.
 		 *\param[in]	addLF	Dit si on ajoute un LF à la fin..
@@ -364,37 +371,74 @@ namespace castor
 		CU_API void pushMessage( LogType type
 			, std::string const & message
 			, bool addLF = true );
-
+		/**
+		 *\~english
+		 *\brief		Writes the pending records of all threads.
+		 *\~french
+		 *\brief		Ecrit les enregistrements en attente de tous les threads.
+		 */
 		CU_API void flushQueue();
+		/**
+		 *\~english
+		 *\return		The messages dropped since the logger creation, because their thread's buffer was full.
+		 *\~french
+		 *\return		Les messages abandonnés depuis la création du logger, parce que le tampon de leur thread était plein.
+		 */
+		uint64_t getDroppedCount()const noexcept
+		{
+			return m_dropped.load( std::memory_order_relaxed );
+		}
 
-		String getHeader( uint8_t index )const
+		String const & getHeader( uint8_t index )const
 		{
 			return m_headers[index];
 		}
 
 		void lock()const
 		{
-			m_mutexQueue.lock();
+			m_mutexStream.lock();
 		}
 
 		void unlock()const
 		{
-			m_mutexQueue.unlock();
+			m_mutexStream.unlock();
 		}
 
 	private:
+		using LogRecordBufferPtr = std::shared_ptr< LogRecordBuffer >;
+
 		void doInitialiseThread();
 		void doCleanupThread();
-		void doLockedPushMessage( LogType type
+		void doPushMessage( LogType type
 			, std::string const & message
 			, bool addLF = true );
+		LogRecordBuffer & doGetThreadBuffer();
 
 	private:
+		uint64_t m_id;
 		LogType m_logLevel;
 		LoggerImpl m_impl;
 		std::array< String, size_t( LogType::eCount ) > m_headers;
-		MessageQueue m_queue;
-		mutable std::mutex m_mutexQueue;
+		//!\~english	The threads record buffers, released when their thread ends.
+		//!\~french		Les tampons d'enregistrements des threads, libérés quand leur thread se termine.
+		std::vector< LogRecordBufferPtr > m_buffers;
+		std::mutex m_mutexBuffers;
+		//!\~english	The messages too big for a record buffer.
+		//!\~french		Les messages trop gros pour un tampon d'enregistrements.
+		MessageQueue m_overflow;
+		std::mutex m_mutexOverflow;
+		//!\~english	Protects the streams shared buffer, see LoggerStreambufT.
+		//!\~french		Protège le tampon partagé des flux, voir LoggerStreambufT.
+		mutable std::mutex m_mutexStream;
+		//!\~english	Makes flushQueue() the only consumer of the record buffers.
+		//!\~french		Fait de flushQueue() le seul consommateur des tampons d'enregistrements.
+		std::mutex m_mutexFlush;
+		std::mutex m_mutexPrint;
+		LogRecordArray m_records;
+		std::atomic_uint64_t m_dropped{};
+		std::mutex m_mutexWake;
+		std::condition_variable m_wake;
+		std::atomic_bool m_wakeRequested{ false };
 		std::thread m_logThread;
 		std::atomic_bool m_initialised{ false };
 		std::atomic_bool m_stopped{ false };
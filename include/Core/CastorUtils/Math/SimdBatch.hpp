@@ -0,0 +1,152 @@
+/*
+See LICENSE file in root folder
+*/
+#ifndef ___CU_SimdBatch_H___
+#define ___CU_SimdBatch_H___
+
+#include "CastorUtils/Math/Quaternion.hpp"
+#include "CastorUtils/Math/SquareMatrix.hpp"
+
+namespace castor::simd
+{
+	/**
+	\~english
+	\brief		Batched float matrices, points and quaternions operations, using the SIMD kernels.
+	\remarks	The results may be the inputs.
+	\~french
+	\brief		Opérations par lots sur des matrices, points et quaternions flottants, utilisant les noyaux SIMD.
+	\remarks	Les résultats peuvent être les entrées.
+	*/
+	/**
+	 *\~english
+	 *\brief		Multiplies a matrix by an array of matrices.
+	 *\param[in]	lhs		The left hand side operand.
+	 *\param[in]	rhs		The right hand side operands.
+	 *\param[out]	result	Receives lhs * rhs[i].
+	 *\param[in]	count	The matrices count.
+	 *\~french
+	 *\brief		Multiplie une matrice par un tableau de matrices.
+	 *\param[in]	lhs		L'opérande de gauche.
+	 *\param[in]	rhs		Les opérandes de droite.
+	 *\param[out]	result	Reçoit lhs * rhs[i].
+	 *\param[in]	count	Le nombre de matrices.
+	 */
+	CU_API void multiply( Matrix4x4f const & lhs
+		, Matrix4x4f const * rhs
+		, Matrix4x4f * result
+		, size_t count );
+	/**
+	 *\~english
+	 *\brief		Multiplies two arrays of matrices, pairwise.
+	 *\param[in]	lhs		The left hand side operands.
+	 *\param[in]	rhs		The right hand side operands.
+	 *\param[out]	result	Receives lhs[i] * rhs[i].
+	 *\param[in]	count	The matrices count.
+	 *\~french
+	 *\brief		Multiplie deux tableaux de matrices, deux à deux.
+	 *\param[in]	lhs		Les opérandes de gauche.
+	 *\param[in]	rhs		Les opérandes de droite.
+	 *\param[out]	result	Reçoit lhs[i] * rhs[i].
+	 *\param[in]	count	Le nombre de matrices.
+	 */
+	CU_API void multiply( Matrix4x4f const * lhs
+		, Matrix4x4f const * rhs
+		, Matrix4x4f * result
+		, size_t count );
+	/**
+	 *\~english
+	 *\brief		Inverts an array of matrices.
+	 *\param[in]	input	The matrices.
+	 *\param[out]	result	Receives the inverse matrices.
+	 *\param[in]	count	The matrices count.
+	 *\~french
+	 *\brief		Inverse un tableau de matrices.
+	 *\param[in]	input	Les matrices.
+	 *\param[out]	result	Reçoit les matrices inverses.
+	 *\param[in]	count	Le nombre de matrices.
+	 */
+	CU_API void invert( Matrix4x4f const * input
+		, Matrix4x4f * result
+		, size_t count );
+	/**
+	 *\~english
+	 *\brief		Transforms an array of points, as matrix * point does.
+	 *\param[in]	matrix	The transformation matrix.
+	 *\param[in]	input	The points.
+	 *\param[out]	result	Receives the transformed points.
+	 *\param[in]	count	The points count.
+	 *\~french
+	 *\brief		Transforme un tableau de points, comme le fait matrix * point.
+	 *\param[in]	matrix	La matrice de transformation.
+	 *\param[in]	input	Les points.
+	 *\param[out]	result	Reçoit les points transformés.
+	 *\param[in]	count	Le nombre de points.
+	 */
+	CU_API void transform( Matrix4x4f const & matrix
+		, Point3f const * input
+		, Point3f * result
+		, size_t count );
+	/**
+	 *\copydoc	castor::simd::transform( Matrix4x4f const &, Point3f const *, Point3f *, size_t )
+	 */
+	CU_API void transform( Matrix4x4f const & matrix
+		, Point4f const * input
+		, Point4f * result
+		, size_t count );
+	/**
+	 *\~english
+	 *\brief		Multiplies two arrays of quaternions, pairwise.
+	 *\param[in]	lhs		The left hand side operands.
+	 *\param[in]	rhs		The right hand side operands.
+	 *\param[out]	result	Receives lhs[i] * rhs[i].
+	 *\param[in]	count	The quaternions count.
+	 *\~french
+	 *\brief		Multiplie deux tableaux de quaternions, deux à deux.
+	 *\param[in]	lhs		Les opérandes de gauche.
+	 *\param[in]	rhs		Les opérandes de droite.
+	 *\param[out]	result	Reçoit lhs[i] * rhs[i].
+	 *\param[in]	count	Le nombre de quaternions.
+	 */
+	CU_API void multiply( Quaternion const * lhs
+		, Quaternion const * rhs
+		, Quaternion * result
+		, size_t count );
+	/**
+	 *\~english
+	 *\brief		Spherical linear interpolation between two arrays of quaternions, pairwise.
+	 *\param[in]	lhs		The source quaternions.
+	 *\param[in]	rhs		The destination quaternions.
+	 *\param[in]	factor	The interpolation factor.
+	 *\param[out]	result	Receives lhs[i].slerp( rhs[i], factor ).
+	 *\param[in]	count	The quaternions count.
+	 *\~french
+	 *\brief		Interpolation linéaire sphérique entre deux tableaux de quaternions, deux à deux.
+	 *\param[in]	lhs		Les quaternions source.
+	 *\param[in]	rhs		Les quaternions destination.
+	 *\param[in]	factor	Le facteur d'interpolation.
+	 *\param[out]	result	Reçoit lhs[i].slerp( rhs[i], factor ).
+	 *\param[in]	count	Le nombre de quaternions.
+	 */
+	CU_API void slerp( Quaternion const * lhs
+		, Quaternion const * rhs
+		, float factor
+		, Quaternion * result
+		, size_t count );
+	/**
+	 *\~english
+	 *\brief		Builds the rotation matrices matching an array of quaternions.
+	 *\param[in]	input	The quaternions.
+	 *\param[out]	result	Receives the rotation matrices.
+	 *\param[in]	count	The quaternions count.
+	 *\~french
+	 *\brief		Construit les matrices de rotation correspondant à un tableau de quaternions.
+	 *\param[in]	input	Les quaternions.
+	 *\param[out]	result	Reçoit les matrices de rotation.
+	 *\param[in]	count	Le nombre de quaternions.
+	 */
+	CU_API void toMatrix( Quaternion const * input
+		, Matrix4x4f * result
+		, size_t count );
+}
+
+#endif
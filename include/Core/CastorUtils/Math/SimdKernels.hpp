@@ -0,0 +1,160 @@
+/*
+See LICENSE file in root folder
+*/
+#ifndef ___CU_SimdKernels_H___
+#define ___CU_SimdKernels_H___
+
+#include "CastorUtils/Math/Simd.hpp"
+
+#include "CastorUtils/Config/BeginExternHeaderGuard.hpp"
+#if CU_UseAVX
+#	include <immintrin.h>
+#elif CU_UseSSE2
+#	include <xmmintrin.h>
+#elif CU_UseNEON
+#	include <arm_neon.h>
+#endif
+#include <cmath>
+#include "CastorUtils/Config/EndExternHeaderGuard.hpp"
+
+namespace castor::simd
+{
+	/**
+	\~english
+	\brief		Low level float kernels, working on raw unaligned memory.
+	\remarks	Matrices are 4x4, column major, stored as 16 contiguous floats.
+				<br />Quaternions are stored as x, y, z, w.
+				<br />The operations are done in the same order as the scalar templates, lane by lane.
+				<br />The results may alias the inputs.
+	\~french
+	\brief		Noyaux flottants bas niveau, travaillant sur de la mémoire brute non alignée.
+	\remarks	Les matrices sont 4x4, en colonnes d'abord, stockées sous la forme de 16 flottants contigus.
+				<br />Les quaternions sont stockés sous la forme x, y, z, w.
+				<br />Les opérations sont effectuées dans le même ordre que les templates scalaires, composante par composante.
+				<br />Les résultats peuvent être les mêmes zones mémoire que les entrées.
+	*/
+	/**
+	 *\~english
+	 *\brief		Multiplies two 4x4 matrices.
+	 *\param[in]	lhs, rhs	The operands.
+	 *\param[out]	result		Receives lhs * rhs.
+	 *\~french
+	 *\brief		Multiplie deux matrices 4x4.
+	 *\param[in]	lhs, rhs	Les opérandes.
+	 *\param[out]	result		Reçoit lhs * rhs.
+	 */
+	inline void mulMtx4( float const * lhs
+		, float const * rhs
+		, float * result );
+	/**
+	 *\~english
+	 *\brief		Inverts a 4x4 matrix.
+	 *\param[in]	input	The matrix.
+	 *\param[out]	result	Receives the inverse matrix.
+	 *\~french
+	 *\brief		Inverse une matrice 4x4.
+	 *\param[in]	input	La matrice.
+	 *\param[out]	result	Reçoit la matrice inverse.
+	 */
+	inline void invertMtx4( float const * input
+		, float * result );
+	/**
+	 *\~english
+	 *\brief		Transforms 3 components points, the fourth component being considered as 1, and ignored in the result.
+	 *\param[in]	matrix	The transformation matrix.
+	 *\param[in]	input	The points, 3 contiguous floats each.
+	 *\param[out]	result	Receives the transformed points.
+	 *\param[in]	count	The points count.
+	 *\~french
+	 *\brief		Transforme des points à 3 composantes, la quatrième composante étant considérée à 1, et ignorée dans le résultat.
+	 *\param[in]	matrix	La matrice de transformation.
+	 *\param[in]	input	Les points, 3 flottants contigus chacun.
+	 *\param[out]	result	Reçoit les points transformés.
+	 *\param[in]	count	Le nombre de points.
+	 */
+	inline void transformPoints3( float const * matrix
+		, float const * input
+		, float * result
+		, size_t count );
+	/**
+	 *\~english
+	 *\brief		Transforms 3 components points, the fourth component being considered as 1, and divides the result by its fourth component.
+	 *\param[in]	matrix	The transformation matrix.
+	 *\param[in]	input	The points, 3 contiguous floats each.
+	 *\param[out]	result	Receives the transformed points.
+	 *\param[in]	count	The points count.
+	 *\~french
+	 *\brief		Transforme des points à 3 composantes, la quatrième composante étant considérée à 1, et divise le résultat par sa quatrième composante.
+	 *\param[in]	matrix	La matrice de transformation.
+	 *\param[in]	input	Les points, 3 flottants contigus chacun.
+	 *\param[out]	result	Reçoit les points transformés.
+	 *\param[in]	count	Le nombre de points.
+	 */
+	inline void projectPoints3( float const * matrix
+		, float const * input
+		, float * result
+		, size_t count );
+	/**
+	 *\~english
+	 *\brief		Transforms 4 components points.
+	 *\param[in]	matrix	The transformation matrix.
+	 *\param[in]	input	The points, 4 contiguous floats each.
+	 *\param[out]	result	Receives the transformed points.
+	 *\param[in]	count	The points count.
+	 *\~french
+	 *\brief		Transforme des points à 4 composantes.
+	 *\param[in]	matrix	La matrice de transformation.
+	 *\param[in]	input	Les points, 4 flottants contigus chacun.
+	 *\param[out]	result	Reçoit les points transformés.
+	 *\param[in]	count	Le nombre de points.
+	 */
+	inline void transformPoints4( float const * matrix
+		, float const * input
+		, float * result
+		, size_t count );
+	/**
+	 *\~english
+	 *\brief		Multiplies two quaternions, and normalises the result.
+	 *\param[in]	lhs, rhs	The operands.
+	 *\param[out]	result		Receives lhs * rhs.
+	 *\~french
+	 *\brief		Multiplie deux quaternions, et normalise le résultat.
+	 *\param[in]	lhs, rhs	Les opérandes.
+	 *\param[out]	result		Reçoit lhs * rhs.
+	 */
+	inline void mulQuat( float const * lhs
+		, float const * rhs
+		, float * result );
+	/**
+	 *\~english
+	 *\brief		Spherical linear interpolation between two quaternions.
+	 *\param[in]	lhs, rhs	The quaternions.
+	 *\param[in]	factor		The interpolation factor.
+	 *\param[out]	result		Receives the interpolated quaternion.
+	 *\~french
+	 *\brief		Interpolation linéaire sphérique entre deux quaternions.
+	 *\param[in]	lhs, rhs	Les quaternions.
+	 *\param[in]	factor		Le facteur d'interpolation.
+	 *\param[out]	result		Reçoit le quaternion interpolé.
+	 */
+	inline void slerpQuat( float const * lhs
+		, float const * rhs
+		, float factor
+		, float * result );
+	/**
+	 *\~english
+	 *\brief		Builds the rotation matrix matching a quaternion.
+	 *\param[in]	input	The quaternion.
+	 *\param[out]	result	Receives the rotation matrix.
+	 *\~french
+	 *\brief		Construit la matrice de rotation correspondant à un quaternion.
+	 *\param[in]	input	Le quaternion.
+	 *\param[out]	result	Reçoit la matrice de rotation.
+	 */
+	inline void quatToMtx4( float const * input
+		, float * result );
+}
+
+#include "SimdKernels.inl"
+
+#endif
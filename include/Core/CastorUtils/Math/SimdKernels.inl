@@ -0,0 +1,537 @@
+namespace castor::simd
+{
+	namespace details
+	{
+		//*****************************************************************************************
+
+#if CU_UseSSE2
+
+		using Vec4 = __m128;
+
+		inline Vec4 load( float const * src )
+		{
+			return _mm_loadu_ps( src );
+		}
+
+		inline void store( float * dst, Vec4 value )
+		{
+			_mm_storeu_ps( dst, value );
+		}
+
+		inline void store3( float * dst, Vec4 value )
+		{
+			_mm_storel_pi( reinterpret_cast< __m64 * >( dst ), value );
+			_mm_store_ss( dst + 2u, _mm_movehl_ps( value, value ) );
+		}
+
+		inline Vec4 splat( float value )
+		{
+			return _mm_set1_ps( value );
+		}
+
+		inline Vec4 set( float x, float y, float z, float w )
+		{
+			return _mm_setr_ps( x, y, z, w );
+		}
+
+		inline Vec4 add( Vec4 lhs, Vec4 rhs )
+		{
+			return _mm_add_ps( lhs, rhs );
+		}
+
+		inline Vec4 sub( Vec4 lhs, Vec4 rhs )
+		{
+			return _mm_sub_ps( lhs, rhs );
+		}
+
+		inline Vec4 mul( Vec4 lhs, Vec4 rhs )
+		{
+			return _mm_mul_ps( lhs, rhs );
+		}
+
+		inline Vec4 div( Vec4 lhs, Vec4 rhs )
+		{
+			return _mm_div_ps( lhs, rhs );
+		}
+
+		/**
+		 *\return	( lhs[X], lhs[Y], rhs[Z], rhs[W] ).
+		 */
+		template< int X, int Y, int Z, int W >
+		inline Vec4 shuffle( Vec4 lhs, Vec4 rhs )
+		{
+			return _mm_shuffle_ps( lhs, rhs, _MM_SHUFFLE( W, Z, Y, X ) );
+		}
+
+		template< int I >
+		inline float lane( Vec4 value )
+		{
+			return _mm_cvtss_f32( _mm_shuffle_ps( value, value, _MM_SHUFFLE( I, I, I, I ) ) );
+		}
+
+#elif CU_UseNEON
+
+		using Vec4 = float32x4_t;
+
+		inline Vec4 load( float const * src )
+		{
+			return vld1q_f32( src );
+		}
+
+		inline void store( float * dst, Vec4 value )
+		{
+			vst1q_f32( dst, value );
+		}
+
+		inline void store3( float * dst, Vec4 value )
+		{
+			vst1_f32( dst, vget_low_f32( value ) );
+			dst[2] = vgetq_lane_f32( value, 2 );
+		}
+
+		inline Vec4 splat( float value )
+		{
+			return vdupq_n_f32( value );
+		}
+
+		inline Vec4 set( float x, float y, float z, float w )
+		{
+			float const values[4]{ x, y, z, w };
+			return vld1q_f32( values );
+		}
+
+		inline Vec4 add( Vec4 lhs, Vec4 rhs )
+		{
+			return vaddq_f32( lhs, rhs );
+		}
+
+		inline Vec4 sub( Vec4 lhs, Vec4 rhs )
+		{
+			return vsubq_f32( lhs, rhs );
+		}
+
+		inline Vec4 mul( Vec4 lhs, Vec4 rhs )
+		{
+			return vmulq_f32( lhs, rhs );
+		}
+
+		inline Vec4 div( Vec4 lhs, Vec4 rhs )
+		{
+			return vdivq_f32( lhs, rhs );
+		}
+
+		template< int X, int Y, int Z, int W >
+		inline Vec4 shuffle( Vec4 lhs, Vec4 rhs )
+		{
+			return set( vgetq_lane_f32( lhs, X )
+				, vgetq_lane_f32( lhs, Y )
+				, vgetq_lane_f32( rhs, Z )
+				, vgetq_lane_f32( rhs, W ) );
+		}
+
+		template< int I >
+		inline float lane( Vec4 value )
+		{
+			return vgetq_lane_f32( value, I );
+		}
+
+#else
+
+		struct Vec4
+		{
+			float v[4];
+		};
+
+		inline Vec4 load( float const * src )
+		{
+			return Vec4{ { src[0], src[1], src[2], src[3] } };
+		}
+
+		inline void store( float * dst, Vec4 value )
+		{
+			dst[0] = value.v[0];
+			dst[1] = value.v[1];
+			dst[2] = value.v[2];
+			dst[3] = value.v[3];
+		}
+
+		inline void store3( float * dst, Vec4 value )
+		{
+			dst[0] = value.v[0];
+			dst[1] = value.v[1];
+			dst[2] = value.v[2];
+		}
+
+		inline Vec4 splat( float value )
+		{
+			return Vec4{ { value, value, value, value } };
+		}
+
+		inline Vec4 set( float x, float y, float z, float w )
+		{
+			return Vec4{ { x, y, z, w } };
+		}
+
+		inline Vec4 add( Vec4 lhs, Vec4 rhs )
+		{
+			return Vec4{ { lhs.v[0] + rhs.v[0], lhs.v[1] + rhs.v[1], lhs.v[2] + rhs.v[2], lhs.v[3] + rhs.v[3] } };
+		}
+
+		inline Vec4 sub( Vec4 lhs, Vec4 rhs )
+		{
+			return Vec4{ { lhs.v[0] - rhs.v[0], lhs.v[1] - rhs.v[1], lhs.v[2] - rhs.v[2], lhs.v[3] - rhs.v[3] } };
+		}
+
+		inline Vec4 mul( Vec4 lhs, Vec4 rhs )
+		{
+			return Vec4{ { lhs.v[0] * rhs.v[0], lhs.v[1] * rhs.v[1], lhs.v[2] * rhs.v[2], lhs.v[3] * rhs.v[3] } };
+		}
+
+		inline Vec4 div( Vec4 lhs, Vec4 rhs )
+		{
+			return Vec4{ { lhs.v[0] / rhs.v[0], lhs.v[1] / rhs.v[1], lhs.v[2] / rhs.v[2], lhs.v[3] / rhs.v[3] } };
+		}
+
+		template< int X, int Y, int Z, int W >
+		inline Vec4 shuffle( Vec4 lhs, Vec4 rhs )
+		{
+			return Vec4{ { lhs.v[X], lhs.v[Y], rhs.v[Z], rhs.v[W] } };
+		}
+
+		template< int I >
+		inline float lane( Vec4 value )
+		{
+			return value.v[I];
+		}
+
+#endif
+
+		//*****************************************************************************************
+
+		template< int X, int Y, int Z, int W >
+		inline Vec4 swizzle( Vec4 value )
+		{
+			return shuffle< X, Y, Z, W >( value, value );
+		}
+
+		template< int I >
+		inline Vec4 broadcast( Vec4 value )
+		{
+			return swizzle< I, I, I, I >( value );
+		}
+
+		/**
+		 *\return	( ( c0 * x + c1 * y ) + c2 * z ) + c3 * w, the scalar templates order.
+		 */
+		inline Vec4 combine( Vec4 const ( & columns )[4]
+			, Vec4 x
+			, Vec4 y
+			, Vec4 z
+			, Vec4 w )
+		{
+			return add( add( add( mul( columns[0], x )
+						, mul( columns[1], y ) )
+					, mul( columns[2], z ) )
+				, mul( columns[3], w ) );
+		}
+
+		inline Vec4 transformPoint3( Vec4 const ( & columns )[4]
+			, float const * point )
+		{
+			return add( add( add( mul( columns[0], splat( point[0] ) )
+						, mul( columns[1], splat( point[1] ) ) )
+					, mul( columns[2], splat( point[2] ) ) )
+				, columns[3] );
+		}
+
+		/**
+		 *\return	( ( ( 0 + x * x' ) + y * y' ) + z * z' ) + w * w', the point::dot order.
+		 */
+		inline float dot( Vec4 lhs, Vec4 rhs )
+		{
+			auto products = mul( lhs, rhs );
+			return lane< 0 >( products )
+				+ lane< 1 >( products )
+				+ lane< 2 >( products )
+				+ lane< 3 >( products );
+		}
+
+		/**
+		 *\return	The given factors of the cofactors of a 4x4 matrix, in the scalar templates order:
+		 *\			( S2i * S3j - S3i * S2j, S2i * S3j - S3i * S2j, S1i * S3j - S3i * S1j, S1i * S2j - S2i * S1j ).
+		 */
+		template< int I, int J >
+		inline Vec4 subFactors( Vec4 c1, Vec4 c2, Vec4 c3 )
+		{
+			auto p = shuffle< I, I, I, I >( c2, c1 );
+			auto q = swizzle< 0, 0, 0, 2 >( shuffle< J, J, J, J >( c3, c2 ) );
+			auto r = swizzle< 0, 0, 0, 2 >( shuffle< I, I, I, I >( c3, c2 ) );
+			auto t = shuffle< J, J, J, J >( c2, c1 );
+			return sub( mul( p, q ), mul( r, t ) );
+		}
+
+		/**
+		 *\return	( S1k, S0k, S0k, S0k ).
+		 */
+		template< int K >
+		inline Vec4 cofactorsRow( Vec4 c0, Vec4 c1 )
+		{
+			return swizzle< 0, 2, 2, 2 >( shuffle< K, K, K, K >( c1, c0 ) );
+		}
+
+		//*****************************************************************************************
+	}
+
+	inline void mulMtx4( float const * lhs
+		, float const * rhs
+		, float * result )
+	{
+#if CU_UseAVX
+		// Two result columns at once, each 128 bits lane holding one column.
+		__m256 const l[4]{ _mm256_broadcast_ps( reinterpret_cast< __m128 const * >( lhs ) )
+			, _mm256_broadcast_ps( reinterpret_cast< __m128 const * >( lhs + 4u ) )
+			, _mm256_broadcast_ps( reinterpret_cast< __m128 const * >( lhs + 8u ) )
+			, _mm256_broadcast_ps( reinterpret_cast< __m128 const * >( lhs + 12u ) ) };
+		auto mulColumns = [&l]( __m256 r )
+		{
+			return _mm256_add_ps( _mm256_add_ps( _mm256_add_ps( _mm256_mul_ps( l[0], _mm256_shuffle_ps( r, r, 0x00 ) )
+						, _mm256_mul_ps( l[1], _mm256_shuffle_ps( r, r, 0x55 ) ) )
+					, _mm256_mul_ps( l[2], _mm256_shuffle_ps( r, r, 0xAA ) ) )
+				, _mm256_mul_ps( l[3], _mm256_shuffle_ps( r, r, 0xFF ) ) );
+		};
+		auto c01 = mulColumns( _mm256_loadu_ps( rhs ) );
+		auto c23 = mulColumns( _mm256_loadu_ps( rhs + 8u ) );
+		_mm256_storeu_ps( result, c01 );
+		_mm256_storeu_ps( result + 8u, c23 );
+#else
+		using namespace details;
+		Vec4 const l[4]{ load( lhs )
+			, load( lhs + 4u )
+			, load( lhs + 8u )
+			, load( lhs + 12u ) };
+		Vec4 c[4];
+
+		for ( uint32_t i = 0u; i < 4u; ++i )
+		{
+			auto r = load( rhs + i * 4u );
+			c[i] = combine( l
+				, broadcast< 0 >( r )
+				, broadcast< 1 >( r )
+				, broadcast< 2 >( r )
+				, broadcast< 3 >( r ) );
+		}
+
+		store( result, c[0] );
+		store( result + 4u, c[1] );
+		store( result + 8u, c[2] );
+		store( result + 12u, c[3] );
+#endif
+	}
+
+	inline void invertMtx4( float const * input
+		, float * result )
+	{
+		using namespace details;
+		auto c0 = load( input );
+		auto c1 = load( input + 4u );
+		auto c2 = load( input + 8u );
+		auto c3 = load( input + 12u );
+
+		auto f0 = subFactors< 2, 3 >( c1, c2, c3 );
+		auto f1 = subFactors< 1, 3 >( c1, c2, c3 );
+		auto f2 = subFactors< 1, 2 >( c1, c2, c3 );
+		auto f3 = subFactors< 0, 3 >( c1, c2, c3 );
+		auto f4 = subFactors< 0, 2 >( c1, c2, c3 );
+		auto f5 = subFactors< 0, 1 >( c1, c2, c3 );
+
+		auto v0 = cofactorsRow< 0 >( c0, c1 );
+		auto v1 = cofactorsRow< 1 >( c0, c1 );
+		auto v2 = cofactorsRow< 2 >( c0, c1 );
+		auto v3 = cofactorsRow< 3 >( c0, c1 );
+
+		auto signA = set( 1.0f, -1.0f, 1.0f, -1.0f );
+		auto signB = set( -1.0f, 1.0f, -1.0f, 1.0f );
+		auto i0 = mul( signA, add( sub( mul( v1, f0 ), mul( v2, f1 ) ), mul( v3, f2 ) ) );
+		auto i1 = mul( signB, add( sub( mul( v0, f0 ), mul( v2, f3 ) ), mul( v3, f4 ) ) );
+		auto i2 = mul( signA, add( sub( mul( v0, f1 ), mul( v1, f3 ) ), mul( v3, f5 ) ) );
+		auto i3 = mul( signB, add( sub( mul( v0, f2 ), mul( v1, f4 ) ), mul( v2, f5 ) ) );
+
+		auto determinant = splat( dot( c0
+			, set( lane< 0 >( i0 ), lane< 0 >( i1 ), lane< 0 >( i2 ), lane< 0 >( i3 ) ) ) );
+		store( result, div( i0, determinant ) );
+		store( result + 4u, div( i1, determinant ) );
+		store( result + 8u, div( i2, determinant ) );
+		store( result + 12u, div( i3, determinant ) );
+	}
+
+	inline void transformPoints3( float const * matrix
+		, float const * input
+		, float * result
+		, size_t count )
+	{
+		using namespace details;
+		Vec4 const columns[4]{ load( matrix )
+			, load( matrix + 4u )
+			, load( matrix + 8u )
+			, load( matrix + 12u ) };
+
+		for ( size_t i = 0u; i < count; ++i )
+		{
+			store3( result, transformPoint3( columns, input ) );
+			input += 3u;
+			result += 3u;
+		}
+	}
+
+	inline void projectPoints3( float const * matrix
+		, float const * input
+		, float * result
+		, size_t count )
+	{
+		using namespace details;
+		Vec4 const columns[4]{ load( matrix )
+			, load( matrix + 4u )
+			, load( matrix + 8u )
+			, load( matrix + 12u ) };
+
+		for ( size_t i = 0u; i < count; ++i )
+		{
+			auto point = transformPoint3( columns, input );
+			store3( result, div( point, broadcast< 3 >( point ) ) );
+			input += 3u;
+			result += 3u;
+		}
+	}
+
+	inline void transformPoints4( float const * matrix
+		, float const * input
+		, float * result
+		, size_t count )
+	{
+		size_t i = 0u;
+#if CU_UseAVX
+		// Two points at once, each 128 bits lane holding one point.
+		__m256 const c[4]{ _mm256_broadcast_ps( reinterpret_cast< __m128 const * >( matrix ) )
+			, _mm256_broadcast_ps( reinterpret_cast< __m128 const * >( matrix + 4u ) )
+			, _mm256_broadcast_ps( reinterpret_cast< __m128 const * >( matrix + 8u ) )
+			, _mm256_broadcast_ps( reinterpret_cast< __m128 const * >( matrix + 12u ) ) };
+
+		for ( ; i + 2u <= count; i += 2u )
+		{
+			auto p = _mm256_loadu_ps( input );
+			_mm256_storeu_ps( result
+				, _mm256_add_ps( _mm256_add_ps( _mm256_add_ps( _mm256_mul_ps( c[0], _mm256_shuffle_ps( p, p, 0x00 ) )
+							, _mm256_mul_ps( c[1], _mm256_shuffle_ps( p, p, 0x55 ) ) )
+						, _mm256_mul_ps( c[2], _mm256_shuffle_ps( p, p, 0xAA ) ) )
+					, _mm256_mul_ps( c[3], _mm256_shuffle_ps( p, p, 0xFF ) ) ) );
+			input += 8u;
+			result += 8u;
+		}
+#endif
+		using namespace details;
+		Vec4 const columns[4]{ load( matrix )
+			, load( matrix + 4u )
+			, load( matrix + 8u )
+			, load( matrix + 12u ) };
+
+		for ( ; i < count; ++i )
+		{
+			auto p = load( input );
+			store( result
+				, combine( columns
+					, broadcast< 0 >( p )
+					, broadcast< 1 >( p )
+					, broadcast< 2 >( p )
+					, broadcast< 3 >( p ) ) );
+			input += 4u;
+			result += 4u;
+		}
+	}
+
+	inline void mulQuat( float const * lhs
+		, float const * rhs
+		, float * result )
+	{
+		using namespace details;
+		auto l = load( lhs );
+		auto r = load( rhs );
+		// x = w * rx + x * rw + y * rz - z * ry
+		// y = w * ry + y * rw + z * rx - x * rz
+		// z = w * rz + z * rw + x * ry - y * rx
+		// w = w * rw - x * rx - y * ry - z * rz
+		auto lastNegated = set( 1.0f, 1.0f, 1.0f, -1.0f );
+		auto a = mul( broadcast< 3 >( l ), r );
+		auto b = mul( lastNegated, mul( swizzle< 0, 1, 2, 0 >( l ), swizzle< 3, 3, 3, 0 >( r ) ) );
+		auto c = mul( lastNegated, mul( swizzle< 1, 2, 0, 1 >( l ), swizzle< 2, 0, 1, 1 >( r ) ) );
+		auto d = mul( swizzle< 2, 0, 1, 2 >( l ), swizzle< 1, 2, 0, 2 >( r ) );
+		auto q = sub( add( add( a, b ), c ), d );
+		auto length = std::sqrt( dot( q, q ) );
+
+		if ( length != 0.0f )
+		{
+			q = div( q, splat( length ) );
+		}
+
+		store( result, q );
+	}
+
+	inline void slerpQuat( float const * lhs
+		, float const * rhs
+		, float factor
+		, float * result )
+	{
+		using namespace details;
+		auto l = load( lhs );
+		auto r = load( rhs );
+		auto cosTheta = dot( l, r );
+
+		// do we need to invert rotation?
+		if ( cosTheta < 0 )
+		{
+			cosTheta = -cosTheta;
+			r = mul( splat( -1.0f ), r );
+		}
+
+		// Same coefficients computation as QuaternionT< float >::slerp.
+		float sclp;
+		float sclq;
+
+		if ( ( 1.0f - cosTheta ) > 0.0001 )
+		{
+			auto omega = std::acos( cosTheta );
+			auto sinom = std::sin( omega );
+			sclp = float( std::sin( ( 1.0 - factor ) * omega ) / sinom );
+			sclq = float( std::sin( factor * omega ) / sinom );
+		}
+		else
+		{
+			sclp = float( 1.0 - factor );
+			sclq = factor;
+		}
+
+		store( result, add( mul( splat( sclp ), l ), mul( splat( sclq ), r ) ) );
+	}
+
+	inline void quatToMtx4( float const * input
+		, float * result )
+	{
+		using namespace details;
+		auto q = load( input );
+		// ( yy + zz, xy + wz, xz - wy )
+		auto t0 = add( mul( swizzle< 1, 0, 0, 3 >( q ), swizzle< 1, 1, 2, 3 >( q ) )
+			, mul( set( 1.0f, 1.0f, -1.0f, 0.0f )
+				, mul( swizzle< 2, 3, 3, 3 >( q ), swizzle< 2, 2, 1, 3 >( q ) ) ) );
+		// ( xy - wz, xx + zz, yz + wx )
+		auto t1 = add( mul( swizzle< 0, 0, 1, 3 >( q ), swizzle< 1, 0, 2, 3 >( q ) )
+			, mul( set( -1.0f, 1.0f, 1.0f, 0.0f )
+				, mul( swizzle< 3, 2, 3, 3 >( q ), swizzle< 2, 2, 0, 3 >( q ) ) ) );
+		// ( xz + wy, yz - wx, xx + yy )
+		auto t2 = add( mul( swizzle< 0, 1, 0, 3 >( q ), swizzle< 2, 2, 0, 3 >( q ) )
+			, mul( set( 1.0f, -1.0f, 1.0f, 0.0f )
+				, mul( swizzle< 3, 3, 1, 3 >( q ), swizzle< 1, 0, 1, 3 >( q ) ) ) );
+		store( result, add( set( 1.0f, 0.0f, 0.0f, 0.0f ), mul( set( -2.0f, 2.0f, 2.0f, 0.0f ), t0 ) ) );
+		store( result + 4u, add( set( 0.0f, 1.0f, 0.0f, 0.0f ), mul( set( 2.0f, -2.0f, 2.0f, 0.0f ), t1 ) ) );
+		store( result + 8u, add( set( 0.0f, 0.0f, 1.0f, 0.0f ), mul( set( 2.0f, 2.0f, -2.0f, 0.0f ), t2 ) ) );
+		store( result + 12u, set( 0.0f, 0.0f, 0.0f, 1.0f ) );
+	}
+}
@@ -1,4 +1,4 @@
-#include "CastorUtils/Math/Simd.hpp"
+#include "CastorUtils/Math/SimdKernels.hpp"
 
 namespace castor
 {
@@ -69,6 +69,16 @@ namespace castor
 			}
 		};
 
+		template<>
+		struct SqrMtxInverter< float, 4 >
+		{
+			static inline void inverse( castor::SquareMatrix< float, 4 > const & input
+				, castor::SquareMatrix< float, 4 > & result )
+			{
+				simd::invertMtx4( input.constPtr(), result.ptr() );
+			}
+		};
+
 		template< typename Type >
 		struct SqrMtxInverter< Type, 3 >
 		{
@@ -210,6 +220,17 @@ namespace castor
 			}
 		};
 
+		template<>
+		struct SqrMtxOperators< float, 4 >
+		{
+			static const uint32_t Size = sizeof( float ) * 4;
+
+			static inline void mul( castor::SquareMatrix< float, 4 > & lhs, castor::SquareMatrix< float, 4 > const & rhs )
+			{
+				simd::mulMtx4( lhs.constPtr(), rhs.constPtr(), lhs.ptr() );
+			}
+		};
+
 		template< typename Type >
 		struct SqrMtxOperators< Type, 3 >
 		{
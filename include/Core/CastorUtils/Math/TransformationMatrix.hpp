@@ -266,6 +266,20 @@ namespace castor
 		template< typename T, typename U >
 		static Point3< U > getTransformed( Matrix4x4< T > const & matrix
 			, Point3< U > const & value );
+		/**
+		 *\~english
+		 *\brief		Transforms the position/scale through a transformation matrix, float version.
+		 *\param[out]	matrix	The transformation matrix
+		 *\param[in]	value	The position/scale.
+		 *\return		The transformed position.
+		 *\~french
+		 *\brief		Transforme une position/mise à l'échelle via une matrice de transformation, version float.
+		 *\param[out]	matrix	La matrice de transformation.
+		 *\param[in]	value	La position/mise à l'échelle.
+		 *\return		La position transformée.
+		 */
+		inline Point3f getTransformed( Matrix4x4f const & matrix
+			, Point3f const & value );
 		/**
 		 *\~english
 		 *\brief		Transforms the orientation through a transformation matrix.
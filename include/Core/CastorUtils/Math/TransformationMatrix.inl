@@ -243,6 +243,14 @@ namespace castor
 			return result;
 		}
 
+		inline Point3f getTransformed( Matrix4x4f const & matrix
+			, Point3f const & value )
+		{
+			Point3f result;
+			simd::projectPoints3( matrix.constPtr(), value.constPtr(), result.ptr(), 1u );
+			return result;
+		}
+
 		template< typename T, typename U >
 		static Quaternion getTransformed( castor::Matrix4x4< T > const & matrix
 			, castor::QuaternionT< U > const & value )
@@ -54,6 +54,16 @@ namespace castor
 	class PreciseTimer;
 	/**
 	\~english
+	\brief		Scoped zones profiler, exporting Chrome traces
+	\remark		Call the macro CU_ProfileZone() at the beginning of a block to record it while the profiler is enabled
+	\~french
+	\brief		Profileur de zones, exportant des traces Chrome
+	\remark		Appelez la macro CU_ProfileZone() au début d'un bloc pour l'enregistrer lorsque le profileur est activé
+	*/
+	class Profiler;
+	class ProfileZone;
+	/**
+	\~english
 	\brief 		String functions namespace
 	\~french
 	\brief 		Espace de nom regroupant des fonctions sur les chaînes de caractères
@@ -0,0 +1,287 @@
+/*
+See LICENSE file in root folder
+*/
+#ifndef ___CU_Profiler_HPP___
+#define ___CU_Profiler_HPP___
+
+#include "CastorUtils/Miscellaneous/MiscellaneousModule.hpp"
+
+#include "CastorUtils/Data/Path.hpp"
+#include "CastorUtils/Multithreading/SpinMutex.hpp"
+
+#include "CastorUtils/Config/BeginExternHeaderGuard.hpp"
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <vector>
+#include "CastorUtils/Config/EndExternHeaderGuard.hpp"
+
+namespace castor
+{
+	/**
+	\~english
+	\brief		Scoped zones profiler, recording the CPU zones of each thread and the GPU passes times, frame per frame.
+	\remarks	Always compiled, it only records something while enabled, a disabled zone costs an atomic load.
+	\n			Each thread records its zones in its own ring buffer, the oldest zones are overwritten.
+	\n			The captured frames are exported in the Chrome trace event format, readable by chrome://tracing, Perfetto, or Tracy through its import-chrome tool.
+	\~french
+	\brief		Profileur de zones, enregistrant les zones CPU de chaque thread et les temps des passes GPU, frame par frame.
+	\remarks	Toujours compilé, il n'enregistre quelque chose que lorsqu'il est activé, une zone désactivée coûte un chargement atomique.
+	\n			Chaque thread enregistre ses zones dans son propre tampon circulaire, les zones les plus anciennes sont écrasées.
+	\n			Les frames capturées sont exportées au format Chrome trace event, lisible par chrome://tracing, Perfetto, ou Tracy via son outil import-chrome.
+	*/
+	class Profiler
+	{
+	public:
+		//!\~english	The zones count kept for each thread.
+		//!\~french		Le nombre de zones gardées pour chaque thread.
+		static size_t constexpr ZonesPerThread = 16384u;
+		//!\~english	The frames count kept.
+		//!\~french		Le nombre de frames gardées.
+		static size_t constexpr FramesCount = 128u;
+
+		/**
+		\~english
+		\brief		A CPU zone.
+		\~french
+		\brief		Une zone CPU.
+		*/
+		struct Zone
+		{
+			//!\~english	The zone name, a string literal.
+			//!\~french		Le nom de la zone, une chaîne littérale.
+			char const * name;
+			//!\~english	The zone bounds, in nanoseconds since the profiler creation.
+			//!\~french		Les bornes de la zone, en nanosecondes depuis la création du profileur.
+			int64_t begin;
+			int64_t end;
+			//!\~english	The zone nesting level, 0 for a root zone.
+			//!\~french		Le niveau d'imbrication de la zone, 0 pour une zone racine.
+			uint32_t depth;
+		};
+		/**
+		\~english
+		\brief		The GPU time of a render pass.
+		\~french
+		\brief		Le temps GPU d'une passe de rendu.
+		*/
+		struct GpuZone
+		{
+			String name;
+			int64_t duration;
+		};
+		/**
+		\~english
+		\brief		A frame bounds, and the GPU times retrieved during it.
+		\~french
+		\brief		Les bornes d'une frame, et les temps GPU récupérés pendant celle-ci.
+		*/
+		struct Frame
+		{
+			uint64_t index{};
+			int64_t begin{};
+			int64_t end{};
+			std::vector< GpuZone > gpuZones;
+		};
+
+	public:
+		CU_API Profiler();
+		CU_API ~Profiler()noexcept;
+
+		Profiler( Profiler const & ) = delete;
+		Profiler & operator=( Profiler const & ) = delete;
+		Profiler( Profiler && ) = delete;
+		Profiler & operator=( Profiler && ) = delete;
+		/**
+		 *\~english
+		 *\return		The process wide profiler.
+		 *\~french
+		 *\return		Le profileur global au processus.
+		 */
+		CU_API static Profiler & getSingleton();
+		/**
+		 *\~english
+		 *\brief		Enables or disables the recording.
+		 *\~french
+		 *\brief		Active ou désactive l'enregistrement.
+		 */
+		CU_API void setEnabled( bool enable );
+		/**
+		 *\~english
+		 *\brief		Names the calling thread in the exported traces.
+		 *\~french
+		 *\brief		Nomme le thread appelant dans les traces exportées.
+		 */
+		CU_API void setThreadName( String const & name );
+		/**
+		 *\~english
+		 *\brief		Opens a zone on the calling thread.
+		 *\return		The zone nesting level.
+		 *\~french
+		 *\brief		Ouvre une zone sur le thread appelant.
+		 *\return		Le niveau d'imbrication de la zone.
+		 */
+		CU_API uint32_t beginZone();
+		/**
+		 *\~english
+		 *\brief		Closes a zone opened by beginZone() on the calling thread, and records it.
+		 *\param[in]	name	The zone name, must outlive the profiler (string literal).
+		 *\param[in]	begin	The zone start time, from now().
+		 *\param[in]	depth	The value returned by beginZone().
+		 *\~french
+		 *\brief		Ferme une zone ouverte par beginZone() sur le thread appelant, et l'enregistre.
+		 *\param[in]	name	Le nom de la zone, doit survivre au profileur (chaîne littérale).
+		 *\param[in]	begin	L'heure de début de la zone, venant de now().
+		 *\param[in]	depth	La valeur retournée par beginZone().
+		 */
+		CU_API void endZone( char const * name
+			, int64_t begin
+			, uint32_t depth );
+		/**
+		 *\~english
+		 *\brief		Marks the beginning of a frame.
+		 *\~french
+		 *\brief		Marque le début d'une frame.
+		 */
+		CU_API void beginFrame();
+		/**
+		 *\~english
+		 *\brief		Marks the end of the current frame, and writes the pending capture if it is complete.
+		 *\~french
+		 *\brief		Marque la fin de la frame courante, et écrit la capture en attente si elle est complète.
+		 */
+		CU_API void endFrame();
+		/**
+		 *\~english
+		 *\brief		Adds the GPU time of a render pass to the current frame.
+		 *\~french
+		 *\brief		Ajoute le temps GPU d'une passe de rendu à la frame courante.
+		 */
+		CU_API void addGpuZone( String const & name
+			, Nanoseconds duration );
+		/**
+		 *\~english
+		 *\brief		Captures the next frames, and writes them to a Chrome trace file.
+		 *\remarks		The profiler is enabled for the capture, and restored afterwards.
+		 *\param[in]	file		The trace file.
+		 *\param[in]	frameCount	The captured frames count.
+		 *\~french
+		 *\brief		Capture les prochaines frames, et les écrit dans un fichier de trace Chrome.
+		 *\remarks		Le profileur est activé pour la capture, puis restauré.
+		 *\param[in]	file		Le fichier de trace.
+		 *\param[in]	frameCount	Le nombre de frames capturées.
+		 */
+		CU_API void captureFrames( Path const & file
+			, uint32_t frameCount = 1u );
+		/**
+		 *\~english
+		 *\brief		Writes the latest recorded frames in the Chrome trace event JSON format.
+		 *\param[out]	stream		Receives the trace.
+		 *\param[in]	frameCount	The exported frames count, the zones outside those frames are ignored.
+		 *\return		\p false if no frame was recorded.
+		 *\~french
+		 *\brief		Ecrit les dernières frames enregistrées au format JSON Chrome trace event.
+		 *\param[out]	stream		Reçoit la trace.
+		 *\param[in]	frameCount	Le nombre de frames exportées, les zones hors de ces frames sont ignorées.
+		 *\return		\p false si aucune frame n'a été enregistrée.
+		 */
+		CU_API bool writeChromeTrace( std::ostream & stream
+			, uint32_t frameCount )const;
+		/**
+		 *\~english
+		 *\return		The time, in nanoseconds since the profiler creation.
+		 *\~french
+		 *\return		L'heure, en nanosecondes depuis la création du profileur.
+		 */
+		int64_t now()const noexcept
+		{
+			return std::chrono::duration_cast< std::chrono::nanoseconds >( Clock::now() - m_epoch ).count();
+		}
+
+		bool isEnabled()const noexcept
+		{
+			return m_enabled.load( std::memory_order_relaxed );
+		}
+
+	private:
+		using Clock = std::chrono::steady_clock;
+
+		struct ThreadZones
+		{
+			uint32_t id;
+			String name;
+			mutable SpinMutex mutex;
+			std::vector< Zone > zones;
+			size_t next{};
+			uint32_t depth{};
+		};
+		using ThreadZonesPtr = std::shared_ptr< ThreadZones >;
+
+		ThreadZones & doGetThreadZones();
+		void doWriteCapture( Path const & path
+			, uint32_t frameCount )const;
+
+	private:
+		Clock::time_point m_epoch;
+		std::atomic_bool m_enabled{ false };
+		mutable std::mutex m_mutex;
+		std::vector< ThreadZonesPtr > m_threads;
+		std::vector< Frame > m_frames;
+		uint64_t m_frameIndex{};
+		bool m_inFrame{};
+		Path m_capturePath;
+		uint32_t m_captureCount{};
+		uint32_t m_captureRemaining{};
+		bool m_enabledBeforeCapture{};
+	};
+	/**
+	\~english
+	\brief		Records a CPU zone from its construction to its destruction, if the profiler is enabled.
+	\remarks	Use the CU_ProfileZone and CU_ProfileFunction macros.
+	\~french
+	\brief		Enregistre une zone CPU de sa construction à sa destruction, si le profileur est activé.
+	\remarks	Utilisez les macros CU_ProfileZone et CU_ProfileFunction.
+	*/
+	class ProfileZone
+	{
+	public:
+		explicit ProfileZone( char const * name )
+			: m_name{ name }
+		{
+			auto & profiler = Profiler::getSingleton();
+
+			if ( profiler.isEnabled() )
+			{
+				m_depth = profiler.beginZone();
+				m_begin = profiler.now();
+			}
+		}
+
+		~ProfileZone()noexcept
+		{
+			if ( m_begin >= 0 )
+			{
+				Profiler::getSingleton().endZone( m_name, m_begin, m_depth );
+			}
+		}
+
+		ProfileZone( ProfileZone const & ) = delete;
+		ProfileZone & operator=( ProfileZone const & ) = delete;
+		ProfileZone( ProfileZone && ) = delete;
+		ProfileZone & operator=( ProfileZone && ) = delete;
+
+	private:
+		char const * m_name;
+		int64_t m_begin{ -1 };
+		uint32_t m_depth{};
+	};
+}
+
+#define CU_ProfileZoneNameI( Line ) profileZone##Line
+#define CU_ProfileZoneName( Line ) CU_ProfileZoneNameI( Line )
+#define CU_ProfileZone( Name ) castor::ProfileZone CU_ProfileZoneName( __LINE__ ){ Name }
+#define CU_ProfileFunction() castor::ProfileZone CU_ProfileZoneName( __LINE__ ){ __FUNCTION__ }
+
+#endif
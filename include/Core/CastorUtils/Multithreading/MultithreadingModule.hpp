@@ -27,6 +27,15 @@ namespace castor
 	/**
 	*\~english
 	*\brief
+	*	Pool of persistent threads executing indexed tasks, the calling thread participating.
+	*\~french
+	*\brief
+	*	Pool de threads persistants exécutant des tâches indexées, le thread appelant y participant.
+	*/
+	class TaskPool;
+	/**
+	*\~english
+	*\brief
 	*	Thread pool implementation, using WorkerThreads.
 	*\~french
 	*\brief
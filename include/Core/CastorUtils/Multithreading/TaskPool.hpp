@@ -0,0 +1,94 @@
+/*
+See LICENSE file in root folder
+*/
+#ifndef ___CU_TaskPool_H___
+#define ___CU_TaskPool_H___
+
+#include "CastorUtils/Multithreading/MultithreadingModule.hpp"
+
+#include "CastorUtils/Config/BeginExternHeaderGuard.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include "CastorUtils/Config/EndExternHeaderGuard.hpp"
+
+#include <functional>
+
+namespace castor
+{
+	class TaskPool
+	{
+	public:
+		using Task = std::function< void( uint32_t ) >;
+
+	public:
+		/**
+		 *\~english
+		 *\brief		Constructor, starts the given count of worker threads.
+		 *\remarks		The thread calling parallelFor also executes tasks, so \p count can be 0.
+		 *\param[in]	count	The worker threads count.
+		 *\~french
+		 *\brief		Constructeur, démarre le nombre donné de threads de travail.
+		 *\remarks		Le thread appelant parallelFor exécute aussi des tâches, \p count peut donc valoir 0.
+		 *\param[in]	count	Le nombre de threads de travail.
+		 */
+		CU_API explicit TaskPool( uint32_t count );
+		/**
+		 *\~english
+		 *\brief		Destructor, stops the worker threads.
+		 *\~french
+		 *\brief		Destructeur, arrête les threads de travail.
+		 */
+		CU_API ~TaskPool()noexcept;
+		/**
+		 *\~english
+		 *\brief		Executes \p task once for each index in [0, count), and waits for all of them to end.
+		 *\remarks		Indices are distributed dynamically between the workers and the calling thread.
+		 *\n			A call made from inside a task is executed serially by the calling thread.
+		 *\n			The first exception thrown by a task is rethrown once all tasks have ended.
+		 *\param[in]	count	The indices count.
+		 *\param[in]	task	The task.
+		 *\~french
+		 *\brief		Exécute \p task une fois pour chaque index dans [0, count), et attend qu'elles soient toutes finies.
+		 *\remarks		Les indices sont distribués dynamiquement entre les threads de travail et le thread appelant.
+		 *\n			Un appel fait depuis une tâche est exécuté séquentiellement par le thread appelant.
+		 *\n			La première exception lancée par une tâche est relancée une fois toutes les tâches finies.
+		 *\param[in]	count	Le nombre d'indices.
+		 *\param[in]	task	La tâche.
+		 */
+		CU_API void parallelFor( uint32_t count
+			, Task const & task );
+		/**
+		 *\~english
+		 *\return		The worker threads count.
+		 *\~french
+		 *\return		Le nombre de threads de travail.
+		 */
+		uint32_t getCount()const noexcept
+		{
+			return uint32_t( m_workers.size() );
+		}
+
+	private:
+		void doRun();
+		void doProcess();
+
+	private:
+		std::vector< std::thread > m_workers;
+		std::mutex m_runMutex;
+		std::mutex m_mutex;
+		std::condition_variable m_start;
+		std::condition_variable m_end;
+		bool m_stopped{ false };
+		uint64_t m_generation{ 0u };
+		uint32_t m_running{ 0u };
+		Task const * m_task{ nullptr };
+		uint32_t m_count{ 0u };
+		std::atomic< uint32_t > m_next{ 0u };
+		std::exception_ptr m_exception;
+	};
+}
+
+#endif
@@ -49,13 +49,15 @@ namespace castor
 					, size_t( ( m_freeEnd - m_freeIndex ) * sizeof( Object ) ) );
 			}
 
-			delete [] m_free;
+			free( m_free );
 
 			for ( auto buffer = m_buffers; buffer != m_buffersEnd; ++buffer )
 			{
 				MemoryAllocator::deallocate( buffer->m_data );
 			}
 
+			free( m_buffers );
+
 			m_free = nullptr;
 			m_buffers = nullptr;
 			m_freeIndex = m_free;
@@ -0,0 +1,136 @@
+/*
+See LICENSE file in root folder
+*/
+#ifndef ___CU_FrameArena_HPP___
+#define ___CU_FrameArena_HPP___
+#pragma once
+
+#include "CastorUtils/Pool/PoolModule.hpp"
+
+#include <cstddef>
+#include <memory_resource>
+#include <vector>
+
+namespace castor
+{
+	/**
+	\~english
+	\brief		Linear allocator, meant for objects living at most one frame.
+	\remarks	Allocations are bumped into memory blocks, deallocations are no-ops, and reset() makes all the memory available again.
+	\n			It is not thread safe, each thread must use its own arena.
+	\~french
+	\brief		Allocateur linéaire, destiné aux objets vivant au plus une frame.
+	\remarks	Les allocations se suivent dans des blocs mémoire, les désallocations ne font rien, et reset() rend toute la mémoire de nouveau disponible.
+	\n			Il n'est pas thread safe, chaque thread doit utiliser sa propre arène.
+	*/
+	class FrameArena
+		: public std::pmr::memory_resource
+	{
+	public:
+		static size_t constexpr DefaultBlockSize = 256u * 1024u;
+
+	public:
+		/**
+		 *\~english
+		 *\brief		Constructor.
+		 *\param[in]	blockSize	The size of the memory blocks requested to \p upstream.
+		 *\param[in]	upstream	The resource providing the memory blocks.
+		 *\~french
+		 *\brief		Constructeur.
+		 *\param[in]	blockSize	La taille des blocs mémoire demandés à \p upstream.
+		 *\param[in]	upstream	La ressource fournissant les blocs mémoire.
+		 */
+		CU_API explicit FrameArena( size_t blockSize = DefaultBlockSize
+			, std::pmr::memory_resource * upstream = std::pmr::get_default_resource() );
+		/**
+		 *\~english
+		 *\brief		Destructor, releases the memory blocks.
+		 *\~french
+		 *\brief		Destructeur, libère les blocs mémoire.
+		 */
+		CU_API ~FrameArena()noexcept override;
+
+		FrameArena( FrameArena const & ) = delete;
+		FrameArena & operator=( FrameArena const & ) = delete;
+		FrameArena( FrameArena && ) = delete;
+		FrameArena & operator=( FrameArena && ) = delete;
+		/**
+		 *\~english
+		 *\brief		Makes all the memory available again, and resets the counters.
+		 *\remarks		All the objects allocated from the arena must have been destroyed.
+		 *\n			If the previous frame needed more than one block, they are merged in a single one.
+		 *\~french
+		 *\brief		Rend toute la mémoire de nouveau disponible, et remet les compteurs à zéro.
+		 *\remarks		Tous les objets alloués depuis l'arène doivent avoir été détruits.
+		 *\n			Si la frame précédente a eu besoin de plus d'un bloc, ils sont fusionnés en un seul.
+		 */
+		CU_API void reset();
+		/**
+		 *\~english
+		 *name Getters.
+		 *\~french
+		 *name Accesseurs.
+		**/
+		/**@{*/
+		uint32_t getAllocationCount()const noexcept
+		{
+			return m_allocationCount;
+		}
+
+		size_t getAllocatedSize()const noexcept
+		{
+			return m_allocatedSize;
+		}
+
+		uint32_t getUpstreamAllocationCount()const noexcept
+		{
+			return m_upstreamAllocationCount;
+		}
+
+		size_t getCapacity()const noexcept
+		{
+			return m_capacity;
+		}
+		/**@}*/
+
+	private:
+		struct Block
+		{
+			std::byte * data;
+			size_t size;
+		};
+
+	private:
+		void * do_allocate( size_t bytes
+			, size_t alignment )override;
+		void do_deallocate( void * ptr
+			, size_t bytes
+			, size_t alignment )override;
+		bool do_is_equal( std::pmr::memory_resource const & other )const noexcept override;
+
+		void * doAllocate( Block const & block
+			, size_t bytes
+			, size_t alignment );
+		void doAllocateBlock( size_t size );
+		void doReleaseBlocks();
+
+	private:
+		std::pmr::memory_resource * m_upstream;
+		size_t m_blockSize;
+		std::vector< Block > m_blocks;
+		size_t m_current{};
+		size_t m_offset{};
+		size_t m_capacity{};
+		//!\~english	The allocations count since last reset.
+		//!\~french		Le nombre d'allocations depuis la dernière remise à zéro.
+		uint32_t m_allocationCount{};
+		//!\~english	The allocated size since last reset.
+		//!\~french		La taille allouée depuis la dernière remise à zéro.
+		size_t m_allocatedSize{};
+		//!\~english	The blocks requested to the upstream resource since last reset.
+		//!\~french		Les blocs demandés à la ressource amont depuis la dernière remise à zéro.
+		uint32_t m_upstreamAllocationCount{};
+	};
+}
+
+#endif
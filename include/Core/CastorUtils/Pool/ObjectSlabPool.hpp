@@ -0,0 +1,160 @@
+/*
+See LICENSE file in root folder
+*/
+#ifndef ___CU_ObjectSlabPool_HPP___
+#define ___CU_ObjectSlabPool_HPP___
+
+#include "CastorUtils/Pool/FixedGrowingSizeMemoryData.hpp"
+#include "CastorUtils/Align/AlignedMemoryAllocator.hpp"
+#include "CastorUtils/Config/MultiThreadConfig.hpp"
+
+#include "CastorUtils/Config/BeginExternHeaderGuard.hpp"
+#include <mutex>
+#include <new>
+#include "CastorUtils/Config/EndExternHeaderGuard.hpp"
+
+namespace castor
+{
+	/**
+	\~english
+	\brief		Thread safe memory pool, meant to back the class specific new and delete operators of \p ObjectT.
+	\remarks	The memory is allocated by contiguous slabs of objects, which are never moved, so the objects addresses are stable.
+	\n			Requests which size differs from sizeof( ObjectT ) (derived classes) are forwarded to the global operators.
+	\~french
+	\brief		Pool mémoire thread safe, destiné à implémenter les opérateurs new et delete spécifiques à la classe \p ObjectT.
+	\remarks	La mémoire est allouée par blocs contigus d'objets, qui ne sont jamais déplacés, les adresses des objets sont donc stables.
+	\n			Les demandes dont la taille diffère de sizeof( ObjectT ) (classes dérivées) sont transmises aux opérateurs globaux.
+	*/
+	template< typename ObjectT >
+	class ObjectSlabPoolT
+		: private FixedGrowingSizeMemoryData< ObjectT, AlignedMemoryAllocator< std::max( alignof( ObjectT ), alignof( std::max_align_t ) ) > >
+	{
+		using MemoryData = FixedGrowingSizeMemoryData< ObjectT, AlignedMemoryAllocator< std::max( alignof( ObjectT ), alignof( std::max_align_t ) ) > >;
+
+	public:
+		/**
+		 *\~english
+		 *\brief		Constructor.
+		 *\param[in]	slabSize	The objects count in each slab.
+		 *\~french
+		 *\brief		Constructeur.
+		 *\param[in]	slabSize	Le nombre d'objets dans chaque bloc.
+		 */
+		explicit ObjectSlabPoolT( size_t slabSize = 256u )noexcept
+			: m_slabSize{ slabSize }
+			, m_capacity{ slabSize }
+		{
+			MemoryData::initialise( m_slabSize );
+		}
+		/**
+		 *\~english
+		 *\brief		Destructor, reports the objects that have not been deallocated.
+		 *\~french
+		 *\brief		Destructeur, rapporte les objets qui n'ont pas été désalloués.
+		 */
+		~ObjectSlabPoolT()noexcept
+		{
+			MemoryData::cleanup();
+		}
+
+		ObjectSlabPoolT( ObjectSlabPoolT const & ) = delete;
+		ObjectSlabPoolT & operator=( ObjectSlabPoolT const & ) = delete;
+		ObjectSlabPoolT( ObjectSlabPoolT && ) = delete;
+		ObjectSlabPoolT & operator=( ObjectSlabPoolT && ) = delete;
+		/**
+		 *\~english
+		 *\brief		Allocates memory for an object.
+		 *\param[in]	size	The requested size.
+		 *\return		The memory, a new slab is created if the pool is full.
+		 *\~french
+		 *\brief		Alloue la mémoire pour un objet.
+		 *\param[in]	size	La taille demandée.
+		 *\return		La mémoire, un nouveau bloc est créé si le pool est plein.
+		 */
+		void * allocate( size_t size )
+		{
+			if ( size != sizeof( ObjectT ) )
+			{
+				return ::operator new( size );
+			}
+
+			auto lock( makeUniqueLock( m_mutex ) );
+
+			if ( m_allocated == m_capacity )
+			{
+				m_capacity += m_slabSize;
+			}
+
+			auto result = MemoryData::allocate();
+
+			if ( !result )
+			{
+				throw std::bad_alloc{};
+			}
+
+			++m_allocated;
+			return result;
+		}
+		/**
+		 *\~english
+		 *\brief		Gives memory allocated through allocate() back to the pool.
+		 *\param[in]	memory	The memory.
+		 *\param[in]	size	The size given to allocate().
+		 *\~french
+		 *\brief		Rend au pool la mémoire allouée via allocate().
+		 *\param[in]	memory	La mémoire.
+		 *\param[in]	size	La taille donnée à allocate().
+		 */
+		void deallocate( void * memory
+			, size_t size )noexcept
+		{
+			if ( size != sizeof( ObjectT ) )
+			{
+				::operator delete( memory );
+				return;
+			}
+
+			if ( memory )
+			{
+				auto lock( makeUniqueLock( m_mutex ) );
+
+				if ( MemoryData::deallocate( memory ) )
+				{
+					--m_allocated;
+				}
+			}
+		}
+		/**
+		 *\~english
+		 *name Getters.
+		 *\~french
+		 *name Accesseurs.
+		**/
+		/**@{*/
+		size_t getAllocatedCount()const noexcept
+		{
+			auto lock( makeUniqueLock( m_mutex ) );
+			return m_allocated;
+		}
+
+		size_t getCapacity()const noexcept
+		{
+			auto lock( makeUniqueLock( m_mutex ) );
+			return m_capacity;
+		}
+
+		size_t getSlabSize()const noexcept
+		{
+			return m_slabSize;
+		}
+		/**@}*/
+
+	private:
+		mutable std::mutex m_mutex;
+		size_t m_slabSize;
+		size_t m_capacity;
+		size_t m_allocated{};
+	};
+}
+
+#endif
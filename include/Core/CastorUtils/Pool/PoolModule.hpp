@@ -228,6 +228,13 @@ namespace castor
 	class FixedSizeMarkedMemoryData;
 	template< typename Object >
 	class FixedGrowingSizeMarkedMemoryData;
+	/**
+	\~english
+	\brief		Linear allocator, for objects living at most one frame.
+	\~french
+	\brief		Allocateur linéaire, pour des objets vivant au plus une frame.
+	*/
+	class FrameArena;
 	//@}
 }
 
@@ -4,6 +4,7 @@
 
 #include <CastorUtils/Data/BinaryFile.hpp>
 
+#include <cstring>
 #include <numeric>
 
 namespace castor3d
@@ -87,6 +88,9 @@ namespace castor3d
 			case castor3d::ChunkType::eMorphTargetTangentsMikkt:
 			case castor3d::ChunkType::eSubmeshBitangents:
 			case castor3d::ChunkType::eMorphTargetBitangents:
+			case castor3d::ChunkType::eSubmeshLodError:
+			case castor3d::ChunkType::eSubmeshLodIndexCount:
+			case castor3d::ChunkType::eSubmeshLodIndices:
 #pragma warning( push )
 #pragma warning( disable: 4996 )
 #pragma GCC diagnostic push
@@ -285,6 +289,39 @@ namespace castor3d
 		return result;
 	}
 
+	bool BinaryChunk::read( castor::ByteArray const & data )
+	{
+		uint32_t size = 0;
+		bool result = data.size() >= sizeof( ChunkType ) + sizeof( uint32_t );
+
+		if ( result )
+		{
+			std::memcpy( &m_type, data.data(), sizeof( ChunkType ) );
+			m_isLittleEndian = binchunk::isValidType( m_type );
+
+			if ( !m_isLittleEndian )
+			{
+				castor::switchEndianness( m_type );
+				result = binchunk::isValidType( m_type );
+			}
+		}
+
+		if ( result )
+		{
+			std::memcpy( &size, data.data() + sizeof( ChunkType ), sizeof( uint32_t ) );
+			chunkEndianToSystemEndian( *this, size );
+			auto begin = data.begin() + sizeof( ChunkType ) + sizeof( uint32_t );
+			result = size_t( data.end() - begin ) >= size;
+
+			if ( result )
+			{
+				m_data.assign( begin, begin + size );
+			}
+		}
+
+		return result;
+	}
+
 	void BinaryChunk::binaryError( std::string_view view )
 	{
 		log::error << view;
@@ -203,6 +203,25 @@ namespace castor3d
 					auto const * data = reinterpret_cast< FaceIndices const * >( obj.getComponent< TriFaceMapping >()->getFaces().data() );
 					result = doWriteChunk( data, count, ChunkType::eSubmeshIndices, m_chunk );
 				}
+
+				for ( auto & lod : obj.getComponent< TriFaceMapping >()->getLods() )
+				{
+					if ( result )
+					{
+						result = doWriteChunk( lod.error, ChunkType::eSubmeshLodError, m_chunk );
+					}
+
+					if ( result )
+					{
+						result = doWriteChunk( uint32_t( lod.faces.size() ), ChunkType::eSubmeshLodIndexCount, m_chunk );
+					}
+
+					if ( result )
+					{
+						auto const * data = reinterpret_cast< FaceIndices const * >( lod.faces.data() );
+						result = doWriteChunk( data, lod.faces.size(), ChunkType::eSubmeshLodIndices, m_chunk );
+					}
+				}
 			}
 			else if ( obj.hasComponent( LinesMapping::Name ) )
 			{
@@ -256,6 +275,7 @@ namespace castor3d
 		uint32_t count{ 0u };
 		uint32_t components{ 0u };
 		uint32_t faceCount{ 0u };
+		std::vector< TriFaceMapping::Lod > lods;
 		BinaryChunk chunk{ doIsLittleEndian() };
 
 		while ( result && doGetSubChunk( chunk ) )
@@ -466,11 +486,48 @@ namespace castor3d
 				}
 				faceCount = 0u;
 				break;
+			case ChunkType::eSubmeshLodError:
+				lods.emplace_back();
+				result = doParseChunk( lods.back().error, chunk );
+				checkError( result, "Couldn't parse level of detail error." );
+				break;
+			case ChunkType::eSubmeshLodIndexCount:
+				result = !lods.empty()
+					&& doParseChunk( count, chunk );
+				checkError( result, "Couldn't parse level of detail index count." );
+				if ( result )
+				{
+					faces.resize( count );
+				}
+				break;
+			case ChunkType::eSubmeshLodIndices:
+				result = !lods.empty()
+					&& doParseChunk( faces, chunk );
+				checkError( result, "Couldn't parse level of detail index data." );
+				if ( result )
+				{
+					auto & lodFaces = lods.back().faces;
+					lodFaces.reserve( faces.size() );
+
+					for ( auto & face : faces )
+					{
+						lodFaces.emplace_back( face.m_index[0], face.m_index[1], face.m_index[2] );
+					}
+				}
+				break;
 			default:
 				break;
 			}
 		}
 
+		if ( !lods.empty() )
+		{
+			if ( auto indexMapping = obj.getComponent< TriFaceMapping >() )
+			{
+				indexMapping->setLods( std::move( lods ) );
+			}
+		}
+
 		if ( m_fileVersion < Version{ 1, 7, 0 }
 			&& obj.hasComponent( NormalsComponent::Name )
 			&& obj.hasComponent( Texcoords0Component::Name )
@@ -13,7 +13,7 @@
 #include "Castor3D/Scene/SceneNode.hpp"
 #include "Castor3D/Scene/Animation/SceneNodeAnimation.hpp"
 
-#include <CastorUtils/Data/BinaryFile.hpp>
+#include <CastorUtils/Data/VirtualFileSystem.hpp>
 
 namespace castor3d
 {
@@ -39,6 +39,21 @@ namespace castor3d
 
 			return name;
 		}
+
+		template< typename ParsedT >
+		static bool parseFile( castor::Path const & path
+			, ParsedT & parsed )
+		{
+			castor::ByteArray data;
+
+			if ( !castor::VirtualFileSystem::getSingleton().readFile( path, data ) )
+			{
+				log::error << cuT( "Couldn't read file [" ) << path << cuT( "]" ) << std::endl;
+				return false;
+			}
+
+			return BinaryParser< ParsedT >{}.parse( parsed, data );
+		}
 	}
 
 	//*********************************************************************************************
@@ -216,8 +231,7 @@ namespace castor3d
 
 	bool CmshMeshImporter::doImportMesh( Mesh & mesh )
 	{
-		castor::BinaryFile meshFile{ m_file->getFileName(), castor::File::OpenMode::eRead };
-		return BinaryParser< Mesh >{}.parse( mesh, meshFile );
+		return cmshimp::parseFile( m_file->getFileName(), mesh );
 	}
 
 	//*********************************************************************************************
@@ -236,8 +250,7 @@ namespace castor3d
 
 	bool CmshSkeletonImporter::doImportSkeleton( Skeleton & skeleton )
 	{
-		castor::BinaryFile skelFile{ m_file->getFileName(), castor::File::OpenMode::eRead };
-		return BinaryParser< Skeleton >{}.parse( skeleton, skelFile );
+		return cmshimp::parseFile( m_file->getFileName(), skeleton );
 	}
 
 	//*********************************************************************************************
@@ -258,8 +271,7 @@ namespace castor3d
 
 	bool CmshAnimationImporter::doImportSkeleton( SkeletonAnimation & animation )
 	{
-		castor::BinaryFile animFile{ m_file->getFileName(), castor::File::OpenMode::eRead };
-		auto result = BinaryParser< SkeletonAnimation >{}.parse( animation, animFile );
+		auto result = cmshimp::parseFile( m_file->getFileName(), animation );
 
 		if ( result )
 		{
@@ -273,8 +285,7 @@ namespace castor3d
 
 	bool CmshAnimationImporter::doImportMesh( MeshAnimation & animation )
 	{
-		castor::BinaryFile animFile{ m_file->getFileName(), castor::File::OpenMode::eRead };
-		auto result = BinaryParser< MeshAnimation >{}.parse( animation, animFile );
+		auto result = cmshimp::parseFile( m_file->getFileName(), animation );
 
 		if ( result )
 		{
@@ -288,8 +299,7 @@ namespace castor3d
 
 	bool CmshAnimationImporter::doImportNode( SceneNodeAnimation & animation )
 	{
-		castor::BinaryFile animFile{ m_file->getFileName(), castor::File::OpenMode::eRead };
-		auto result = BinaryParser< SceneNodeAnimation >{}.parse( animation, animFile );
+		auto result = cmshimp::parseFile( m_file->getFileName(), animation );
 
 		if ( result )
 		{
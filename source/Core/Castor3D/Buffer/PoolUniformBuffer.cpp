@@ -58,10 +58,43 @@ namespace castor3d
 	{
 		if ( m_buffer )
 		{
-			m_buffer->getBuffer().flush( 0u, ashes::WholeSize );
+			auto lock( castor::makeUniqueLock( m_dirtyMutex ) );
+			auto align = VkDeviceSize( m_renderSystem.getValue( GpuMin::eBufferMapSize ) );
+			auto & buffer = m_buffer->getBuffer();
+			mergeRanges( m_dirtyRanges, align );
+
+			for ( auto & range : m_dirtyRanges )
+			{
+				auto begin = ( range.begin / align ) * align;
+				auto end = ashes::getAlignedSize( range.end, align );
+
+				if ( end >= buffer.getSize() )
+				{
+					buffer.flush( begin, ashes::WholeSize );
+				}
+				else
+				{
+					buffer.flush( begin, end - begin );
+				}
+			}
+
+			m_dirtyRanges.clear();
 		}
 	}
 
+	void PoolUniformBuffer::markDirty( VkDeviceSize offset
+		, VkDeviceSize size )
+	{
+		auto lock( castor::makeUniqueLock( m_dirtyMutex ) );
+		m_dirtyRanges.push_back( { offset, offset + size } );
+	}
+
+	bool PoolUniformBuffer::hasDirty()const
+	{
+		auto lock( castor::makeUniqueLock( m_dirtyMutex ) );
+		return !m_dirtyRanges.empty();
+	}
+
 	bool PoolUniformBuffer::hasAvailable( VkDeviceSize size )const
 	{
 		return !hasAllocated()
@@ -0,0 +1,329 @@
+#include "Castor3D/Buffer/RingUploadData.hpp"
+
+#include "Castor3D/Engine.hpp"
+#include "Castor3D/Buffer/GpuBuffer.hpp"
+#include "Castor3D/Miscellaneous/Logger.hpp"
+#include "Castor3D/Render/RenderDevice.hpp"
+#include "Castor3D/Render/RenderSystem.hpp"
+
+#include <RenderGraph/FramePassTimer.hpp>
+
+#include <ashespp/Buffer/Buffer.hpp>
+#include <ashespp/Command/CommandPool.hpp>
+#include <ashespp/Image/Image.hpp>
+#include <ashespp/Sync/Queue.hpp>
+
+namespace castor3d
+{
+	namespace ringupld
+	{
+		static VkDeviceSize constexpr MinImageCopyAlign = 16u;
+	}
+
+	RingUploadData::RingUploadData( RenderDevice const & device
+		, std::string debugName
+		, ashes::CommandPool const & commandPool
+		, VkDeviceSize frameSize
+		, uint32_t frameCount )
+		: UploadData{ device, std::move( debugName ), nullptr }
+		, m_frameSize{ ashes::getAlignedSize( frameSize, ringupld::MinImageCopyAlign ) }
+		, m_alignment{ std::max( VkDeviceSize( m_device.renderSystem.getValue( GpuMin::eBufferMapSize ) )
+			, ringupld::MinImageCopyAlign ) }
+		, m_ring{ makeBufferBase( device
+			, m_frameSize * std::max( 1u, frameCount )
+			, VK_BUFFER_USAGE_TRANSFER_SRC_BIT
+			, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT
+			, m_debugName + "Ring" ) }
+		, m_timer{ castor::makeUnique< crg::FramePassTimer >( device.makeContext(), "Upload" ) }
+	{
+		m_mapped = m_ring->lock( 0u, ashes::WholeSize, 0u );
+
+		if ( !m_mapped )
+		{
+			log::error << "RingUploadData: Couldn't map staging ring [" << m_ring->getName() << "]" << std::endl;
+			CU_Failure( "Couldn't map staging ring" );
+		}
+
+		for ( uint32_t i = 0u; i < std::max( 1u, frameCount ); ++i )
+		{
+			auto name = m_debugName + std::to_string( i );
+			Frame frame;
+			frame.commandBuffer = commandPool.createCommandBuffer( name );
+			frame.semaphore = device->createSemaphore( name );
+			frame.fence = device->createFence( name );
+			frame.begin = m_frameSize * i;
+			frame.current = frame.begin;
+			m_frames.emplace_back( std::move( frame ) );
+		}
+
+		m_commandBuffer = m_frames.front().commandBuffer.get();
+		m_device.renderSystem.getEngine()->registerTimer( "Upload", *m_timer );
+	}
+
+	RingUploadData::~RingUploadData()noexcept
+	{
+		m_device.renderSystem.getEngine()->unregisterTimer( "Upload", *m_timer );
+
+		for ( auto & frame : m_frames )
+		{
+			if ( frame.submitted )
+			{
+				frame.fence->wait( ashes::MaxTimeout );
+			}
+		}
+
+		m_frames.clear();
+		m_ring->unlock();
+		log::info << "  Staging Ring total allocated size: " << m_ring->getSize() << " bytes" << std::endl;
+	}
+
+	void RingUploadData::doBegin()
+	{
+		auto & frame = m_frames[m_frameIndex];
+
+		if ( frame.submitted )
+		{
+			frame.fence->wait( ashes::MaxTimeout );
+			frame.fence->reset();
+			frame.submitted = false;
+		}
+
+		frame.current = frame.begin;
+		frame.overflow.clear();
+		frame.bufferCopies.clear();
+		frame.imageCopies.clear();
+		frame.uploadSize = 0u;
+		m_commandBuffer = frame.commandBuffer.get();
+		m_cpuBlock = std::make_unique< crg::FramePassTimerBlock >( m_timer->start() );
+		m_commandBuffer->begin( VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT );
+	}
+
+	void RingUploadData::doPreprocess( std::vector< BufferDataRange > *& pendingBuffers
+		, std::vector< ImageDataRange > *& pendingImages )
+	{
+		auto & engine = *m_device.renderSystem.getEngine();
+		m_commandBuffer->beginDebugBlock( { "Buffers Upload"
+			, makeFloatArray( engine.getNextRainbowColour() ) } );
+		m_timer->beginPass( *m_commandBuffer );
+		auto & frame = m_frames[m_frameIndex];
+		frame.bufferCopies.reserve( frame.bufferCopies.size() + m_pendingBuffers.size() );
+		frame.imageCopies.reserve( frame.imageCopies.size() + m_pendingImages.size() );
+		pendingBuffers = &m_pendingBuffers;
+		pendingImages = &m_pendingImages;
+	}
+
+	VkDeviceSize RingUploadData::doUpload( BufferDataRange & data )
+	{
+		if ( data.dstOffset + data.srcSize > data.dstBuffer->getSize() )
+		{
+			log::error << "RingUploadBuffer: Trying to copy more than there is in target [" << data.dstBuffer->getName()
+				<< "] buffer: dstOffset = " << data.dstOffset
+				<< ", size = " << data.srcSize << std::endl;
+			CU_Failure( "Trying to copy more than there is in target buffer" );
+		}
+
+		auto & frame = m_frames[m_frameIndex];
+		// Buffer to buffer copies have no alignment requirement, so ring chunks are packed tightly,
+		// allowing contiguous uploads to be merged into a single copy region.
+		frame.bufferCopies.push_back( { &data, doAllocate( frame, data.srcData, data.srcSize, 1u ) } );
+		frame.uploadSize += data.srcSize;
+		return data.srcSize;
+	}
+
+	VkDeviceSize RingUploadData::doUpload( ImageDataRange & data )
+	{
+		auto imgSize = data.dstImage->getMemoryRequirements().size;
+
+		if ( data.srcSize > imgSize )
+		{
+			log::error << "RingUploadImage: Trying to copy more than there can be in image [" << data.dstImage->getName()
+				<< "] device memory: size = " << data.srcSize << std::endl;
+			CU_Failure( "Trying to copy more than there can be in image" );
+		}
+
+		if ( data.dstRange.baseArrayLayer + data.dstRange.layerCount > data.dstImage->getLayerCount() )
+		{
+			log::error << "RingUploadImage: Trying to copy to invalid array layers for image [" << data.dstImage->getName()
+				<< "]: baseArrayLayer = " << data.dstRange.baseArrayLayer
+				<< ", layerCount = " << data.dstRange.layerCount << std::endl;
+			CU_Failure( "Trying to copy to invalid array layers for image" );
+		}
+
+		if ( data.dstRange.baseMipLevel + data.dstRange.levelCount > data.dstImage->getMipmapLevels() )
+		{
+			log::error << "RingUploadImage: Trying to copy to invalid mip levels for image [" << data.dstImage->getName()
+				<< "]: baseMipLevel = " << data.dstRange.baseMipLevel
+				<< ", levelCount = " << data.dstRange.levelCount << std::endl;
+			CU_Failure( "Trying to copy to invalid mip levels for image" );
+		}
+
+		auto & frame = m_frames[m_frameIndex];
+		frame.imageCopies.push_back( { &data, doAllocate( frame, data.srcData, data.srcSize, m_alignment ) } );
+		frame.uploadSize += data.srcSize;
+		return data.srcSize;
+	}
+
+	void RingUploadData::doPostprocess()
+	{
+		auto & frame = m_frames[m_frameIndex];
+
+		if ( !frame.bufferCopies.empty()
+			|| !frame.imageCopies.empty() )
+		{
+			m_commandBuffer->memoryBarrier( VK_PIPELINE_STAGE_HOST_BIT
+				, VK_PIPELINE_STAGE_TRANSFER_BIT
+				, m_ring->makeTransferSource() );
+
+			for ( auto & buffer : frame.overflow )
+			{
+				m_commandBuffer->memoryBarrier( VK_PIPELINE_STAGE_HOST_BIT
+					, VK_PIPELINE_STAGE_TRANSFER_BIT
+					, buffer->makeTransferSource() );
+			}
+
+			doCopyBuffers( frame );
+
+			for ( auto & [upload, src] : frame.imageCopies )
+			{
+				doUploadImage( *upload
+					, *src.buffer
+					, src.offset );
+			}
+
+			m_commandBuffer->memoryBarrier( VK_PIPELINE_STAGE_TRANSFER_BIT
+				, VK_PIPELINE_STAGE_HOST_BIT
+				, m_ring->makeHostWrite() );
+		}
+
+		m_timer->endPass( *m_commandBuffer );
+		m_commandBuffer->endDebugBlock();
+		m_timer->notifyPassRender( m_frameIndex );
+	}
+
+	UploadData::SemaphoreUsed RingUploadData::doEnd( ashes::Queue const & queue
+		, ashes::Fence const * fence
+		, castor::Milliseconds timeout )
+	{
+		auto & frame = m_frames[m_frameIndex];
+		m_commandBuffer->end();
+		m_cpuBlock = {};
+		queue.submit( getCommandBuffer()
+			, ( frame.used
+				? VkSemaphore{ VK_NULL_HANDLE }
+				: *frame.semaphore )
+			, ( frame.used
+				? VkPipelineStageFlagBits{}
+				: VK_PIPELINE_STAGE_TRANSFER_BIT )
+			, *frame.semaphore
+			, ( fence ? VkFence( *fence ) : VkFence( *frame.fence ) ) );
+		UploadData::SemaphoreUsed result{ frame.semaphore.get()
+			, &frame.used
+			, frame.uploadSize
+			, 1u + frame.overflow.size() };
+
+		if ( fence )
+		{
+			fence->wait( uint64_t( timeout.count() ) );
+			fence->reset();
+		}
+		else
+		{
+			frame.submitted = true;
+		}
+
+		m_frameIndex = ( m_frameIndex + 1u ) % uint32_t( m_frames.size() );
+		return result;
+	}
+
+	RingUploadData::StagingRange RingUploadData::doAllocate( Frame & frame
+		, void const * srcData
+		, VkDeviceSize srcSize
+		, VkDeviceSize alignment )
+	{
+		StagingRange result;
+		auto offset = frame.begin + ashes::getAlignedSize( frame.current - frame.begin, alignment );
+
+		if ( offset + srcSize <= frame.begin + m_frameSize )
+		{
+			result.buffer = m_ring.get();
+			result.offset = offset;
+			std::memcpy( m_mapped + offset, srcData, srcSize );
+			frame.current = offset + srcSize;
+			return result;
+		}
+
+		log::debug << "RingUpload: Frame ring is full, allocating overflow staging buffer of " << srcSize << " bytes" << std::endl;
+		auto buffer = makeBufferBase( m_device
+			, srcSize
+			, VK_BUFFER_USAGE_TRANSFER_SRC_BIT
+			, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT
+			, m_debugName + "Overflow" + std::to_string( frame.overflow.size() ) );
+
+		if ( auto mapped = buffer->lock( 0u, ashes::WholeSize, 0u ) )
+		{
+			std::memcpy( mapped, srcData, srcSize );
+			buffer->flush( 0u, ashes::WholeSize );
+			buffer->unlock();
+		}
+		else
+		{
+			log::error << "RingUpload: Couldn't map overflow staging buffer [" << buffer->getName() << "]" << std::endl;
+			CU_Failure( "Couldn't map overflow staging buffer" );
+		}
+
+		result.buffer = buffer.get();
+		frame.overflow.emplace_back( std::move( buffer ) );
+		return result;
+	}
+
+	void RingUploadData::doCopyBuffers( Frame const & frame )
+	{
+		auto it = frame.bufferCopies.begin();
+
+		while ( it != frame.bufferCopies.end() )
+		{
+			// Pending buffer uploads are sorted by destination buffer then offset,
+			// so copies to the same destination are consecutive.
+			auto & first = *it->data;
+			auto src = it->src.buffer;
+			std::vector< VkBufferCopy > regions;
+			regions.push_back( { it->src.offset, first.dstOffset, first.srcSize } );
+			++it;
+
+			while ( it != frame.bufferCopies.end()
+				&& it->src.buffer == src
+				&& it->data->dstBuffer == first.dstBuffer
+				&& it->data->dstAccessFlags == first.dstAccessFlags
+				&& it->data->dstPipelineFlags == first.dstPipelineFlags )
+			{
+				auto & region = regions.back();
+				auto & data = *it->data;
+
+				if ( data.dstOffset < region.dstOffset + region.size )
+				{
+					// Overlapping destination regions are not allowed within one copy command.
+					break;
+				}
+
+				if ( region.srcOffset + region.size == it->src.offset
+					&& region.dstOffset + region.size == data.dstOffset )
+				{
+					region.size += data.srcSize;
+				}
+				else
+				{
+					regions.push_back( { it->src.offset, data.dstOffset, data.srcSize } );
+				}
+
+				++it;
+			}
+
+			copyBuffer( *m_commandBuffer
+				, *src
+				, *first.dstBuffer
+				, regions
+				, first.dstAccessFlags
+				, first.dstPipelineFlags );
+		}
+	}
+}
@@ -59,7 +59,8 @@ namespace castor3d
 		{
 			for ( auto & buffer : bufferIt.second )
 			{
-				if ( buffer.buffer->hasAllocated() )
+				if ( buffer.buffer->hasAllocated()
+					&& buffer.buffer->hasDirty() )
 				{
 					auto & vkBuffer = buffer.buffer->getBuffer().getBuffer();
 					auto curFlags = vkBuffer.getCompatibleStageFlags();
@@ -21,6 +21,38 @@ CU_ImplementSmartPtr( castor3d, UploadData )
 
 namespace castor3d
 {
+	void mergeRanges( MemRangeArray & ranges
+		, VkDeviceSize mergeDistance )
+	{
+		if ( ranges.size() < 2u )
+		{
+			return;
+		}
+
+		std::sort( ranges.begin()
+			, ranges.end()
+			, []( MemRange const & lhs, MemRange const & rhs )noexcept
+			{
+				return lhs.begin < rhs.begin;
+			} );
+		auto dst = ranges.begin();
+
+		for ( auto it = std::next( ranges.begin() ); it != ranges.end(); ++it )
+		{
+			if ( it->begin <= dst->end + mergeDistance )
+			{
+				dst->end = std::max( dst->end, it->end );
+			}
+			else
+			{
+				++dst;
+				*dst = *it;
+			}
+		}
+
+		ranges.erase( std::next( dst ), ranges.end() );
+	}
+
 	std::ostream & operator<<( std::ostream & stream, VkImageSubresourceRange const & rhs )
 	{
 		stream << rhs.aspectMask
@@ -55,6 +87,7 @@ namespace castor3d
 			return;
 		}
 
+		m_pendingUploadSizes[dstBuffer.getName()] += srcSize;
 		BufferDataRange upload{ srcData, srcSize, &dstBuffer, dstOffset, dstAccessFlags, dstPipelineFlags };
 		auto it = std::lower_bound( m_pendingBuffers.begin()
 			, m_pendingBuffers.end()
@@ -80,6 +113,7 @@ namespace castor3d
 			return;
 		}
 
+		m_pendingUploadSizes[dstImage.getName()] += srcSize;
 		ImageDataRange upload{ srcData, srcSize, &dstImage, dstLayout, dstRange, dstImageLayout, dstPipelineFlags };
 		auto it = std::lower_bound( m_pendingImages.begin()
 			, m_pendingImages.end()
@@ -95,6 +129,39 @@ namespace castor3d
 		m_pendingImages.emplace( it, std::move( upload ) );
 	}
 
+	void UploadData::pushUpload( void const * srcData
+		, VkDeviceSize srcSize
+		, ashes::Image const & dstImage
+		, VkOffset3D dstOffset
+		, VkExtent3D dstExtent
+		, VkImageLayout dstImageLayout
+		, VkPipelineStageFlags dstPipelineFlags )
+	{
+		if ( !srcSize || !srcData || !dstExtent.width || !dstExtent.height )
+		{
+			return;
+		}
+
+		m_pendingUploadSizes[dstImage.getName()] += srcSize;
+		ImageDataRange upload{ srcData
+			, srcSize
+			, &dstImage
+			, castor::ImageLayout{}
+			, VkImageSubresourceRange{ ashes::getAspectMask( dstImage.getFormat() ), 0u, 1u, 0u, 1u }
+			, dstImageLayout
+			, dstPipelineFlags
+			, dstOffset
+			, dstExtent };
+		auto it = std::upper_bound( m_pendingImages.begin()
+			, m_pendingImages.end()
+			, upload
+			, []( ImageDataRange const & lhs, ImageDataRange const & rhs )noexcept
+			{
+				return lhs.dstImage < rhs.dstImage;
+			} );
+		m_pendingImages.emplace( it, std::move( upload ) );
+	}
+
 	void UploadData::process()
 	{
 		std::vector< BufferDataRange > * pendingBuffers;
@@ -131,6 +198,8 @@ namespace castor3d
 #endif
 		m_pendingBuffers.clear();
 		m_pendingImages.clear();
+		std::swap( m_uploadSizes, m_pendingUploadSizes );
+		m_pendingUploadSizes.clear();
 	}
 
 	UploadData::SemaphoreUsed UploadData::end( ashes::Queue const & queue
@@ -306,9 +375,34 @@ namespace castor3d
 			<< ")], Offset: " << srcOffset
 			<< ", Upload Size: " << data.srcSize
 			<< std::endl );
-		bool is3D = data.dstLayout.type == castor::ImageLayout::e3D;
 		auto & dstImage = *data.dstImage;
 
+		if ( data.dstExtent.width )
+		{
+			// Partial update, the current content must be kept, hence the transition from the current layout.
+			m_commandBuffer->memoryBarrier( data.dstPipelineFlags
+				, VK_PIPELINE_STAGE_TRANSFER_BIT
+				, dstImage.makeTransition( data.dstImageLayout
+					, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL
+					, data.dstRange ) );
+			m_commandBuffer->copyToImage( ashes::VkBufferImageCopyArray{ { srcOffset
+					, 0u
+					, 0u
+					, { data.dstRange.aspectMask, 0u, 0u, 1u }
+					, data.dstOffset
+					, data.dstExtent } }
+				, srcBuffer
+				, dstImage );
+			m_commandBuffer->memoryBarrier( VK_PIPELINE_STAGE_TRANSFER_BIT
+				, data.dstPipelineFlags
+				, dstImage.makeTransition( VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL
+					, data.dstImageLayout
+					, data.dstRange ) );
+			return;
+		}
+
+		bool is3D = data.dstLayout.type == castor::ImageLayout::e3D;
+
 		ashes::VkBufferImageCopyArray copies;
 		VkExtent3D baseDimensions{ dstImage.getDimensions().width
 			, dstImage.getDimensions().height
@@ -49,6 +49,7 @@
 #include <CastorUtils/Graphics/StbImageWriter.hpp>
 #include <CastorUtils/Graphics/XpmImageLoader.hpp>
 #include <CastorUtils/Miscellaneous/DynamicLibrary.hpp>
+#include <CastorUtils/Miscellaneous/Profiler.hpp>
 #include <CastorUtils/Pool/UniqueObjectPool.hpp>
 
 #include <ashespp/Image/StagingTexture.hpp>
@@ -159,6 +160,7 @@ namespace castor3d
 		, m_importerFileFactory{ castor::makeUnique< ImporterFileFactory >() }
 		, m_particleFactory{ castor::makeUnique< ParticleFactory >() }
 		, m_cpuJobs{ std::max( 8u, std::min( 4u, castor::CpuInformations{}.getCoreCount() / 2u ) ) }
+		, m_taskPool{ std::max( 1u, castor::CpuInformations{}.getCoreCount() ) - 1u }
 		, m_resources{ m_resourceHandler }
 	{
 		m_passFactory = castor::makeUnique< PassFactory >( *this );
@@ -175,6 +177,7 @@ namespace castor3d
 		castor::ExrImageLoader::registerLoader( m_imageLoader );
 		castor::XpmImageLoader::registerLoader( m_imageLoader );
 		castor::FreeImageLoader::registerLoader( m_imageLoader );
+		m_imageLoader.setTaskPool( &m_taskPool );
 		castor::StbImageWriter::registerWriter( m_imageWriter );
 		castor::GliImageWriter::registerWriter( m_imageWriter );
 
@@ -484,6 +487,7 @@ namespace castor3d
 
 	void Engine::update( CpuUpdater & updater )
 	{
+		CU_ProfileZone( "Engine::update(CPU)" );
 		getMaterialCache().update( updater );
 		getSceneCache().forEach( [&updater]( Scene & scene )
 			{
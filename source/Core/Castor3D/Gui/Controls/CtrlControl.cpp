@@ -136,6 +136,7 @@ namespace castor3d
 		updateClientRect();
 		doGetBackground().setPixelSize( m_size );
 		doSetSize( m_size );
+		doMarkIndexDirty();
 		onChanged( *this );
 	}
 
@@ -154,6 +155,7 @@ namespace castor3d
 		}
 
 		doSetPosition( m_position );
+		doMarkIndexDirty();
 		onChanged( *this );
 	}
 
@@ -190,9 +192,26 @@ namespace castor3d
 	{
 		doGetBackground().setVisible( value );
 		doSetVisible( value );
+		doMarkIndexDirty();
 		onChanged( *this );
 	}
 
+	void Control::doMarkIndexDirty()const
+	{
+		if ( m_ctrlManager )
+		{
+			m_ctrlManager->doMarkIndexDirty();
+		}
+	}
+
+	void Control::doMarkDirty()const
+	{
+		if ( m_ctrlManager )
+		{
+			m_ctrlManager->doMarkDirty();
+		}
+	}
+
 	castor::Position Control::getAbsolutePosition()const
 	{
 		ControlRPtr parent = getParent();
@@ -332,9 +351,12 @@ namespace castor3d
 
 	void Control::addChild( ControlRPtr control )
 	{
-		auto lock( castor::makeUniqueLock( m_mutexChildren ) );
-		m_children.push_back( control );
-		doAddChild( control );
+		{
+			auto lock( castor::makeUniqueLock( m_mutexChildren ) );
+			m_children.push_back( control );
+			doAddChild( control );
+		}
+		doMarkDirty();
 	}
 
 	void Control::removeChild( ControlRPtr control )
@@ -346,6 +368,8 @@ namespace castor3d
 		{
 			doRemoveChild( control );
 			m_children.erase( it );
+			lock.unlock();
+			doMarkDirty();
 		}
 	}
 
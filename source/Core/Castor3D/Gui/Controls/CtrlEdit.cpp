@@ -1007,25 +1007,7 @@ namespace castor3d
 		{
 			auto fontTexture = text->getFontTexture();
 			auto font = fontTexture->getFont();
-			std::vector< char32_t > newCaption;
-
-			for ( auto c : m_caption )
-			{
-				if ( !font->hasGlyphAt( c ) )
-				{
-					newCaption.push_back( c );
-				}
-			}
-
-			if ( !newCaption.empty() )
-			{
-				for ( auto c : newCaption )
-				{
-					font->loadGlyph( c );
-				}
-
-				fontTexture->update( true );
-			}
+			fontTexture->loadGlyphs( m_caption );
 
 			if ( !m_caption.empty() )
 			{
@@ -0,0 +1,136 @@
+#include "Castor3D/Gui/ControlsIndex.hpp"
+
+#include <CastorUtils/Config/BeginExternHeaderGuard.hpp>
+#include <algorithm>
+#include <limits>
+#include <CastorUtils/Config/EndExternHeaderGuard.hpp>
+
+namespace castor3d
+{
+	namespace ctrlidx
+	{
+		static bool isEmpty( ControlsIndex::Rect const & rect )
+		{
+			return rect.size.getWidth() == 0u
+				|| rect.size.getHeight() == 0u;
+		}
+
+		static uint32_t getCellsCount( int64_t extent
+			, uint32_t cellSize )
+		{
+			return uint32_t( ( extent + cellSize - 1 ) / cellSize );
+		}
+	}
+
+	//*********************************************************************************************
+
+	ControlsIndex::ControlsIndex( std::vector< Rect > rects
+		, uint32_t cellSize )
+		: m_rects{ std::move( rects ) }
+		, m_cellSize{ std::max( cellSize, 1u ) }
+	{
+		int64_t minX = std::numeric_limits< int64_t >::max();
+		int64_t minY = std::numeric_limits< int64_t >::max();
+		int64_t maxX = std::numeric_limits< int64_t >::lowest();
+		int64_t maxY = std::numeric_limits< int64_t >::lowest();
+
+		for ( auto & rect : m_rects )
+		{
+			if ( !ctrlidx::isEmpty( rect ) )
+			{
+				minX = std::min( minX, int64_t( rect.position.x() ) );
+				minY = std::min( minY, int64_t( rect.position.y() ) );
+				maxX = std::max( maxX, int64_t( rect.position.x() ) + rect.size.getWidth() );
+				maxY = std::max( maxY, int64_t( rect.position.y() ) + rect.size.getHeight() );
+			}
+		}
+
+		if ( minX >= maxX )
+		{
+			return;
+		}
+
+		while ( ctrlidx::getCellsCount( maxX - minX, m_cellSize ) > MaxCellsPerAxis
+			|| ctrlidx::getCellsCount( maxY - minY, m_cellSize ) > MaxCellsPerAxis )
+		{
+			m_cellSize *= 2u;
+		}
+
+		m_origin = castor::Position{ int32_t( minX ), int32_t( minY ) };
+		m_columns = ctrlidx::getCellsCount( maxX - minX, m_cellSize );
+		m_rows = ctrlidx::getCellsCount( maxY - minY, m_cellSize );
+		m_cellStarts.assign( size_t( m_columns ) * m_rows + 1u, 0u );
+
+		// Counts the rectangles per cell, then fills the cells in rectangles order, to keep them back to front.
+		auto forEachCell = [this]( Rect const & rect, auto function )
+		{
+			auto x0 = uint32_t( int64_t( rect.position.x() ) - m_origin.x() ) / m_cellSize;
+			auto y0 = uint32_t( int64_t( rect.position.y() ) - m_origin.y() ) / m_cellSize;
+			auto x1 = uint32_t( int64_t( rect.position.x() ) + rect.size.getWidth() - 1 - m_origin.x() ) / m_cellSize;
+			auto y1 = uint32_t( int64_t( rect.position.y() ) + rect.size.getHeight() - 1 - m_origin.y() ) / m_cellSize;
+
+			for ( auto y = y0; y <= y1; ++y )
+			{
+				for ( auto x = x0; x <= x1; ++x )
+				{
+					function( y * m_columns + x );
+				}
+			}
+		};
+
+		for ( auto & rect : m_rects )
+		{
+			if ( !ctrlidx::isEmpty( rect ) )
+			{
+				forEachCell( rect
+					, [this]( uint32_t cell )
+					{
+						++m_cellStarts[cell + 1u];
+					} );
+			}
+		}
+
+		for ( size_t i = 1u; i < m_cellStarts.size(); ++i )
+		{
+			m_cellStarts[i] += m_cellStarts[i - 1u];
+		}
+
+		m_cellItems.resize( m_cellStarts.back() );
+		auto cursors = m_cellStarts;
+
+		for ( uint32_t index = 0u; index < uint32_t( m_rects.size() ); ++index )
+		{
+			auto & rect = m_rects[index];
+
+			if ( !ctrlidx::isEmpty( rect ) )
+			{
+				forEachCell( rect
+					, [this, &cursors, index]( uint32_t cell )
+					{
+						m_cellItems[cursors[cell]++] = index;
+					} );
+			}
+		}
+	}
+
+	uint32_t ControlsIndex::doGetCell( castor::Position const & position )const
+	{
+		auto x = int64_t( position.x() ) - m_origin.x();
+		auto y = int64_t( position.y() ) - m_origin.y();
+
+		if ( x < 0 || y < 0 )
+		{
+			return InvalidIndex;
+		}
+
+		auto column = uint64_t( x ) / m_cellSize;
+		auto row = uint64_t( y ) / m_cellSize;
+
+		if ( column >= m_columns || row >= m_rows )
+		{
+			return InvalidIndex;
+		}
+
+		return uint32_t( row * m_columns + column );
+	}
+}
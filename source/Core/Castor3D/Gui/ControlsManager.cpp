@@ -988,6 +988,7 @@ namespace castor3d
 		}
 
 		m_controlsByZIndex.clear();
+		doStoreSnapshot( nullptr );
 		m_rootControls.clear();
 		m_controlsById.clear();
 		m_movedControl = {};
@@ -1009,22 +1010,24 @@ namespace castor3d
 			return m_resizedControl;
 		}
 
-		auto controls = doGetControlsByZIndex();
 		EventHandlerRPtr result{};
-		auto it = controls.rbegin();
 
-		while ( !result && it != controls.rend() )
+		if ( auto snapshot = doLoadSnapshot() )
 		{
-			ControlRPtr control = *it;
-
-			if ( control
-				&& !control->isBackgroundInvisible()
-				&& control->catchesMouseEvents()
-				&& control->getAbsolutePosition().x() <= position.x()
-				&& control->getAbsolutePosition().x() + int32_t( control->getSize().getWidth() ) > position.x()
-				&& control->getAbsolutePosition().y() <= position.y()
-				&& control->getAbsolutePosition().y() + int32_t( control->getSize().getHeight() ) > position.y() )
+			// The index gives the candidates, their current state is checked, in case they changed since the last update.
+			auto index = snapshot->index.pick( position
+				, [&snapshot, &position]( uint32_t lookup )
+				{
+					ControlRPtr control = snapshot->controls[lookup];
+					return control
+						&& !control->isBackgroundInvisible()
+						&& control->catchesMouseEvents()
+						&& ControlsIndex::contains( { control->getAbsolutePosition(), control->getSize() }, position );
+				} );
+
+			if ( index != ControlsIndex::InvalidIndex )
 			{
+				ControlRPtr control = snapshot->controls[index];
 				auto cursor = control->getCursor();
 
 				if ( control->isResizable() )
@@ -1054,8 +1057,6 @@ namespace castor3d
 				onCursorAction( cursor );
 				result = control;
 			}
-
-			++it;
 		}
 
 		if ( !result )
@@ -1068,42 +1069,72 @@ namespace castor3d
 
 	void ControlsManager::doUpdate()
 	{
-		std::vector< ControlRPtr > result;
-		std::vector< ControlRPtr > top;
-		auto controls = getRootControls();
-		result.reserve( controls.size() );
-		top.reserve( controls.size() );
-		uint32_t index{};
-
-		for ( auto control : controls )
+		if ( m_zIndexDirty.exchange( false ) )
 		{
-			if ( control )
+			std::vector< ControlRPtr > result;
+			std::vector< ControlRPtr > top;
+			auto controls = getRootControls();
+			result.reserve( controls.size() );
+			top.reserve( controls.size() );
+			uint32_t index{};
+
+			for ( auto control : controls )
+			{
+				if ( control )
+				{
+					control->updateZIndex( index, result, top );
+				}
+			}
+
+			for ( auto control : top )
 			{
-				control->updateZIndex( index, result, top );
+				control->adjustZIndex( index );
 			}
+
+			result.insert( result.end()
+				, top.begin()
+				, top.end() );
+			m_controlsByZIndex = std::move( result );
 		}
 
-		for ( auto control : top )
+		// Only the bounds are read here, the z-order is reused while the hierarchy doesn't change.
+		std::vector< ControlsIndex::Rect > rects;
+		rects.reserve( m_controlsByZIndex.size() );
+
+		for ( auto control : m_controlsByZIndex )
 		{
-			control->adjustZIndex( index );
+			if ( control )
+			{
+				rects.push_back( { control->getAbsolutePosition(), control->getSize() } );
+			}
+			else
+			{
+				rects.push_back( {} );
+			}
 		}
 
-		result.insert( result.end()
-			, top.begin()
-			, top.end() );
-		doSetControlsByZIndex( std::move( result ) );
+		auto snapshot = std::make_shared< ControlsSnapshot >();
+		snapshot->controls = m_controlsByZIndex;
+		snapshot->index = ControlsIndex{ std::move( rects ) };
+		doStoreSnapshot( std::move( snapshot ) );
 	}
 
-	void ControlsManager::doSetControlsByZIndex( std::vector< ControlRPtr > v )
+	ControlsManager::ControlsSnapshotPtr ControlsManager::doLoadSnapshot()const
 	{
-		ctrlmgr::LockType lock{ castor::makeUniqueLock( m_mutexControlsByZIndex ) };
-		m_controlsByZIndex = std::move( v );
+#if defined( __cpp_lib_atomic_shared_ptr )
+		return m_snapshot.load( std::memory_order_acquire );
+#else
+		return std::atomic_load_explicit( &m_snapshot, std::memory_order_acquire );
+#endif
 	}
 
-	std::vector< ControlRPtr > ControlsManager::doGetControlsByZIndex()const
+	void ControlsManager::doStoreSnapshot( ControlsSnapshotPtr snapshot )
 	{
-		ctrlmgr::LockType lock{ castor::makeUniqueLock( m_mutexControlsByZIndex ) };
-		return m_controlsByZIndex;
+#if defined( __cpp_lib_atomic_shared_ptr )
+		m_snapshot.store( std::move( snapshot ), std::memory_order_release );
+#else
+		std::atomic_store_explicit( &m_snapshot, std::move( snapshot ), std::memory_order_release );
+#endif
 	}
 
 	std::map< ControlID, ControlRPtr > ControlsManager::doGetControlsById()const
@@ -1113,6 +1144,12 @@ namespace castor3d
 	}
 
 	void ControlsManager::doMarkDirty()
+	{
+		m_zIndexDirty = true;
+		doMarkIndexDirty();
+	}
+
+	void ControlsManager::doMarkIndexDirty()
 	{
 		if ( !m_event )
 		{
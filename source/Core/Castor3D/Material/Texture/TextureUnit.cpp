@@ -13,6 +13,7 @@
 #include "Castor3D/Scene/Scene.hpp"
 #include "Castor3D/Scene/SceneFileParser.hpp"
 
+#include <CastorUtils/Data/VirtualFileSystem.hpp>
 #include <CastorUtils/Design/ResourceCache.hpp>
 #include <CastorUtils/FileParser/FileParser.hpp>
 #include <CastorUtils/FileParser/ParserParameter.hpp>
@@ -102,7 +103,7 @@ namespace castor3d
 				castor::Path relative;
 				params[0]->get( relative );
 
-				if ( castor::File::fileExists( context.file.getPath() / relative ) )
+				if ( castor::VirtualFileSystem::getSingleton().fileExists( context.file.getPath() / relative ) )
 				{
 					folder = context.file.getPath();
 					auto & engine = *parsingContext.parser->getEngine();
@@ -116,7 +117,7 @@ namespace castor3d
 						parsingContext.texture.image = engine.addImage( relative.getFileName(), img );
 					}
 				}
-				else if ( !castor::File::fileExists( relative ) )
+				else if ( !castor::VirtualFileSystem::getSingleton().fileExists( relative ) )
 				{
 					CU_ParsingError( cuT( "File [" ) + relative + cuT( "] not found, check the relativeness of the path" ) );
 					relative.clear();
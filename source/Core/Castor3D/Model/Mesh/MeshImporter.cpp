@@ -10,6 +10,8 @@
 #include "Castor3D/Scene/Scene.hpp"
 #include "Castor3D/Scene/SceneImporter.hpp"
 
+#include <CastorUtils/Miscellaneous/PreciseTimer.hpp>
+
 CU_ImplementSmartPtr( castor3d, MeshImporter )
 
 namespace castor3d
@@ -19,38 +21,41 @@ namespace castor3d
 		static void transformMesh( castor::Matrix4x4f const & transform
 			, Mesh & mesh )
 		{
-			for ( auto & submesh : mesh )
-			{
-				for ( auto & vertex : submesh->getPositions() )
+			mesh.getEngine()->getTaskPool().parallelFor( mesh.getSubmeshCount()
+				, [&transform, &mesh]( uint32_t index )
 				{
-					vertex = transform * vertex;
-				}
+					auto submesh = mesh.getSubmesh( index );
 
-				SubmeshUtils::computeNormals( submesh->getPositions()
-					, submesh->getNormals()
-					, static_cast< TriFaceMapping const & >( *submesh->getIndexMapping() ).getFaces() );
+					for ( auto & vertex : submesh->getPositions() )
+					{
+						vertex = transform * vertex;
+					}
 
-				static castor::Point4fArray tan;
-				static castor::Point3fArray tex;
-				castor::Point4fArray * tangents = &tan;
-				castor::Point3fArray const * texcoords = &tex;
+					SubmeshUtils::computeNormals( submesh->getPositions()
+						, submesh->getNormals()
+						, static_cast< TriFaceMapping const & >( *submesh->getIndexMapping() ).getFaces() );
 
-				if ( auto tanComp = submesh->getComponent< TangentsComponent >() )
-				{
-					tangents = &tanComp->getData();
-				}
+					castor::Point4fArray tan;
+					castor::Point3fArray tex;
+					castor::Point4fArray * tangents = &tan;
+					castor::Point3fArray const * texcoords = &tex;
 
-				if ( auto texComp = submesh->getComponent< Texcoords0Component >() )
-				{
-					texcoords = &texComp->getData();
-				}
+					if ( auto tanComp = submesh->getComponent< TangentsComponent >() )
+					{
+						tangents = &tanComp->getData();
+					}
 
-				SubmeshUtils::computeTangentsFromNormals( submesh->getPositions()
-					, *texcoords
-					, submesh->getNormals()
-					, *tangents
-					, static_cast< TriFaceMapping const & >( *submesh->getIndexMapping() ).getFaces() );
-			}
+					if ( auto texComp = submesh->getComponent< Texcoords0Component >() )
+					{
+						texcoords = &texComp->getData();
+					}
+
+					SubmeshUtils::computeTangentsFromNormals( submesh->getPositions()
+						, *texcoords
+						, submesh->getNormals()
+						, *tangents
+						, static_cast< TriFaceMapping const & >( *submesh->getIndexMapping() ).getFaces() );
+				} );
 		}
 	}
 
@@ -70,7 +75,11 @@ namespace castor3d
 
 		if ( !mesh.getSubmeshCount() || forceImport )
 		{
+			castor::PreciseTimer timer;
 			result = doImportMesh( mesh );
+			auto importTime = std::chrono::duration_cast< castor::Milliseconds >( timer.getElapsed() );
+			doFlushTangentSpaces();
+			auto tangentsTime = std::chrono::duration_cast< castor::Milliseconds >( timer.getElapsed() );
 
 			if ( result )
 			{
@@ -85,6 +94,8 @@ namespace castor3d
 					meshimp::transformMesh( transform, mesh );
 				}
 
+				auto transformTime = std::chrono::duration_cast< castor::Milliseconds >( timer.getElapsed() );
+
 				bool invertNormals{};
 
 				if ( parameters.get( "invert_normals", invertNormals )
@@ -107,12 +118,18 @@ namespace castor3d
 					MeshPreparer::prepare( mesh, parameters );
 				}
 
+				auto prepareTime = std::chrono::duration_cast< castor::Milliseconds >( timer.getElapsed() );
 				mesh.computeContainers();
 				log::info << "Loaded mesh [" << mesh.getName() << "]"
 					<< " AABB (" << print( mesh.getBoundingBox() ) << ")"
 					<< ", " << mesh.getVertexCount() << " vertices"
 					<< ", " << mesh.getFaceCount() << " faces"
 					<< ", " << mesh.getSubmeshCount() << " submeshes" << std::endl;
+				log::debug << "Mesh [" << mesh.getName() << "] import times"
+					<< " - Import: " << importTime.count() << "ms"
+					<< ", Tangent spaces: " << tangentsTime.count() << "ms"
+					<< ", Transform: " << transformTime.count() << "ms"
+					<< ", Preparation: " << prepareTime.count() << "ms" << std::endl;
 			}
 		}
 		else
@@ -158,4 +175,30 @@ namespace castor3d
 
 		return false;
 	}
+
+	void MeshImporter::doComputeTangentSpace( Submesh & submesh
+		, bool normals )
+	{
+		auto it = m_tangentSpaces.emplace( &submesh, normals ).first;
+		it->second = it->second || normals;
+	}
+
+	void MeshImporter::doFlushTangentSpaces()
+	{
+		std::vector< std::pair< Submesh *, bool > > submeshes{ m_tangentSpaces.begin(), m_tangentSpaces.end() };
+		m_tangentSpaces.clear();
+		getOwner()->getTaskPool().parallelFor( uint32_t( submeshes.size() )
+			, [&submeshes]( uint32_t index )
+			{
+				auto & [submesh, normals] = submeshes[index];
+				auto indexMapping = submesh->getIndexMapping();
+
+				if ( normals )
+				{
+					indexMapping->computeNormals();
+				}
+
+				indexMapping->computeTangents();
+			} );
+	}
 }
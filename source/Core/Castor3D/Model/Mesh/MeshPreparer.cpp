@@ -3,6 +3,7 @@
 #include "Castor3D/Config.hpp"
 #include "Castor3D/DebugDefines.hpp"
 #include "Castor3D/Engine.hpp"
+#include "Castor3D/Limits.hpp"
 #include "Castor3D/Model/Mesh/Mesh.hpp"
 #include "Castor3D/Model/Mesh/Submesh/Submesh.hpp"
 #include "Castor3D/Model/Mesh/Submesh/SubmeshUtils.hpp"
@@ -14,6 +15,8 @@
 #include "Castor3D/Render/RenderDevice.hpp"
 #include "Castor3D/Render/RenderSystem.hpp"
 
+#include <CastorUtils/Miscellaneous/PreciseTimer.hpp>
+
 #include <CastorUtils/Config/BeginExternHeaderGuard.hpp>
 #include <meshoptimizer.h>
 #include <CastorUtils/Config/EndExternHeaderGuard.hpp>
@@ -320,11 +323,104 @@ namespace castor3d
 				, remapped );
 		}
 
+		struct LodConfig
+		{
+			// The reduced levels count.
+			uint32_t count{};
+			// The indices count ratio between two successive levels.
+			float ratio{ 0.5f };
+			// The maximum simplification error, relative to the mesh extent.
+			float error{ 0.05f };
+		};
+
+		static LodConfig getLodConfig( Parameters const & parameters )
+		{
+			// Read as strings, to support both the importers and the generators parameters.
+			LodConfig result;
+			castor::String param;
+
+			if ( parameters.get( cuT( "lod_count" ), param ) )
+			{
+				result.count = std::min( castor::string::toUInt( param ), MaxSubmeshLods );
+			}
+
+			if ( parameters.get( cuT( "lod_ratio" ), param ) )
+			{
+				result.ratio = std::clamp( castor::string::toFloat( param ), 0.01f, 0.99f );
+			}
+
+			if ( parameters.get( cuT( "lod_error" ), param ) )
+			{
+				result.error = std::max( castor::string::toFloat( param ), 0.0f );
+			}
+
+			return result;
+		}
+
+		static std::vector< TriFaceMapping::Lod > buildLods( Remapped const & remapped
+			, LodConfig const & config )
+		{
+			std::vector< TriFaceMapping::Lod > result;
+			auto it = remapped.baseBuffers.find( SubmeshData::ePositions );
+			auto vertexCount = it->second.size();
+			auto positions = it->second.data()->constPtr();
+			// meshoptimizer errors are relative to the mesh extent, the stored ones are in object space units.
+			auto scale = meshopt_simplifyScale( positions
+				, vertexCount
+				, sizeof( castor::Point3f ) );
+			auto source = remapped.indices;
+			auto error = 0.0f;
+
+			for ( uint32_t level = 0u; level < config.count; ++level )
+			{
+				auto indexCount = source.size() * 3u;
+				auto targetCount = size_t( float( indexCount ) * config.ratio ) / 3u * 3u;
+
+				if ( targetCount < 3u )
+				{
+					break;
+				}
+
+				FaceArray faces( source.size() );
+				float levelError{};
+				auto count = meshopt_simplify( faces.data()->data()
+					, source.data()->data()
+					, indexCount
+					, positions
+					, vertexCount
+					, sizeof( castor::Point3f )
+					, targetCount
+					, config.error
+					, 0u
+					, &levelError );
+
+				// Stop when the simplifier can't reduce the mesh significantly anymore.
+				if ( count < 3u
+					|| float( count ) > float( indexCount ) * 0.95f )
+				{
+					break;
+				}
+
+				faces.resize( count / 3u );
+				meshopt_optimizeVertexCache( faces.data()->data()
+					, faces.data()->data()
+					, count
+					, vertexCount );
+				error = std::max( error, levelError * scale );
+				source = faces;
+				result.push_back( { std::move( faces ), error } );
+			}
+
+			return result;
+		}
+
 #if C3D_UseMeshShaders
 
-		static std::vector< Meshlet > buildMeshlets( Remapped const & remapped )
+		static std::vector< Meshlet > buildMeshlets( Remapped const & remapped
+			, uint32_t firstFace
+			, uint32_t faceCount )
 		{
-			auto indexCount = remapped.indices.size() * 3u;
+			auto indexCount = size_t( faceCount ) * 3u;
 			auto maxMeshlets = meshopt_buildMeshletsBound( indexCount
 				, MaxMeshletVertexCount
 				, MaxMeshletTriangleCount );
@@ -336,7 +432,7 @@ namespace castor3d
 			auto meshletCount = meshopt_buildMeshletsScan( meshlets.data()
 				, vertices.data()
 				, triangles.data()
-				, remapped.indices.data()->data()
+				, remapped.indices[firstFace].data()
 				, indexCount
 				, vertexCount
 				, MaxMeshletVertexCount
@@ -388,86 +484,247 @@ namespace castor3d
 
 #	endif
 #endif
-	}
 
-	bool MeshPreparer::prepare( Mesh & mesh
-		, Parameters const & parameters )
-	{
-		return std::all_of( mesh.begin()
-			, mesh.end()
-			, [&parameters]( SubmeshUPtr const & submesh )
-			{
-				return prepare( *submesh, parameters );
-			} );
-	}
+		// Bigger submeshes have their meshlets built by several jobs, the meshlets are only a bit less filled at the jobs bounds.
+		static uint32_t constexpr MeshletsJobFaces = 65536u;
 
-	bool MeshPreparer::prepare( Submesh & submesh
-		, Parameters const & parameters )
-	{
-		auto indexMapping = submesh.getIndexMapping();
+		struct Prepared
+		{
+			Submesh * submesh{};
+			TriFaceMapping * triangles{};
+			Remapped remapped;
+			std::vector< TriFaceMapping::Lod > lods;
+#if C3D_UseMeshShaders
+			std::vector< std::vector< Meshlet > > meshlets;
+#	if C3D_UseTaskShaders
+			std::vector< std::vector< MeshletCullData > > cullData;
+#	endif
+#endif
+		};
 
-		if ( !indexMapping || indexMapping->getComponentsCount() != 3u )
+		struct MeshletsJob
 		{
-			// Don't optimize non triangular meshes.
+			Prepared * prepared;
+			uint32_t index;
+			uint32_t firstFace;
+			uint32_t faceCount;
+		};
+
+		static bool optimise( Submesh & submesh
+			, Parameters const & parameters
+			, Prepared & prepared )
+		{
+			auto indexMapping = submesh.getIndexMapping();
+
+			if ( !indexMapping || indexMapping->getComponentsCount() != 3u )
+			{
+				// Don't optimize non triangular meshes.
+				return false;
+			}
+
+			prepared.submesh = &submesh;
+			prepared.triangles = &static_cast< TriFaceMapping & >( *indexMapping );
+			auto & remapped = prepared.remapped;
+			auto streams = gather( submesh
+				, *prepared.triangles
+				, remapped );
+			auto newVertexCount = remap( streams
+				, remapped );
+			optimizeCache( remapped
+				, newVertexCount );
+			optimizeOverdraw( remapped );
+			optimizeFetch( remapped );
+			auto lodConfig = getLodConfig( parameters );
+
+			if ( lodConfig.count )
+			{
+				// Generated after the fetch optimisation, since it remaps the vertices.
+				prepared.lods = buildLods( remapped, lodConfig );
+			}
+
 			return true;
 		}
 
-		auto & triangles = static_cast< TriFaceMapping & >( *indexMapping );
-		meshopt::Remapped remapped;
-		auto streams = meshopt::gather( submesh
-			, triangles
-			, remapped );
-		auto newVertexCount = meshopt::remap( streams
-			, remapped );
-		meshopt::optimizeCache( remapped
-			, newVertexCount );
-		meshopt::optimizeOverdraw( remapped );
-		meshopt::optimizeFetch( remapped );
+		static void addMeshletsJobs( Prepared & prepared
+			, std::vector< MeshletsJob > & jobs )
+		{
+#if C3D_UseMeshShaders
+			auto faceCount = uint32_t( prepared.remapped.indices.size() );
+			auto jobCount = ( faceCount + MeshletsJobFaces - 1u ) / MeshletsJobFaces;
+			prepared.meshlets.resize( jobCount );
+#	if C3D_UseTaskShaders
+			prepared.cullData.resize( jobCount );
+#	endif
 
+			for ( uint32_t index = 0u; index < jobCount; ++index )
+			{
+				auto firstFace = index * MeshletsJobFaces;
+				jobs.push_back( { &prepared
+					, index
+					, firstFace
+					, std::min( MeshletsJobFaces, faceCount - firstFace ) } );
+			}
+#endif
+		}
+
+		static void buildMeshlets( MeshletsJob const & job )
+		{
 #if C3D_UseMeshShaders
-		RenderDevice & device = submesh.getOwner()->getOwner()->getRenderSystem()->getRenderDevice();
+			auto & prepared = *job.prepared;
+			auto & meshlets = prepared.meshlets[job.index];
+			meshlets = buildMeshlets( prepared.remapped
+				, job.firstFace
+				, job.faceCount );
+#	if C3D_UseTaskShaders
+			prepared.cullData[job.index] = buildBoundingData( meshlets, prepared.remapped );
+#	endif
+#endif
+		}
 
-		if ( device.hasMeshAndTaskShaders() )
+		static void store( Prepared & prepared )
 		{
-			if ( auto meshlet = submesh.createComponent< MeshletComponent >() )
+			auto & submesh = *prepared.submesh;
+			auto & remapped = prepared.remapped;
+
+#if C3D_UseMeshShaders
+			if ( !prepared.meshlets.empty() )
 			{
-				auto meshlets = meshopt::buildMeshlets( remapped );
+				if ( auto meshlet = submesh.createComponent< MeshletComponent >() )
+				{
+					auto & meshlets = meshlet->getMeshletsData();
+#	if C3D_UseTaskShaders
+					auto & cullData = meshlet->getCullData();
+#	endif
+
+					for ( size_t index = 0u; index < prepared.meshlets.size(); ++index )
+					{
+						meshlets.insert( meshlets.end()
+							, prepared.meshlets[index].begin()
+							, prepared.meshlets[index].end() );
 #	if C3D_UseTaskShaders
-				auto cullData = meshopt::buildBoundingData( meshlets, remapped );
-				meshlet->getCullData() = std::move( cullData );
+						cullData.insert( cullData.end()
+							, prepared.cullData[index].begin()
+							, prepared.cullData[index].end() );
 #	endif
-				meshlet->getMeshletsData() = std::move( meshlets );
+					}
+				}
 			}
-		}
 #endif
 
-		triangles.getFaces() = std::move( remapped.indices );
+			prepared.triangles->getFaces() = std::move( remapped.indices );
+			prepared.triangles->setLods( std::move( prepared.lods ) );
 
-		for ( auto & data : remapped.baseBuffers )
-		{
-			submesh.setBaseData( data.first, std::move( data.second ) );
-		}
+			for ( auto & data : remapped.baseBuffers )
+			{
+				submesh.setBaseData( data.first, std::move( data.second ) );
+			}
 
-		if ( auto tangents = submesh.getComponent< TangentsComponent >() )
-		{
-			tangents->getData() = std::move( remapped.tangentBuffer );
+			if ( auto tangents = submesh.getComponent< TangentsComponent >() )
+			{
+				tangents->getData() = std::move( remapped.tangentBuffer );
+			}
+
+			if ( auto skin = submesh.getComponent< SkinComponent >() )
+			{
+				skin->getData() = std::move( remapped.skin );
+			}
+
+			if ( auto passMasks = submesh.getComponent< PassMasksComponent >() )
+			{
+				passMasks->getData() = std::move( remapped.passMasks );
+			}
+
+			if ( auto morph = submesh.getComponent< MorphComponent >() )
+			{
+				morph->getMorphTargetsBuffers() = std::move( remapped.morphTargets );
+			}
 		}
 
-		if ( auto skin = submesh.getComponent< SkinComponent >() )
+		static bool needsMeshlets( Engine & engine )
 		{
-			skin->getData() = std::move( remapped.skin );
+#if C3D_UseMeshShaders
+			return engine.getRenderSystem()->getRenderDevice().hasMeshAndTaskShaders();
+#else
+			return false;
+#endif
 		}
 
-		if ( auto passMasks = submesh.getComponent< PassMasksComponent >() )
+		static void prepare( Engine & engine
+			, castor::String const & name
+			, std::vector< Submesh * > const & submeshes
+			, Parameters const & parameters )
 		{
-			passMasks->getData() = std::move( remapped.passMasks );
+			auto & taskPool = engine.getTaskPool();
+			castor::PreciseTimer timer;
+			std::vector< Prepared > prepared( submeshes.size() );
+			taskPool.parallelFor( uint32_t( submeshes.size() )
+				, [&submeshes, &parameters, &prepared]( uint32_t index )
+				{
+					optimise( *submeshes[index], parameters, prepared[index] );
+				} );
+			auto optimiseTime = std::chrono::duration_cast< castor::Milliseconds >( timer.getElapsed() );
+
+			std::vector< MeshletsJob > jobs;
+
+			if ( needsMeshlets( engine ) )
+			{
+				for ( auto & submesh : prepared )
+				{
+					if ( submesh.submesh )
+					{
+						addMeshletsJobs( submesh, jobs );
+					}
+				}
+
+				taskPool.parallelFor( uint32_t( jobs.size() )
+					, [&jobs]( uint32_t index )
+					{
+						buildMeshlets( jobs[index] );
+					} );
+			}
+
+			auto meshletsTime = std::chrono::duration_cast< castor::Milliseconds >( timer.getElapsed() );
+			taskPool.parallelFor( uint32_t( prepared.size() )
+				, [&prepared]( uint32_t index )
+				{
+					if ( prepared[index].submesh )
+					{
+						store( prepared[index] );
+					}
+				} );
+			auto storeTime = std::chrono::duration_cast< castor::Milliseconds >( timer.getElapsed() );
+			log::debug << "Prepared mesh [" << name << "], " << submeshes.size() << " submeshes"
+				<< " - Optimisation: " << optimiseTime.count() << "ms"
+				<< ", Meshlets (" << jobs.size() << " jobs): " << meshletsTime.count() << "ms"
+				<< ", Storage: " << storeTime.count() << "ms" << std::endl;
 		}
+	}
 
-		if ( auto morph = submesh.getComponent< MorphComponent >() )
+	bool MeshPreparer::prepare( Mesh & mesh
+		, Parameters const & parameters )
+	{
+		std::vector< Submesh * > submeshes;
+		submeshes.reserve( mesh.getSubmeshCount() );
+
+		for ( auto & submesh : mesh )
 		{
-			morph->getMorphTargetsBuffers() = std::move( remapped.morphTargets );
+			submeshes.push_back( submesh.get() );
 		}
 
+		meshopt::prepare( *mesh.getEngine()
+			, mesh.getName()
+			, submeshes
+			, parameters );
+		return true;
+	}
+
+	bool MeshPreparer::prepare( Submesh & submesh
+		, Parameters const & parameters )
+	{
+		meshopt::prepare( *submesh.getOwner()->getEngine()
+			, submesh.getOwner()->getName()
+			, { &submesh }
+			, parameters );
 		return true;
 	}
 }
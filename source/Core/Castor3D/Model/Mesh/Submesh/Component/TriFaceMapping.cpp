@@ -47,6 +47,7 @@ namespace castor3d
 	void TriFaceMapping::clearFaces()
 	{
 		m_faces.clear();
+		m_lods.clear();
 	}
 
 	Face TriFaceMapping::addFace( uint32_t a, uint32_t b, uint32_t c )
@@ -168,10 +169,60 @@ namespace castor3d
 			, *tangents );
 	}
 
+	uint32_t TriFaceMapping::getLodsCount()const
+	{
+		return uint32_t( m_lods.size() );
+	}
+
+	uint32_t TriFaceMapping::getLodsElementsCount()const
+	{
+		uint32_t result{};
+
+		for ( auto & lod : m_lods )
+		{
+			result += uint32_t( lod.faces.size() );
+		}
+
+		return result;
+	}
+
+	uint32_t TriFaceMapping::selectLod( float pixelsPerUnit
+		, float pixelError )const
+	{
+		// The levels are sorted by increasing error, look for the coarsest tolerable one.
+		auto level = uint32_t( m_lods.size() );
+
+		while ( level > 0u
+			&& m_lods[level - 1u].error * pixelsPerUnit > pixelError )
+		{
+			--level;
+		}
+
+		return level;
+	}
+
+	castor::Point2ui TriFaceMapping::getLodIndexRange( uint32_t level )const
+	{
+		if ( level == 0u || level > m_lods.size() )
+		{
+			return castor::Point2ui{ 0u, uint32_t( m_faces.size() * 3u ) };
+		}
+
+		auto first = uint32_t( m_faces.size() );
+
+		for ( uint32_t i = 0u; i < level - 1u; ++i )
+		{
+			first += uint32_t( m_lods[i].faces.size() );
+		}
+
+		return castor::Point2ui{ first * 3u, uint32_t( m_lods[level - 1u].faces.size() * 3u ) };
+	}
+
 	SubmeshComponentUPtr TriFaceMapping::clone( Submesh & submesh )const
 	{
 		auto result = castor::makeUnique< TriFaceMapping >( submesh );
 		result->m_faces = m_faces;
+		result->m_lods = m_lods;
 		result->m_hasNormals = m_hasNormals;
 		result->m_cameraPosition = m_cameraPosition;
 		return castor::ptrRefCast< SubmeshComponent >( result );
@@ -180,6 +231,7 @@ namespace castor3d
 	void TriFaceMapping::doCleanup( RenderDevice const & device )
 	{
 		m_faces.clear();
+		m_lods.clear();
 	}
 
 	void TriFaceMapping::doUpload( UploadData & uploader )
@@ -196,6 +248,21 @@ namespace castor3d
 				, buffer.getOffset()
 				, VK_ACCESS_INDEX_READ_BIT
 				, VK_PIPELINE_STAGE_VERTEX_INPUT_BIT );
+			auto offset = buffer.getOffset() + m_faces.size() * sizeof( Face );
+
+			for ( auto & lod : m_lods )
+			{
+				if ( !lod.faces.empty() )
+				{
+					uploader.pushUpload( lod.faces.data()
+						, lod.faces.size() * sizeof( Face )
+						, buffer.getBuffer()
+						, offset
+						, VK_ACCESS_INDEX_READ_BIT
+						, VK_PIPELINE_STAGE_VERTEX_INPUT_BIT );
+					offset += lod.faces.size() * sizeof( Face );
+				}
+			}
 		}
 	}
 }
@@ -12,6 +12,8 @@
 #include "Castor3D/Model/Mesh/Submesh/Component/MeshletComponent.hpp"
 #include "Castor3D/Model/Mesh/Submesh/Component/MorphComponent.hpp"
 #include "Castor3D/Model/Mesh/Submesh/Component/PassMasksComponent.hpp"
+#include "Castor3D/Model/Mesh/Submesh/Component/TriFaceMapping.hpp"
+#include "Castor3D/Model/Mesh/Submesh/TriangleBvh.hpp"
 #include "Castor3D/Render/RenderNodesPass.hpp"
 #include "Castor3D/Render/RenderSystem.hpp"
 #include "Castor3D/Render/Node/SubmeshRenderNode.hpp"
@@ -230,7 +232,8 @@ namespace castor3d
 
 				if ( m_indexMapping )
 				{
-					indexCount = VkDeviceSize( m_indexMapping->getCount() ) * m_indexMapping->getComponentsCount();
+					// The reduced levels of detail are stored after the full detail indices.
+					indexCount = VkDeviceSize( m_indexMapping->getCount() + m_indexMapping->getLodsElementsCount() ) * m_indexMapping->getComponentsCount();
 				}
 
 				if ( isDynamic()
@@ -353,6 +356,11 @@ namespace castor3d
 			return;
 		}
 
+		{
+			auto lock( castor::makeUniqueLock( m_bvhMutex ) );
+			m_bvh.reset();
+		}
+
 		auto positions = getComponent< PositionsComponent >();
 
 		if ( positions && getPointsCount() )
@@ -445,6 +453,37 @@ namespace castor3d
 			, uint32_t( m_sourceBufferOffset ? m_sourceBufferOffset.getCount< castor::Point4f >( SubmeshFlag::ePositions ) : 0u ) } );
 	}
 
+	TriangleBvh const & Submesh::getBvh()const
+	{
+		auto lock( castor::makeUniqueLock( m_bvhMutex ) );
+
+		if ( !m_bvh )
+		{
+			static castor::Point3fArray const noPositions;
+			auto positions = getComponent< PositionsComponent >();
+			auto & points = positions
+				? positions->getData()
+				: noPositions;
+			auto triFaces = getComponent< TriFaceMapping >();
+			FaceArray faces;
+
+			if ( !triFaces
+				&& getTopology() == VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST )
+			{
+				// Non indexed triangles list.
+				for ( uint32_t i = 0u; i + 2u < uint32_t( points.size() ); i += 3u )
+				{
+					faces.emplace_back( i, i + 1u, i + 2u );
+				}
+			}
+
+			m_bvh = castor::makeUnique< TriangleBvh >( points
+				, triFaces ? triFaces->getFaces() : faces );
+		}
+
+		return *m_bvh;
+	}
+
 	int Submesh::isInMyPoints( castor::Point3f const & vertex
 		, double precision )
 	{
@@ -659,6 +698,10 @@ namespace castor3d
 		{
 		case castor3d::SubmeshData::ePositions:
 			getPositions() = std::move( data );
+			{
+				auto lock( castor::makeUniqueLock( m_bvhMutex ) );
+				m_bvh.reset();
+			}
 			break;
 		case castor3d::SubmeshData::eNormals:
 			getNormals() = std::move( data );
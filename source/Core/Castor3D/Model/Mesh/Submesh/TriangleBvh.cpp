@@ -0,0 +1,409 @@
+#include "Castor3D/Model/Mesh/Submesh/TriangleBvh.hpp"
+
+#include "Castor3D/Model/Mesh/Submesh/Component/Face.hpp"
+
+#include <CastorUtils/Config/BeginExternHeaderGuard.hpp>
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <CastorUtils/Config/EndExternHeaderGuard.hpp>
+
+CU_ImplementSmartPtr( castor3d, TriangleBvh )
+
+namespace castor3d
+{
+	namespace bvh
+	{
+		// Bounds the stack used by the traversal, deeper nodes are made leaves.
+		static uint32_t constexpr MaxDepth = 64u;
+
+		struct BuildTriangle
+		{
+			castor::Point3f min;
+			castor::Point3f max;
+			castor::Point3f centroid;
+			uint32_t face;
+		};
+
+		struct Bounds
+		{
+			castor::Point3f min{ std::numeric_limits< float >::max()
+				, std::numeric_limits< float >::max()
+				, std::numeric_limits< float >::max() };
+			castor::Point3f max{ std::numeric_limits< float >::lowest()
+				, std::numeric_limits< float >::lowest()
+				, std::numeric_limits< float >::lowest() };
+
+			void merge( castor::Point3f const & pmin
+				, castor::Point3f const & pmax )
+			{
+				for ( uint32_t i = 0u; i < 3u; ++i )
+				{
+					min[i] = std::min( min[i], pmin[i] );
+					max[i] = std::max( max[i], pmax[i] );
+				}
+			}
+
+			float getHalfArea()const
+			{
+				auto dx = max[0] - min[0];
+				auto dy = max[1] - min[1];
+				auto dz = max[2] - min[2];
+				return ( dx < 0.0f || dy < 0.0f || dz < 0.0f )
+					? 0.0f
+					: dx * dy + dy * dz + dz * dx;
+			}
+		};
+
+		struct Bin
+		{
+			Bounds bounds;
+			uint32_t count{};
+		};
+
+		struct Range
+		{
+			uint32_t node;
+			uint32_t begin;
+			uint32_t end;
+			uint32_t depth;
+		};
+
+		struct Split
+		{
+			float cost{ std::numeric_limits< float >::max() };
+			uint32_t axis{};
+			uint32_t bin{};
+		};
+
+		static uint32_t getBin( float value
+			, float min
+			, float scale )
+		{
+			return std::min( TriangleBvh::BinsCount - 1u
+				, uint32_t( ( value - min ) * scale ) );
+		}
+
+		static Split findSplit( std::vector< BuildTriangle > const & triangles
+			, Range const & range
+			, Bounds const & centroids )
+		{
+			Split result;
+
+			for ( uint32_t axis = 0u; axis < 3u; ++axis )
+			{
+				auto extent = centroids.max[axis] - centroids.min[axis];
+
+				if ( extent <= 0.0f )
+				{
+					continue;
+				}
+
+				std::array< Bin, TriangleBvh::BinsCount > bins{};
+				auto scale = float( TriangleBvh::BinsCount ) / extent;
+
+				for ( auto i = range.begin; i < range.end; ++i )
+				{
+					auto & triangle = triangles[i];
+					auto & bin = bins[getBin( triangle.centroid[axis], centroids.min[axis], scale )];
+					bin.bounds.merge( triangle.min, triangle.max );
+					++bin.count;
+				}
+
+				// Right side sweep, then left side sweep evaluating the planes between the bins.
+				std::array< float, TriangleBvh::BinsCount > rightCosts{};
+				Bounds right;
+				uint32_t rightCount{};
+
+				for ( auto i = TriangleBvh::BinsCount - 1u; i > 0u; --i )
+				{
+					right.merge( bins[i].bounds.min, bins[i].bounds.max );
+					rightCount += bins[i].count;
+					rightCosts[i] = rightCount
+						? right.getHalfArea() * float( rightCount )
+						: std::numeric_limits< float >::max();
+				}
+
+				Bounds left;
+				uint32_t leftCount{};
+
+				for ( uint32_t i = 0u; i < TriangleBvh::BinsCount - 1u; ++i )
+				{
+					left.merge( bins[i].bounds.min, bins[i].bounds.max );
+					leftCount += bins[i].count;
+
+					if ( leftCount == 0u
+						|| rightCosts[i + 1u] == std::numeric_limits< float >::max() )
+					{
+						continue;
+					}
+
+					auto cost = left.getHalfArea() * float( leftCount ) + rightCosts[i + 1u];
+
+					if ( cost < result.cost )
+					{
+						result = { cost, axis, i };
+					}
+				}
+			}
+
+			return result;
+		}
+
+		static bool intersectBox( castor::Point3f const & min
+			, castor::Point3f const & max
+			, castor::Point3f const & origin
+			, castor::Point3f const & invDirection
+			, float maxDistance
+			, float & nearDistance )
+		{
+			float tmin = 0.0f;
+			float tmax = maxDistance;
+
+			for ( uint32_t i = 0u; i < 3u; ++i )
+			{
+				auto t0 = ( min[i] - origin[i] ) * invDirection[i];
+				auto t1 = ( max[i] - origin[i] ) * invDirection[i];
+
+				if ( t0 > t1 )
+				{
+					std::swap( t0, t1 );
+				}
+
+				// Written so that a NaN (origin on a slab plane, null direction component) leaves the interval untouched.
+				tmin = t0 > tmin ? t0 : tmin;
+				tmax = t1 < tmax ? t1 : tmax;
+			}
+
+			nearDistance = tmin;
+			return tmin <= tmax;
+		}
+	}
+
+	//*********************************************************************************************
+
+	TriangleBvh::TriangleBvh( castor::Point3fArray const & positions
+		, FaceArray const & faces )
+	{
+		std::vector< bvh::BuildTriangle > triangles;
+		triangles.reserve( faces.size() );
+		auto count = uint32_t( positions.size() );
+
+		for ( uint32_t i = 0u; i < uint32_t( faces.size() ); ++i )
+		{
+			auto & face = faces[i];
+
+			if ( face[0] >= count || face[1] >= count || face[2] >= count )
+			{
+				continue;
+			}
+
+			bvh::Bounds bounds;
+			bounds.merge( positions[face[0]], positions[face[0]] );
+			bounds.merge( positions[face[1]], positions[face[1]] );
+			bounds.merge( positions[face[2]], positions[face[2]] );
+			triangles.push_back( { bounds.min
+				, bounds.max
+				, ( bounds.min + bounds.max ) * 0.5f
+				, i } );
+		}
+
+		if ( triangles.empty() )
+		{
+			return;
+		}
+
+		m_nodes.reserve( 2u * triangles.size() );
+		m_triangles.reserve( triangles.size() );
+		m_nodes.push_back( {} );
+		std::vector< bvh::Range > ranges{ { 0u, 0u, uint32_t( triangles.size() ), 0u } };
+
+		while ( !ranges.empty() )
+		{
+			auto range = ranges.back();
+			ranges.pop_back();
+			bvh::Bounds bounds;
+			bvh::Bounds centroids;
+
+			for ( auto i = range.begin; i < range.end; ++i )
+			{
+				bounds.merge( triangles[i].min, triangles[i].max );
+				centroids.merge( triangles[i].centroid, triangles[i].centroid );
+			}
+
+			m_nodes[range.node].min = bounds.min;
+			m_nodes[range.node].max = bounds.max;
+			auto triCount = range.end - range.begin;
+
+			if ( triCount <= MaxLeafTriangles
+				|| range.depth + 1u >= bvh::MaxDepth )
+			{
+				m_nodes[range.node].index = uint32_t( m_triangles.size() );
+				m_nodes[range.node].count = triCount;
+
+				for ( auto i = range.begin; i < range.end; ++i )
+				{
+					auto & triangle = triangles[i];
+					auto & face = faces[triangle.face];
+					auto & v0 = positions[face[0]];
+					m_triangles.push_back( { v0
+						, positions[face[1]] - v0
+						, positions[face[2]] - v0
+						, triangle.face } );
+				}
+
+				continue;
+			}
+
+			auto split = bvh::findSplit( triangles, range, centroids );
+			auto middle = range.begin + triCount / 2u;
+
+			if ( split.cost < std::numeric_limits< float >::max() )
+			{
+				auto axis = split.axis;
+				auto min = centroids.min[axis];
+				auto scale = float( BinsCount ) / ( centroids.max[axis] - min );
+				auto it = std::partition( triangles.begin() + range.begin
+					, triangles.begin() + range.end
+					, [axis, min, scale, &split]( bvh::BuildTriangle const & triangle )
+					{
+						return bvh::getBin( triangle.centroid[axis], min, scale ) <= split.bin;
+					} );
+				middle = uint32_t( std::distance( triangles.begin(), it ) );
+			}
+			// else all the centroids are the same, any split is as good as another.
+
+			auto left = uint32_t( m_nodes.size() );
+			m_nodes[range.node].index = left;
+			m_nodes[range.node].count = 0u;
+			m_nodes.push_back( {} );
+			m_nodes.push_back( {} );
+			ranges.push_back( { left, range.begin, middle, range.depth + 1u } );
+			ranges.push_back( { left + 1u, middle, range.end, range.depth + 1u } );
+		}
+	}
+
+	bool TriangleBvh::intersect( castor::Point3f const & origin
+		, castor::Point3f const & direction
+		, float maxDistance
+		, Hit & hit )const
+	{
+		if ( m_nodes.empty() )
+		{
+			return false;
+		}
+
+		castor::Point3f invDirection{ 1.0f / direction[0]
+			, 1.0f / direction[1]
+			, 1.0f / direction[2] };
+		float nearest = maxDistance;
+		float distance{};
+
+		if ( !bvh::intersectBox( m_nodes[0].min, m_nodes[0].max, origin, invDirection, nearest, distance ) )
+		{
+			return false;
+		}
+
+		struct Entry
+		{
+			uint32_t node;
+			float distance;
+		};
+		std::array< Entry, bvh::MaxDepth > stack;
+		uint32_t size{};
+		stack[size++] = { 0u, distance };
+		bool result = false;
+
+		while ( size )
+		{
+			auto entry = stack[--size];
+
+			if ( entry.distance > nearest )
+			{
+				continue;
+			}
+
+			auto & node = m_nodes[entry.node];
+
+			if ( node.count )
+			{
+				for ( auto i = node.index; i < node.index + node.count; ++i )
+				{
+					// Möller-Trumbore.
+					auto & triangle = m_triangles[i];
+					auto p = castor::point::cross( direction, triangle.e2 );
+					auto det = castor::point::dot( triangle.e1, p );
+
+					if ( std::abs( det ) < std::numeric_limits< float >::min() )
+					{
+						continue;
+					}
+
+					auto invDet = 1.0f / det;
+					auto s = origin - triangle.v0;
+					auto u = castor::point::dot( s, p ) * invDet;
+
+					if ( u < 0.0f || u > 1.0f )
+					{
+						continue;
+					}
+
+					auto q = castor::point::cross( s, triangle.e1 );
+					auto v = castor::point::dot( direction, q ) * invDet;
+
+					if ( v < 0.0f || u + v > 1.0f )
+					{
+						continue;
+					}
+
+					auto t = castor::point::dot( triangle.e2, q ) * invDet;
+
+					if ( t > 0.0f && t < nearest )
+					{
+						nearest = t;
+						hit = { triangle.face, t, castor::Point2f{ u, v } };
+						result = true;
+					}
+				}
+			}
+			else
+			{
+				// Nearest child last, so that it is visited first.
+				Entry lhs{ node.index, 0.0f };
+				Entry rhs{ node.index + 1u, 0.0f };
+				auto & lhsNode = m_nodes[lhs.node];
+				auto & rhsNode = m_nodes[rhs.node];
+				auto lhsHit = bvh::intersectBox( lhsNode.min, lhsNode.max, origin, invDirection, nearest, lhs.distance );
+				auto rhsHit = bvh::intersectBox( rhsNode.min, rhsNode.max, origin, invDirection, nearest, rhs.distance );
+
+				if ( lhsHit && rhsHit )
+				{
+					if ( lhs.distance < rhs.distance )
+					{
+						std::swap( lhs, rhs );
+					}
+
+					stack[size++] = lhs;
+					stack[size++] = rhs;
+				}
+				else if ( lhsHit )
+				{
+					stack[size++] = lhs;
+				}
+				else if ( rhsHit )
+				{
+					stack[size++] = rhs;
+				}
+			}
+		}
+
+		return result;
+	}
+
+	castor::BoundingBox TriangleBvh::getBoundingBox()const
+	{
+		return m_nodes.empty()
+			? castor::BoundingBox{}
+			: castor::BoundingBox{ m_nodes[0].min, m_nodes[0].max };
+	}
+}
@@ -16,6 +16,8 @@
 #include <ashespp/Core/Device.hpp>
 #include <ashespp/Miscellaneous/QueryPool.hpp>
 
+#include <CastorUtils/Miscellaneous/Profiler.hpp>
+
 #include <RenderGraph/FramePassTimer.hpp>
 
 #include <iomanip>
@@ -477,6 +479,13 @@ namespace castor3d
 			m_gpu.time += timer.first->getGpuTime();
 			timer.first->reset();
 		}
+
+		auto & profiler = castor::Profiler::getSingleton();
+
+		if ( profiler.isEnabled() && m_gpu.time > 0_ns )
+		{
+			profiler.addGpuZone( m_name, m_gpu.time );
+		}
 	}
 
 	bool DebugOverlays::PassOverlays::update( uint32_t & top )
@@ -1256,6 +1265,24 @@ namespace castor3d
 		m_debugPanel->addCountPanel( cuT( "StagingBuffersCount" )
 			, cuT( "Upload Buffers:" )
 			, m_renderInfo.stagingBuffersCount );
+		m_debugPanel->addCountPanel( cuT( "FrameAllocationsCount" )
+			, cuT( "Frame Allocations:" )
+			, m_renderInfo.frameAllocationsCount );
+		m_debugPanel->addCountPanel( cuT( "FrameAllocatedSize" )
+			, cuT( "Frame Allocated Size:" )
+			, m_renderInfo.frameAllocatedSize );
+		m_debugPanel->addCountPanel( cuT( "ShadowMapsCount" )
+			, cuT( "Shadow Maps:" )
+			, m_renderInfo.shadowMapsCount );
+		m_debugPanel->addCountPanel( cuT( "ShadowMapsRendered" )
+			, cuT( "Rendered Shadow Maps:" )
+			, m_renderInfo.shadowMapsRendered );
+		m_debugPanel->addCountPanel( cuT( "ShadowMapsDeferred" )
+			, cuT( "Deferred Shadow Maps:" )
+			, m_renderInfo.shadowMapsDeferred );
+		m_debugPanel->addCountPanel( cuT( "ShadowMapsCached" )
+			, cuT( "Cached Shadow Maps:" )
+			, m_renderInfo.shadowMapsCached );
 		m_debugPanel->setVisible( m_visible );
 	}
 
@@ -11,6 +11,7 @@
 #include <CastorUtils/Design/ResourceCache.hpp>
 #include <CastorUtils/Graphics/Font.hpp>
 #include <CastorUtils/Graphics/Image.hpp>
+#include <CastorUtils/Miscellaneous/BitSize.hpp>
 
 CU_ImplementSmartPtr( castor3d, FontTexture )
 
@@ -20,6 +21,33 @@ namespace castor3d
 
 	namespace fonttex
 	{
+		static uint32_t constexpr GlyphPadding = 1u;
+		static uint32_t constexpr MinAtlasWidth = 256u;
+		static uint32_t constexpr MinAtlasHeight = 64u;
+		static uint32_t constexpr MaxAtlasSize = 4096u;
+		static uint32_t constexpr NoShelf = ~0u;
+		static uint64_t constexpr PinnedShelf = ~0ull;
+
+		static uint32_t getPowerOfTwo( uint32_t value )
+		{
+			return castor::isPowerOfTwo( value )
+				? value
+				: castor::getNextPowerOfTwo( value );
+		}
+
+		static castor::Size getInitialSize( castor::Font const & font )
+		{
+			uint32_t const cellWidth = font.getMaxWidth() + GlyphPadding;
+			uint32_t const cellHeight = font.getMaxHeight() + GlyphPadding;
+			uint32_t const count = std::max( 1u, uint32_t( std::distance( font.begin(), font.end() ) ) );
+			uint32_t const width = std::min( MaxAtlasSize
+				, std::max( MinAtlasWidth, getPowerOfTwo( cellWidth * 16u ) ) );
+			uint32_t const perLine = std::max( 1u, width / cellWidth );
+			uint32_t const height = std::min( MaxAtlasSize
+				, std::max( MinAtlasHeight, getPowerOfTwo( castor::divRoundUp( count, perLine ) * cellHeight ) ) );
+			return { width, height };
+		}
+
 		static TextureLayoutUPtr createTexture( Engine & engine, castor::FontResPtr font )
 		{
 			if ( !font )
@@ -27,14 +55,11 @@ namespace castor3d
 				CU_Exception( "No Font given to FontTexture" );
 			}
 
-			uint32_t const maxWidth = font->getMaxWidth();
-			uint32_t const maxHeight = font->getMaxHeight();
-			uint32_t const count = castor::divRoundUp( uint32_t( std::distance( font->begin(), font->end() ) ), 16u );
-
+			auto size = getInitialSize( *font );
 			ashes::ImageCreateInfo image{ 0u
 				, VK_IMAGE_TYPE_2D
 				, VK_FORMAT_R8_UNORM
-				, { maxWidth * 16, maxHeight * count, 1u }
+				, { size.getWidth(), size.getHeight(), 1u }
 				, 1u
 				, 1u
 				, VK_SAMPLE_COUNT_1_BIT
@@ -72,6 +97,9 @@ namespace castor3d
 			, *engine.getRenderDevice()
 			, *this
 			, MaxCharsPerBuffer ) }
+		, m_atlasSize{ fonttex::getInitialSize( *font ) }
+		, m_textureSize{ m_atlasSize }
+		, m_pendingSize{ m_atlasSize }
 	{
 		if ( !m_font )
 		{
@@ -86,6 +114,26 @@ namespace castor3d
 			sampler->setMagFilter( VK_FILTER_LINEAR );
 			m_sampler = sampler;
 		}
+
+		// The atlas is sized to hold the glyphs already loaded in the font, so it can't grow nor evict here.
+		m_atlas.resize( size_t( m_atlasSize.getWidth() ) * m_atlasSize.getHeight() );
+		castor::U32String preloaded{ U'?' };
+
+		for ( auto & glyph : *m_font )
+		{
+			preloaded += glyph.getCharacter();
+		}
+
+		std::vector< char32_t > added;
+		bool moved{};
+		bool grown{};
+		doLoadGlyphs( preloaded, added, moved, grown );
+		m_glyphMisses = 0u;
+
+		for ( auto c : added )
+		{
+			m_buffer->add( m_font->getGlyphAt( c ) );
+		}
 	}
 
 	FontTexture::~FontTexture()noexcept
@@ -107,18 +155,41 @@ namespace castor3d
 	void FontTexture::upload( UploadData & uploader )
 	{
 		auto & resource = doGetResource();
-
-		if ( resource.needsUpload )
 		{
-			resource.resource->upload( uploader );
-			resource.needsUpload = false;
-		}
+			auto lock( castor::makeUniqueLock( m_atlasMutex ) );
 
-		m_buffer->update( uploader );
+			if ( resource.needsUpload )
+			{
+				resource.resource->upload( uploader );
+				resource.needsUpload = false;
+			}
+			else if ( m_dirtyBegin < m_dirtyEnd
+				&& m_textureSize == m_atlasSize
+				&& resource.resource->isInitialised() )
+			{
+				// Only the modified rows are uploaded, from a copy that stays alive until the uploader processes it.
+				auto const width = m_atlasSize.getWidth();
+				m_staging.assign( m_atlas.begin() + ptrdiff_t( size_t( m_dirtyBegin ) * width )
+					, m_atlas.begin() + ptrdiff_t( size_t( m_dirtyEnd ) * width ) );
+				uploader.pushUpload( m_staging.data()
+					, m_staging.size()
+					, resource.resource->getTexture()
+					, VkOffset3D{ 0, int32_t( m_dirtyBegin ), 0 }
+					, VkExtent3D{ width, m_dirtyEnd - m_dirtyBegin, 1u }
+					, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL
+					, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT );
+				m_dirtyBegin = ~0u;
+				m_dirtyEnd = 0u;
+			}
+
+			++m_frameIndex;
+			m_buffer->update( uploader );
+		}
 	}
 
 	castor::UInt32Array FontTexture::convert( castor::U32String const & text )const
 	{
+		auto lock( castor::makeUniqueLock( m_atlasMutex ) );
 		castor::UInt32Array result;
 		result.resize( text.size() );
 		auto defaultIt = m_charIndices.find( U'?' );
@@ -139,21 +210,78 @@ namespace castor3d
 		return result;
 	}
 
+	bool FontTexture::loadGlyphs( castor::U32String const & text )
+	{
+		std::vector< char32_t > added;
+		bool moved{};
+		bool grown{};
+		{
+			auto lock( castor::makeUniqueLock( m_atlasMutex ) );
+			doLoadGlyphs( text, added, moved, grown );
+
+			for ( auto c : added )
+			{
+				m_buffer->add( m_font->getGlyphAt( c ) );
+			}
+
+			if ( moved )
+			{
+				m_buffer->markDirty();
+			}
+		}
+
+		if ( grown )
+		{
+			update( true );
+		}
+		else if ( moved )
+		{
+			// Evicted glyphs may still be displayed by other overlays, they need to request them again.
+			onResourceChanged( *this );
+		}
+
+		return moved || !added.empty();
+	}
+
 	castor::String const & FontTexture::getFontName()const
 	{
 		return getFont()->getName();
 	}
 
-	castor::Position const & FontTexture::getGlyphPosition( char32_t glyphChar )const
+	castor::Position FontTexture::getGlyphPosition( char32_t glyphChar )const
 	{
-		auto it = m_frontGlyphsPositions.find( glyphChar );
+		auto lock( castor::makeUniqueLock( m_atlasMutex ) );
+		return doGetGlyphPosition( glyphChar );
+	}
 
-		if ( it == m_frontGlyphsPositions.end() )
-		{
-			return getGlyphPosition( U'?' );
-		}
+	uint32_t FontTexture::getGlyphMisses()const
+	{
+		auto lock( castor::makeUniqueLock( m_atlasMutex ) );
+		return m_glyphMisses;
+	}
+
+	uint32_t FontTexture::getEvictedGlyphs()const
+	{
+		auto lock( castor::makeUniqueLock( m_atlasMutex ) );
+		return m_evictedGlyphs;
+	}
+
+	uint32_t FontTexture::getResidentGlyphs()const
+	{
+		auto lock( castor::makeUniqueLock( m_atlasMutex ) );
+		return uint32_t( m_residents.size() );
+	}
 
-		return it->second;
+	float FontTexture::getOccupancy()const
+	{
+		auto lock( castor::makeUniqueLock( m_atlasMutex ) );
+		return float( double( m_usedArea ) / double( m_atlas.size() ) );
+	}
+
+	castor::Size FontTexture::getAtlasSize()const
+	{
+		auto lock( castor::makeUniqueLock( m_atlasMutex ) );
+		return m_atlasSize;
 	}
 
 	void FontTexture::initialiseResource( Resource & resource
@@ -171,70 +299,256 @@ namespace castor3d
 	void FontTexture::updateResource( Resource & resource
 		, bool front )
 	{
-		if ( auto font = getFont() )
-		{
-			auto & glyphPositions = front ? m_frontGlyphsPositions : m_backGlyphsPositions;
-			uint32_t const maxWidth = font->getMaxWidth();
-			uint32_t const maxHeight = font->getMaxHeight();
-			uint32_t const count = castor::divRoundUp( uint32_t( std::distance( font->begin(), font->end() ) ), 16u );
-			castor::Size size{ maxWidth * 16, maxHeight * count };
-			m_buffer->setMaxHeight( font->getMaxHeight() );
-			m_buffer->setImgWidth( size.getWidth() );
-			m_buffer->setImgHeight( size.getHeight() );
-			resource.resource->setSource( castor::PxBufferBase::create( castor::Size( maxWidth * 16, maxHeight * count )
-				, castor::PixelFormat::eR8_UNORM ), true );
-			auto & image = resource.resource->getImage();
-
-			auto it = font->begin();
-			castor::Size const & sizeImg = size;
-			uint32_t const imgLineSize = sizeImg.getWidth();
-			uint32_t offY = sizeImg.getHeight() - maxHeight;
-			auto buffer = image.getBuffer();
-			uint8_t * dstBuffer = buffer.data();
-
-			for ( uint32_t y = 0; y < count && it != font->end(); ++y )
+		auto lock( castor::makeUniqueLock( m_atlasMutex ) );
+		resource.resource->setSource( castor::PxBufferBase::create( m_atlasSize
+			, castor::PixelFormat::eR8_UNORM
+			, m_atlas.data()
+			, castor::PixelFormat::eR8_UNORM ), true );
+		resource.needsUpload = true;
+		m_buffer->setMaxHeight( m_font->getMaxHeight() );
+
+		if ( front )
+		{
+			m_textureSize = m_atlasSize;
+			m_buffer->setImgWidth( m_textureSize.getWidth() );
+			m_buffer->setImgHeight( m_textureSize.getHeight() );
+		}
+		else
+		{
+			m_pendingSize = m_atlasSize;
+		}
+	}
+
+	void FontTexture::swapResources()
+	{
+		auto lock( castor::makeUniqueLock( m_atlasMutex ) );
+		m_textureSize = m_pendingSize;
+		m_buffer->setImgWidth( m_textureSize.getWidth() );
+		m_buffer->setImgHeight( m_textureSize.getHeight() );
+		// The glyphs placed since the back resource was filled are not in it yet.
+		doMarkDirty( 0u, m_textureSize.getHeight() );
+	}
+
+	void FontTexture::doLoadGlyphs( castor::U32String const & text
+		, std::vector< char32_t > & added
+		, bool & moved
+		, bool & grown )
+	{
+		for ( auto c : text )
+		{
+			auto it = m_residents.find( c );
+
+			if ( it != m_residents.end() )
 			{
-				uint32_t offX = 0;
+				if ( it->second != fonttex::NoShelf )
+				{
+					auto & shelf = m_shelves[it->second];
+					shelf.lastUse = std::max( shelf.lastUse, m_frameIndex );
+				}
+
+				continue;
+			}
+
+			++m_glyphMisses;
 
-				for ( uint32_t x = 0; x < 16 && it != font->end(); ++x )
+			if ( !m_font->hasGlyphAt( c ) )
+			{
+				m_font->loadGlyph( c );
+			}
+
+			if ( doPlaceGlyph( m_font->getGlyphAt( c ), moved, grown ) )
+			{
+				if ( m_charIndices.emplace( c, uint32_t( m_charIndices.size() ) ).second )
 				{
-					castor::Glyph const & glyph = *it;
-					castor::Size const & glyphSize = glyph.getSize();
-					auto srcGlyphBuffer = glyph.getBitmap().data();
-					uint32_t dstGlyphIndex = ( imgLineSize * offY ) + offX;
-					uint8_t * dstGlyphBuffer = &dstBuffer[dstGlyphIndex];
-
-					for ( uint32_t i = 0; i < glyphSize.getHeight(); ++i )
-					{
-						CU_Ensure( size_t( dstGlyphIndex ) + glyphSize.getWidth() <= buffer.size() );
-						std::memcpy( dstGlyphBuffer, srcGlyphBuffer, glyphSize.getWidth() );
-						dstGlyphBuffer += imgLineSize;
-						dstGlyphIndex += imgLineSize;
-						srcGlyphBuffer += glyphSize.getWidth();
-					}
-
-					glyphPositions[glyph.getCharacter()] = castor::Position( int32_t( offX ), int32_t( offY ) );
-					offX += maxWidth;
-					++it;
-
-					auto ires = m_charIndices.emplace( glyph.getCharacter(), uint32_t( m_charIndices.size() ) );
-
-					if ( ires.second )
-					{
-						m_buffer->add( glyph );
-					}
+					added.push_back( c );
 				}
+				else
+				{
+					m_buffer->markDirty();
+				}
+			}
+		}
+	}
+
+	bool FontTexture::doPlaceGlyph( castor::Glyph const & glyph
+		, bool & moved
+		, bool & grown )
+	{
+		auto const c = glyph.getCharacter();
+		auto const & glyphSize = glyph.getSize();
+
+		if ( glyphSize.getWidth() == 0u
+			|| glyphSize.getHeight() == 0u )
+		{
+			m_residents.emplace( c, fonttex::NoShelf );
+			m_glyphsPositions[c] = castor::Position{};
+			return true;
+		}
+
+		uint32_t const width = glyphSize.getWidth() + fonttex::GlyphPadding;
+		uint32_t const height = glyphSize.getHeight() + fonttex::GlyphPadding;
+
+		if ( width > m_atlasSize.getWidth() )
+		{
+			log::warn << "FontTexture: Glyph " << uint32_t( c ) << " is too wide for the atlas." << std::endl;
+			return false;
+		}
+
+		// Prefer reusing the space of glyphs unused since last upload, over growing the atlas.
+		auto index = doAllocateShelf( width, height );
+
+		if ( index == fonttex::NoShelf )
+		{
+			index = doEvictShelf( height, true );
+			moved = moved || index != fonttex::NoShelf;
+		}
+
+		while ( index == fonttex::NoShelf
+			&& m_atlasSize.getHeight() < fonttex::MaxAtlasSize )
+		{
+			m_atlasSize = { m_atlasSize.getWidth(), m_atlasSize.getHeight() * 2u };
+			m_atlas.resize( size_t( m_atlasSize.getWidth() ) * m_atlasSize.getHeight() );
+			grown = true;
+			index = doAllocateShelf( width, height );
+		}
+
+		if ( index == fonttex::NoShelf )
+		{
+			index = doEvictShelf( height, false );
+			moved = moved || index != fonttex::NoShelf;
+		}
+
+		if ( index == fonttex::NoShelf )
+		{
+			log::warn << "FontTexture: No room left in the atlas for glyph " << uint32_t( c ) << "." << std::endl;
+			return false;
+		}
+
+		auto & shelf = m_shelves[index];
+		castor::Position position{ int32_t( shelf.left ), int32_t( shelf.top ) };
+		uint32_t const imgLineSize = m_atlasSize.getWidth();
+		auto srcGlyphBuffer = glyph.getBitmap().data();
+		auto dstGlyphBuffer = m_atlas.data() + size_t( shelf.top ) * imgLineSize + shelf.left;
+
+		for ( uint32_t i = 0; i < glyphSize.getHeight(); ++i )
+		{
+			std::memcpy( dstGlyphBuffer, srcGlyphBuffer, glyphSize.getWidth() );
+			dstGlyphBuffer += imgLineSize;
+			srcGlyphBuffer += glyphSize.getWidth();
+		}
+
+		shelf.left += width;
+		shelf.area += width * height;
+		shelf.lastUse = ( c == U'?'
+			? fonttex::PinnedShelf
+			: std::max( shelf.lastUse, m_frameIndex ) );
+		shelf.glyphs.push_back( c );
+		m_usedArea += width * height;
+		m_residents.emplace( c, index );
+		m_glyphsPositions[c] = position;
+		doMarkDirty( shelf.top, shelf.top + glyphSize.getHeight() );
+		return true;
+	}
+
+	uint32_t FontTexture::doAllocateShelf( uint32_t width
+		, uint32_t height )
+	{
+		uint32_t result = fonttex::NoShelf;
+		uint32_t waste = ~0u;
+
+		for ( uint32_t index = 0u; index < m_shelves.size(); ++index )
+		{
+			auto & shelf = m_shelves[index];
 
-				offY -= maxHeight;
+			if ( shelf.height >= height
+				&& shelf.left + width <= m_atlasSize.getWidth()
+				&& shelf.height - height < waste )
+			{
+				result = index;
+				waste = shelf.height - height;
 			}
+		}
 
-			resource.needsUpload = true;
+		if ( result == fonttex::NoShelf
+			&& m_shelvesEnd + height <= m_atlasSize.getHeight() )
+		{
+			// New shelves are as high as the tallest glyph, to be reusable by any other glyph.
+			uint32_t const shelfHeight = std::min( std::max( height, m_font->getMaxHeight() + fonttex::GlyphPadding )
+				, m_atlasSize.getHeight() - m_shelvesEnd );
+			result = uint32_t( m_shelves.size() );
+			m_shelves.push_back( { m_shelvesEnd, shelfHeight } );
+			m_shelvesEnd += shelfHeight;
 		}
+
+		return result;
 	}
 
-	void FontTexture::swapResources()
+	uint32_t FontTexture::doEvictShelf( uint32_t height
+		, bool staleOnly )
+	{
+		uint32_t result = fonttex::NoShelf;
+		uint64_t lastUse = fonttex::PinnedShelf;
+
+		for ( uint32_t index = 0u; index < m_shelves.size(); ++index )
+		{
+			auto & shelf = m_shelves[index];
+
+			if ( shelf.height >= height
+				&& shelf.lastUse < lastUse
+				&& ( !staleOnly || shelf.lastUse < m_frameIndex ) )
+			{
+				result = index;
+				lastUse = shelf.lastUse;
+			}
+		}
+
+		if ( result != fonttex::NoShelf )
+		{
+			auto & shelf = m_shelves[result];
+
+			for ( auto c : shelf.glyphs )
+			{
+				m_residents.erase( c );
+				m_glyphsPositions.erase( c );
+			}
+
+			m_evictedGlyphs += uint32_t( shelf.glyphs.size() );
+			m_usedArea -= shelf.area;
+			shelf.glyphs.clear();
+			shelf.left = 0u;
+			shelf.area = 0u;
+			shelf.lastUse = 0u;
+			auto begin = m_atlas.begin() + ptrdiff_t( size_t( shelf.top ) * m_atlasSize.getWidth() );
+			std::fill( begin
+				, begin + ptrdiff_t( size_t( shelf.height ) * m_atlasSize.getWidth() )
+				, uint8_t{} );
+			doMarkDirty( shelf.top, shelf.top + shelf.height );
+		}
+
+		return result;
+	}
+
+	castor::Position FontTexture::doGetGlyphPosition( char32_t glyphChar )const
+	{
+		auto it = m_glyphsPositions.find( glyphChar );
+
+		// Glyphs placed in rows the front texture doesn't have yet fall back to '?'.
+		if ( it == m_glyphsPositions.end()
+			|| uint32_t( it->second.y() ) >= m_textureSize.getHeight() )
+		{
+			it = m_glyphsPositions.find( U'?' );
+		}
+
+		return it == m_glyphsPositions.end()
+			? castor::Position{}
+			: it->second;
+	}
+
+	void FontTexture::doMarkDirty( uint32_t begin
+		, uint32_t end )
 	{
-		std::swap( m_frontGlyphsPositions, m_backGlyphsPositions );
+		m_dirtyBegin = std::min( m_dirtyBegin, begin );
+		m_dirtyEnd = std::max( m_dirtyEnd, end );
 	}
 
 	//*********************************************************************************************
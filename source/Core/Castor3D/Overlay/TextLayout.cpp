@@ -0,0 +1,404 @@
+#include "Castor3D/Overlay/TextLayout.hpp"
+
+#include <CastorUtils/Config/BeginExternHeaderGuard.hpp>
+#include <algorithm>
+#include <string_view>
+#include <CastorUtils/Config/EndExternHeaderGuard.hpp>
+
+namespace castor3d
+{
+	namespace txtlayout
+	{
+		template< typename TextContainerT >
+		static bool isEmpty( TextContainerT const & v )
+		{
+			return v.charEnd == v.charBegin;
+		}
+
+		template< typename ValueT >
+		static uint32_t getCount( std::vector< ValueT > const & v )
+		{
+			return uint32_t( v.size() );
+		}
+	}
+
+	//*********************************************************************************************
+
+	bool TextLayout::update( castor::Font const & font
+		, std::u32string const & caption
+		, Config const & config )
+	{
+		// The width only matters when lines are wrapped or aligned.
+		auto width = ( config.wrappingMode == TextWrappingMode::eNone && config.hAlign == HAlign::eLeft )
+			? 0.0f
+			: config.size->x;
+		// The font's max range grows when new glyphs are loaded, and is used by all lines in eMaxFontHeight mode.
+		auto fontRange = font.getMaxRange();
+		auto relayout = m_font != &font
+			|| m_width != width
+			|| m_config.wrappingMode != config.wrappingMode
+			|| m_config.lineSpacingMode != config.lineSpacingMode
+			|| m_config.hAlign != config.hAlign
+			|| ( config.lineSpacingMode == TextLineSpacingMode::eMaxFontHeight
+				&& m_fontRange != fontRange );
+		m_font = &font;
+		m_fontRange = fontRange;
+		m_width = width;
+		m_config = config;
+		m_laidOutParagraphs = 0u;
+
+		// Lays out the paragraphs whose text changed, and remembers the first one.
+		std::u32string_view text{ caption };
+		uint32_t first = relayout ? 0u : ~0u;
+		uint32_t index{};
+		size_t begin{};
+
+		while ( begin != std::u32string_view::npos )
+		{
+			auto end = text.find( U'\n', begin );
+			auto paragraphText = text.substr( begin
+				, end == std::u32string_view::npos ? std::u32string_view::npos : end - begin );
+			begin = end == std::u32string_view::npos ? end : end + 1u;
+
+			if ( index == m_paragraphs.size() )
+			{
+				m_paragraphs.emplace_back();
+			}
+
+			// A laid out paragraph always has at least one line.
+			auto & paragraph = m_paragraphs[index];
+
+			if ( relayout
+				|| paragraph.lines.empty()
+				|| paragraph.text != paragraphText )
+			{
+				paragraph.text = paragraphText;
+				doLayout( font, paragraph );
+				++m_laidOutParagraphs;
+				first = std::min( first, index );
+			}
+
+			++index;
+		}
+
+		if ( index < m_paragraphs.size() )
+		{
+			m_paragraphs.erase( std::next( m_paragraphs.begin(), index ), m_paragraphs.end() );
+			first = std::min( first, index );
+		}
+
+		auto topOffset = m_topOffset;
+
+		if ( first != ~0u )
+		{
+			// The paragraphs before the first changed one are kept as they are.
+			m_height = {};
+			uint32_t charBase{};
+			uint32_t wordBase{};
+			uint32_t lineBase{};
+
+			if ( first > 0u )
+			{
+				auto & previous = m_paragraphs[first - 1u];
+				m_height = previous.top + previous.height;
+				charBase = previous.charBase + txtlayout::getCount( previous.chars );
+				wordBase = previous.wordBase + txtlayout::getCount( previous.words );
+				lineBase = previous.lineBase + txtlayout::getCount( previous.lines );
+			}
+
+			m_chars.resize( charBase );
+			m_codes.resize( charBase );
+			m_words.resize( wordBase );
+			m_lines.resize( lineBase );
+
+			for ( auto it = std::next( m_paragraphs.begin(), first ); it != m_paragraphs.end(); ++it )
+			{
+				doAppend( *it );
+			}
+		}
+
+		doFinish();
+		return first != ~0u
+			|| topOffset != m_topOffset;
+	}
+
+	void TextLayout::clear()
+	{
+		m_font = {};
+		m_fontRange = {};
+		m_paragraphs.clear();
+		m_chars.clear();
+		m_codes.clear();
+		m_words.clear();
+		m_lines.clear();
+		m_maxRange = {};
+		m_topOffset = {};
+		m_height = {};
+	}
+
+	void TextLayout::doLayout( castor::Font const & font
+		, Paragraph & paragraph )const
+	{
+		paragraph.chars.clear();
+		paragraph.codes.clear();
+		paragraph.words.clear();
+		paragraph.lines.clear();
+		paragraph.maxRange = { 100.0, 0.0 };
+
+		float lineTop{};
+		float totalLeft{};
+		float wordLeft{};
+		float charLeft{};
+		uint32_t charIndex{};
+		uint32_t wordIndex{};
+		uint32_t lineIndex{};
+
+		// The words and lines are accessed by index, since their storage can grow.
+		auto nextWord = [&]()
+		{
+			auto & word = paragraph.words.emplace_back();
+			word.left = wordLeft;
+			word.range = { 100.0, 0.0 };
+			word.charBegin = charIndex;
+			word.charEnd = word.charBegin;
+			word.line = {};
+			return uint32_t( paragraph.words.size() - 1u );
+		};
+
+		auto nextLine = [&]()
+		{
+			auto & line = paragraph.lines.emplace_back();
+			line.position = { 0.0, lineTop };
+			line.range = { 100.0, 0.0 };
+			line.wordBegin = wordIndex;
+			line.wordEnd = line.wordBegin;
+			line.charBegin = charIndex;
+			line.charEnd = line.charBegin;
+			line.width = 0.0;
+			charLeft = totalLeft - wordLeft;
+			totalLeft = charLeft;
+			wordLeft = 0.0;
+			return uint32_t( paragraph.lines.size() - 1u );
+		};
+
+		auto word = nextWord();
+		auto line = nextLine();
+
+		auto alignLine = [&]()
+		{
+			auto & current = paragraph.lines[line];
+
+			if ( !txtlayout::isEmpty( current ) )
+			{
+				if ( m_config.lineSpacingMode == TextLineSpacingMode::eMaxFontHeight )
+				{
+					current.range = castor::Point2f{ font.getMaxRange() };
+				}
+
+				// Move line according to halign
+				if ( m_config.hAlign != HAlign::eLeft )
+				{
+					auto offset = m_width - current.width;
+
+					if ( m_config.hAlign == HAlign::eCenter )
+					{
+						offset /= 2;
+					}
+
+					current.position->x = current.position->x + offset;
+				}
+			}
+
+			lineTop += current.range->y - current.range->x;
+			++lineIndex;
+		};
+
+		auto addWord = [&]()
+		{
+			auto & currentWord = paragraph.words[word];
+
+			if ( !txtlayout::isEmpty( currentWord ) )
+			{
+				auto & currentLine = paragraph.lines[line];
+				currentWord.width = charLeft;
+				currentWord.line = lineIndex;
+				currentLine.range->x = std::min( currentLine.range->x, currentWord.range->x );
+				currentLine.range->y = std::max( currentLine.range->y, currentWord.range->y );
+				currentLine.width = totalLeft;
+				paragraph.maxRange->x = std::min( paragraph.maxRange->x, currentLine.range->x );
+				paragraph.maxRange->y = std::max( paragraph.maxRange->y, currentLine.range->y );
+				++currentLine.wordEnd;
+				currentLine.charEnd = currentWord.charEnd;
+			}
+
+			wordLeft = totalLeft;
+		};
+
+		auto addChar = [&]( char32_t code
+			, castor::Point2f const & charSize
+			, castor::Point2f const & bearing )
+		{
+			auto xMin = bearing->x;
+			auto xMax = xMin + charSize->x;
+			auto yMin = -bearing->y;
+			auto yMax = yMin + charSize->y;
+
+			if ( m_config.wrappingMode == TextWrappingMode::eBreakWords
+				&& wordLeft > 0.0
+				&& ( wordLeft > m_width
+					|| totalLeft + xMax > m_width ) )
+			{
+				// The word will overflow the overlay size.
+				// So we jump to the next line,
+				// and will write the word on this next line.
+				alignLine();
+				line = nextLine();
+				paragraph.lines[line].charBegin = paragraph.words[word].charBegin;
+				paragraph.words[word].left = wordLeft;
+			}
+			else if ( m_config.wrappingMode == TextWrappingMode::eBreak
+				&& totalLeft + xMax > m_width )
+			{
+				// The char will overflow the overlay size.
+				// So we write the current word,
+				// jump to the next line,
+				// then carry on the word on this next line.
+				addWord();
+				alignLine();
+				wordLeft = totalLeft;
+				++wordIndex;
+				line = nextLine();
+				word = nextWord();
+			}
+
+			// Setup char
+			auto & outChar = paragraph.chars.emplace_back();
+			outChar.left = charLeft;
+			outChar.size = charSize;
+			outChar.bearing = bearing;
+			outChar.word = wordIndex;
+			outChar.index = charIndex;
+			paragraph.codes.push_back( code );
+
+			// Complete word
+			auto & currentWord = paragraph.words[word];
+			currentWord.range->x = std::min( currentWord.range->x, yMin );
+			currentWord.range->y = std::max( currentWord.range->y, yMax );
+			++currentWord.charEnd;
+		};
+
+		for ( auto code : paragraph.text )
+		{
+			castor::Glyph const & glyph{ font.getGlyphAt( code ) };
+
+			if ( code == U' ' || code == U'\t' )
+			{
+				// write the word and leave space before next word.
+				addWord();
+				totalLeft += float( glyph.getAdvance() );
+				wordLeft += float( glyph.getAdvance() );
+				charLeft = 0.0;
+				++wordIndex;
+				word = nextWord();
+			}
+			else
+			{
+				addChar( code
+					, { glyph.getSize().getWidth(), glyph.getSize().getHeight() }
+					, { glyph.getBearing().x(), glyph.getBearing().y() } );
+				totalLeft += float( glyph.getAdvance() );
+				charLeft += float( glyph.getAdvance() );
+				++charIndex;
+			}
+		}
+
+		addWord();
+		alignLine();
+		paragraph.height = lineTop;
+	}
+
+	void TextLayout::doAppend( Paragraph & paragraph )
+	{
+		paragraph.top = m_height;
+		paragraph.charBase = txtlayout::getCount( m_chars );
+		paragraph.wordBase = txtlayout::getCount( m_words );
+		paragraph.lineBase = txtlayout::getCount( m_lines );
+		m_height += paragraph.height;
+
+		for ( auto character : paragraph.chars )
+		{
+			character.word += paragraph.wordBase;
+			character.index += paragraph.charBase;
+			m_chars.push_back( character );
+		}
+
+		m_codes += paragraph.codes;
+
+		for ( auto word : paragraph.words )
+		{
+			word.charBegin += paragraph.charBase;
+			word.charEnd += paragraph.charBase;
+			word.line += paragraph.lineBase;
+			m_words.push_back( word );
+		}
+
+		for ( auto line : paragraph.lines )
+		{
+			line.position->y += paragraph.top;
+			line.wordBegin += paragraph.wordBase;
+			line.wordEnd += paragraph.wordBase;
+			line.charBegin += paragraph.charBase;
+			line.charEnd += paragraph.charBase;
+			m_lines.push_back( line );
+		}
+	}
+
+	void TextLayout::doFinish()
+	{
+		m_maxRange = { 100.0, 0.0 };
+
+		for ( auto & paragraph : m_paragraphs )
+		{
+			m_maxRange->x = std::min( m_maxRange->x, paragraph.maxRange->x );
+			m_maxRange->y = std::max( m_maxRange->y, paragraph.maxRange->y );
+		}
+
+		m_topOffset = {};
+
+		if ( m_lines.empty() )
+		{
+			return;
+		}
+
+		auto lineTop = m_height;
+
+		if ( m_config.lineSpacingMode == TextLineSpacingMode::eMaxLineHeight )
+		{
+			// Adjust lines heights to maxHeight
+			auto lineHeight = m_maxRange->y - m_maxRange->x;
+			lineTop = 0.0;
+
+			for ( auto & line : m_lines )
+			{
+				line.position->y = lineTop;
+				line.range = m_maxRange;
+				lineTop += lineHeight;
+			}
+		}
+
+		m_topOffset = -m_lines.front().range->x;
+
+		// Move lines according to valign
+		if ( m_config.vAlign != VAlign::eTop )
+		{
+			auto offset = m_config.size->y - lineTop;
+
+			if ( m_config.vAlign == VAlign::eCenter )
+			{
+				offset /= 2;
+			}
+
+			m_topOffset += offset;
+		}
+	}
+}
@@ -150,12 +150,6 @@ namespace castor3d
 
 			return *pfont;
 		}
-
-		template< typename TextContainerT >
-		static bool isEmpty( TextContainerT const & v )
-		{
-			return v.charEnd == v.charBegin;
-		}
 	}
 
 	//*********************************************************************************************
@@ -178,7 +172,7 @@ namespace castor3d
 
 	uint32_t TextOverlay::getCount( bool secondary )const
 	{
-		return m_charsCount * 6u;
+		return getCharCount() * 6u;
 	}
 
 	float TextOverlay::fillBuffer( uint32_t overlayIndex
@@ -186,22 +180,25 @@ namespace castor3d
 		, castor::ArrayView< TextWord > words
 		, castor::ArrayView< TextLine > lines )const
 	{
-		std::copy( m_text.begin()
-			, m_text.begin() + m_charsCount
+		std::copy( m_layout.getChars().begin()
+			, m_layout.getChars().end()
 			, texts.begin() );
-		std::copy( m_words.words().begin()
-			, m_words.words().end()
+		std::copy( m_layout.getWords().begin()
+			, m_layout.getWords().end()
 			, words.begin() );
-		std::copy( m_lines.lines().begin()
-			, m_lines.lines().end()
+		std::copy( m_layout.getLines().begin()
+			, m_layout.getLines().end()
 			, lines.begin() );
+		auto uvIt = m_uvPositions.begin();
 
 		for ( auto & v : texts )
 		{
+			v.uvPosition = *uvIt;
 			v.overlay = overlayIndex;
+			++uvIt;
 		}
 
-		return m_lines.topOffset;
+		return m_layout.getTopOffset();
 	}
 
 	ashes::PipelineShaderStageCreateInfo TextOverlay::createProgram( RenderDevice const & device )
@@ -388,8 +385,11 @@ namespace castor3d
 			m_fontTexture = fontTexture;
 			m_connection = fontTexture->onResourceChanged.connect( [this]( DoubleBufferedTextureLayout const & )
 			{
+				m_fontTextureChanged = true;
 				m_textChanged = true;
 			} );
+			m_layout.clear();
+			m_fontTextureChanged = true;
 		}
 		else
 		{
@@ -424,34 +424,12 @@ namespace castor3d
 			CU_Exception( cuT( "The TextOverlay [" ) + getOverlayName() + cuT( "] has no Font. Did you set its font?" ) );
 		}
 
-		std::vector< char32_t > newCaption;
-
-		for ( auto c : m_currentCaption )
-		{
-			if ( !font->hasGlyphAt( c ) )
-			{
-				newCaption.push_back( c );
-			}
-		}
-
-		if ( !newCaption.empty() )
-		{
-			for ( auto c : newCaption )
-			{
-				font->loadGlyph( c );
-			}
-
-			fontTexture->update( true );
-		}
+		fontTexture->loadGlyphs( m_currentCaption );
 
 		if ( !m_currentCaption.empty() )
 		{
-			m_previousCaption = m_currentCaption;
-			auto count = std::count( m_previousCaption.begin(), m_previousCaption.end(), U' ' );
-			count += std::count( m_previousCaption.begin(), m_previousCaption.end(), U'\t' );
-			count += std::count( m_previousCaption.begin(), m_previousCaption.end(), U'\n' );
-			m_charsCount = uint32_t( ( m_previousCaption.size() - uint32_t( std::max( ptrdiff_t{}, count ) ) ) );
 			doPrepareText( renderer.getSize() );
+			doUpdateUvPositions();
 		}
 
 		m_displayable = m_displayable
@@ -462,230 +440,39 @@ namespace castor3d
 	{
 		castor::Point2f renderSize{ castor::Point2f{ rndSize.getWidth(), rndSize.getHeight() }
 			* getRenderRatio( rndSize ) };
-		castor::Point2f overlaySize( renderSize * getOverlay().getAbsoluteSize() );
-
-		m_words.count = 0u;
-		m_lines.count = 0u;
-		m_lines.maxRange = { 100.0, 0.0 };
-		m_lines.topOffset = {};
-		m_lines.count = {};
+		TextLayout::Config config;
+		config.size = renderSize * getOverlay().getAbsoluteSize();
+		config.wrappingMode = m_wrappingMode;
+		config.lineSpacingMode = m_lineSpacingMode;
+		config.hAlign = m_hAlign;
+		config.vAlign = m_vAlign;
+		// Only the paragraphs whose text changed are laid out again.
+		m_layout.update( ovrltxt::getFont( *this )
+			, m_currentCaption
+			, config );
+	}
 
-		auto caption = m_previousCaption;
+	void TextOverlay::doUpdateUvPositions()
+	{
+		auto & codes = m_layout.getCharCodes();
 		auto fontTexture = getFontTexture();
-		auto & font = ovrltxt::getFont( *this );
-		float lineTop{};
-		{
-			float totalLeft{};
-			float wordLeft{};
-			float charLeft{};
-			uint32_t charIndex{};
-			uint32_t wordIndex{};
-			uint32_t lineIndex{};
-			auto cit = caption.begin();
-			auto tit = m_text.begin();
-
-			auto nextWord = [&]()
-			{
-				auto & word = m_words.getNext();
-				word.left = wordLeft;
-				word.range = { 100.0, 0.0 };
-				word.charBegin = charIndex;
-				word.charEnd = word.charBegin;
-				word.line = {};
-				return &word;
-			};
-
-			auto nextLine = [&]()
-			{
-				auto & line = m_lines.getNext();
-				line.position = { 0.0, lineTop };
-				line.range = { 100.0, 0.0 };
-				line.wordBegin = wordIndex;
-				line.wordEnd = line.wordBegin;
-				line.charBegin = charIndex;
-				line.charEnd = line.charBegin;
-				line.width = 0.0;
-				charLeft = totalLeft - wordLeft;
-				totalLeft = charLeft;
-				wordLeft = 0.0;
-				return &line;
-			};
-
-			auto word = nextWord();
-			auto line = nextLine();
-
-			auto alignLine = [&]()
-			{
-				if ( !ovrltxt::isEmpty( *line ) )
-				{
-					if ( m_lineSpacingMode == TextLineSpacingMode::eMaxFontHeight )
-					{
-						line->range = castor::Point2f{ ovrltxt::getFont( *this ).getMaxRange() };
-					}
-
-					// Move line according to halign
-					if ( m_hAlign != HAlign::eLeft )
-					{
-						auto offset = overlaySize->x - line->width;
-
-						if ( m_hAlign == HAlign::eCenter )
-						{
-							offset /= 2;
-						}
-
-						line->position->x = line->position->x + offset;
-					}
-				}
-
-				lineTop += line->range->y - line->range->x;
-				++lineIndex;
-			};
 
-			auto addWord = [&]()
-			{
-				if ( !ovrltxt::isEmpty( *word ) )
-				{
-					word->width = charLeft;
-					word->line = lineIndex;
-					line->range->x = std::min( line->range->x, word->range->x );
-					line->range->y = std::max( line->range->y, word->range->y );
-					line->width = totalLeft;
-					m_lines.maxRange->x = std::min( m_lines.maxRange->x, line->range->x );
-					m_lines.maxRange->y = std::max( m_lines.maxRange->y, line->range->y );
-					++line->wordEnd;
-					line->charEnd = word->charEnd;
-				}
-
-				wordLeft = totalLeft;
-			};
-
-			auto addChar = [&]( castor::Point2f charSize
-				, castor::Point2f const & bearing )
-			{
-				auto xMin = bearing->x;
-				auto xMax = xMin + charSize->x;
-				auto yMin = -bearing->y;
-				auto yMax = yMin + charSize->y;
-
-				if ( m_wrappingMode == TextWrappingMode::eBreakWords
-					&& wordLeft > 0.0
-					&& ( wordLeft > overlaySize->x
-						|| totalLeft + xMax > overlaySize->x ) )
-				{
-					// The word will overflow the overlay size.
-					// So we jump to the next line,
-					// and will write the word on this next line.
-					alignLine();
-					line = nextLine();
-					line->charBegin = word->charBegin;
-					word->left = wordLeft;
-				}
-				else if ( m_wrappingMode == TextWrappingMode::eBreak
-					&& totalLeft + xMax > overlaySize->x )
-				{
-					// The char will overflow the overlay size.
-					// So we write the current word,
-					// jump to the next line,
-					// then carry on the word on this next line.
-					addWord();
-					alignLine();
-					wordLeft = totalLeft;
-					++wordIndex;
-					line = nextLine();
-					word = nextWord();
-				}
-
-				// Setup char
-				auto uvPosition = fontTexture->getGlyphPosition( *cit );
-				auto & outChar = *tit;
-				outChar.left = charLeft;
-				outChar.size = charSize;
-				outChar.bearing = bearing;
-				outChar.uvPosition = { uvPosition.x(), uvPosition.y() };
-				outChar.word = wordIndex;
-				outChar.index = charIndex;
-
-				// Complete word
-				word->range->x = std::min( word->range->x, yMin );
-				word->range->y = std::max( word->range->y, yMax );
-				++word->charEnd;
-			};
-
-			while ( cit != caption.end() )
-			{
-				if ( *cit == U'\n' )
-				{
-					addWord();
-					alignLine();
-					line = nextLine();
-					charLeft = 0.0;
-					++wordIndex;
-					word = nextWord();
-				}
-				else
-				{
-					castor::Glyph const & glyph{ font.getGlyphAt( *cit ) };
-
-					if ( *cit == U' ' || *cit == U'\t' )
-					{
-						// write the word and leave space before next word.
-						addWord();
-						totalLeft += float( glyph.getAdvance() );
-						wordLeft += float( glyph.getAdvance() );
-						charLeft = 0.0;
-						++wordIndex;
-						word = nextWord();
-					}
-					else
-					{
-						addChar( { glyph.getSize().getWidth(), glyph.getSize().getHeight() }
-							, { glyph.getBearing().x(), glyph.getBearing().y() } );
-						totalLeft += float( glyph.getAdvance() );
-						charLeft += float( glyph.getAdvance() );
-						++charIndex;
-						++tit;
-					}
-				}
-
-				++cit;
-			}
-
-			addWord();
-			alignLine();
+		if ( m_fontTextureChanged.exchange( false ) )
+		{
+			// The glyphs may have moved in the font texture.
+			m_uvCodes.clear();
 		}
 
-		auto lines = m_lines.lines();
+		m_uvCodes.resize( codes.size(), U'\0' );
+		m_uvPositions.resize( codes.size() );
 
-		if ( !lines.empty() )
+		for ( size_t i = 0u; i < codes.size(); ++i )
 		{
-			if ( m_lineSpacingMode == TextLineSpacingMode::eMaxLineHeight )
+			if ( m_uvCodes[i] != codes[i] )
 			{
-				// Adjust lines heights to maxHeight
-				auto lineRange = m_lines.maxRange;
-				auto lineHeight = lineRange->y - lineRange->x;
-				lineTop = 0.0;
-
-				for ( auto & line : lines )
-				{
-					line.position->y = lineTop;
-					line.range = lineRange;
-					lineTop += lineHeight;
-				}
-			}
-
-			m_lines.topOffset = -lines.front().range->x;
-
-			// Move lines according to valign
-			if ( m_vAlign != VAlign::eTop )
-			{
-				auto offset = overlaySize->y - lineTop;
-
-				if ( m_vAlign == VAlign::eCenter )
-				{
-					offset /= 2;
-				}
-
-				m_lines.topOffset += offset;
+				auto position = fontTexture->getGlyphPosition( codes[i] );
+				m_uvPositions[i] = { position.x(), position.y() };
+				m_uvCodes[i] = codes[i];
 			}
 		}
 	}
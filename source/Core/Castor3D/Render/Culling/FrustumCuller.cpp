@@ -41,10 +41,16 @@ namespace castor3d
 		m_frustum->update( projection, view );
 	}
 
+	Frustum const * FrustumCuller::getLodFrustum()const
+	{
+		return hasCamera() ? &getCamera().getFrustum() : m_frustum;
+	}
+
 	bool FrustumCuller::isSubmeshVisible( SubmeshRenderNode const & node )const
 	{
 		return !node.instance.isCullable()
-			|| isVisible( hasCamera() ? getCamera().getFrustum() : *m_frustum , node );
+			|| ( isVisible( hasCamera() ? getCamera().getFrustum() : *m_frustum , node )
+				&& !isOccluded( node ) );
 	}
 
 	bool FrustumCuller::isBillboardVisible( BillboardRenderNode const & node )const
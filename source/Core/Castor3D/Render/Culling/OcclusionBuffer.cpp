@@ -0,0 +1,299 @@
+#include "Castor3D/Render/Culling/OcclusionBuffer.hpp"
+
+#include "Castor3D/Model/Mesh/Submesh/Component/Face.hpp"
+
+#include <CastorUtils/Config/BeginExternHeaderGuard.hpp>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <CastorUtils/Config/EndExternHeaderGuard.hpp>
+
+CU_ImplementSmartPtr( castor3d, OcclusionBuffer )
+
+namespace castor3d
+{
+	namespace occbuf
+	{
+		// Vertices closer to the camera plane are considered as crossing it.
+		static float constexpr MinW = 1.0e-5f;
+
+		struct ScreenVertex
+		{
+			float x;
+			float y;
+			float invW;
+		};
+
+		static ScreenVertex toScreen( castor::Point4f const & clip
+			, float width
+			, float height )
+		{
+			auto invW = 1.0f / clip->w;
+			return { ( clip->x * invW * 0.5f + 0.5f ) * width
+				, ( clip->y * invW * 0.5f + 0.5f ) * height
+				, invW };
+		}
+
+		// Edge function E(x, y) = a * x + b * y + c, positive inside the triangle.
+		struct Edge
+		{
+			Edge( ScreenVertex const & p
+				, ScreenVertex const & q )
+				: a{ p.y - q.y }
+				, b{ q.x - p.x }
+				, c{ -( a * p.x + b * p.y ) }
+			{
+			}
+
+			float get( float x, float y )const
+			{
+				return a * x + b * y + c;
+			}
+
+			float a;
+			float b;
+			float c;
+		};
+	}
+
+	//*********************************************************************************************
+
+	OcclusionBuffer::OcclusionBuffer( uint32_t width
+		, uint32_t height )
+	{
+		width = std::max( width, 1u );
+		height = std::max( height, 1u );
+		m_levels.push_back( { width, height, std::vector< float >( size_t( width ) * height, 0.0f ) } );
+
+		while ( width > 1u || height > 1u )
+		{
+			width = ( width + 1u ) / 2u;
+			height = ( height + 1u ) / 2u;
+			m_levels.push_back( { width, height, std::vector< float >( size_t( width ) * height, 0.0f ) } );
+		}
+	}
+
+	void OcclusionBuffer::clear( castor::Matrix4x4f const & viewProj )
+	{
+		m_viewProj = viewProj;
+		m_trianglesCount = 0u;
+
+		for ( auto & level : m_levels )
+		{
+			std::fill( level.depths.begin(), level.depths.end(), 0.0f );
+		}
+	}
+
+	void OcclusionBuffer::addOccluder( castor::Point3fArray const & positions
+		, FaceArray const & faces
+		, castor::Matrix4x4f const & transform )
+	{
+		auto mvp = m_viewProj * transform;
+		m_clipPositions.resize( positions.size() );
+
+		for ( size_t i = 0u; i < positions.size(); ++i )
+		{
+			auto & position = positions[i];
+			m_clipPositions[i] = mvp * castor::Point4f{ position->x, position->y, position->z, 1.0f };
+		}
+
+		for ( auto & face : faces )
+		{
+			if ( face[0] < m_clipPositions.size()
+				&& face[1] < m_clipPositions.size()
+				&& face[2] < m_clipPositions.size() )
+			{
+				doRasterise( m_clipPositions[face[0]]
+					, m_clipPositions[face[1]]
+					, m_clipPositions[face[2]] );
+			}
+		}
+	}
+
+	void OcclusionBuffer::buildPyramid()
+	{
+		// Each texel keeps the farthest occluder depth of the four texels below it.
+		for ( size_t index = 1u; index < m_levels.size(); ++index )
+		{
+			auto & src = m_levels[index - 1u];
+			auto & dst = m_levels[index];
+
+			for ( uint32_t y = 0u; y < dst.height; ++y )
+			{
+				auto y0 = 2u * y;
+				auto y1 = std::min( y0 + 1u, src.height - 1u );
+				auto row0 = src.depths.data() + size_t( y0 ) * src.width;
+				auto row1 = src.depths.data() + size_t( y1 ) * src.width;
+				auto dstRow = dst.depths.data() + size_t( y ) * dst.width;
+
+				for ( uint32_t x = 0u; x < dst.width; ++x )
+				{
+					auto x0 = 2u * x;
+					auto x1 = std::min( x0 + 1u, src.width - 1u );
+					dstRow[x] = std::min( std::min( row0[x0], row0[x1] )
+						, std::min( row1[x0], row1[x1] ) );
+				}
+			}
+		}
+	}
+
+	bool OcclusionBuffer::isOccluded( castor::BoundingBox const & box
+		, castor::Matrix4x4f const & transform )const
+	{
+		if ( !hasOccluders() )
+		{
+			return false;
+		}
+
+		auto mvp = m_viewProj * transform;
+		auto min = box.getMin();
+		auto max = box.getMax();
+		auto width = float( getWidth() );
+		auto height = float( getHeight() );
+		float minX = std::numeric_limits< float >::max();
+		float minY = std::numeric_limits< float >::max();
+		float maxX = std::numeric_limits< float >::lowest();
+		float maxY = std::numeric_limits< float >::lowest();
+		float nearest = 0.0f;
+
+		for ( uint32_t i = 0u; i < 8u; ++i )
+		{
+			auto clip = mvp * castor::Point4f{ ( i & 1u ) ? max->x : min->x
+				, ( i & 2u ) ? max->y : min->y
+				, ( i & 4u ) ? max->z : min->z
+				, 1.0f };
+
+			if ( clip->w < occbuf::MinW )
+			{
+				// The box crosses the camera plane.
+				return false;
+			}
+
+			auto vertex = occbuf::toScreen( clip, width, height );
+			minX = std::min( minX, vertex.x );
+			minY = std::min( minY, vertex.y );
+			maxX = std::max( maxX, vertex.x );
+			maxY = std::max( maxY, vertex.y );
+			nearest = std::max( nearest, vertex.invW );
+		}
+
+		if ( maxX < 0.0f || maxY < 0.0f
+			|| minX >= width || minY >= height )
+		{
+			// Outside of the buffer, the frustum culling decides.
+			return false;
+		}
+
+		auto x0 = uint32_t( std::max( 0.0f, std::floor( minX ) ) );
+		auto y0 = uint32_t( std::max( 0.0f, std::floor( minY ) ) );
+		auto x1 = uint32_t( std::min( width - 1.0f, std::floor( maxX ) ) );
+		auto y1 = uint32_t( std::min( height - 1.0f, std::floor( maxY ) ) );
+
+		// Select the level where the box covers at most 2x2 texels.
+		uint32_t level{};
+
+		while ( level + 1u < getLevelsCount()
+			&& ( ( x1 >> level ) - ( x0 >> level ) > 1u
+				|| ( y1 >> level ) - ( y0 >> level ) > 1u ) )
+		{
+			++level;
+		}
+
+		for ( auto y = y0 >> level; y <= ( y1 >> level ); ++y )
+		{
+			for ( auto x = x0 >> level; x <= ( x1 >> level ); ++x )
+			{
+				if ( getDepth( level, x, y ) <= nearest )
+				{
+					return false;
+				}
+			}
+		}
+
+		return true;
+	}
+
+	void OcclusionBuffer::doRasterise( castor::Point4f const & a
+		, castor::Point4f const & b
+		, castor::Point4f const & c )
+	{
+		if ( a->w < occbuf::MinW
+			|| b->w < occbuf::MinW
+			|| c->w < occbuf::MinW )
+		{
+			return;
+		}
+
+		auto & level = m_levels.front();
+		auto width = float( level.width );
+		auto height = float( level.height );
+		std::array< occbuf::ScreenVertex, 3u > vertices{ occbuf::toScreen( a, width, height )
+			, occbuf::toScreen( b, width, height )
+			, occbuf::toScreen( c, width, height ) };
+		auto area = ( vertices[1].x - vertices[0].x ) * ( vertices[2].y - vertices[0].y )
+			- ( vertices[1].y - vertices[0].y ) * ( vertices[2].x - vertices[0].x );
+
+		if ( std::abs( area ) < std::numeric_limits< float >::epsilon() )
+		{
+			return;
+		}
+
+		// Occluders are seen from both sides.
+		if ( area < 0.0f )
+		{
+			std::swap( vertices[1], vertices[2] );
+			area = -area;
+		}
+
+		auto minX = std::max( 0.0f, std::floor( std::min( { vertices[0].x, vertices[1].x, vertices[2].x } ) ) );
+		auto minY = std::max( 0.0f, std::floor( std::min( { vertices[0].y, vertices[1].y, vertices[2].y } ) ) );
+		auto maxX = std::min( width - 1.0f, std::floor( std::max( { vertices[0].x, vertices[1].x, vertices[2].x } ) ) );
+		auto maxY = std::min( height - 1.0f, std::floor( std::max( { vertices[0].y, vertices[1].y, vertices[2].y } ) ) );
+
+		if ( minX > maxX || minY > maxY )
+		{
+			return;
+		}
+
+		++m_trianglesCount;
+		occbuf::Edge e0{ vertices[1], vertices[2] };
+		occbuf::Edge e1{ vertices[2], vertices[0] };
+		occbuf::Edge e2{ vertices[0], vertices[1] };
+
+		// 1/W is affine in screen space: depth(x, y) = dx * x + dy * y + d0.
+		auto invArea = 1.0f / area;
+		auto dx = ( e0.a * vertices[0].invW + e1.a * vertices[1].invW + e2.a * vertices[2].invW ) * invArea;
+		auto dy = ( e0.b * vertices[0].invW + e1.b * vertices[1].invW + e2.b * vertices[2].invW ) * invArea;
+		auto d0 = ( e0.c * vertices[0].invW + e1.c * vertices[1].invW + e2.c * vertices[2].invW ) * invArea;
+		// The farthest depth in a fully covered pixel, bounded by the farthest vertex.
+		auto depthMargin = 0.5f * ( std::abs( dx ) + std::abs( dy ) );
+		auto farthest = std::min( { vertices[0].invW, vertices[1].invW, vertices[2].invW } );
+		auto x0 = uint32_t( minX );
+		auto count = uint32_t( maxX ) - x0 + 1u;
+
+		for ( auto y = uint32_t( minY ); y <= uint32_t( maxY ); ++y )
+		{
+			auto py = float( y ) + 0.5f;
+			auto px = minX + 0.5f;
+			auto w0 = e0.get( px, py );
+			auto w1 = e1.get( px, py );
+			auto w2 = e2.get( px, py );
+			auto depth = dx * px + dy * py + d0 - depthMargin;
+			auto row = level.depths.data() + size_t( y ) * level.width + x0;
+
+			// Branchless, so that the compiler vectorises it.
+			for ( uint32_t i = 0u; i < count; ++i )
+			{
+				auto fi = float( i );
+				auto covered = ( w0 + e0.a * fi >= 0.0f )
+					& ( w1 + e1.a * fi >= 0.0f )
+					& ( w2 + e2.a * fi >= 0.0f );
+				auto value = std::max( depth + dx * fi, farthest );
+				row[i] = covered
+					? std::max( row[i], value )
+					: row[i];
+			}
+		}
+	}
+}
@@ -10,8 +10,13 @@
 #include "Castor3D/Material/Pass/Pass.hpp"
 #include "Castor3D/Model/Mesh/Mesh.hpp"
 #include "Castor3D/Model/Mesh/Submesh/Submesh.hpp"
+#include "Castor3D/Model/Mesh/Submesh/Component/IndexMapping.hpp"
+#include "Castor3D/Model/Mesh/Submesh/Component/PositionsComponent.hpp"
+#include "Castor3D/Model/Mesh/Submesh/Component/TriFaceMapping.hpp"
+#include "Castor3D/Render/Frustum.hpp"
 #include "Castor3D/Render/RenderNodesPass.hpp"
 #include "Castor3D/Render/RenderSystem.hpp"
+#include "Castor3D/Render/Culling/OcclusionBuffer.hpp"
 #include "Castor3D/Render/Culling/PipelineNodes.hpp"
 #include "Castor3D/Render/Node/BillboardRenderNode.hpp"
 #include "Castor3D/Render/Node/SceneRenderNodes.hpp"
@@ -29,6 +34,7 @@
 #include <CastorUtils/Miscellaneous/BitSize.hpp>
 #include <CastorUtils/Miscellaneous/BlockTimer.hpp>
 #include <CastorUtils/Miscellaneous/Hash.hpp>
+#include <CastorUtils/Miscellaneous/Profiler.hpp>
 
 CU_ImplementSmartPtr( castor3d, SceneCuller )
 
@@ -138,6 +144,7 @@ namespace castor3d
 
 	void SceneCuller::update( CpuUpdater & updater )
 	{
+		CU_ProfileFunction();
 #if C3D_DebugTimers
 		auto block( m_timer->start() );
 #endif
@@ -154,12 +161,13 @@ namespace castor3d
 
 		if ( m_first )
 		{
+			doBuildOcclusion();
 			doInitialiseCulled();
 		}
 		else
 		{
 			auto & sceneObjs = sceneIt->second;
-			doUpdateChanged( sceneObjs );
+			doUpdateChanged( sceneObjs, doUpdateOcclusion( sceneObjs ) );
 			doUpdateCulled( sceneObjs );
 		}
 
@@ -199,6 +207,23 @@ namespace castor3d
 		}
 	}
 
+	Frustum const * SceneCuller::getLodFrustum()const
+	{
+		return hasCamera() ? &getCamera().getFrustum() : nullptr;
+	}
+
+	bool SceneCuller::isOccluded( SubmeshRenderNode const & node )const
+	{
+		auto sceneNode = node.instance.getParent();
+		return m_occlusion
+			&& m_occlusion->hasOccluders()
+			&& sceneNode
+			&& !node.instance.isOccluder()												// Occluders don't hide themselves
+			&& !node.data.getInstantiation().isInstanced( node.pass->getOwner() )		// Don't cull individual instances
+			&& m_occlusion->isOccluded( node.instance.getBoundingBox( node.data )
+				, sceneNode->getDerivedTransformationMatrix() );
+	}
+
 	void SceneCuller::resetCamera( Camera * camera )
 	{
 		if ( m_camera != camera )
@@ -228,7 +253,8 @@ namespace castor3d
 			{
 				m_culledSubmeshes.push_back( { nodeIt.second.get()
 					, 1u
-					, isSubmeshVisible( *nodeIt.second ) } );
+					, isSubmeshVisible( *nodeIt.second )
+					, doSelectLod( *nodeIt.second ) } );
 			}
 		}
 
@@ -249,13 +275,99 @@ namespace castor3d
 			&& m_culledSubmeshes.empty();
 	}
 
-	void SceneCuller::doUpdateChanged( CpuUpdater::DirtyObjects & sceneObjs )
+	void SceneCuller::doBuildOcclusion()
+	{
+		if ( !hasCamera() || m_shadowCuller )
+		{
+			m_occlusion.reset();
+			return;
+		}
+
+		auto viewProj = getCamera().getProjection( false ) * getCamera().getView();
+
+		if ( m_occlusion )
+		{
+			m_occlusion->clear( viewProj );
+		}
+
+		auto & cache = getScene().getGeometryCache();
+		auto lock( castor::makeUniqueLock( cache ) );
+
+		for ( auto & geomIt : cache )
+		{
+			auto & geometry = *geomIt.second;
+			auto node = geometry.getParent();
+			auto mesh = geometry.getMesh();
+
+			if ( geometry.isOccluder()
+				&& node && mesh && node->isDisplayable() && node->isVisible() )
+			{
+				if ( !m_occlusion )
+				{
+					// Only the cullers seeing occluders get a buffer.
+					m_occlusion = castor::makeUnique< OcclusionBuffer >( OcclusionBufferWidth, OcclusionBufferHeight );
+					m_occlusion->clear( viewProj );
+				}
+
+				for ( auto & submesh : *mesh )
+				{
+					auto positions = submesh->getComponent< PositionsComponent >();
+					auto triFaces = submesh->getComponent< TriFaceMapping >();
+
+					if ( positions && triFaces )
+					{
+						m_occlusion->addOccluder( positions->getData()
+							, triFaces->getFaces()
+							, node->getDerivedTransformationMatrix() );
+					}
+				}
+			}
+		}
+
+		if ( m_occlusion )
+		{
+			m_occlusion->buildPyramid();
+		}
+	}
+
+	bool SceneCuller::doUpdateOcclusion( CpuUpdater::DirtyObjects const & sceneObjs )
+	{
+		if ( !hasCamera() || m_shadowCuller )
+		{
+			return false;
+		}
+
+		auto changed = sceneObjs.dirtyCameras.end() != std::find( sceneObjs.dirtyCameras.begin()
+				, sceneObjs.dirtyCameras.end()
+				, m_camera )
+			|| sceneObjs.dirtyGeometries.end() != std::find_if( sceneObjs.dirtyGeometries.begin()
+				, sceneObjs.dirtyGeometries.end()
+				, []( Geometry const * lookup )
+				{
+					return lookup->isOccluder();
+				} );
+
+		if ( !changed )
+		{
+			return false;
+		}
+
+		// Only an occlusion buffer that had, or now has, occluders changes the nodes visibility.
+		auto hadOccluders = m_occlusion && m_occlusion->hasOccluders();
+		doBuildOcclusion();
+		return hadOccluders
+			|| ( m_occlusion && m_occlusion->hasOccluders() );
+	}
+
+	void SceneCuller::doUpdateChanged( CpuUpdater::DirtyObjects & sceneObjs
+		, bool occlusionChanged )
 	{
 		auto itCamera = std::find( sceneObjs.dirtyCameras.begin()
 			, sceneObjs.dirtyCameras.end()
 			, m_camera );
 
-		if ( itCamera != sceneObjs.dirtyCameras.end() )
+		if ( occlusionChanged
+			|| itCamera != sceneObjs.dirtyCameras.end() )
 		{
 			m_anyChanged = true;
 #if C3D_DebugTimers
@@ -264,8 +376,12 @@ namespace castor3d
 			for ( auto & node : m_culledSubmeshes )
 			{
 				auto visible = isSubmeshVisible( *node.node );
-				m_culledChanged = m_culledChanged || node.visibleOrFrontCulled != visible;
+				auto lod = doSelectLod( *node.node );
+				m_culledChanged = m_culledChanged
+					|| node.visibleOrFrontCulled != visible
+					|| node.lod != lod;
 				node.visibleOrFrontCulled = visible;
+				node.lod = lod;
 			}
 
 			for ( auto & node : m_culledBillboards )
@@ -279,8 +395,10 @@ namespace castor3d
 
 	void SceneCuller::doUpdateCulled( CpuUpdater::DirtyObjects & sceneObjs )
 	{
-		std::vector< SubmeshRenderNode const * > dirtySubmeshes;
-		std::vector< BillboardRenderNode const * > dirtyBillboards;
+		// The temporaries use the frame resource the dirty objects are allocated from.
+		auto allocator = sceneObjs.dirtyGeometries.get_allocator();
+		std::pmr::vector< SubmeshRenderNode const * > dirtySubmeshes{ allocator };
+		std::pmr::vector< BillboardRenderNode const * > dirtyBillboards{ allocator };
 		doMarkDirty( sceneObjs, dirtySubmeshes, dirtyBillboards );
 
 		if ( !dirtySubmeshes.empty()
@@ -291,13 +409,12 @@ namespace castor3d
 #endif
 			duUpdateCulledSubmeshes( dirtySubmeshes );
 			duUpdateCulledBillboards( dirtyBillboards );
-			m_anyChanged = true;
 		}
 	}
 
 	void SceneCuller::doMarkDirty( CpuUpdater::DirtyObjects & sceneObjs
-		, std::vector< SubmeshRenderNode const * > & dirtySubmeshes
-		, std::vector< BillboardRenderNode const * > & dirtyBillboards )
+		, std::pmr::vector< SubmeshRenderNode const * > & dirtySubmeshes
+		, std::pmr::vector< BillboardRenderNode const * > & dirtyBillboards )
 	{
 #if C3D_DebugTimers
 		auto blockDirty( m_timerDirty->start() );
@@ -313,7 +430,7 @@ namespace castor3d
 		}
 	}
 
-	void SceneCuller::duUpdateCulledSubmeshes( std::vector< SubmeshRenderNode const * > const & dirtySubmeshes )
+	void SceneCuller::duUpdateCulledSubmeshes( std::pmr::vector< SubmeshRenderNode const * > const & dirtySubmeshes )
 	{
 		for ( auto dirty : dirtySubmeshes )
 		{
@@ -324,21 +441,30 @@ namespace castor3d
 					return lookup.node == dirty;
 				} );
 			auto visible = isSubmeshVisible( *dirty );
+			auto lod = doSelectLod( *dirty );
 
 			if ( it != m_culledSubmeshes.end() )
 			{
-				m_culledChanged = m_culledChanged || it->visibleOrFrontCulled != visible;
+				// A node that moved outside of the culler's volume, and stays there, doesn't change anything.
+				m_anyChanged = m_anyChanged
+					|| it->visibleOrFrontCulled
+					|| visible;
+				m_culledChanged = m_culledChanged
+					|| it->visibleOrFrontCulled != visible
+					|| it->lod != lod;
 				it->visibleOrFrontCulled = visible;
+				it->lod = lod;
 			}
 			else
 			{
+				m_anyChanged = m_anyChanged || visible;
 				m_culledChanged = true;
-				m_culledSubmeshes.push_back( { dirty, 1u, visible } );
+				m_culledSubmeshes.push_back( { dirty, 1u, visible, lod } );
 			}
 		}
 	}
 
-	void SceneCuller::duUpdateCulledBillboards( std::vector< BillboardRenderNode const * > const & dirtyBillboards )
+	void SceneCuller::duUpdateCulledBillboards( std::pmr::vector< BillboardRenderNode const * > const & dirtyBillboards )
 	{
 		for ( auto dirty : dirtyBillboards )
 		{
@@ -353,6 +479,9 @@ namespace castor3d
 
 			if ( it != m_culledBillboards.end() )
 			{
+				m_anyChanged = m_anyChanged
+					|| it->visibleOrFrontCulled
+					|| visible;
 				m_culledChanged = m_culledChanged
 					|| it->visibleOrFrontCulled != visible
 					|| it->instanceCount != count;
@@ -361,14 +490,40 @@ namespace castor3d
 			}
 			else
 			{
+				m_anyChanged = m_anyChanged || visible;
 				m_culledChanged = true;
 				m_culledBillboards.push_back( { dirty, count, visible } );
 			}
 		}
 	}
 
+	uint32_t SceneCuller::doSelectLod( SubmeshRenderNode const & node )const
+	{
+		auto frustum = getLodFrustum();
+		auto sceneNode = node.instance.getParent();
+		auto indexMapping = node.data.getIndexMapping();
+
+		if ( !frustum
+			|| !sceneNode
+			|| !indexMapping
+			|| !indexMapping->getLodsCount() )
+		{
+			return 0u;
+		}
+
+		auto & sphere = node.instance.getBoundingSphere( node.data );
+		castor::Point3f center = sceneNode->getDerivedTransformationMatrix() * sphere.getCenter();
+		auto scale = sceneNode->getDerivedScale();
+		auto maxScale = std::max( scale[0], std::max( scale[1], scale[2] ) );
+		auto bias = m_shadowCuller
+			? m_scene.getShadowLodBias()
+			: m_scene.getLodBias();
+		return indexMapping->selectLod( frustum->getPixelsPerUnit( center ) * maxScale
+			, LodPixelError * std::exp2( bias ) );
+	}
+
 	void SceneCuller::doMakeDirty( Geometry const & object
-		, std::vector< SubmeshRenderNode const * > & dirtySubmeshes )const
+		, std::pmr::vector< SubmeshRenderNode const * > & dirtySubmeshes )const
 	{
 		if ( m_isStatic == std::nullopt
 			|| object.getParent()->isStatic() == m_isStatic )
@@ -394,7 +549,7 @@ namespace castor3d
 	}
 
 	void SceneCuller::doMakeDirty( BillboardBase const & object
-		, std::vector< BillboardRenderNode const * > & dirtyBillboards )const
+		, std::pmr::vector< BillboardRenderNode const * > & dirtyBillboards )const
 	{
 		if ( m_isStatic == std::nullopt
 			|| object.getNode()->isStatic() == m_isStatic )
@@ -56,8 +56,9 @@ namespace castor3d
 	void Frustum::update( castor::Matrix4x4f const & projection
 		, castor::Matrix4x4f const & view )
 	{
-#if !C3D_DisableFrustumCulling
 		auto const vp = projection * view;
+		m_viewProjection = vp;
+#if !C3D_DisableFrustumCulling
 		std::array< castor::Point4f, size_t( FrustumPlane::eCount ) > points;
 
 		const castor::Point4f x{ vp[0][0], vp[1][0], vp[2][0], vp[3][0] };
@@ -100,6 +101,7 @@ namespace castor3d
 
 		rendfrust::updatePoints( m_planes, vp, m_points );
 #endif
+		m_projectionScale = std::abs( projection[1][1] );
 	}
 
 	bool Frustum::isVisible( castor::BoundingBox const & box
@@ -153,4 +155,15 @@ namespace castor3d
 			} );
 #endif
 	}
+
+	float Frustum::getPixelsPerUnit( castor::Point3f const & position )const
+	{
+		// The clip space w is the view depth for a perspective projection, 1 for an orthographic one.
+		auto w = m_viewProjection[0][3] * position->x
+			+ m_viewProjection[1][3] * position->y
+			+ m_viewProjection[2][3] * position->z
+			+ m_viewProjection[3][3];
+		return m_projectionScale * 0.5f * float( m_viewport->getHeight() )
+			/ std::max( w, std::numeric_limits< float >::epsilon() );
+	}
 }
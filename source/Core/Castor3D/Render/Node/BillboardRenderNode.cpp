@@ -3,10 +3,23 @@
 #include "Castor3D/Buffer/GpuBufferOffset.hpp"
 #include "Castor3D/Scene/BillboardList.hpp"
 
+#include <CastorUtils/Pool/ObjectSlabPool.hpp>
+
 CU_ImplementSmartPtr( castor3d, BillboardRenderNode )
 
 namespace castor3d
 {
+	namespace bbnode
+	{
+		static castor::ObjectSlabPoolT< BillboardRenderNode > & getPool()
+		{
+			static castor::ObjectSlabPoolT< BillboardRenderNode > result;
+			return result;
+		}
+	}
+
+	//*********************************************************************************************
+
 	BillboardRenderNode::BillboardRenderNode( Pass & pass
 		, BillboardBase & data
 		, ModelBufferConfiguration & modelData
@@ -19,6 +32,16 @@ namespace castor3d
 	{
 	}
 
+	void * BillboardRenderNode::operator new( size_t size )
+	{
+		return bbnode::getPool().allocate( size );
+	}
+
+	void BillboardRenderNode::operator delete( void * memory, size_t size )
+	{
+		bbnode::getPool().deallocate( memory, size );
+	}
+
 	uint32_t BillboardRenderNode::getId()const
 	{
 		return instance.getId( *pass );
@@ -14,6 +14,7 @@
 #include "Castor3D/Material/Pass/Component/Lighting/TransmissionComponent.hpp"
 #include "Castor3D/Miscellaneous/makeVkType.hpp"
 #include "Castor3D/Model/Mesh/Submesh/Submesh.hpp"
+#include "Castor3D/Model/Mesh/Submesh/Component/IndexMapping.hpp"
 #include "Castor3D/Render/RenderNodesPass.hpp"
 #include "Castor3D/Render/RenderPipeline.hpp"
 #include "Castor3D/Render/RenderQueue.hpp"
@@ -90,13 +91,14 @@ namespace castor3d
 			, NodeT const & node
 			, uint32_t drawCount
 			, bool isFrontCulled
+			, uint32_t lod
 			, NodePtrByPipelineMapT< NodeT > & nodes
 			, PipelineBufferArray & nodesIds )
 		{
 			auto & bufferChunk = node.getFinalBufferOffsets().getBufferChunk( SubmeshFlag::ePositions );
 			auto buffer = &bufferChunk.buffer->getBuffer();
-			NodePtrByBufferMapT< NodeT > & pipelineMap = nodes.emplace( &pipeline, NodePtrByBufferMapT< NodeT >{} ).first->second;
-			NodeArrayT< NodeT > & bufferMap = pipelineMap.emplace( buffer, NodeArrayT< NodeT >{} ).first->second;
+			NodePtrByBufferMapT< NodeT > & pipelineMap = nodes.try_emplace( &pipeline ).first->second;
+			NodeArrayT< NodeT > & bufferMap = pipelineMap.try_emplace( buffer ).first->second;
 			auto it = std::find_if( bufferMap.begin()
 				, bufferMap.end()
 				, [&node]( CountedNodeT< NodeT > const & lookup )
@@ -104,7 +106,7 @@ namespace castor3d
 					return compareOffsets( *lookup.node, node );
 				} );
 			CU_Require( buffer );
-			bufferMap.emplace( it, CountedNodeT< NodeT >{ &node, drawCount, isFrontCulled } );
+			bufferMap.emplace( it, CountedNodeT< NodeT >{ &node, drawCount, isFrontCulled, lod } );
 			registerPipelineNodes( pipeline.getFlagsHash(), *buffer, nodesIds );
 		}
 
@@ -113,15 +115,16 @@ namespace castor3d
 			, NodeT const & node
 			, uint32_t drawCount
 			, bool isFrontCulled
+			, uint32_t lod
 			, ObjectNodesPtrByPipelineMapT< NodeT > & nodes
 			, PipelineBufferArray & nodesIds )
 		{
 			auto & bufferChunk = node.getFinalBufferOffsets().getBufferChunk( SubmeshFlag::ePositions );
 			auto buffer = &bufferChunk.buffer->getBuffer();
-			ObjectNodesPtrByBufferMapT< NodeT > & pipelineMap = nodes.emplace( &pipeline, ObjectNodesPtrByBufferMapT< NodeT >{} ).first->second;
-			ObjectNodesPtrByPassT< NodeT > & bufferMap = pipelineMap.emplace( buffer, ObjectNodesPtrByPassT< NodeT >{} ).first->second;
-			ObjectNodesPtrMapT< NodeT > & passMap = bufferMap.emplace( node.pass, ObjectNodesPtrMapT< NodeT >{} ).first->second;
-			NodeArrayT< NodeT > & objectMap = passMap.emplace( &node.data, NodeArrayT< NodeT >{} ).first->second;
+			ObjectNodesPtrByBufferMapT< NodeT > & pipelineMap = nodes.try_emplace( &pipeline ).first->second;
+			ObjectNodesPtrByPassT< NodeT > & bufferMap = pipelineMap.try_emplace( buffer ).first->second;
+			ObjectNodesPtrMapT< NodeT > & passMap = bufferMap.try_emplace( node.pass ).first->second;
+			NodeArrayT< NodeT > & objectMap = passMap.try_emplace( &node.data ).first->second;
 			auto it = std::find_if( objectMap.begin()
 				, objectMap.end()
 				, [&node]( CountedNodeT< NodeT > const & lookup )
@@ -129,7 +132,7 @@ namespace castor3d
 					return compareOffsets( *lookup.node, node );
 				} );
 			CU_Require( buffer );
-			objectMap.emplace( it, CountedNodeT< NodeT >{ &node, drawCount, isFrontCulled } );
+			objectMap.emplace( it, CountedNodeT< NodeT >{ &node, drawCount, isFrontCulled, lod } );
 			registerPipelineNodes( pipeline.getFlagsHash(), *buffer, nodesIds );
 		}
 
@@ -595,13 +598,19 @@ namespace castor3d
 
 		static void fillIndirectCommand( SubmeshRenderNode const & culled
 			, VkDrawIndexedIndirectCommand *& indirectIndexedCommands
-			, uint32_t instanceCount )
+			, uint32_t instanceCount
+			, uint32_t lod )
 		{
 			auto & indexOffset = culled.getSourceBufferOffsets().getBufferChunk( SubmeshFlag::eIndex );
 			auto & bufferOffsets = culled.getFinalBufferOffsets();
-			indirectIndexedCommands->indexCount = indexOffset.getCount< uint32_t >();
+			// The index chunk also holds the reduced levels of detail, only the selected one is drawn.
+			auto indexMapping = culled.data.getIndexMapping();
+			auto indexRange = indexMapping
+				? indexMapping->getLodIndexRange( lod )
+				: castor::Point2ui{ 0u, indexOffset.getCount< uint32_t >() };
+			indirectIndexedCommands->indexCount = indexRange->y;
 			indirectIndexedCommands->instanceCount = instanceCount;
-			indirectIndexedCommands->firstIndex = indexOffset.getFirst< uint32_t >();
+			indirectIndexedCommands->firstIndex = indexOffset.getFirst< uint32_t >() + indexRange->x;
 			indirectIndexedCommands->vertexOffset = int32_t( bufferOffsets.getFirstVertex< castor::Point4f >() );
 			indirectIndexedCommands->firstInstance = 0u;
 			++indirectIndexedCommands;
@@ -732,7 +741,8 @@ namespace castor3d
 			, VkDrawMeshTasksIndirectCommandNV *& indirectMeshBuffer
 			, VkDrawIndexedIndirectCommand *& indirectIdxBuffer
 			, VkDrawIndirectCommand *& indirectNIdxBuffer
-			, uint32_t instanceCount )
+			, uint32_t instanceCount
+			, uint32_t lod )
 		{
 			if ( meshShading
 				&& node.data.getMeshletsCount()
@@ -747,7 +757,8 @@ namespace castor3d
 			{
 				fillIndirectCommand( node
 					, indirectIdxBuffer
-					, instanceCount );
+					, instanceCount
+					, lod );
 			}
 			else
 			{
@@ -764,12 +775,15 @@ namespace castor3d
 			, VkDrawIndirectCommand *& indirectNIdxBuffer )
 		{
 			uint32_t instanceCount = 0u;
+			// All the instances share the same draw, so the finest visible level is used.
+			auto lod = std::numeric_limits< uint32_t >::max();
 
 			for ( auto & node : nodes )
 			{
 				if ( node.node->instance.getParent()->isVisible() )
 				{
 					++instanceCount;
+					lod = std::min( lod, node.lod );
 #	ifndef NDEBUG
 					checkBuffers( *nodes.front().node, *node.node );
 #	endif
@@ -781,10 +795,12 @@ namespace castor3d
 				, indirectMeshBuffer
 				, indirectIdxBuffer
 				, indirectNIdxBuffer
-				, instanceCount );
+				, instanceCount
+				, instanceCount ? lod : 0u );
 		}
 
 		static void fillNodeCommands( SubmeshRenderNode const & node
+			, uint32_t lod
 			, Scene const & scene
 			, bool meshShading
 			, VkDrawMeshTasksIndirectCommandNV *& indirectMeshBuffer
@@ -797,7 +813,8 @@ namespace castor3d
 				, indirectMeshBuffer
 				, indirectIdxBuffer
 				, indirectNIdxBuffer
-				, getInstanceCount( node ) );
+				, getInstanceCount( node )
+				, lod );
 			( *pipelinesBuffer ) = node.instance.getId( *node.pass, node.data );
 			++pipelinesBuffer;
 		}
@@ -807,11 +824,12 @@ namespace castor3d
 		static void fillNodeCommands( SubmeshRenderNode const & node
 			, VkDrawIndexedIndirectCommand *& indirectIdxBuffer
 			, VkDrawIndirectCommand *& indirectNIdxBuffer
-			, uint32_t instanceCount )
+			, uint32_t instanceCount
+			, uint32_t lod )
 		{
 			if ( node.getSourceBufferOffsets().hasData( SubmeshFlag::eIndex ) )
 			{
-				fillIndirectCommand( node, indirectIdxBuffer, instanceCount );
+				fillIndirectCommand( node, indirectIdxBuffer, instanceCount, lod );
 			}
 			else
 			{
@@ -824,12 +842,15 @@ namespace castor3d
 			, VkDrawIndirectCommand *& indirectNIdxBuffer )
 		{
 			uint32_t instanceCount = 0u;
+			// All the instances share the same draw, so the finest visible level is used.
+			auto lod = std::numeric_limits< uint32_t >::max();
 
 			for ( auto & node : nodes )
 			{
 				if ( node.node->instance.getParent()->isVisible() )
 				{
 					++instanceCount;
+					lod = std::min( lod, node.lod );
 #ifndef NDEBUG
 					checkBuffers( *nodes.front().node, *node.node );
 #endif
@@ -839,10 +860,12 @@ namespace castor3d
 			fillNodeCommands( *nodes.front().node
 				, indirectIdxBuffer
 				, indirectNIdxBuffer
-				, instanceCount );
+				, instanceCount
+				, instanceCount ? lod : 0u );
 		}
 
 		static void fillNodeCommands( SubmeshRenderNode const & node
+			, uint32_t lod
 			, Scene const & scene
 			, VkDrawIndexedIndirectCommand *& indirectIdxBuffer
 			, VkDrawIndirectCommand *& indirectNIdxBuffer
@@ -851,7 +874,8 @@ namespace castor3d
 			fillNodeCommands( node
 				, indirectIdxBuffer
 				, indirectNIdxBuffer
-				, getInstanceCount( node ) );
+				, getInstanceCount( node )
+				, lod );
 			( *pipelinesBuffer ) = node.instance.getId( *node.pass, node.data );
 			++pipelinesBuffer;
 		}
@@ -915,6 +939,9 @@ namespace castor3d
 
 	QueueRenderNodes::QueueRenderNodes( RenderQueue const & queue )
 		: castor::OwnedBy< RenderQueue const >{ queue }
+		, m_submeshNodes{ &m_nodesResource }
+		, m_instancedSubmeshNodes{ &m_nodesResource }
+		, m_billboardNodes{ &m_nodesResource }
 	{
 	}
 
@@ -1059,14 +1086,16 @@ namespace castor3d
 						doAddInstancedSubmesh( shadowMaps
 							, shadowBuffer
 							, *culled.node
-							, false );
+							, false
+							, culled.lod );
 
 						if ( needsFront )
 						{
 							doAddInstancedSubmesh( shadowMaps
 								, shadowBuffer
 								, *culled.node
-								, true );
+								, true
+								, culled.lod );
 						}
 					}
 				}
@@ -1075,14 +1104,16 @@ namespace castor3d
 					doAddSubmesh( shadowMaps
 						, shadowBuffer
 						, *culled.node
-						, false );
+						, false
+						, culled.lod );
 
 					if ( needsFront )
 					{
 						doAddSubmesh( shadowMaps
 							, shadowBuffer
 							, *culled.node
-							, true );
+							, true
+							, culled.lod );
 					}
 				}
 			}
@@ -1150,6 +1181,7 @@ namespace castor3d
 					{
 #if VK_EXT_mesh_shader || VK_NV_mesh_shader
 						queuerndnd::fillNodeCommands( *culled.node
+							, culled.lod
 							, scene
 							, renderPass->isMeshShading()
 							, indirectMshBuffer
@@ -1159,6 +1191,7 @@ namespace castor3d
 						CU_Require( size_t( std::distance( origIndirectMshBuffer, indirectMshBuffer ) ) <= m_submeshMeshletIndirectCommands->getCount() );
 #else
 						cullscn::fillNodeCommands( *culled.node
+							, culled.lod
 							, scene
 							, indirectIdxBuffer
 							, indirectNIdxBuffer
@@ -1462,7 +1495,8 @@ namespace castor3d
 	void QueueRenderNodes::doAddSubmesh( ShadowMapLightTypeArray & shadowMaps
 		, ShadowBuffer const * shadowBuffer
 		, SubmeshRenderNode const & node
-		, bool frontCulled )
+		, bool frontCulled
+		, uint32_t lod )
 	{
 		auto & renderPass = *getOwner()->getOwner();
 		auto & pipeline = doGetPipeline( node, frontCulled );
@@ -1470,6 +1504,7 @@ namespace castor3d
 			, node
 			, node.getInstanceCount()
 			, frontCulled
+			, lod
 			, m_submeshNodes
 			, m_nodesIds );
 		renderPass.initialiseAdditionalDescriptor( pipeline
@@ -1482,7 +1517,8 @@ namespace castor3d
 	void QueueRenderNodes::doAddInstancedSubmesh( ShadowMapLightTypeArray & shadowMaps
 		, ShadowBuffer const * shadowBuffer
 		, SubmeshRenderNode const & node
-		, bool frontCulled )
+		, bool frontCulled
+		, uint32_t lod )
 	{
 		auto & renderPass = *getOwner()->getOwner();
 		auto & pipeline = doGetPipeline( node, frontCulled );
@@ -1490,6 +1526,7 @@ namespace castor3d
 			, node
 			, node.getInstanceCount()
 			, frontCulled
+			, lod
 			, m_instancedSubmeshNodes
 			, m_nodesIds );
 		renderPass.initialiseAdditionalDescriptor( pipeline
@@ -1509,6 +1546,7 @@ namespace castor3d
 			, node
 			, node.getInstanceCount()
 			, false
+			, 0u
 			, m_billboardNodes
 			, m_nodesIds );
 		renderPass.initialiseAdditionalDescriptor( pipeline
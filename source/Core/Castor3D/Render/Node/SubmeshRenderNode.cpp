@@ -8,10 +8,23 @@
 #include "Castor3D/Render/RenderDevice.hpp"
 #include "Castor3D/Scene/Geometry.hpp"
 
+#include <CastorUtils/Pool/ObjectSlabPool.hpp>
+
 CU_ImplementSmartPtr( castor3d, SubmeshRenderNode )
 
 namespace castor3d
 {
+	namespace smshnode
+	{
+		static castor::ObjectSlabPoolT< SubmeshRenderNode > & getPool()
+		{
+			static castor::ObjectSlabPoolT< SubmeshRenderNode > result;
+			return result;
+		}
+	}
+
+	//*********************************************************************************************
+
 	SubmeshRenderNode::SubmeshRenderNode( Pass & pass
 		, Submesh & data
 		, Geometry & instance
@@ -23,6 +36,16 @@ namespace castor3d
 	{
 	}
 
+	void * SubmeshRenderNode::operator new( size_t size )
+	{
+		return smshnode::getPool().allocate( size );
+	}
+
+	void SubmeshRenderNode::operator delete( void * memory, size_t size )
+	{
+		smshnode::getPool().deallocate( memory, size );
+	}
+
 	uint32_t SubmeshRenderNode::getId()const
 	{
 		return instance.getId( *pass, data );
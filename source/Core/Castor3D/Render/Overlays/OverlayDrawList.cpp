@@ -0,0 +1,105 @@
+/*
+See LICENSE file in root folder
+*/
+#include "Castor3D/Render/Overlays/OverlayDrawList.hpp"
+
+#include <CastorUtils/Config/BeginExternHeaderGuard.hpp>
+#include <algorithm>
+#include <CastorUtils/Config/EndExternHeaderGuard.hpp>
+
+namespace castor3d
+{
+	void OverlayDrawList::clear()
+	{
+		m_entries.clear();
+		m_pending.clear();
+	}
+
+	void OverlayDrawList::add( uint32_t level
+		, OverlayDrawData data )
+	{
+		CU_Require( data.pipelineData );
+		m_entries.push_back( { level, 0u, uint32_t( m_pending.size() ) } );
+		m_pending.push_back( std::move( data ) );
+	}
+
+	bool OverlayDrawList::sort()
+	{
+		// The registration order is kept inside a level, for a given pipeline data.
+		std::stable_sort( m_entries.begin()
+			, m_entries.end()
+			, []( Entry const & lhs, Entry const & rhs )
+			{
+				return lhs.level < rhs.level;
+			} );
+		m_draws.clear();
+		m_batches.clear();
+		m_offsets.clear();
+		auto begin = m_entries.begin();
+
+		while ( begin != m_entries.end() )
+		{
+			auto level = begin->level;
+			auto end = std::find_if( begin
+				, m_entries.end()
+				, [level]( Entry const & entry )
+				{
+					return entry.level != level;
+				} );
+
+			// Rank the level pipeline data by first appearance,
+			// the last one drawn in the previous level coming first.
+			m_levelPipelines.clear();
+
+			if ( !m_batches.empty() )
+			{
+				m_levelPipelines.push_back( m_batches.back().pipelineData );
+			}
+
+			for ( auto it = begin; it != end; ++it )
+			{
+				auto pipelineData = m_pending[it->index].pipelineData;
+				auto rit = std::find( m_levelPipelines.begin(), m_levelPipelines.end(), pipelineData );
+				it->rank = uint32_t( std::distance( m_levelPipelines.begin(), rit ) );
+
+				if ( rit == m_levelPipelines.end() )
+				{
+					m_levelPipelines.push_back( pipelineData );
+				}
+			}
+
+			std::stable_sort( begin
+				, end
+				, []( Entry const & lhs, Entry const & rhs )
+				{
+					return lhs.rank < rhs.rank;
+				} );
+
+			for ( auto it = begin; it != end; ++it )
+			{
+				auto & draw = m_draws.emplace_back( m_pending[it->index] );
+				auto & offset = m_offsets.emplace( draw.pipelineData, 0u ).first->second;
+
+				if ( m_batches.empty()
+					|| m_batches.back().pipelineData != draw.pipelineData )
+				{
+					m_batches.push_back( { draw.pipelineData
+						, uint32_t( m_draws.size() - 1u )
+						, offset
+						, 0u } );
+				}
+
+				++m_batches.back().count;
+				++offset;
+			}
+
+			begin = end;
+		}
+
+		auto result = m_invalidated
+			|| m_batches != m_previous;
+		m_previous = m_batches;
+		m_invalidated = false;
+		return result;
+	}
+}
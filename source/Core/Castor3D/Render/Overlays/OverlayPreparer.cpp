@@ -9,8 +9,6 @@ See LICENSE file in root folder
 #include "Castor3D/Overlay/TextOverlay.hpp"
 #include "Castor3D/Render/Overlays/OverlayRenderer.hpp"
 
-#include <CastorUtils/Miscellaneous/Hash.hpp>
-
 namespace castor3d
 {
 	namespace ovrlprep
@@ -52,14 +50,6 @@ namespace castor3d
 			data.vertexOffset = vertexOffset;
 			return ratio;
 		}
-
-		static size_t makeHash( ashes::Pipeline const * pipeline
-			, ashes::DescriptorSetCRefArray const * descriptorSets )
-		{
-			auto result = std::hash< ashes::Pipeline const * >{}( pipeline );
-			result = castor::hashCombinePtr( result, *descriptorSets );
-			return result;
-		}
 	}
 
 	OverlayPreparer::OverlayPreparer( OverlayRenderer & renderer
@@ -74,6 +64,7 @@ namespace castor3d
 		, m_framebuffer{ framebuffer }
 	{
 		m_renderer.doResetCompute();
+		m_renderer.m_draw.drawList.clear();
 	}
 
 	OverlayPreparer::OverlayPreparer( OverlayPreparer && rhs )noexcept
@@ -82,6 +73,8 @@ namespace castor3d
 		, m_fence{ rhs.m_fence }
 		, m_renderPass{ rhs.m_renderPass }
 		, m_framebuffer{ rhs.m_framebuffer }
+		, m_drawsChanged{ rhs.m_drawsChanged }
+		, m_drawCounts{ rhs.m_drawCounts }
 	{
 		rhs.m_renderPass = VkRenderPass{};
 		rhs.m_framebuffer = VkFramebuffer{};
@@ -91,6 +84,8 @@ namespace castor3d
 	{
 		m_renderPass = rhs.m_renderPass;
 		m_framebuffer = rhs.m_framebuffer;
+		m_drawsChanged = rhs.m_drawsChanged;
+		m_drawCounts = rhs.m_drawCounts;
 
 		rhs.m_renderPass = VkRenderPass{};
 		rhs.m_framebuffer = VkFramebuffer{};
@@ -103,41 +98,47 @@ namespace castor3d
 		if ( m_renderPass )
 		{
 			fillDrawData();
-			auto & commandBuffer = m_renderer.doBeginPrepare( m_renderPass, m_framebuffer, m_fence );
+			auto batches = m_renderer.m_draw.drawList.getBatches();
+
+			if ( m_drawCounts )
+			{
+				*m_drawCounts += uint32_t( batches.size() );
+			}
 
-			for ( auto [level, pipelines] : m_levelsOverlays )
+			// The draw commands are recorded again only when the batches changed.
+			if ( m_renderer.doIsRecordNeeded( m_renderPass, m_framebuffer, m_drawsChanged ) )
 			{
-				for ( auto [pipelineData, overlayDatas] : pipelines )
+				auto draws = m_renderer.m_draw.drawList.getDraws();
+				auto & commandBuffer = m_renderer.doBeginPrepare( m_renderPass, m_framebuffer, m_fence );
+
+				for ( auto & batch : batches )
 				{
-					if ( !overlayDatas.empty() )
-					{
-						auto & data = overlayDatas.front();
-						auto & count = m_descriptorsCounts[ovrlprep::makeHash( data.node->pipeline.pipeline.get(), &pipelineData->descriptorSets->all )];
+					auto & data = draws[batch.first];
+					auto & pipelineData = *batch.pipelineData;
 #if !defined( NDEBUG )
-						auto commands = castor::makeArrayView( pipelineData->indirectCommands.begin() + count
-							, uint32_t( overlayDatas.size() ) );
-						for ( auto & command : commands )
+					auto commands = castor::makeArrayView( pipelineData.indirectCommands.begin() + batch.offset
+						, batch.count );
+					for ( auto & command : commands )
+					{
+						if ( command.vertexCount == 0
+							|| command.instanceCount == 0 )
 						{
-							if ( command.vertexCount == 0
-								|| command.instanceCount == 0 )
-							{
-								log::error << "OverlayPreparer: "
-									<< "Level " << level
-									<< "Unexpected empty draw command" << std::endl;
-							}
+							log::error << "OverlayPreparer: "
+								<< "Level " << data.overlay->getLevel()
+								<< "Unexpected empty draw command" << std::endl;
 						}
-#endif
-						doRegisterDrawCommands( data.node->pipeline
-							, pipelineData->descriptorSets->all
-							, pipelineData->indirectCommandsBuffer->getBuffer()
-							, uint32_t( overlayDatas.size() )
-							, count
-							, commandBuffer );;
 					}
+#endif
+					doRegisterDrawCommands( data.node->pipeline
+						, pipelineData.descriptorSets->all
+						, pipelineData.indirectCommandsBuffer->getBuffer()
+						, batch.count
+						, batch.offset
+						, commandBuffer );
 				}
-			}
 
-			m_renderer.doEndPrepare();
+				m_renderer.doEndPrepare();
+			}
 		}
 	}
 
@@ -151,7 +152,7 @@ namespace castor3d
 
 			if ( size->x > 0 && size->y > 0 )
 			{
-				auto & pipelines = m_levelsOverlays.emplace( overlay.getLevel(), OverlayDatasMap{} ).first->second;
+				auto & drawList = m_renderer.m_draw.drawList;
 
 				for ( auto & pass : *material )
 				{
@@ -166,15 +167,15 @@ namespace castor3d
 							, overlay
 							, *pass
 							, false );
-						auto & overlays = pipelines.emplace( pipelineData, OverlayDataArray{} ).first->second;
-						overlays.push_back( { &overlay
-							, node
-							, pipelineData
-							, nullptr
-							, uint32_t{}
-							, uint32_t{}
-							, OverlayTextBufferIndex{}
-						, false } );
+						drawList.add( overlay.getLevel()
+							, { &overlay
+								, node
+								, pipelineData
+								, nullptr
+								, uint32_t{}
+								, uint32_t{}
+								, OverlayTextBufferIndex{}
+								, false } );
 					}
 				}
 			}
@@ -188,7 +189,7 @@ namespace castor3d
 
 				if ( borderSize->x != 0 || borderSize->y != 0 || borderSize->z != 0 || borderSize->w != 0 )
 				{
-					auto & pipelines = m_levelsOverlays.emplace( overlay.getLevel(), OverlayDatasMap{} ).first->second;
+					auto & drawList = m_renderer.m_draw.drawList;
 
 					for ( auto & pass : *borderMaterial )
 					{
@@ -201,15 +202,15 @@ namespace castor3d
 								, overlay
 								, *pass
 								, true );
-							auto & overlays = pipelines.emplace( pipelineData, OverlayDataArray{} ).first->second;
-							overlays.push_back( { &overlay
-								, node
-								, pipelineData
-								, nullptr
-								, uint32_t{}
-								, uint32_t{}
-								, OverlayTextBufferIndex{}
-							, true } );
+							drawList.add( overlay.getLevel()
+								, { &overlay
+									, node
+									, pipelineData
+									, nullptr
+									, uint32_t{}
+									, uint32_t{}
+									, OverlayTextBufferIndex{}
+									, true } );
 						}
 					}
 				}
@@ -221,92 +222,87 @@ namespace castor3d
 
 	void OverlayPreparer::fillDrawData()
 	{
-		for ( auto [level, pipelines] : m_levelsOverlays )
+		auto & drawList = m_renderer.m_draw.drawList;
+		m_drawsChanged = drawList.sort();
+
+		for ( auto & data : drawList.getDraws() )
 		{
-			for ( auto [pipelineData, overlayDatas] : pipelines )
+			auto overlay = data.overlay;
+
+			switch ( overlay->getType() )
 			{
-				for ( auto data : overlayDatas )
+			case OverlayType::ePanel:
+				if ( auto panel = overlay->getPanelOverlay() )
 				{
-					auto overlay = data.overlay;
-
-					switch ( overlay->getType() )
+					if ( m_renderer.m_common.panelVertexBuffer->fill( m_renderer.getSize()
+						, *panel
+						, data
+						, false
+						, nullptr ) )
 					{
-					case OverlayType::ePanel:
-						if ( auto panel = overlay->getPanelOverlay() )
-						{
-							if ( m_renderer.m_common.panelVertexBuffer->fill( m_renderer.getSize()
-								, *panel
-								, data
-								, false
-								, nullptr ) )
-							{
-								doUpdateUbo( m_renderer.m_common.panelVertexBuffer->overlaysBuffer[data.overlayIndex]
-									, *panel
-									, data.node->pass
-									, m_renderer.getSize()
-									, data.indirectData->firstVertex
-									, data.textBuffer );
-							}
-						}
-						break;
-					case OverlayType::eBorderPanel:
-						if ( auto border = overlay->getBorderPanelOverlay() )
+						doUpdateUbo( m_renderer.m_common.panelVertexBuffer->overlaysBuffer[data.overlayIndex]
+							, *panel
+							, data.node->pass
+							, m_renderer.getSize()
+							, data.indirectData->firstVertex
+							, data.textBuffer );
+					}
+				}
+				break;
+			case OverlayType::eBorderPanel:
+				if ( auto border = overlay->getBorderPanelOverlay() )
+				{
+					if ( data.secondary )
+					{
+						if ( m_renderer.m_common.borderVertexBuffer->fill( m_renderer.getSize()
+							, *border
+							, data
+							, true
+							, nullptr ) )
 						{
-							if ( data.secondary )
-							{
-								if ( m_renderer.m_common.borderVertexBuffer->fill( m_renderer.getSize()
-									, *border
-									, data
-									, true
-									, nullptr ) )
-								{
-									doUpdateUbo( m_renderer.m_common.borderVertexBuffer->overlaysBuffer[data.overlayIndex]
-										, *border
-										, data.node->pass
-										, m_renderer.getSize()
-										, data.indirectData->firstVertex
-										, data.textBuffer );
-								}
-							}
-							else if ( m_renderer.m_common.panelVertexBuffer->fill( m_renderer.getSize()
+							doUpdateUbo( m_renderer.m_common.borderVertexBuffer->overlaysBuffer[data.overlayIndex]
 								, *border
-								, data
-								, false
-								, nullptr ) )
-							{
-								doUpdateUbo( m_renderer.m_common.panelVertexBuffer->overlaysBuffer[data.overlayIndex]
-									, *border
-									, data.node->pass
-									, m_renderer.getSize()
-									, data.indirectData->firstVertex
-									, data.textBuffer );
-							}
+								, data.node->pass
+								, m_renderer.getSize()
+								, data.indirectData->firstVertex
+								, data.textBuffer );
 						}
-						break;
-					case OverlayType::eText:
-						if ( auto text = overlay->getTextOverlay() )
-						{
-							if ( m_renderer.m_common.textVertexBuffer->fill( m_renderer.getSize()
-								, *text
-								, data
-								, false
-								, text->getFontTexture() ) )
-							{
-								doUpdateUbo( m_renderer.m_common.textVertexBuffer->overlaysBuffer[data.overlayIndex]
-									, *text
-									, data.node->pass
-									, m_renderer.getSize()
-									, data.indirectData->firstVertex
-									, data.textBuffer );
-							}
-						}
-						break;
-					default:
-						break;
 					}
-
-					m_overlays.push_back( std::move( data ) );
+					else if ( m_renderer.m_common.panelVertexBuffer->fill( m_renderer.getSize()
+						, *border
+						, data
+						, false
+						, nullptr ) )
+					{
+						doUpdateUbo( m_renderer.m_common.panelVertexBuffer->overlaysBuffer[data.overlayIndex]
+							, *border
+							, data.node->pass
+							, m_renderer.getSize()
+							, data.indirectData->firstVertex
+							, data.textBuffer );
+					}
 				}
+				break;
+			case OverlayType::eText:
+				if ( auto text = overlay->getTextOverlay() )
+				{
+					if ( m_renderer.m_common.textVertexBuffer->fill( m_renderer.getSize()
+						, *text
+						, data
+						, false
+						, text->getFontTexture() ) )
+					{
+						doUpdateUbo( m_renderer.m_common.textVertexBuffer->overlaysBuffer[data.overlayIndex]
+							, *text
+							, data.node->pass
+							, m_renderer.getSize()
+							, data.indirectData->firstVertex
+							, data.textBuffer );
+					}
+				}
+				break;
+			default:
+				break;
 			}
 		}
 	}
@@ -315,7 +311,7 @@ namespace castor3d
 		, ashes::DescriptorSetCRefArray const & descriptorSets
 		, ashes::BufferBase const & indirectCommands
 		, uint32_t drawCount
-		, uint32_t & offset
+		, uint32_t offset
 		, ashes::CommandBuffer & commandBuffer )
 	{
 		commandBuffer.bindPipeline( *pipeline.pipeline );
@@ -330,12 +326,6 @@ namespace castor3d
 			, uint32_t( offset * sizeof( VkDrawIndirectCommand ) )
 			, drawCount
 			, sizeof( VkDrawIndirectCommand ) );
-		offset += drawCount;
-
-		if ( m_drawCounts )
-		{
-			++( *m_drawCounts );
-		}
 	}
 
 	void OverlayPreparer::doUpdateUbo( OverlayUboConfiguration & data
@@ -715,6 +715,7 @@ namespace castor3d
 				{
 					retired.emplace_back( std::move( descriptorConnection.descriptorSet ) );
 					m_commonData.textVertexBuffer->clearDrawPipelineData( &fontTexture );
+					drawList.invalidate();
 				} );
 		}
 
@@ -730,6 +731,8 @@ namespace castor3d
 		timerBlock = std::make_unique< crg::FramePassTimerBlock >( timer.start() );
 		retired.clear();
 		fence.wait( ashes::MaxTimeout );
+		recordedRenderPass = renderPass;
+		recordedFramebuffer = framebuffer;
 		commands.commandBuffer->begin( VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT | VK_COMMAND_BUFFER_USAGE_SIMULTANEOUS_USE_BIT
 			, makeVkStruct< VkCommandBufferInheritanceInfo >( renderPass
 				, 0u
@@ -1052,6 +1055,18 @@ namespace castor3d
 		m_sizeChanged = false;
 	}
 
+	bool OverlayRenderer::doIsRecordNeeded( VkRenderPass renderPass
+		, VkFramebuffer framebuffer
+		, bool drawsChanged )const
+	{
+		// The draw commands only reference the buffers, whose content is updated each frame,
+		// so they stay valid as long as the batches, the viewport and the targets stay the same.
+		return drawsChanged
+			|| m_sizeChanged
+			|| m_draw.recordedRenderPass != renderPass
+			|| m_draw.recordedFramebuffer != framebuffer;
+	}
+
 	std::pair< OverlayDrawNode *, OverlayPipelineData * > OverlayRenderer::doGetDrawNodeData( RenderDevice const & device
 		, VkRenderPass renderPass
 		, Overlay const & overlay
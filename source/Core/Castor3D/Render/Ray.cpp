@@ -2,12 +2,64 @@
 
 #include "Castor3D/Model/Mesh/Mesh.hpp"
 #include "Castor3D/Model/Mesh/Submesh/Submesh.hpp"
+#include "Castor3D/Model/Mesh/Submesh/TriangleBvh.hpp"
+#include "Castor3D/Model/Mesh/Submesh/Component/Face.hpp"
+#include "Castor3D/Model/Mesh/Submesh/Component/TriFaceMapping.hpp"
 #include "Castor3D/Scene/Camera.hpp"
 #include "Castor3D/Scene/Geometry.hpp"
 #include "Castor3D/Scene/SceneNode.hpp"
 
 namespace castor3d
 {
+	namespace ray
+	{
+		static bool intersectSlabs( castor::Point3f const & min
+			, castor::Point3f const & max
+			, castor::Point3f const & origin
+			, castor::Point3f const & direction
+			, float & tmin
+			, float & tmax )
+		{
+			tmin = std::numeric_limits< float >::lowest();
+			tmax = std::numeric_limits< float >::max();
+
+			for ( uint32_t i = 0u; i < 3u; ++i )
+			{
+				if ( std::abs( direction[i] ) < std::numeric_limits< float >::epsilon() )
+				{
+					// Parallel to the slab, the origin must be inside it.
+					if ( origin[i] < min[i] || origin[i] > max[i] )
+					{
+						return false;
+					}
+
+					continue;
+				}
+
+				auto invDirection = 1.0f / direction[i];
+				auto t0 = ( min[i] - origin[i] ) * invDirection;
+				auto t1 = ( max[i] - origin[i] ) * invDirection;
+
+				if ( t0 > t1 )
+				{
+					std::swap( t0, t1 );
+				}
+
+				tmin = std::max( tmin, t0 );
+				tmax = std::min( tmax, t1 );
+
+				if ( tmin > tmax )
+				{
+					return false;
+				}
+			}
+
+			return tmax >= 0.0f;
+		}
+	}
+
+	//*********************************************************************************************
+
 	Ray::Ray( castor::Position const & point
 		, Camera const & camera )
 	{
@@ -56,10 +108,20 @@ namespace castor3d
 		, castor::Point3f const & pt3
 		, float & distance )const
 	{
-		// see http://www.lighthouse3d.com/tutorials/maths/ray-triangle-intersection/
+		castor::Point2f barycentrics;
+		return intersects( pt1, pt2, pt3, distance, barycentrics );
+	}
+
+	castor::Intersection Ray::intersects( castor::Point3f const & pt1
+		, castor::Point3f const & pt2
+		, castor::Point3f const & pt3
+		, float & distance
+		, castor::Point2f & barycentrics )const
+	{
+		// Möller-Trumbore, see https://en.wikipedia.org/wiki/M%C3%B6ller%E2%80%93Trumbore_intersection_algorithm
 		auto result = castor::Intersection::eOut;
 		castor::Point3f e1{ pt2 - pt1 };
-		castor::Point3f e2{ pt1 - pt3 };
+		castor::Point3f e2{ pt3 - pt1 };
 		castor::Point3f h{ castor::point::cross( m_direction, e2 ) };
 		float a = castor::point::dot( e1, h );
 
@@ -76,10 +138,12 @@ namespace castor3d
 
 				if ( v >= 0.0 && u + v <= 1.0 )
 				{
-					distance = f * castor::point::dot( e2, q );
+					auto t = f * castor::point::dot( e2, q );
 
-					if ( distance > 0.00001f )
+					if ( t > 0.00001f )
 					{
+						distance = t;
+						barycentrics = castor::Point2f{ u, v };
 						result = castor::Intersection::eIn;
 					}
 				}
@@ -94,13 +158,19 @@ namespace castor3d
 		, Submesh const & submesh
 		, float & distance )const
 	{
-		//castor::Point3f pt1, pt2, pt3;
-		//auto stride = submesh.getVertexBuffer().getDeclaration().stride();
-		//return intersects( transform * Vertex::getPosition( &submesh.getVertexBuffer().getData()[face[0] * stride], pt1 )
-		//	, transform * Vertex::getPosition( &submesh.getVertexBuffer().getData()[face[1] * stride], pt2 )
-		//	, transform * Vertex::getPosition( &submesh.getVertexBuffer().getData()[face[2] * stride], pt3 )
-		//	, distance );
-		return castor::Intersection::eOut;
+		auto & positions = submesh.getPositions();
+
+		if ( face[0] >= positions.size()
+			|| face[1] >= positions.size()
+			|| face[2] >= positions.size() )
+		{
+			return castor::Intersection::eOut;
+		}
+
+		return intersects( transform * positions[face[0]]
+			, transform * positions[face[1]]
+			, transform * positions[face[2]]
+			, distance );
 	}
 
 	castor::Intersection Ray::intersects( castor::Point3f const & vertex
@@ -122,96 +192,19 @@ namespace castor3d
 	castor::Intersection Ray::intersects( castor::BoundingBox const & box
 		, float & distance )const
 	{
-		castor::Point3f v1( box.getMin().constPtr() );
-		castor::Point3f v8( box.getMax().constPtr() );
-		castor::Point3f v2( v8[0], v1[1], v1[2] );
-		castor::Point3f v3( v1[0], v8[1], v1[2] );
-		castor::Point3f v4( v8[0], v8[1], v1[2] );
-		castor::Point3f v5( v8[0], v1[1], v8[2] );
-		castor::Point3f v6( v1[0], v8[1], v8[2] );
-		castor::Point3f v7( v8[0], v8[1], v8[2] );
-		auto result = castor::Intersection::eOut;
-		float dist = 0.0f;
-		float min = std::numeric_limits< float >::max();
-
-		if ( ( intersects( v1, v2, v3, dist ) ) != castor::Intersection::eOut )
-		{
-			result = castor::Intersection::eIn;
-			min = std::min( min, dist );
-		}
-
-		if ( ( intersects( v2, v4, v3, dist ) ) != castor::Intersection::eOut )
-		{
-			result = castor::Intersection::eIn;
-			min = std::min( min, dist );
-		}
-
-		if ( ( intersects( v2, v6, v4, dist ) ) != castor::Intersection::eOut )
-		{
-			result = castor::Intersection::eIn;
-			min = std::min( min, dist );
-		}
-
-		if ( ( intersects( v6, v8, v4, dist ) ) != castor::Intersection::eOut )
-		{
-			result = castor::Intersection::eIn;
-			min = std::min( min, dist );
-		}
-
-		if ( ( intersects( v6, v5, v8, dist ) ) != castor::Intersection::eOut )
-		{
-			result = castor::Intersection::eIn;
-			min = std::min( min, dist );
-		}
-
-		if ( ( intersects( v5, v7, v8, dist ) ) != castor::Intersection::eOut )
-		{
-			result = castor::Intersection::eIn;
-			min = std::min( min, dist );
-		}
-
-		if ( ( intersects( v1, v7, v5, dist ) ) != castor::Intersection::eOut )
-		{
-			result = castor::Intersection::eIn;
-			min = std::min( min, dist );
-		}
-
-		if ( ( intersects( v1, v3, v7, dist ) ) != castor::Intersection::eOut )
-		{
-			result = castor::Intersection::eIn;
-			min = std::min( min, dist );
-		}
+		float tmin{};
+		float tmax{};
 
-		if ( ( intersects( v2, v1, v5, dist ) ) != castor::Intersection::eOut )
+		if ( !ray::intersectSlabs( box.getMin(), box.getMax(), m_origin, m_direction, tmin, tmax ) )
 		{
-			result = castor::Intersection::eIn;
-			min = std::min( min, dist );
-		}
-
-		if ( ( intersects( v2, v5, v6, dist ) ) != castor::Intersection::eOut )
-		{
-			result = castor::Intersection::eIn;
-			min = std::min( min, dist );
+			return castor::Intersection::eOut;
 		}
 
-		if ( ( intersects( v3, v4, v7, dist ) ) != castor::Intersection::eOut )
-		{
-			result = castor::Intersection::eIn;
-			min = std::min( min, dist );
-		}
-
-		if ( ( intersects( v4, v7, v8, dist ) ) != castor::Intersection::eOut )
-		{
-			result = castor::Intersection::eIn;
-			min = std::min( min, dist );
-		}
-
-		if ( result != castor::Intersection::eOut )
-		{
-			distance = min;
-		}
-
-		return result;
+		// From inside the box, the nearest hit is the exit point.
+		distance = tmin > 0.0f
+			? tmin
+			: tmax;
+		return castor::Intersection::eIn;
 	}
 
 	castor::Intersection Ray::intersects( castor::BoundingSphere const & sphere
@@ -279,49 +272,60 @@ namespace castor3d
 		, SubmeshRPtr & nearestSubmesh
 		, float & distance )const
 	{
-		auto mesh = geometry->getMesh();
-		castor::Point3f center{ geometry->getParent()->getDerivedPosition() };
-		castor::BoundingSphere sphere{ center, mesh->getBoundingSphere().getRadius() };
-		//castor::Matrix4x4f const & transform{ geometry->getParent()->getDerivedTransformationMatrix() };
-		auto result = castor::Intersection::eOut;
+		RaycastHit hit;
 
-		if ( intersects( sphere, distance ) != castor::Intersection::eOut )
+		if ( !intersects( *geometry
+			, geometry->getParent()->getDerivedTransformationMatrix().getInverse()
+			, hit ) )
 		{
-			for ( auto & submesh : *mesh )
+			return castor::Intersection::eOut;
+		}
+
+		for ( auto & submesh : *geometry->getMesh() )
+		{
+			if ( submesh.get() == hit.submesh )
 			{
-				sphere.load( center, submesh->getBoundingSphere().getRadius() );
+				nearestSubmesh = submesh.get();
+			}
+		}
 
-				if ( intersects( sphere, distance ) != castor::Intersection::eOut )
-				{
-					result = castor::Intersection::eIn;
-
-					//if ( auto indices = submesh->getIndexBuffer().lock() )
-					//{
-					//	float faceDist = std::numeric_limits< float >::max();
-
-					//	for ( uint32_t k = 0u; k < submesh->getFaceCount(); k++ )
-					//	{
-					//		Face face
-					//		{
-					//			indices[k * 3 + 0],
-					//			indices[k * 3 + 1],
-					//			indices[k * 3 + 2],
-					//		};
-					//		float curfaceDist = 0.0f;
-
-					//		if ( intersects( face, transform, *submesh, curfaceDist ) != Intersection::eOut && curfaceDist < faceDist )
-					//		{
-					//			result = Intersection::eIn;
-					//			nearestFace = face;
-					//			nearestSubmesh = submesh;
-					//			distance = curfaceDist;
-					//			faceDist = curfaceDist;
-					//		}
-					//	}
-					//}
-
-					//submesh->getIndexBuffer().unlock();
-				}
+		auto faces = nearestSubmesh->getComponent< TriFaceMapping >();
+		nearestFace = faces
+			? faces->getFaces()[hit.face]
+			: Face{ hit.face * 3u, hit.face * 3u + 1u, hit.face * 3u + 2u };
+		distance = hit.distance;
+		return castor::Intersection::eIn;
+	}
+
+	bool Ray::intersects( Geometry const & geometry
+		, castor::Matrix4x4f const & inverseTransform
+		, RaycastHit & hit )const
+	{
+		auto mesh = geometry.getMesh();
+
+		if ( !mesh )
+		{
+			return false;
+		}
+
+		// The direction isn't normalised in object space, so that the distances remain in world units.
+		auto origin = inverseTransform * m_origin;
+		auto direction = ( inverseTransform * ( m_origin + m_direction ) ) - origin;
+		bool result = false;
+
+		for ( auto & submesh : *mesh )
+		{
+			// The BVH starts with a slab test against the submesh box.
+			TriangleBvh::Hit bvhHit;
+
+			if ( submesh->getBvh().intersect( origin, direction, hit.distance, bvhHit ) )
+			{
+				hit.geometry = &geometry;
+				hit.submesh = submesh.get();
+				hit.face = bvhHit.face;
+				hit.barycentrics = bvhHit.barycentrics;
+				hit.distance = bvhHit.distance;
+				result = true;
 			}
 		}
 
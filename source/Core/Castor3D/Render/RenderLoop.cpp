@@ -4,7 +4,7 @@
 #include "Castor3D/Engine.hpp"
 #include "Castor3D/Buffer/GpuBufferPool.hpp"
 #include "Castor3D/Buffer/ObjectBufferPool.hpp"
-#include "Castor3D/Buffer/StagedUploadData.hpp"
+#include "Castor3D/Buffer/RingUploadData.hpp"
 #include "Castor3D/Buffer/UniformBufferPool.hpp"
 #include "Castor3D/Cache/AnimatedObjectGroupCache.hpp"
 #include "Castor3D/Cache/GeometryCache.hpp"
@@ -24,6 +24,7 @@
 
 #include <CastorUtils/Design/BlockGuard.hpp>
 #include <CastorUtils/Design/ResourceCache.hpp>
+#include <CastorUtils/Miscellaneous/Profiler.hpp>
 
 CU_ImplementSmartPtr( castor3d, RenderLoop )
 
@@ -193,14 +194,20 @@ namespace castor3d
 	{
 		if ( m_renderSystem.hasDevice() )
 		{
+			auto & profiler = castor::Profiler::getSingleton();
+			profiler.beginFrame();
 			bool first = m_ignored > 0;
 			RenderInfo & info = m_debugOverlays->beginFrame();
+			m_frameArena.reset();
 			doProcessEvents( CpuEventType::ePreGpuStep );
 			doGpuStep( info );
 			doProcessEvents( CpuEventType::ePreCpuStep );
 			doCpuStep( tslf );
 			doProcessEvents( CpuEventType::ePostCpuStep );
+			info.frameAllocationsCount = m_frameArena.getAllocationCount();
+			info.frameAllocatedSize = uint32_t( m_frameArena.getAllocatedSize() );
 			m_lastFrameTime = m_debugOverlays->endFrame( first );
+			profiler.endFrame();
 
 			if ( m_ignored == 1 )
 			{
@@ -213,6 +220,7 @@ namespace castor3d
 
 	void RenderLoop::doProcessEvents( CpuEventType eventType )
 	{
+		CU_ProfileZone( "RenderLoop::CpuEvents" );
 		auto block = m_timerCpuEvents[size_t( eventType )]->start();
 		getEngine()->getFrameListenerCache().forEach( [eventType]( FrameListener & listener )
 			{
@@ -224,6 +232,7 @@ namespace castor3d
 		, RenderDevice const & device
 		, QueueData const & queueData )
 	{
+		CU_ProfileZone( "RenderLoop::GpuEvents" );
 		auto block = m_timerGpuEvents[size_t( eventType )]->start();
 		getEngine()->getFrameListenerCache().forEach( [eventType, &device, &queueData]( FrameListener & listener )
 			{
@@ -233,6 +242,7 @@ namespace castor3d
 
 	void RenderLoop::doGpuStep( RenderInfo & info )
 	{
+		CU_ProfileFunction();
 		auto & windows = getEngine()->getRenderWindows();
 		crg::SemaphoreWaitArray toWait;
 		auto & device = m_renderSystem.getRenderDevice();
@@ -254,9 +264,9 @@ namespace castor3d
 				data = m_reservedQueue;
 			}
 
-			m_uploadData = castor::makeUniqueDerived< UploadData, StagedUploadData >( device
+			m_uploadData = castor::makeUniqueDerived< UploadData, RingUploadData >( device
 				, "RenderLoop"
-				, data->commandPool->createCommandBuffer( "RenderLoopUpload" ) );
+				, *data->commandPool );
 			m_uploadFence = device->createFence( "RenderLoopUpload" );
 
 			registerTimer( "Events/CPU/PreRender", *m_timerCpuEvents[0] );
@@ -279,9 +289,13 @@ namespace castor3d
 		doProcessEvents( GpuEventType::ePreUpload, device, *data );
 
 		// GPU Update
-		GpuUpdater updater{ device, info };
-		getEngine()->update( updater );
+		{
+			CU_ProfileZone( "RenderLoop::GpuUpdate" );
+			GpuUpdater updater{ device, info, &m_frameArena };
+			getEngine()->update( updater );
+		}
 
+		CU_ProfileZone( "RenderLoop::Upload" );
 		uploadData.begin();
 		device.bufferPool->upload( uploadData );
 		device.uboPool->upload( uploadData );
@@ -322,6 +336,11 @@ namespace castor3d
 		info.uploadSize = uint32_t( used.uploadSize );
 		info.stagingBuffersCount = uint32_t( used.buffersCount );
 
+		for ( auto & [name, size] : uploadData.getUploadSizes() )
+		{
+			info.buffersUploadSize[name] += uint32_t( size );
+		}
+
 		// Usually GPU cleanup
 		doProcessEvents( GpuEventType::ePostRender, device, *data );
 
@@ -335,7 +354,8 @@ namespace castor3d
 
 	void RenderLoop::doCpuStep( castor::Milliseconds tslf )
 	{
-		CpuUpdater updater;
+		CU_ProfileFunction();
+		CpuUpdater updater{ &m_frameArena };
 		updater.tslf = tslf;
 		getEngine()->update( updater );
 
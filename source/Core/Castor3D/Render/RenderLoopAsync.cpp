@@ -4,6 +4,7 @@
 #include "Castor3D/Render/RenderSystem.hpp"
 
 #include <CastorUtils/Miscellaneous/PreciseTimer.hpp>
+#include <CastorUtils/Miscellaneous/Profiler.hpp>
 #include <CastorUtils/Design/ScopeGuard.hpp>
 #include <CastorUtils/Design/BlockGuard.hpp>
 
@@ -130,6 +131,7 @@ namespace castor3d
 
 	void RenderLoopAsync::doMainLoop()
 	{
+		castor::Profiler::getSingleton().setThreadName( cuT( "Render loop" ) );
 		castor::PreciseTimer timer;
 		m_frameEnded = true;
 		auto scopeGuard{ castor::makeScopeGuard( [this]()
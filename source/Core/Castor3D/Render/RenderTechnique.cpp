@@ -48,6 +48,7 @@
 #include "Castor3D/Shader/ShaderBuffers/ShadowBuffer.hpp"
 
 #include <CastorUtils/Design/ResourceCache.hpp>
+#include <CastorUtils/Miscellaneous/Hash.hpp>
 
 #include <RenderGraph/FramePassGroup.hpp>
 #include <RenderGraph/FramePassTimer.hpp>
@@ -543,6 +544,7 @@ namespace castor3d
 			array.clear();
 		}
 
+		m_shadowRequests.clear();
 		m_directionalShadowMap.reset();
 		m_pointShadowMap.reset();
 		m_spotShadowMap.reset();
@@ -1048,6 +1050,8 @@ namespace castor3d
 					, m_layeredLightPropagationVolumesG
 					, updater );
 			}
+
+			doScheduleShadowMaps( updater );
 		}
 #endif
 	}
@@ -1068,6 +1072,72 @@ namespace castor3d
 		}
 	}
 
+	void RenderTechnique::doScheduleShadowMaps( CpuUpdater & updater )
+	{
+		auto & scene = *m_renderTarget.getScene();
+		auto & camera = *updater.camera;
+		auto sceneIt = updater.dirtyScenes.find( &scene );
+		auto optimise = getEngine()->areUpdateOptimisationsEnabled();
+		m_shadowScheduler.setBudget( optimise
+			? scene.getShadowUpdateBudget()
+			: 0u );
+		m_shadowRequests.clear();
+
+		for ( auto & array : m_activeShadowMaps )
+		{
+			for ( auto & shadowMap : array )
+			{
+				for ( auto & id : shadowMap.ids )
+				{
+					auto & light = *id.first;
+					ShadowMapScheduler::Request request;
+					request.id = std::hash< Light const * >{}( &light );
+					castor::hashCombine64( request.id, id.second );
+					request.outOfDate = !optimise
+						|| !shadowMap.shadowMap.get().isUpToDate( id.second );
+
+					switch ( light.getLightType() )
+					{
+					case LightType::eDirectional:
+						// The cascades follow the camera, the shadow matrices are updated each frame.
+						request.cost = scene.getDirectionalShadowCascades();
+						request.mandatory = true;
+						break;
+					case LightType::ePoint:
+						request.cost = 6u;
+						break;
+					default:
+						request.cost = 1u;
+						break;
+					}
+
+					if ( !request.mandatory )
+					{
+						// A moved light's shadow matrices don't match its previous layer content anymore.
+						request.mandatory = sceneIt != updater.dirtyScenes.end()
+							&& sceneIt->second.dirtyLights.end() != std::find( sceneIt->second.dirtyLights.begin()
+								, sceneIt->second.dirtyLights.end()
+								, &light );
+						// Approximates the light's screen coverage.
+						auto radius = float( castor::point::length( light.getBoundingBox().getDimensions() ) ) * 0.5f;
+						auto distance = float( castor::point::distanceSquared( camera.getParent()->getDerivedPosition()
+							, light.getParent()->getDerivedPosition() ) );
+						request.priority = ( radius * radius + 1.0f ) / ( radius * radius + distance + 1.0f );
+					}
+
+					m_shadowRequests.push_back( request );
+				}
+			}
+		}
+
+		m_shadowScheduler.schedule( m_shadowRequests );
+		auto & counts = m_shadowScheduler.getCounts();
+		updater.info.shadowMapsCount += counts.requested;
+		updater.info.shadowMapsRendered += counts.rendered;
+		updater.info.shadowMapsDeferred += counts.deferred;
+		updater.info.shadowMapsCached += counts.cached;
+	}
+
 	void RenderTechnique::doUpdateLpv( CpuUpdater & updater )
 	{
 		for ( auto i = uint32_t( LightType::eMin ); i < uint32_t( LightType::eCount ); ++i )
@@ -1143,13 +1213,25 @@ namespace castor3d
 
 		if ( scene.hasShadows() )
 		{
+			auto request = m_shadowRequests.begin();
+
 			for ( auto & array : m_activeShadowMaps )
 			{
 				for ( auto & shadowMap : array )
 				{
 					for ( auto & index : shadowMap.ids )
 					{
-						result = shadowMap.shadowMap.get().render( result, queue, index.second );
+						// A deferred layer stays out of date, and is requested again next frame.
+						if ( request == m_shadowRequests.end()
+							|| request->render )
+						{
+							result = shadowMap.shadowMap.get().render( result, queue, index.second );
+						}
+
+						if ( request != m_shadowRequests.end() )
+						{
+							++request;
+						}
 					}
 				}
 			}
@@ -268,6 +268,15 @@ namespace castor3d
 		return result;
 	}
 
+	bool ShadowMap::isUpToDate( uint32_t index )const
+	{
+		auto & myPasses = m_passes[m_passesIndex];
+		return index < myPasses.otherNodes.runnables.size()
+			&& myPasses.otherNodes.runnables[index]
+			&& doIsUpToDate( index, myPasses.staticNodes )
+			&& doIsUpToDate( index, myPasses.otherNodes );
+	}
+
 	ashes::VkClearValueArray const & ShadowMap::getClearValues()const
 	{
 		static ashes::VkClearValueArray const result
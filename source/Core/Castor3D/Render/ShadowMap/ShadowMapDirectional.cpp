@@ -257,6 +257,7 @@ namespace castor3d
 			passes.passes.emplace_back( std::make_unique< ShadowMap::PassData >() );
 			auto & passData = *passes.passes.back();
 			passData.ownCuller = castor::makeUniqueDerived< SceneCuller, DummyCuller >( m_scene, &camera, isStatic );
+			passData.ownCuller->setShadowCuller( true );
 			passData.culler = passData.ownCuller.get();
 			auto & pass = group.createPass( "Nodes"
 				, [&passData, this, cascade, vsm, rsm, isStatic, &camera, &cameraUbo]( crg::FramePass const & framePass
@@ -540,12 +541,17 @@ namespace castor3d
 		m_shadowType = light.getShadowType();
 
 		auto shadowModified = directional.updateShadow( camera );
+		auto & myPasses = m_passes[m_passesIndex];
 
 		for ( uint32_t cascade = 0u; cascade < m_cascades; ++cascade )
 		{
-			if ( shadowModified )
+			if ( shadowModified
+				&& directional.isCascadeModified( cascade ) )
 			{
-				auto & lightCamera = *m_passes[m_passesIndex].cameras[cascade];
+				// Redraw the moved cascade this frame, its light camera will only be seen as dirty next frame.
+				myPasses.staticNodes.passes[cascade]->pass->setOutOfDate();
+				myPasses.otherNodes.passes[cascade]->pass->setOutOfDate();
+				auto & lightCamera = *myPasses.cameras[cascade];
 				lightCamera.attachTo( *node );
 				lightCamera.setView( directional.getViewMatrix( cascade ) );
 				lightCamera.setProjection( directional.getProjMatrix( cascade ) );
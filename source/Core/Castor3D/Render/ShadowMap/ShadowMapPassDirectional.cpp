@@ -87,7 +87,9 @@ namespace castor3d
 				, sceneObjs.dirtyCameras.end()
 				, &m_camera );
 
-			if ( it == sceneObjs.dirtyCameras.end() )
+			// Reused cascades don't depend on the viewer camera.
+			if ( it == sceneObjs.dirtyCameras.end()
+				&& getScene().getDirectionalShadowReuseTolerance() <= 0.0f )
 			{
 				it = std::find( sceneObjs.dirtyCameras.begin()
 					, sceneObjs.dirtyCameras.end()
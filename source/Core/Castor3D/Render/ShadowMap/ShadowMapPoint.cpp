@@ -137,6 +137,7 @@ namespace castor3d
 				, ShadowMapPointTextureSize } );
 			passData.frustum = castor::makeUnique< Frustum >( *passData.viewport );
 			passData.ownCuller = castor::makeUniqueDerived< SceneCuller, FrustumCuller >( m_scene, *passData.frustum, isStatic );
+			passData.ownCuller->setShadowCuller( true );
 			passData.culler = passData.ownCuller.get();
 			auto & pass = group.createPass( "Nodes"
 				, [faceIndex, &passData, this, vsm, rsm, isStatic, &cameraUbo]( crg::FramePass const & framePass
@@ -0,0 +1,111 @@
+#include "Castor3D/Render/ShadowMap/ShadowMapScheduler.hpp"
+
+#include <CastorUtils/Config/BeginExternHeaderGuard.hpp>
+#include <algorithm>
+#include <CastorUtils/Config/EndExternHeaderGuard.hpp>
+
+namespace castor3d
+{
+	namespace shdsched
+	{
+		static float getScore( ShadowMapScheduler::Request const & request
+			, uint32_t waited )
+		{
+			return request.priority * float( 1u + waited );
+		}
+	}
+
+	//*********************************************************************************************
+
+	ShadowMapScheduler::ShadowMapScheduler( uint32_t budget )
+		: m_budget{ budget }
+	{
+	}
+
+	void ShadowMapScheduler::schedule( RequestArray & requests )
+	{
+		++m_frame;
+		m_counts = Counts{};
+		m_counts.requested = uint32_t( requests.size() );
+		m_candidates.clear();
+		uint32_t used{};
+
+		for ( uint32_t i = 0u; i < uint32_t( requests.size() ); ++i )
+		{
+			auto & request = requests[i];
+			auto it = m_states.find( request.id );
+			request.render = false;
+
+			if ( it == m_states.end() )
+			{
+				// Never drawn, its content is undefined.
+				request.render = true;
+				it = m_states.emplace( request.id, State{} ).first;
+			}
+			else if ( !request.outOfDate )
+			{
+				it->second.waited = 0u;
+				++m_counts.cached;
+			}
+			else if ( request.mandatory
+				|| m_budget == 0u
+				|| it->second.waited >= MaxDeferredFrames )
+			{
+				request.render = true;
+			}
+			else
+			{
+				m_candidates.push_back( i );
+			}
+
+			if ( request.render )
+			{
+				used += request.cost;
+				it->second.waited = 0u;
+				++m_counts.rendered;
+			}
+
+			it->second.frame = m_frame;
+		}
+
+		std::stable_sort( m_candidates.begin()
+			, m_candidates.end()
+			, [this, &requests]( uint32_t lhs, uint32_t rhs )
+			{
+				return shdsched::getScore( requests[lhs], m_states[requests[lhs].id].waited )
+					> shdsched::getScore( requests[rhs], m_states[requests[rhs].id].waited );
+			} );
+
+		for ( auto index : m_candidates )
+		{
+			auto & request = requests[index];
+			auto & state = m_states[request.id];
+
+			if ( m_counts.rendered == 0u
+				|| used + request.cost <= m_budget )
+			{
+				request.render = true;
+				used += request.cost;
+				state.waited = 0u;
+				++m_counts.rendered;
+			}
+			else
+			{
+				++state.waited;
+				++m_counts.deferred;
+			}
+		}
+
+		for ( auto it = m_states.begin(); it != m_states.end(); )
+		{
+			if ( it->second.frame != m_frame )
+			{
+				it = m_states.erase( it );
+			}
+			else
+			{
+				++it;
+			}
+		}
+	}
+}
@@ -129,6 +129,7 @@ namespace castor3d
 		passes.passes.emplace_back( std::make_unique< ShadowMap::PassData >( nullptr ) );
 		auto & passData = *passes.passes.back();
 		passData.ownCuller = castor::makeUniqueDerived< SceneCuller, FrustumCuller >( m_scene, camera, isStatic );
+		passData.ownCuller->setShadowCuller( true );
 		passData.culler = passData.ownCuller.get();
 		auto & pass = group.createPass( "Nodes"
 			, [index, &passData, this, vsm, rsm, isStatic, &cameraUbo]( crg::FramePass const & framePass
@@ -8,10 +8,23 @@
 #include "Castor3D/Render/Node/SceneRenderNodes.hpp"
 #include "Castor3D/Scene/Scene.hpp"
 
+#include <CastorUtils/Pool/ObjectSlabPool.hpp>
+
 CU_ImplementSmartPtr( castor3d, Geometry )
 
 namespace castor3d
 {
+	namespace geom
+	{
+		static castor::ObjectSlabPoolT< Geometry > & getPool()
+		{
+			static castor::ObjectSlabPoolT< Geometry > result;
+			return result;
+		}
+	}
+
+	//*********************************************************************************************
+
 	Geometry::Geometry( castor::String const & name
 		, Scene & scene
 		, SceneNode & node
@@ -33,6 +46,16 @@ namespace castor3d
 		doUpdateMesh();
 	}
 
+	void * Geometry::operator new( size_t size )
+	{
+		return geom::getPool().allocate( size );
+	}
+
+	void Geometry::operator delete( void * memory, size_t size )
+	{
+		geom::getPool().deallocate( memory, size );
+	}
+
 	void Geometry::prepare( uint32_t & faceCount
 		, uint32_t & vertexCount )
 	{
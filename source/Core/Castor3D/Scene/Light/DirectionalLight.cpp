@@ -3,11 +3,13 @@
 #include "Castor3D/DebugDefines.hpp"
 #include "Castor3D/Engine.hpp"
 #include "Castor3D/Limits.hpp"
+#include "Castor3D/Model/Mesh/Mesh.hpp"
 #include "Castor3D/Render/RenderSystem.hpp"
 #include "Castor3D/Render/Viewport.hpp"
 #include "Castor3D/Render/ShadowMap/ShadowMapDirectional.hpp"
 #include "Castor3D/Render/ShadowMap/ShadowMapPassDirectional.hpp"
 #include "Castor3D/Scene/Camera.hpp"
+#include "Castor3D/Scene/Geometry.hpp"
 #include "Castor3D/Scene/Scene.hpp"
 #include "Castor3D/Scene/SceneNode.hpp"
 #include "Castor3D/Scene/Light/Light.hpp"
@@ -25,130 +27,369 @@ namespace castor3d
 
 	namespace lgtdirectional
 	{
-		static std::vector< DirectionalLight::Cascade > doComputeCascades( Camera const & camera
-			, DirectionalLight const & light
-			, uint32_t cascades )
-		{
-			auto & scene = *light.getLight().getScene();
-			auto & renderSystem = *scene.getEngine()->getRenderSystem();
-			std::vector< DirectionalLight::Cascade > result( cascades );
-			castor::Point3f lightDirection = light.getDirection();
+		// The shrinks applied to a fitted cascade are powers of two of its sphere diameter, up to 2^MaxFitLevel.
+		static uint32_t constexpr MaxFitLevel = 4u;
 
-			castor::Point3f up{ 0.0f, 1.0f, 0.0f };
-			castor::Point3f right( castor::point::getNormalised( castor::point::cross( up, lightDirection ) ) );
-			up = castor::point::getNormalised( castor::point::cross( lightDirection, right ) );
-			auto const lightViewMatrix = castor::matrix::lookAt( castor::Point3f{}, lightDirection, up );
-			auto const cameraVP = castor::matrix::reverseDepth( camera.getProjection( false ) ) * camera.getView();
-			auto const invCameraVP = cameraVP.getInverse();
+		static bool overlaps( castor::BoundingBox const & box
+			, castor::Point3f const & min
+			, castor::Point3f const & max
+			, bool checkDepth )
+		{
+			auto boxMin = box.getMin();
+			auto boxMax = box.getMax();
+			return boxMin->x <= max->x && boxMax->x >= min->x
+				&& boxMin->y <= max->y && boxMax->y >= min->y
+				&& ( !checkDepth || ( boxMin->z <= max->z && boxMax->z >= min->z ) );
+		}
 
-			auto nearClip = camera.getNear();
-			auto farClip = camera.getFar();
-			float clipRange = farClip - nearClip;
+		static bool contains( DirectionalLightCascade const & cascade
+			, castor::Point3f const & min
+			, castor::Point3f const & max )
+		{
+			return cascade.minExtents->x <= min->x && cascade.maxExtents->x >= max->x
+				&& cascade.minExtents->y <= min->y && cascade.maxExtents->y >= max->y
+				&& cascade.minExtents->z <= min->z && cascade.maxExtents->z >= max->z;
+		}
 
-			float minZ = nearClip;
-			float maxZ = nearClip + clipRange;
+		static void doFitExtents( castor::Point3f const & frustumCenter
+			, float radius
+			, uint32_t textureSize
+			, std::vector< castor::BoundingBox > const & casters
+			, std::vector< castor::BoundingBox > const & receivers
+			, castor::Point3f & minExtents
+			, castor::Point3f & maxExtents
+			, castor::Point3f & minNeeded
+			, castor::Point3f & maxNeeded )
+		{
+			constexpr float fmin = std::numeric_limits< float >::max();
+			constexpr float fmax = std::numeric_limits< float >::lowest();
+			castor::Point3f sliceMin = frustumCenter - castor::Point3f{ radius, radius, radius };
+			castor::Point3f sliceMax = frustumCenter + castor::Point3f{ radius, radius, radius };
+			castor::Point3f fitMin{ fmin, fmin, fmin };
+			castor::Point3f fitMax{ fmax, fmax, fmax };
+			bool found{};
+
+			// Receivers in the slice, clipped to its sphere box.
+			for ( auto & receiver : receivers )
+			{
+				if ( overlaps( receiver, sliceMin, sliceMax, true ) )
+				{
+					auto receiverMin = receiver.getMin();
+					auto receiverMax = receiver.getMax();
 
-			float ratio = maxZ / minZ;
+					for ( uint32_t i = 0u; i < 3u; ++i )
+					{
+						fitMin[i] = std::max( std::min( fitMin[i], receiverMin[i] ), sliceMin[i] );
+						fitMax[i] = std::min( std::max( fitMax[i], receiverMax[i] ), sliceMax[i] );
+					}
 
-			// Calculate split depths based on view camera frustum
-			// Based on method presented in https://developer.nvidia.com/gpugems/GPUGems3/gpugems3_ch10.html
-			std::vector< float > cascadeSplits( cascades, 0.0f );
-			float constexpr lambda = 0.95f;
+					found = true;
+				}
+			}
 
-			for ( uint32_t i = 0; i < cascades; i++ )
+			if ( !found )
 			{
-				float p = float( i + 1 ) / float( cascades );
-				float log = minZ * std::pow( ratio, p );
-				float uniform = minZ + clipRange * p;
-				float d = lambda * ( log - uniform ) + uniform;
-				cascadeSplits[i] = ( d - nearClip ) / clipRange;
+				return;
 			}
 
-			std::array< castor::Point3f, 8u > frustumCorners
+			minNeeded->x = fitMin->x;
+			minNeeded->y = fitMin->y;
+			maxNeeded->x = fitMax->x;
+			maxNeeded->y = fitMax->y;
+
+			// Shrink the cascade by powers of two, keeping a one texel margin, so that its texel size only changes by steps.
+			auto wanted = std::max( fitMax->x - fitMin->x, fitMax->y - fitMin->y );
+			auto size = 2.0f * radius;
+			uint32_t level{};
+
+			while ( level < MaxFitLevel
+				&& size * 0.5f * ( 1.0f - 2.0f / float( textureSize ) ) >= wanted )
 			{
-				castor::Point3f( -1.0f, +1.0f, -1.0f ),
-				castor::Point3f( +1.0f, +1.0f, -1.0f ),
-				castor::Point3f( +1.0f, -1.0f, -1.0f ),
-				castor::Point3f( -1.0f, -1.0f, -1.0f ),
-				castor::Point3f( -1.0f, +1.0f, +1.0f ),
-				castor::Point3f( +1.0f, +1.0f, +1.0f ),
-				castor::Point3f( +1.0f, -1.0f, +1.0f ),
-				castor::Point3f( -1.0f, -1.0f, +1.0f ),
-			};
-
-			// Project main frustum corners into world space
-			for ( auto & frustumCorner : frustumCorners )
+				size *= 0.5f;
+				++level;
+			}
+
+			if ( level )
 			{
-				auto invCorner = invCameraVP * castor::Point4f{ frustumCorner->x, frustumCorner->y, frustumCorner->z, 1.0f };
-				frustumCorner = castor::Point3f{ invCorner / invCorner->w };
+				auto texelSize = size / float( textureSize );
+				minExtents->x = std::floor( ( ( fitMin->x + fitMax->x - size ) * 0.5f ) / texelSize ) * texelSize;
+				minExtents->y = std::floor( ( ( fitMin->y + fitMax->y - size ) * 0.5f ) / texelSize ) * texelSize;
+				maxExtents->x = minExtents->x + size;
+				maxExtents->y = minExtents->y + size;
 			}
 
-			float prevSplitDist = 0.0;
+			// Depth range of the casters and receivers above the cascade.
+			float minZ = fmin;
+			float maxZ = fmax;
 
-			for ( uint32_t cascadeIdx = 0; cascadeIdx < cascades; ++cascadeIdx )
+			for ( auto objects : { &casters, &receivers } )
 			{
-				float splitDist = cascadeSplits[cascadeIdx];
-				auto cascadeFrustum = frustumCorners;
-
-				// Compute cascade frustum in light view space.
-				for ( uint32_t i = 0; i < 4; ++i )
+				for ( auto & object : *objects )
 				{
-					auto cornerRay = cascadeFrustum[i + 4] - cascadeFrustum[i];
-					auto nearCornerRay = cornerRay * prevSplitDist;
-					auto farCornerRay = cornerRay * splitDist;
-					cascadeFrustum[i + 4] = lightViewMatrix * ( cascadeFrustum[i] + farCornerRay );
-					cascadeFrustum[i] = lightViewMatrix * ( cascadeFrustum[i] + nearCornerRay );
+					if ( overlaps( object, minExtents, maxExtents, false ) )
+					{
+						minZ = std::min( minZ, object.getMin()->z );
+						maxZ = std::max( maxZ, object.getMax()->z );
+					}
 				}
+			}
+
+			if ( minZ < maxZ )
+			{
+				minExtents->z = minZ;
+				maxExtents->z = maxZ;
+				minNeeded->z = minZ;
+				maxNeeded->z = maxZ;
+			}
+		}
+
+		static void doComputeExtents( castor::Point3f const & frustumCenter
+			, float radius
+			, float farClip
+			, uint32_t textureSize
+			, bool fitToBounds
+			, std::vector< castor::BoundingBox > const & casters
+			, std::vector< castor::BoundingBox > const & receivers
+			, castor::Point3f & minExtents
+			, castor::Point3f & maxExtents
+			, castor::Point3f & minNeeded
+			, castor::Point3f & maxNeeded )
+		{
+			radius = std::ceil( radius * 16.0f ) / 16.0f;
+
+			// Compute AABB
+			castor::Point3f frustumRadius{ radius, radius, radius };
+			maxExtents = frustumCenter + frustumRadius;
+			minExtents = frustumCenter - frustumRadius;
+			minNeeded = minExtents;
+			maxNeeded = maxExtents;
+
+			// Snap cascade to texel grid:
+			auto extent = maxExtents - minExtents;
+			auto texelSize = extent / float( textureSize );
+			minExtents = castor::point::getFloored( minExtents / texelSize ) * texelSize;
+			maxExtents = castor::point::getFloored( maxExtents / texelSize ) * texelSize;
+
+			// Extrude bounds to avoid early shadow clipping:
+			auto ext = float( fabs( frustumCenter->z - minExtents->z ) );
+			ext = std::max( ext, farClip * 0.5f );
+			minExtents->z = frustumCenter->z - ext;
+			maxExtents->z = frustumCenter->z + ext;
+
+			if ( fitToBounds )
+			{
+				doFitExtents( frustumCenter
+					, radius
+					, textureSize
+					, casters
+					, receivers
+					, minExtents
+					, maxExtents
+					, minNeeded
+					, maxNeeded );
+			}
+		}
+
+		static void doGatherBounds( Scene & scene
+			, castor::Matrix4x4f const & lightViewMatrix
+			, std::vector< castor::BoundingBox > & casters
+			, std::vector< castor::BoundingBox > & receivers )
+		{
+			casters.clear();
+			receivers.clear();
+			auto & cache = scene.getGeometryCache();
+			auto lock( castor::makeUniqueLock( cache ) );
 
-				// Get cascade bounding sphere center
-				castor::Point3f frustumCenter{ 0, 0, 0 };
-				for ( auto frustumCorner : cascadeFrustum )
+			for ( auto & geomIt : cache )
+			{
+				auto & geometry = *geomIt.second;
+				auto node = geometry.getParent();
+				auto mesh = geometry.getMesh();
+
+				if ( node && mesh && node->isDisplayable() && node->isVisible()
+					&& ( geometry.isShadowCaster() || geometry.isShadowReceiver() ) )
 				{
-					frustumCenter += frustumCorner;
+					auto bbox = mesh->getBoundingBox().getAxisAligned( lightViewMatrix * node->getDerivedTransformationMatrix() );
+
+					if ( geometry.isShadowCaster() )
+					{
+						casters.push_back( bbox );
+					}
+
+					if ( geometry.isShadowReceiver() )
+					{
+						receivers.push_back( bbox );
+					}
 				}
-				frustumCenter /= float( cascadeFrustum.size() );
+			}
+		}
+	}
+
+	//*************************************************************************************************
 
-				// Get cascade bounding sphere radius
-				float radius = 0.0f;
-				for ( auto frustumCorner : cascadeFrustum )
+	castor::Matrix4x4f getDirectionalLightView( castor::Point3f const & lightDirection )
+	{
+		castor::Point3f up{ 0.0f, 1.0f, 0.0f };
+		castor::Point3f right( castor::point::getNormalised( castor::point::cross( up, lightDirection ) ) );
+		up = castor::point::getNormalised( castor::point::cross( lightDirection, right ) );
+		return castor::matrix::lookAt( castor::Point3f{}, lightDirection, up );
+	}
+
+	uint32_t computeDirectionalCascades( castor::Matrix4x4f const & cameraView
+		, castor::Matrix4x4f const & cameraProjection
+		, float nearClip
+		, float farClip
+		, castor::Point3f const & lightDirection
+		, uint32_t textureSize
+		, DirectionalCascadesConfig const & config
+		, std::vector< castor::BoundingBox > const & casters
+		, std::vector< castor::BoundingBox > const & receivers
+		, std::vector< DirectionalLightCascade > & cascades )
+	{
+		auto count = uint32_t( cascades.size() );
+		uint32_t result{};
+		auto const lightViewMatrix = getDirectionalLightView( lightDirection );
+		auto const cameraVP = castor::matrix::reverseDepth( cameraProjection ) * cameraView;
+		auto const invCameraVP = cameraVP.getInverse();
+
+		float clipRange = farClip - nearClip;
+
+		float minZ = nearClip;
+		float maxZ = nearClip + clipRange;
+
+		float ratio = maxZ / minZ;
+
+		// Calculate split depths based on view camera frustum
+		// Based on method presented in https://developer.nvidia.com/gpugems/GPUGems3/gpugems3_ch10.html
+		std::vector< float > cascadeSplits( count, 0.0f );
+		float constexpr lambda = 0.95f;
+
+		for ( uint32_t i = 0; i < count; i++ )
+		{
+			float p = float( i + 1 ) / float( count );
+			float log = minZ * std::pow( ratio, p );
+			float uniform = minZ + clipRange * p;
+			float d = lambda * ( log - uniform ) + uniform;
+			cascadeSplits[i] = ( d - nearClip ) / clipRange;
+		}
+
+		std::array< castor::Point3f, 8u > frustumCorners
+		{
+			castor::Point3f( -1.0f, +1.0f, -1.0f ),
+			castor::Point3f( +1.0f, +1.0f, -1.0f ),
+			castor::Point3f( +1.0f, -1.0f, -1.0f ),
+			castor::Point3f( -1.0f, -1.0f, -1.0f ),
+			castor::Point3f( -1.0f, +1.0f, +1.0f ),
+			castor::Point3f( +1.0f, +1.0f, +1.0f ),
+			castor::Point3f( +1.0f, -1.0f, +1.0f ),
+			castor::Point3f( -1.0f, -1.0f, +1.0f ),
+		};
+
+		// Project main frustum corners into world space
+		for ( auto & frustumCorner : frustumCorners )
+		{
+			auto invCorner = invCameraVP * castor::Point4f{ frustumCorner->x, frustumCorner->y, frustumCorner->z, 1.0f };
+			frustumCorner = castor::Point3f{ invCorner / invCorner->w };
+		}
+
+		float prevSplitDist = 0.0;
+
+		for ( uint32_t cascadeIdx = 0; cascadeIdx < count; ++cascadeIdx )
+		{
+			float splitDist = cascadeSplits[cascadeIdx];
+			auto cascadeFrustum = frustumCorners;
+
+			// Compute cascade frustum in light view space.
+			for ( uint32_t i = 0; i < 4; ++i )
+			{
+				auto cornerRay = cascadeFrustum[i + 4] - cascadeFrustum[i];
+				auto nearCornerRay = cornerRay * prevSplitDist;
+				auto farCornerRay = cornerRay * splitDist;
+				cascadeFrustum[i + 4] = lightViewMatrix * ( cascadeFrustum[i] + farCornerRay );
+				cascadeFrustum[i] = lightViewMatrix * ( cascadeFrustum[i] + nearCornerRay );
+			}
+
+			// Get cascade bounding sphere center
+			castor::Point3f frustumCenter{ 0, 0, 0 };
+			for ( auto frustumCorner : cascadeFrustum )
+			{
+				frustumCenter += frustumCorner;
+			}
+			frustumCenter /= float( cascadeFrustum.size() );
+
+			// Get cascade bounding sphere radius
+			float radius = 0.0f;
+			for ( auto frustumCorner : cascadeFrustum )
+			{
+				float distance = float( castor::point::length( frustumCorner - frustumCenter ) );
+				radius = std::max( radius, distance );
+			}
+
+			castor::Point3f minExtents;
+			castor::Point3f maxExtents;
+			castor::Point3f minNeeded;
+			castor::Point3f maxNeeded;
+			lgtdirectional::doComputeExtents( frustumCenter
+				, radius
+				, farClip
+				, textureSize
+				, config.fitToBounds
+				, casters
+				, receivers
+				, minExtents
+				, maxExtents
+				, minNeeded
+				, maxNeeded );
+
+			castor::Point2f splitDepthScale;
+			splitDepthScale->x = ( nearClip + splitDist * clipRange ) * -1.0f;
+			splitDepthScale->y = -splitDepthScale->x / clipRange;
+			prevSplitDist = splitDist;
+			auto & cascade = cascades[cascadeIdx];
+
+			if ( config.reuseTolerance > 0.0f )
+			{
+				// Keep the cascade while it still holds the slice.
+				if ( cascade.viewMatrix == lightViewMatrix
+					&& cascade.splitDepthScale == splitDepthScale
+					&& lgtdirectional::contains( cascade, minNeeded, maxNeeded ) )
 				{
-					float distance = float( castor::point::length( frustumCorner - frustumCenter ) );
-					radius = std::max( radius, distance );
+					continue;
 				}
-				radius = std::ceil( radius * 16.0f ) / 16.0f;
-
-				// Compute AABB
-				castor::Point3f frustumRadius{ radius, radius, radius };
-				castor::Point3f maxExtents = frustumCenter + frustumRadius;
-				castor::Point3f minExtents = frustumCenter - frustumRadius;
-
-				// Snap cascade to texel grid:
-				auto extent = maxExtents - minExtents;
-				auto texelSize = extent / float( ShadowMapDirectionalTextureSize );
-				minExtents = castor::point::getFloored( minExtents / texelSize ) * texelSize;
-				maxExtents = castor::point::getFloored( maxExtents / texelSize ) * texelSize;
-
-				// Extrude bounds to avoid early shadow clipping:
-				auto ext = float( fabs( frustumCenter->z - minExtents->z ) );
-				ext = std::max( ext, farClip * 0.5f );
-				minExtents->z = frustumCenter->z - ext;
-				maxExtents->z = frustumCenter->z + ext;
-
-				// Fill cascade
-				auto & cascade = result[cascadeIdx];
-				cascade.viewMatrix = lightViewMatrix;
-				cascade.projMatrix = renderSystem.getOrtho( minExtents->x, maxExtents->x
-					, minExtents->y, maxExtents->y
-					, minExtents->z, maxExtents->z );
-				cascade.viewProjMatrix = cascade.projMatrix * cascade.viewMatrix;
-				cascade.splitDepthScale->x = ( nearClip + splitDist * clipRange ) * -1.0f;
-				cascade.splitDepthScale->y = -cascade.splitDepthScale->x / clipRange;
-
-				prevSplitDist = splitDist;
+
+				// Otherwise, leave room for the next camera moves.
+				lgtdirectional::doComputeExtents( frustumCenter
+					, radius * ( 1.0f + config.reuseTolerance )
+					, farClip
+					, textureSize
+					, config.fitToBounds
+					, casters
+					, receivers
+					, minExtents
+					, maxExtents
+					, minNeeded
+					, maxNeeded );
 			}
 
-			return result;
+			// Fill cascade
+			DirectionalLightCascade computed;
+			computed.viewMatrix = lightViewMatrix;
+			computed.projMatrix = castor::matrix::reverseDepth( castor::matrix::ortho( minExtents->x, maxExtents->x
+				, minExtents->y, maxExtents->y
+				, minExtents->z, maxExtents->z ) );
+			computed.viewProjMatrix = computed.projMatrix * computed.viewMatrix;
+			computed.splitDepthScale = splitDepthScale;
+			computed.minExtents = minExtents;
+			computed.maxExtents = maxExtents;
+
+			if ( computed != cascade )
+			{
+				cascade = computed;
+				result |= ( 1u << cascadeIdx );
+			}
 		}
+
+		return result;
 	}
 
 	//*************************************************************************************************
@@ -166,7 +407,6 @@ namespace castor3d
 	DirectionalLight::DirectionalLight( Light & light )
 		: LightCategory{ LightType::eDirectional, light, LightDataComponents, ShadowDataComponents }
 		, m_cascades( light.getScene()->getDirectionalShadowCascades() )
-		, m_prvCascades( light.getScene()->getDirectionalShadowCascades() )
 	{
 	}
 
@@ -185,17 +425,29 @@ namespace castor3d
 
 	bool DirectionalLight::updateShadow( Camera const & viewCamera )
 	{
-		m_cascades = lgtdirectional::doComputeCascades( viewCamera
-			, *this
-			, uint32_t( m_cascades.size() ) );
-		bool result = m_cascades != m_prvCascades;
+		auto & scene = *getLight().getScene();
+		DirectionalCascadesConfig config{ scene.isDirectionalShadowFitted()
+			, scene.getDirectionalShadowReuseTolerance() };
 
-		if ( result )
+		if ( config.fitToBounds )
 		{
-			m_prvCascades = m_cascades;
+			lgtdirectional::doGatherBounds( scene
+				, getDirectionalLightView( m_direction )
+				, m_casters
+				, m_receivers );
 		}
 
-		return result;
+		m_modifiedCascades = computeDirectionalCascades( viewCamera.getView()
+			, viewCamera.getProjection( false )
+			, viewCamera.getNear()
+			, viewCamera.getFar()
+			, m_direction
+			, ShadowMapDirectionalTextureSize
+			, config
+			, m_casters
+			, m_receivers
+			, m_cascades );
+		return m_modifiedCascades != 0u;
 	}
 
 	void DirectionalLight::fillShadowBuffer( AllShadowData & data )const
@@ -8,10 +8,23 @@
 #include "Castor3D/Scene/Light/PointLight.hpp"
 #include "Castor3D/Scene/Light/SpotLight.hpp"
 
+#include <CastorUtils/Pool/ObjectSlabPool.hpp>
+
 CU_ImplementSmartPtr( castor3d, Light )
 
 namespace castor3d
 {
+	namespace lgt
+	{
+		static castor::ObjectSlabPoolT< Light > & getPool()
+		{
+			static castor::ObjectSlabPoolT< Light > result;
+			return result;
+		}
+	}
+
+	//*********************************************************************************************
+
 	Light::Light( castor::String const & name
 		, Scene & scene
 		, SceneNode & node
@@ -22,6 +35,16 @@ namespace castor3d
 		m_category = factory.create( lightType, std::ref( *this ) );
 	}
 
+	void * Light::operator new( size_t size )
+	{
+		return lgt::getPool().allocate( size );
+	}
+
+	void Light::operator delete( void * memory, size_t size )
+	{
+		lgt::getPool().deallocate( memory, size );
+	}
+
 	void Light::update( CpuUpdater & updater )
 	{
 		m_category->update();
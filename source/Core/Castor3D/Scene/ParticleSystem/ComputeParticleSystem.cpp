@@ -104,10 +104,6 @@ namespace castor3d
 		}
 	}
 
-	void ComputeParticleSystem::update( CpuUpdater & updater )
-	{
-	}
-
 	uint32_t ComputeParticleSystem::update( GpuUpdater & updater )
 	{
 		auto & device = updater.device;
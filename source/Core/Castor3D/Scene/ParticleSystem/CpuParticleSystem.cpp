@@ -12,62 +12,122 @@ CU_ImplementSmartPtr( castor3d, CpuParticleSystem )
 
 namespace castor3d
 {
+	namespace cpuptcl
+	{
+		// Chunks updates run in parallel, their emitted particles bypass the emitters onEmit signal.
+		struct EmittedScope
+		{
+			explicit EmittedScope( ParticleArray & emitted )
+				: previous{ ParticleEmitter::setThreadEmitted( &emitted ) }
+			{
+			}
+
+			~EmittedScope()noexcept
+			{
+				ParticleEmitter::setThreadEmitted( previous );
+			}
+
+			EmittedScope( EmittedScope const & ) = delete;
+			EmittedScope & operator=( EmittedScope const & ) = delete;
+
+			ParticleArray * previous;
+		};
+
+		static uint32_t getChunksCount( uint32_t count )
+		{
+			return ( count + CpuParticleSystem::ChunkSize - 1u ) / CpuParticleSystem::ChunkSize;
+		}
+	}
+
 	CpuParticleSystem::CpuParticleSystem( ParticleSystem & parent )
 		: ParticleSystemImpl{ ParticleSystemImpl::Type::eCpu, parent }
+		, m_particles{ m_inputs }
 	{
 	}
 
 	bool CpuParticleSystem::initialise( RenderDevice const & device )
 	{
-		m_firstUnused = 1u;
-		m_particles.reserve( m_parent.getMaxParticlesCount() );
-		auto & defaultValues = m_parent.getDefaultValues();
-
-		for ( auto i = 0u; i < m_parent.getMaxParticlesCount(); ++i )
-		{
-			m_particles.emplace_back( m_inputs, defaultValues );
-		}
-
+		m_particles.initialise( m_parent.getMaxParticlesCount()
+			, m_parent.getDefaultValues() );
+		// The first particle, holding the default values, is always alive.
+		m_particles.resize( 1u );
+		m_frameIndex = 0u;
 		return doInitialise();
 	}
 
 	void CpuParticleSystem::cleanup( RenderDevice const & device )
 	{
 		doCleanup();
-		m_particles.clear();
+		m_particles.cleanup();
 		m_emitters.clear();
 		m_updaters.clear();
-		m_firstUnused = 1u;
+		m_chunks.clear();
 	}
 
-	void CpuParticleSystem::update( castor3d::CpuUpdater & updater )
+	uint32_t CpuParticleSystem::beginUpdate( castor::Milliseconds const & time )
 	{
-		auto firstUnused = m_firstUnused;
+		// Particles emitted during this update are appended, and will be updated next time.
+		m_time = time;
+		m_updatedCount = m_particles.size();
+		auto count = cpuptcl::getChunksCount( m_updatedCount );
 
-		for ( auto i = 0u; i < firstUnused; ++i )
+		if ( m_chunks.size() < count )
 		{
-			m_updaters.front()->update( updater.time
-				, m_particles[i] );
+			m_chunks.resize( count );
 		}
 
-		doPackParticles();
+		for ( uint32_t index = 0u; index < count; ++index )
+		{
+			auto & chunk = m_chunks[index];
+			chunk.emitted.clear();
+			std::seed_seq seed{ m_parent.getSeed(), m_frameIndex, index };
+			chunk.random.seed( seed );
+		}
+
+		return count;
 	}
 
-	uint32_t CpuParticleSystem::update( castor3d::GpuUpdater & updater )
+	void CpuParticleSystem::updateChunk( uint32_t index )
 	{
-		auto & vbo = m_parent.getBillboards()->getVertexBuffer();
-		auto stride = m_inputs.stride();
-		auto * dst = vbo.getData().data();
+		auto & chunk = m_chunks[index];
+		auto first = index * ChunkSize;
+		auto count = std::min( ChunkSize, m_updatedCount - first );
+		cpuptcl::EmittedScope scope{ chunk.emitted };
 
-		for ( auto i = 0u; i < m_firstUnused; ++i )
+		for ( auto & particleUpdater : m_updaters )
 		{
-			std::memcpy( dst, m_particles[i].getData(), stride );
-			dst += stride;
+			particleUpdater->update( m_time
+				, m_particles
+				, first
+				, count
+				, chunk.random );
 		}
+	}
+
+	void CpuParticleSystem::endUpdate()
+	{
+		// Emitted particles are merged in chunks order, to get the same result whatever the threads count.
+		auto count = cpuptcl::getChunksCount( m_updatedCount );
+
+		for ( uint32_t index = 0u; index < count; ++index )
+		{
+			for ( auto & particle : m_chunks[index].emitted )
+			{
+				doEmplace( particle );
+			}
+		}
+
+		doPackParticles();
+		++m_frameIndex;
+	}
 
+	uint32_t CpuParticleSystem::update( castor3d::GpuUpdater & updater )
+	{
+		auto & vbo = m_parent.getBillboards()->getVertexBuffer();
+		m_particles.pack( vbo.getData().data() );
 		vbo.markDirty( VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT
 			, VK_PIPELINE_STAGE_VERTEX_INPUT_BIT );
-		return m_firstUnused;
+		return m_particles.size();
 	}
 
 	void CpuParticleSystem::addParticleVariable( castor::String const & name, ParticleFormat type, castor::String const & defaultValue )
@@ -77,8 +137,15 @@ namespace castor3d
 
 	void CpuParticleSystem::onEmit( Particle const & particle )
 	{
-		m_particles[m_firstUnused++] = particle;
-		doOnEmit( particle );
+		doEmplace( particle );
+	}
+
+	void CpuParticleSystem::doEmplace( Particle const & particle )
+	{
+		if ( m_particles.emplace( particle ) )
+		{
+			doOnEmit( particle );
+		}
 	}
 
 	ParticleEmitter * CpuParticleSystem::addEmitter( ParticleEmitterUPtr emitter )
@@ -6,6 +6,11 @@ CU_ImplementSmartPtr( castor3d, ParticleEmitter )
 
 namespace castor3d
 {
+	namespace ptclemit
+	{
+		static thread_local ParticleArray * currentEmitted = nullptr;
+	}
+
 	ParticleEmitter::ParticleEmitter( ParticleDeclaration const & decl )
 		: m_decl{ decl }
 	{
@@ -73,7 +78,22 @@ namespace castor3d
 			++index;
 		}
 
-		onEmit( particle );
+		if ( ptclemit::currentEmitted )
+		{
+			ptclemit::currentEmitted->push_back( particle );
+		}
+		else
+		{
+			onEmit( particle );
+		}
+
 		return particle;
 	}
+
+	ParticleArray * ParticleEmitter::setThreadEmitted( ParticleArray * emitted )
+	{
+		auto result = ptclemit::currentEmitted;
+		ptclemit::currentEmitted = emitted;
+		return result;
+	}
 }
@@ -0,0 +1,174 @@
+#include "Castor3D/Scene/ParticleSystem/ParticlePool.hpp"
+
+#include "Castor3D/Scene/ParticleSystem/Particle.hpp"
+
+namespace castor3d
+{
+	namespace ptclpool
+	{
+		template< uint32_t SizeT >
+		static void packElement( uint8_t const * src
+			, uint8_t * dst
+			, uint32_t stride
+			, uint32_t count )
+		{
+			for ( uint32_t i = 0u; i < count; ++i )
+			{
+				std::memcpy( dst, src, SizeT );
+				src += SizeT;
+				dst += stride;
+			}
+		}
+
+		static void packElement( uint8_t const * src
+			, uint8_t * dst
+			, uint32_t size
+			, uint32_t stride
+			, uint32_t count )
+		{
+			switch ( size )
+			{
+			case 4u:
+				packElement< 4u >( src, dst, stride, count );
+				break;
+			case 8u:
+				packElement< 8u >( src, dst, stride, count );
+				break;
+			case 12u:
+				packElement< 12u >( src, dst, stride, count );
+				break;
+			case 16u:
+				packElement< 16u >( src, dst, stride, count );
+				break;
+			default:
+				for ( uint32_t i = 0u; i < count; ++i )
+				{
+					std::memcpy( dst, src, size );
+					src += size;
+					dst += stride;
+				}
+				break;
+			}
+		}
+	}
+
+	ParticlePool::ParticlePool( ParticleDeclaration const & description )
+		: m_description{ description }
+	{
+	}
+
+	void ParticlePool::initialise( uint32_t capacity
+		, castor::StrStrMap const & defaultValues )
+	{
+		m_capacity = capacity;
+		m_count = 0u;
+		m_arrays.clear();
+		m_sizes.clear();
+		Particle defaults{ m_description, defaultValues };
+
+		for ( auto & element : m_description )
+		{
+			auto size = uint32_t( getSize( element.m_dataType ) );
+			auto & array = m_arrays.emplace_back( size_t( size ) * m_capacity );
+			auto src = defaults.getData() + element.m_offset;
+
+			for ( uint32_t i = 0u; i < m_capacity; ++i )
+			{
+				std::memcpy( array.data() + size_t( i ) * size, src, size );
+			}
+
+			m_sizes.push_back( size );
+		}
+	}
+
+	void ParticlePool::cleanup()
+	{
+		m_arrays.clear();
+		m_sizes.clear();
+		m_capacity = 0u;
+		m_count = 0u;
+	}
+
+	bool ParticlePool::emplace( Particle const & particle )
+	{
+		if ( m_count >= m_capacity )
+		{
+			return false;
+		}
+
+		store( m_count++, particle );
+		return true;
+	}
+
+	void ParticlePool::remove( uint32_t index )
+	{
+		CU_Require( index < m_count );
+		--m_count;
+
+		if ( index == m_count )
+		{
+			return;
+		}
+
+		for ( size_t element = 0u; element < m_arrays.size(); ++element )
+		{
+			auto size = m_sizes[element];
+			auto data = m_arrays[element].data();
+			std::memcpy( data + size_t( index ) * size
+				, data + size_t( m_count ) * size
+				, size );
+		}
+	}
+
+	void ParticlePool::resize( uint32_t count )
+	{
+		m_count = std::min( count, m_capacity );
+	}
+
+	void ParticlePool::load( uint32_t index
+		, Particle & particle )const
+	{
+		CU_Require( index < m_capacity );
+		auto dst = particle.getData();
+		auto elementIt = m_description.begin();
+
+		for ( size_t element = 0u; element < m_arrays.size(); ++element, ++elementIt )
+		{
+			auto size = m_sizes[element];
+			std::memcpy( dst + elementIt->m_offset
+				, m_arrays[element].data() + size_t( index ) * size
+				, size );
+		}
+	}
+
+	void ParticlePool::store( uint32_t index
+		, Particle const & particle )
+	{
+		CU_Require( index < m_capacity );
+		auto src = particle.getData();
+		auto elementIt = m_description.begin();
+
+		for ( size_t element = 0u; element < m_arrays.size(); ++element, ++elementIt )
+		{
+			auto size = m_sizes[element];
+			std::memcpy( m_arrays[element].data() + size_t( index ) * size
+				, src + elementIt->m_offset
+				, size );
+		}
+	}
+
+	void ParticlePool::pack( uint8_t * dst )const
+	{
+		auto stride = m_description.stride();
+		auto elementIt = m_description.begin();
+
+		for ( size_t element = 0u; element < m_arrays.size(); ++element, ++elementIt )
+		{
+			ptclpool::packElement( m_arrays[element].data()
+				, dst + elementIt->m_offset
+				, m_sizes[element]
+				, stride
+				, m_count );
+		}
+	}
+}
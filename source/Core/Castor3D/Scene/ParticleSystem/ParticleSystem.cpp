@@ -194,10 +194,22 @@ namespace castor3d
 	}
 
 	void ParticleSystem::update( CpuUpdater & updater )
+	{
+		auto count = beginUpdate( updater );
+
+		for ( uint32_t index = 0u; index < count; ++index )
+		{
+			updateChunk( index );
+		}
+
+		endUpdate();
+	}
+
+	uint32_t ParticleSystem::beginUpdate( CpuUpdater & updater )
 	{
 		if ( !m_impl )
 		{
-			return;
+			return 0u;
 		}
 
 		auto time = std::chrono::duration_cast< castor::Milliseconds >( m_timer.getElapsed() );
@@ -214,7 +226,20 @@ namespace castor3d
 		m_totalTime += time;
 		updater.time = m_time;
 		updater.total = m_totalTime;
-		m_impl->update( updater );
+		return m_impl->beginUpdate( m_time );
+	}
+
+	void ParticleSystem::updateChunk( uint32_t index )
+	{
+		m_impl->updateChunk( index );
+	}
+
+	void ParticleSystem::endUpdate()
+	{
+		if ( m_impl )
+		{
+			m_impl->endUpdate();
+		}
 	}
 
 	void ParticleSystem::update( GpuUpdater & updater )
@@ -1,5 +1,8 @@
 #include "Castor3D/Scene/ParticleSystem/ParticleUpdater.hpp"
 
+#include "Castor3D/Scene/ParticleSystem/Particle.hpp"
+#include "Castor3D/Scene/ParticleSystem/ParticlePool.hpp"
+
 CU_ImplementSmartPtr( castor3d, ParticleUpdater )
 
 namespace castor3d
@@ -17,4 +20,20 @@ namespace castor3d
 		, Particle & particle )
 	{
 	}
+
+	void ParticleUpdater::update( castor::Milliseconds const & time
+		, ParticlePool & particles
+		, uint32_t first
+		, uint32_t count
+		, ParticleRandom & random )
+	{
+		Particle particle{ m_inputs };
+
+		for ( auto i = first; i < first + count; ++i )
+		{
+			particles.load( i, particle );
+			update( time, particle );
+			particles.store( i, particle );
+		}
+	}
 }
@@ -15,6 +15,7 @@
 #include "Castor3D/Model/Mesh/Submesh/Submesh.hpp"
 #include "Castor3D/Model/Skeleton/Skeleton.hpp"
 #include "Castor3D/Overlay/Overlay.hpp"
+#include "Castor3D/Render/Ray.hpp"
 #include "Castor3D/Render/RenderInfo.hpp"
 #include "Castor3D/Render/RenderLoop.hpp"
 #include "Castor3D/Render/RenderPipeline.hpp"
@@ -91,6 +92,57 @@ namespace castor3d
 
 	//*************************************************************************************************
 
+	namespace scn
+	{
+		// Rays are grouped so that a task is worth its scheduling.
+		static uint32_t constexpr RaysPerTask = 64u;
+
+		struct RaycastTarget
+		{
+			Geometry const * geometry;
+			castor::Matrix4x4f inverseTransform;
+		};
+
+		static std::vector< RaycastTarget > gatherRaycastTargets( GeometryCache & cache )
+		{
+			std::vector< RaycastTarget > result;
+			auto lock( castor::makeUniqueLock( cache ) );
+
+			for ( auto & pair : cache )
+			{
+				auto node = pair.second->getParent();
+
+				if ( pair.second->getMesh()
+					&& node
+					&& node->isVisible() )
+				{
+					result.push_back( { pair.second.get()
+						, node->getDerivedTransformationMatrix().getInverse() } );
+				}
+			}
+
+			return result;
+		}
+
+		static bool raycast( std::vector< RaycastTarget > const & targets
+			, Ray const & ray
+			, RaycastHit & hit
+			, float maxDistance )
+		{
+			hit = RaycastHit{};
+			hit.distance = maxDistance;
+
+			for ( auto & target : targets )
+			{
+				ray.intersects( *target.geometry, target.inverseTransform, hit );
+			}
+
+			return bool( hit );
+		}
+	}
+
+	//*************************************************************************************************
+
 	castor::String Scene::RootNode = cuT( "C3D.RootNode" );
 	castor::String Scene::CameraRootNode = cuT( "C3D.CameraRootNode" );
 	castor::String Scene::ObjectRootNode = cuT( "C3D.ObjectRootNode" );
@@ -449,7 +501,7 @@ namespace castor3d
 		{
 			onUpdate( *this );
 			updater.scene = this;
-			auto & sceneObjs = updater.dirtyScenes.emplace( this, CpuUpdater::DirtyObjects{} ).first->second;
+			auto & sceneObjs = updater.dirtyScenes.try_emplace( this ).first->second;
 			doGatherDirty( sceneObjs );
 			doUpdateSceneNodes( updater, sceneObjs );
 			m_animatedObjectGroupCache->update( updater );
@@ -776,6 +828,56 @@ namespace castor3d
 		}
 	}
 
+	bool Scene::raycast( Ray const & ray
+		, RaycastHit & hit
+		, float maxDistance )const
+	{
+		return scn::raycast( scn::gatherRaycastTargets( *m_geometryCache )
+			, ray
+			, hit
+			, maxDistance );
+	}
+
+	void Scene::raycast( std::vector< Ray > const & rays
+		, std::vector< RaycastHit > & hits
+		, float maxDistance )const
+	{
+		auto targets = scn::gatherRaycastTargets( *m_geometryCache );
+		hits.resize( rays.size() );
+		auto & pool = getEngine()->getTaskPool();
+
+		// The BVHs are built lazily, build the missing ones in parallel before the queries.
+		std::vector< Submesh const * > submeshes;
+
+		for ( auto & target : targets )
+		{
+			for ( auto & submesh : *target.geometry->getMesh() )
+			{
+				submeshes.push_back( submesh.get() );
+			}
+		}
+
+		std::sort( submeshes.begin(), submeshes.end() );
+		submeshes.erase( std::unique( submeshes.begin(), submeshes.end() ), submeshes.end() );
+		pool.parallelFor( uint32_t( submeshes.size() )
+			, [&submeshes]( uint32_t index )
+			{
+				submeshes[index]->getBvh();
+			} );
+
+		auto count = uint32_t( rays.size() );
+		pool.parallelFor( ( count + scn::RaysPerTask - 1u ) / scn::RaysPerTask
+			, [&targets, &rays, &hits, count, maxDistance]( uint32_t index )
+			{
+				auto end = std::min( count, ( index + 1u ) * scn::RaysPerTask );
+
+				for ( auto i = index * scn::RaysPerTask; i < end; ++i )
+				{
+					scn::raycast( targets, rays[i], hits[i], maxDistance );
+				}
+			} );
+	}
+
 	BackgroundModelID Scene::getBackgroundModelId()const
 	{
 		return m_background
@@ -1055,10 +1157,29 @@ namespace castor3d
 		auto & cache = getParticleSystemCache();
 		auto lock( castor::makeUniqueLock( cache ) );
 		updater.index = 0u;
+		m_particleJobs.clear();
 
 		for ( auto & particleSystem : cache )
 		{
-			particleSystem.second->update( updater );
+			auto count = particleSystem.second->beginUpdate( updater );
+
+			for ( uint32_t index = 0u; index < count; ++index )
+			{
+				m_particleJobs.emplace_back( particleSystem.second.get(), index );
+			}
+		}
+
+		// Each chunk of each system is a job, systems are ended serially, in cache order.
+		getEngine()->getTaskPool().parallelFor( uint32_t( m_particleJobs.size() )
+			, [this]( uint32_t index )
+			{
+				auto & job = m_particleJobs[index];
+				job.first->updateChunk( job.second );
+			} );
+
+		for ( auto & particleSystem : cache )
+		{
+			particleSystem.second->endUpdate();
 		}
 	}
 
@@ -14,6 +14,7 @@
 #include "Castor3D/Scene/Shadow.hpp"
 #include "Castor3D/Shader/Shaders/SdwModule.hpp"
 
+#include <CastorUtils/Data/VirtualFileSystem.hpp>
 #include <CastorUtils/Data/ZipArchive.hpp>
 #include <CastorUtils/FileParser/ParserParameter.hpp>
 
@@ -112,10 +113,15 @@ namespace castor3d
 			addParser( result, uint32_t( CSCNSection::eScene ), cuT( "skybox" ), parserSceneSkybox );
 			addParser( result, uint32_t( CSCNSection::eScene ), cuT( "fog_type" ), parserSceneFogType, { makeParameter< ParameterType::eCheckedText, FogType >() } );
 			addParser( result, uint32_t( CSCNSection::eScene ), cuT( "fog_density" ), parserSceneFogDensity, { makeParameter< ParameterType::eFloat >() } );
+			addParser( result, uint32_t( CSCNSection::eScene ), cuT( "lod_bias" ), parserSceneLodBias, { makeParameter< ParameterType::eFloat >() } );
+			addParser( result, uint32_t( CSCNSection::eScene ), cuT( "shadow_lod_bias" ), parserSceneShadowLodBias, { makeParameter< ParameterType::eFloat >() } );
+			addParser( result, uint32_t( CSCNSection::eScene ), cuT( "shadow_update_budget" ), parserSceneShadowUpdateBudget, { makeParameter< ParameterType::eUInt32 >() } );
 			addParser( result, uint32_t( CSCNSection::eScene ), cuT( "particle_system" ), parserSceneParticleSystem, { makeParameter< ParameterType::eName >() } );
 			addParser( result, uint32_t( CSCNSection::eScene ), cuT( "skeleton" ), parserSkeleton, { makeParameter< ParameterType::eName >() } );
 			addParser( result, uint32_t( CSCNSection::eScene ), cuT( "mesh" ), parserMesh, { makeParameter< ParameterType::eName >() } );
 			addParser( result, uint32_t( CSCNSection::eScene ), cuT( "directional_shadow_cascades" ), parserDirectionalShadowCascades, { makeParameter< ParameterType::eUInt32 >( castor::makeRange( 0u, MaxDirectionalCascadesCount ) ) } );
+			addParser( result, uint32_t( CSCNSection::eScene ), cuT( "directional_shadow_fitting" ), parserDirectionalShadowFitting, { makeParameter< ParameterType::eBool >() } );
+			addParser( result, uint32_t( CSCNSection::eScene ), cuT( "directional_shadow_reuse_tolerance" ), parserDirectionalShadowReuseTolerance, { makeParameter< ParameterType::eFloat >() } );
 			addParser( result, uint32_t( CSCNSection::eScene ), cuT( "voxel_cone_tracing" ), parserVoxelConeTracing );
 			addParser( result, uint32_t( CSCNSection::eScene ), cuT( "}" ), parserSceneEnd );
 		}
@@ -143,6 +149,7 @@ namespace castor3d
 			using namespace castor;
 			addParser( result, uint32_t( CSCNSection::eParticleSystem ), cuT( "parent" ), parserParticleSystemParent, { makeParameter< ParameterType::eName >() } );
 			addParser( result, uint32_t( CSCNSection::eParticleSystem ), cuT( "particles_count" ), parserParticleSystemCount, { makeParameter< ParameterType::eUInt32 >() } );
+			addParser( result, uint32_t( CSCNSection::eParticleSystem ), cuT( "seed" ), parserParticleSystemSeed, { makeParameter< ParameterType::eUInt32 >() } );
 			addParser( result, uint32_t( CSCNSection::eParticleSystem ), cuT( "material" ), parserParticleSystemMaterial, { makeParameter< ParameterType::eName >() } );
 			addParser( result, uint32_t( CSCNSection::eParticleSystem ), cuT( "dimensions" ), parserParticleSystemDimensions, { makeParameter< ParameterType::ePoint2F >() } );
 			addParser( result, uint32_t( CSCNSection::eParticleSystem ), cuT( "particle" ), parserParticleSystemParticle );
@@ -196,6 +203,7 @@ namespace castor3d
 			addParser( result, uint32_t( CSCNSection::eObject ), cuT( "cast_shadows" ), parserObjectCastShadows, { makeParameter< ParameterType::eBool >() } );
 			addParser( result, uint32_t( CSCNSection::eObject ), cuT( "receive_shadows" ), parserObjectReceivesShadows, { makeParameter< ParameterType::eBool >() } );
 			addParser( result, uint32_t( CSCNSection::eObject ), cuT( "cullable" ), parserObjectCullable, { makeParameter< ParameterType::eBool >() } );
+			addParser( result, uint32_t( CSCNSection::eObject ), cuT( "occluder" ), parserObjectOccluder, { makeParameter< ParameterType::eBool >() } );
 			addParser( result, uint32_t( CSCNSection::eObject ), cuT( "}" ), parserObjectEnd );
 		}
 
@@ -550,7 +558,7 @@ namespace castor3d
 		{
 			SceneFileContext * userContext = new SceneFileContext{ *context.logger
 				, static_cast< SceneFileParser * >( context.parser ) };
-			castor::File::listDirectoryFiles( context.file.getPath(), userContext->files, true );
+			castor::VirtualFileSystem::getSingleton().listFiles( context.file.getPath(), userContext->files, true );
 
 			for ( auto fileName : userContext->files )
 			{
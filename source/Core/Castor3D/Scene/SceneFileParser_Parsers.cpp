@@ -61,6 +61,7 @@
 #include "Castor3D/Scene/ParticleSystem/ParticleSystem.hpp"
 #include "Castor3D/Shader/Program.hpp"
 
+#include <CastorUtils/Data/VirtualFileSystem.hpp>
 #include <CastorUtils/Design/ResourceCache.hpp>
 #include <CastorUtils/FileParser/ParserParameter.hpp>
 
@@ -203,6 +204,23 @@ namespace castor3d
 				{
 					parameters.add( cuT( "invert_normals" ), true );
 				}
+				else if ( param.find( cuT( "lod_count" ) ) == 0
+					|| param.find( cuT( "lod_ratio" ) ) == 0
+					|| param.find( cuT( "lod_error" ) ) == 0 )
+				{
+					// Kept as strings, as the mesh generators parameters are.
+					auto eqIndex = param.find( cuT( '=' ) );
+
+					if ( eqIndex != castor::String::npos )
+					{
+						castor::String value = param.substr( eqIndex + 1 );
+						parameters.add( param.substr( 0u, eqIndex ), castor::string::trim( value ) );
+					}
+					else
+					{
+						CU_ParsingError( cuT( "Malformed parameter -" ) + param + cuT( "=<value>." ) );
+					}
+				}
 				else if ( param.find( cuT( "preferred_importer" ) ) == 0 )
 				{
 					auto eqIndex = param.find( cuT( '=' ) );
@@ -1498,6 +1516,57 @@ namespace castor3d
 	}
 	CU_EndAttribute()
 
+	CU_ImplementAttributeParser( parserSceneLodBias )
+	{
+		auto & parsingContext = getParserContext( context );
+
+		if ( !parsingContext.scene )
+		{
+			CU_ParsingError( cuT( "No scene initialised." ) );
+		}
+		else
+		{
+			float value;
+			params[0]->get( value );
+			parsingContext.scene->setLodBias( value );
+		}
+	}
+	CU_EndAttribute()
+
+	CU_ImplementAttributeParser( parserSceneShadowLodBias )
+	{
+		auto & parsingContext = getParserContext( context );
+
+		if ( !parsingContext.scene )
+		{
+			CU_ParsingError( cuT( "No scene initialised." ) );
+		}
+		else
+		{
+			float value;
+			params[0]->get( value );
+			parsingContext.scene->setShadowLodBias( value );
+		}
+	}
+	CU_EndAttribute()
+
+	CU_ImplementAttributeParser( parserSceneShadowUpdateBudget )
+	{
+		auto & parsingContext = getParserContext( context );
+
+		if ( !parsingContext.scene )
+		{
+			CU_ParsingError( cuT( "No scene initialised." ) );
+		}
+		else
+		{
+			uint32_t value;
+			params[0]->get( value );
+			parsingContext.scene->setShadowUpdateBudget( value );
+		}
+	}
+	CU_EndAttribute()
+
 	CU_ImplementAttributeParser( parserSceneParticleSystem )
 	{
 		auto & parsingContext = getParserContext( context );
@@ -1516,6 +1585,7 @@ namespace castor3d
 			params[0]->get( value );
 			parsingContext.strName = value;
 			parsingContext.particleCount = 0u;
+			parsingContext.particleSeed = 0u;
 			parsingContext.material = {};
 		}
 	}
@@ -1812,6 +1882,40 @@ namespace castor3d
 	}
 	CU_EndAttribute()
 
+	CU_ImplementAttributeParser( parserDirectionalShadowFitting )
+	{
+		auto & parsingContext = getParserContext( context );
+
+		if ( !parsingContext.scene )
+		{
+			CU_ParsingError( cuT( "No scene initialised." ) );
+		}
+		else
+		{
+			bool value;
+			params[0]->get( value );
+			parsingContext.scene->setDirectionalShadowFitting( value );
+		}
+	}
+	CU_EndAttribute()
+
+	CU_ImplementAttributeParser( parserDirectionalShadowReuseTolerance )
+	{
+		auto & parsingContext = getParserContext( context );
+
+		if ( !parsingContext.scene )
+		{
+			CU_ParsingError( cuT( "No scene initialised." ) );
+		}
+		else
+		{
+			float value;
+			params[0]->get( value );
+			parsingContext.scene->setDirectionalShadowReuseTolerance( value );
+		}
+	}
+	CU_EndAttribute()
+
 	CU_ImplementAttributeParser( parserParticleSystemParent )
 	{
 		auto & parsingContext = getParserContext( context );
@@ -1862,6 +1966,25 @@ namespace castor3d
 	}
 	CU_EndAttribute()
 
+	CU_ImplementAttributeParser( parserParticleSystemSeed )
+	{
+		auto & parsingContext = getParserContext( context );
+
+		if ( !parsingContext.scene )
+		{
+			CU_ParsingError( cuT( "No scene initialised." ) );
+		}
+		else if ( params.empty() )
+		{
+			CU_ParsingError( cuT( "Missing parameter." ) );
+		}
+		else
+		{
+			params[0]->get( parsingContext.particleSeed );
+		}
+	}
+	CU_EndAttribute()
+
 	CU_ImplementAttributeParser( parserParticleSystemMaterial )
 	{
 		auto & parsingContext = getParserContext( context );
@@ -1955,6 +2078,7 @@ namespace castor3d
 
 			parsingContext.particleSystem->setMaterial( parsingContext.material );
 			parsingContext.particleSystem->setDimensions( parsingContext.point2f );
+			parsingContext.particleSystem->setSeed( parsingContext.particleSeed );
 		}
 	}
 	CU_EndAttributePush( CSCNSection::eParticle )
@@ -2527,8 +2651,12 @@ namespace castor3d
 					{
 						auto & animation = node->createAnimation( animName );
 						BinaryParser< SceneNodeAnimation > parser;
-						castor::BinaryFile animFile{ fileName, castor::File::OpenMode::eRead };
-						parser.parse( animation, animFile );
+						castor::ByteArray animData;
+
+						if ( castor::VirtualFileSystem::getSingleton().readFile( fileName, animData ) )
+						{
+							parser.parse( animation, animData );
+						}
 					}
 				}
 			}
@@ -2676,6 +2804,23 @@ namespace castor3d
 	}
 	CU_EndAttribute()
 
+	CU_ImplementAttributeParser( parserObjectOccluder )
+	{
+		auto & parsingContext = getParserContext( context );
+
+		if ( !parsingContext.geometry )
+		{
+			CU_ParsingError( cuT( "No Geometry initialised." ) );
+		}
+		else if ( !params.empty() )
+		{
+			bool value;
+			params[0]->get( value );
+			parsingContext.geometry->setOccluder( value );
+		}
+	}
+	CU_EndAttribute()
+
 	CU_ImplementAttributeParser( parserObjectEnd )
 	{
 		auto & parsingContext = getParserContext( context );
@@ -5232,7 +5377,7 @@ namespace castor3d
 			auto path = params[0]->get< castor::Path >();
 			auto filePath = context.file.getPath();
 
-			if ( castor::File::fileExists( filePath / path ) )
+			if ( castor::VirtualFileSystem::getSingleton().fileExists( filePath / path ) )
 			{
 				uint32_t size;
 				params[1]->get( size );
@@ -5265,7 +5410,7 @@ namespace castor3d
 			auto path = params[0]->get< castor::Path >();
 			auto filePath = context.file.getPath();
 
-			if ( castor::File::fileExists( filePath / path ) )
+			if ( castor::VirtualFileSystem::getSingleton().fileExists( filePath / path ) )
 			{
 				parsingContext.skybox->setCrossTexture( filePath, path );
 			}
@@ -5288,7 +5433,7 @@ namespace castor3d
 			auto path = params[0]->get< castor::Path >();
 			auto filePath = context.file.getPath();
 
-			if ( castor::File::fileExists( filePath / path ) )
+			if ( castor::VirtualFileSystem::getSingleton().fileExists( filePath / path ) )
 			{
 				parsingContext.skybox->setLeftImage( filePath, path );
 			}
@@ -5316,7 +5461,7 @@ namespace castor3d
 			auto path = params[0]->get< castor::Path >();
 			auto filePath = context.file.getPath();
 
-			if ( castor::File::fileExists( filePath / path ) )
+			if ( castor::VirtualFileSystem::getSingleton().fileExists( filePath / path ) )
 			{
 				parsingContext.skybox->setRightImage( filePath, path );
 			}
@@ -5344,7 +5489,7 @@ namespace castor3d
 			auto path = params[0]->get< castor::Path >();
 			auto filePath = context.file.getPath();
 
-			if ( castor::File::fileExists( filePath / path ) )
+			if ( castor::VirtualFileSystem::getSingleton().fileExists( filePath / path ) )
 			{
 				parsingContext.skybox->setTopImage( filePath, path );
 			}
@@ -5372,7 +5517,7 @@ namespace castor3d
 			auto path = params[0]->get< castor::Path >();
 			auto filePath = context.file.getPath();
 
-			if ( castor::File::fileExists( filePath / path ) )
+			if ( castor::VirtualFileSystem::getSingleton().fileExists( filePath / path ) )
 			{
 				parsingContext.skybox->setBottomImage( filePath, path );
 			}
@@ -5400,7 +5545,7 @@ namespace castor3d
 			auto path = params[0]->get< castor::Path >();
 			auto filePath = context.file.getPath();
 
-			if ( castor::File::fileExists( filePath / path ) )
+			if ( castor::VirtualFileSystem::getSingleton().fileExists( filePath / path ) )
 			{
 				parsingContext.skybox->setFrontImage( filePath, path );
 			}
@@ -5428,7 +5573,7 @@ namespace castor3d
 			auto path = params[0]->get< castor::Path >();
 			auto filePath = context.file.getPath();
 
-			if ( castor::File::fileExists( filePath / path ) )
+			if ( castor::VirtualFileSystem::getSingleton().fileExists( filePath / path ) )
 			{
 				parsingContext.skybox->setBackImage( filePath, path );
 			}
@@ -8,10 +8,23 @@
 #include "Castor3D/Scene/Scene.hpp"
 #include "Castor3D/Scene/Animation/SceneNodeAnimation.hpp"
 
+#include <CastorUtils/Pool/ObjectSlabPool.hpp>
+
 CU_ImplementSmartPtr( castor3d, SceneNode )
 
 namespace castor3d
 {
+	namespace scnnode
+	{
+		static castor::ObjectSlabPoolT< SceneNode > & getPool()
+		{
+			static castor::ObjectSlabPoolT< SceneNode > result;
+			return result;
+		}
+	}
+
+	//*********************************************************************************************
+
 	uint64_t SceneNode::Count = 0;
 	uint64_t SceneNode::CurrentId = 0;
 
@@ -74,6 +87,16 @@ namespace castor3d
 		cleanupAnimations();
 	}
 
+	void * SceneNode::operator new( size_t size )
+	{
+		return scnnode::getPool().allocate( size );
+	}
+
+	void SceneNode::operator delete( void * memory, size_t size )
+	{
+		scnnode::getPool().deallocate( memory, size );
+	}
+
 	void SceneNode::update()
 	{
 		doComputeMatrix();
@@ -28,6 +28,7 @@ namespace castor3d
 		: m_device{ device }
 		, m_size{ ashes::getAlignedSize( size + shdbuf::HeaderSize
 			, m_device.renderSystem.getValue( GpuMin::eBufferMapSize ) ) }
+		, m_mergeDistance{ m_device.renderSystem.getValue( GpuMin::eBufferMapSize ) }
 		, m_wantedState{ std::move( wantedState ) }
 		, m_buffer{ makeBufferBase( m_device
 			, m_size
@@ -41,28 +42,45 @@ namespace castor3d
 			, reinterpret_cast< uint32_t * >( m_data ) ) }
 	{
 		CU_Require( m_rawData );
+		doMarkDirty( 0u, m_size );
+	}
+
+	void ShaderBuffer::markDirty( VkDeviceSize offset
+		, VkDeviceSize size )
+	{
+		doMarkDirty( shdbuf::HeaderSize + offset
+			, shdbuf::HeaderSize + offset + size );
+	}
+
+	void ShaderBuffer::markDirty()
+	{
+		doMarkDirty( shdbuf::HeaderSize, m_size );
 	}
 
 	void ShaderBuffer::upload( UploadData & uploader )const
 	{
-		uploader.pushUpload( m_rawData
-			, m_size
-			, *m_buffer
-			, 0u
-			, m_wantedState.access
-			, m_wantedState.pipelineStage );
+		auto lock( castor::makeUniqueLock( m_dirtyMutex ) );
+		mergeRanges( m_dirtyRanges, m_mergeDistance );
+
+		for ( auto & range : m_dirtyRanges )
+		{
+			uploader.pushUpload( m_rawData + range.begin
+				, range.end - range.begin
+				, *m_buffer
+				, range.begin
+				, m_wantedState.access
+				, m_wantedState.pipelineStage );
+		}
+
+		m_dirtyRanges.clear();
 	}
 
 	void ShaderBuffer::upload( UploadData & uploader
 		, VkDeviceSize offset
-		, VkDeviceSize size )const
+		, VkDeviceSize size )
 	{
-		uploader.pushUpload( m_rawData
-			, size
-			, *m_buffer
-			, offset
-			, m_wantedState.access
-			, m_wantedState.pipelineStage );
+		markDirty( offset, size );
+		upload( uploader );
 	}
 
 	VkDescriptorSetLayoutBinding ShaderBuffer::createLayoutBinding( uint32_t index
@@ -117,4 +135,27 @@ namespace castor3d
 			, 0u
 			, uint32_t( m_size ) );
 	}
+
+	void ShaderBuffer::doSetCount( uint32_t index
+		, uint32_t value )
+	{
+		if ( m_counts[index] != value )
+		{
+			m_counts[index] = value;
+			doMarkDirty( index * sizeof( uint32_t )
+				, ( index + 1u ) * sizeof( uint32_t ) );
+		}
+	}
+
+	void ShaderBuffer::doMarkDirty( VkDeviceSize begin
+		, VkDeviceSize end )
+	{
+		end = std::min( end, m_size );
+
+		if ( begin < end )
+		{
+			auto lock( castor::makeUniqueLock( m_dirtyMutex ) );
+			m_dirtyRanges.push_back( { begin, end } );
+		}
+	}
 }
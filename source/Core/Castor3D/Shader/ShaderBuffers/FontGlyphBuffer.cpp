@@ -57,7 +57,7 @@ namespace castor3d
 		pos = m_texture.getGlyphPosition( glyph.getCharacter() );
 		data.position = castor::Point2f{ pos.x(), pos.y() };
 		data.size = castor::Point2f{ glyph.getSize().getWidth(), glyph.getSize().getHeight() };
-		m_glyphs.emplace_back( &glyph );
+		m_glyphs.emplace_back( glyph.getCharacter() );
 		m_dirty = true;
 	}
 
@@ -68,14 +68,15 @@ namespace castor3d
 			auto lock( castor::makeUniqueLock( m_mutex ) );
 			auto buffer = m_data.data();
 
-			for ( auto & glyph : castor::makeArrayView( m_glyphs.begin(), m_glyphs.end() ) )
+			for ( auto c : castor::makeArrayView( m_glyphs.begin(), m_glyphs.end() ) )
 			{
-				auto pos = m_texture.getGlyphPosition( glyph->getCharacter() );
+				auto pos = m_texture.getGlyphPosition( c );
 				buffer->position = castor::Point2f{ pos.x(), pos.y() };
 				++buffer;
 			}
 
 			m_buffer.setCount( uint32_t( m_glyphs.size() ) );
+			m_buffer.markDirty( 0u, m_glyphs.size() * sizeof( FontGlyphData ) );
 			m_buffer.upload( uploader );
 		}
 	}
@@ -101,6 +101,8 @@ namespace castor3d
 				if ( index <= MaxLightsCount )
 				{
 					light->fillLightBuffer( index, offset, &m_data[offset] );
+					m_buffer.markDirty( offset * sizeof( castor::Point4f )
+						, m_lightSizes[size_t( light->getLightType() )] * sizeof( castor::Point4f ) );
 				}
 			}
 
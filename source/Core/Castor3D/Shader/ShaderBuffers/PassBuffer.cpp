@@ -223,6 +223,7 @@ namespace castor3d
 
 		if ( index < m_maxCount )
 		{
+			m_buffer.markDirty( VkDeviceSize( m_stride ) * index, m_stride );
 			return PassBuffer::PassDataPtr{ castor::makeArrayView( m_data.data() + ptrdiff_t( m_stride ) * index, m_stride ) };
 		}
 
@@ -131,6 +131,7 @@ namespace castor3d
 		SssProfileDataPtr result{};
 
 		auto & data = m_data[index];
+		m_buffer.markDirty( VkDeviceSize( DataSize ) * index, DataSize );
 		result.transmittanceProfileSize = &data.transmittanceProfileSize;
 		result.gaussianWidth = &data.gaussianWidth;
 		result.subsurfaceScatteringStrength = &data.subsurfaceScatteringStrength;
@@ -122,6 +122,7 @@ namespace castor3d
 				else
 				{
 					auto & data = m_data[index];
+					m_buffer.markDirty( index * sizeof( Data ), sizeof( Data ) );
 					data.translate = config.transform.translate;
 					data.rotateU = config.transform.rotate.cos();
 					data.rotateV = config.transform.rotate.sin();
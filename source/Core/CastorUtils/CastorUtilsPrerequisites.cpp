@@ -11,13 +11,9 @@ namespace castor
 {
 	Point3f operator*( Matrix4x4f const & lhs, Point3f const & rhs )
 	{
-		float const * mtx = lhs.constPtr();
-		return Point3f
-		{
-			mtx[0] * rhs[0] + mtx[4] * rhs[1] + mtx[ 8] * rhs[2] + mtx[12],
-			mtx[1] * rhs[0] + mtx[5] * rhs[1] + mtx[ 9] * rhs[2] + mtx[13],
-			mtx[2] * rhs[0] + mtx[6] * rhs[1] + mtx[10] * rhs[2] + mtx[14]
-		};
+		Point3f result;
+		simd::transformPoints3( lhs.constPtr(), rhs.constPtr(), result.ptr(), 1u );
+		return result;
 	}
 
 	Point3f operator*( Point3f const & lhs, Matrix4x4f const & rhs )
@@ -33,13 +29,9 @@ namespace castor
 
 	Point4f operator*( Matrix4x4f const & lhs, Point4f const & rhs )
 	{
-		return Point4f
-		{
-			point::dot( rhs, lhs.getRow( 0 ) ),
-			point::dot( rhs, lhs.getRow( 1 ) ),
-			point::dot( rhs, lhs.getRow( 2 ) ),
-			point::dot( rhs, lhs.getRow( 3 ) ),
-		};
+		Point4f result;
+		simd::transformPoints4( lhs.constPtr(), rhs.constPtr(), result.ptr(), 1u );
+		return result;
 	}
 
 	Point4f operator*( Point4f const & lhs, Matrix4x4f const & rhs )
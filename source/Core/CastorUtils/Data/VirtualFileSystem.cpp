@@ -0,0 +1,377 @@
+#include "CastorUtils/Data/VirtualFileSystem.hpp"
+
+#include "CastorUtils/Data/BinaryFile.hpp"
+#include "CastorUtils/Data/ZipArchive.hpp"
+#include "CastorUtils/Config/MultiThreadConfig.hpp"
+#include "CastorUtils/Log/Logger.hpp"
+#include "CastorUtils/Miscellaneous/StringUtils.hpp"
+
+#include <map>
+
+namespace castor
+{
+	namespace vfs
+	{
+		static bool getRelative( Path const & mountPoint
+			, Path const & path
+			, Path & relative )
+		{
+			if ( mountPoint.empty() )
+			{
+				relative = path;
+				return true;
+			}
+
+			if ( path == mountPoint )
+			{
+				relative = Path{};
+				return true;
+			}
+
+			if ( path.find( mountPoint + Path::NativeSeparator ) == 0u )
+			{
+				relative = Path{ path.substr( mountPoint.size() + 1u ) };
+				return true;
+			}
+
+			return false;
+		}
+
+		static bool isListed( Path const & relativeFolder
+			, Path const & name
+			, bool recursive )
+		{
+			size_t start = 0u;
+
+			if ( !relativeFolder.empty() )
+			{
+				if ( name.find( relativeFolder + Path::NativeSeparator ) != 0u )
+				{
+					return false;
+				}
+
+				start = relativeFolder.size() + 1u;
+			}
+
+			return recursive
+				|| name.find( Path::NativeSeparator, start ) == String::npos;
+		}
+
+		static bool readDiskFile( Path const & path
+			, ByteArray & data )
+		{
+			if ( !File::fileExists( path ) )
+			{
+				return false;
+			}
+
+			BinaryFile file{ path, File::OpenMode::eRead };
+
+			if ( !file.isOk() )
+			{
+				return false;
+			}
+
+			data.resize( size_t( file.getLength() ) );
+			return data.empty()
+				|| file.readArray( data.data(), data.size() ) == data.size();
+		}
+	}
+
+	//*********************************************************************************************
+
+	struct VirtualFileSystem::Mount
+	{
+		Path point;
+		Path source;
+		std::unique_ptr< ZipArchive > archive;
+	};
+
+	//*********************************************************************************************
+
+	VirtualFileSystem::VirtualFileSystem() = default;
+
+	VirtualFileSystem::~VirtualFileSystem()noexcept = default;
+
+	VirtualFileSystem & VirtualFileSystem::getSingleton()
+	{
+		static VirtualFileSystem result;
+		return result;
+	}
+
+	void VirtualFileSystem::mountDirectory( Path const & mountPoint
+		, Path const & folder )
+	{
+		auto mount = std::make_shared< Mount >();
+		mount->point = mountPoint;
+		mount->source = folder;
+		auto lock( makeUniqueLock( m_mutex ) );
+		m_mounts.push_back( std::move( mount ) );
+	}
+
+	bool VirtualFileSystem::mountArchive( Path const & mountPoint
+		, Path const & archive )
+	{
+		{
+			auto lock( makeUniqueLock( m_mutex ) );
+			auto it = std::find_if( m_mounts.begin()
+				, m_mounts.end()
+				, [&mountPoint, &archive]( MountPtr const & lookup )
+				{
+					return lookup->archive
+						&& lookup->point == mountPoint
+						&& lookup->source == archive;
+				} );
+
+			if ( it != m_mounts.end() )
+			{
+				return true;
+			}
+		}
+
+		if ( !File::fileExists( archive ) )
+		{
+			Logger::logError( cuT( "VirtualFileSystem: Archive [" ) + archive + cuT( "] doesn't exist." ) );
+			return false;
+		}
+
+		auto mount = std::make_shared< Mount >();
+		mount->point = mountPoint;
+		mount->source = archive;
+
+		try
+		{
+			// Opening the archive builds its entry index, nothing is decompressed.
+			mount->archive = std::make_unique< ZipArchive >( archive, File::OpenMode::eRead );
+		}
+		catch ( std::exception & exc )
+		{
+			Logger::logError( cuT( "VirtualFileSystem: Couldn't mount archive [" ) + archive + cuT( "]: " ) + string::stringCast< xchar >( exc.what() ) );
+			return false;
+		}
+
+		auto lock( makeUniqueLock( m_mutex ) );
+		m_mounts.push_back( std::move( mount ) );
+		return true;
+	}
+
+	bool VirtualFileSystem::mountArchive( Path const & archive )
+	{
+		return mountArchive( archive, archive );
+	}
+
+	void VirtualFileSystem::unmount( Path const & mountPoint )
+	{
+		auto lock( makeUniqueLock( m_mutex ) );
+		// Readers still holding a mount keep it alive until they are done.
+		m_mounts.erase( std::remove_if( m_mounts.begin()
+				, m_mounts.end()
+				, [&mountPoint]( MountPtr const & lookup )
+				{
+					return lookup->point == mountPoint;
+				} )
+			, m_mounts.end() );
+	}
+
+	bool VirtualFileSystem::isMounted( Path const & mountPoint )const
+	{
+		auto lock( makeUniqueLock( m_mutex ) );
+		return m_mounts.end() != std::find_if( m_mounts.begin()
+			, m_mounts.end()
+			, [&mountPoint]( MountPtr const & lookup )
+			{
+				return lookup->point == mountPoint;
+			} );
+	}
+
+	bool VirtualFileSystem::fileExists( Path const & path )const
+	{
+		auto location = doFind( path );
+		return location.mount
+			|| File::fileExists( location.path );
+	}
+
+	bool VirtualFileSystem::readFile( Path const & path
+		, ByteArray & data )const
+	{
+		auto location = doFind( path );
+
+		if ( location.mount )
+		{
+			return location.mount->archive->readFile( location.path, data );
+		}
+
+		return vfs::readDiskFile( location.path, data );
+	}
+
+	bool VirtualFileSystem::readFile( Path const & path
+		, String & text )const
+	{
+		ByteArray data;
+
+		if ( !readFile( path, data ) )
+		{
+			return false;
+		}
+
+		auto begin = reinterpret_cast< char const * >( data.data() );
+		auto end = begin + data.size();
+
+		// Skip UTF-8 BOM.
+		if ( data.size() >= 3u
+			&& data[0] == 0xEF
+			&& data[1] == 0xBB
+			&& data[2] == 0xBF )
+		{
+			begin += 3u;
+		}
+
+		text = string::stringCast< xchar >( begin, end );
+		text.erase( std::remove( text.begin(), text.end(), cuT( '\r' ) ), text.end() );
+		return true;
+	}
+
+	bool VirtualFileSystem::readFiles( PathArray const & paths
+		, std::vector< ByteArray > & data
+		, TaskPool & pool )const
+	{
+		struct ArchiveFiles
+		{
+			MountPtr mount;
+			PathArray names;
+			std::vector< size_t > indices;
+		};
+		std::map< Mount const *, ArchiveFiles > archives;
+		bool result = true;
+		data.resize( paths.size() );
+
+		for ( size_t i = 0u; i < paths.size(); ++i )
+		{
+			auto location = doFind( paths[i] );
+
+			if ( location.mount )
+			{
+				auto & files = archives[location.mount.get()];
+				files.mount = location.mount;
+				files.names.push_back( location.path );
+				files.indices.push_back( i );
+			}
+			else
+			{
+				result = vfs::readDiskFile( location.path, data[i] ) && result;
+			}
+		}
+
+		for ( auto & [key, files] : archives )
+		{
+			std::vector< ByteArray > contents;
+			result = files.mount->archive->readFiles( files.names, contents, pool ) && result;
+
+			for ( size_t i = 0u; i < contents.size(); ++i )
+			{
+				data[files.indices[i]] = std::move( contents[i] );
+			}
+		}
+
+		return result;
+	}
+
+	bool VirtualFileSystem::listFiles( Path const & folder
+		, PathArray & files
+		, bool recursive )const
+	{
+		MountArray mounts;
+		{
+			auto lock( makeUniqueLock( m_mutex ) );
+			mounts = m_mounts;
+		}
+
+		files.clear();
+		bool result = false;
+
+		for ( auto & mount : mounts )
+		{
+			Path relative;
+
+			if ( !vfs::getRelative( mount->point, folder, relative ) )
+			{
+				continue;
+			}
+
+			if ( mount->archive )
+			{
+				result = true;
+
+				for ( auto & entry : mount->archive->getEntries() )
+				{
+					if ( vfs::isListed( relative, entry.name, recursive ) )
+					{
+						files.push_back( mount->point / entry.name );
+					}
+				}
+			}
+			else
+			{
+				PathArray diskFiles;
+				auto diskFolder = relative.empty()
+					? mount->source
+					: mount->source / relative;
+
+				if ( File::directoryExists( diskFolder )
+					&& File::listDirectoryFiles( diskFolder, diskFiles, recursive ) )
+				{
+					result = true;
+
+					for ( auto & file : diskFiles )
+					{
+						Path fileRelative;
+						vfs::getRelative( mount->source, file, fileRelative );
+						files.push_back( mount->point / fileRelative );
+					}
+				}
+			}
+		}
+
+		if ( File::directoryExists( folder ) )
+		{
+			PathArray diskFiles;
+			result = File::listDirectoryFiles( folder, diskFiles, recursive ) || result;
+			files.insert( files.end(), diskFiles.begin(), diskFiles.end() );
+		}
+
+		std::sort( files.begin(), files.end() );
+		files.erase( std::unique( files.begin(), files.end() ), files.end() );
+		return result;
+	}
+
+	VirtualFileSystem::Location VirtualFileSystem::doFind( Path const & path )const
+	{
+		auto lock( makeUniqueLock( m_mutex ) );
+
+		for ( auto it = m_mounts.rbegin(); it != m_mounts.rend(); ++it )
+		{
+			auto & mount = *it;
+			Path relative;
+
+			if ( !vfs::getRelative( mount->point, path, relative )
+				|| relative.empty() )
+			{
+				continue;
+			}
+
+			if ( mount->archive )
+			{
+				if ( mount->archive->findEntry( relative ) )
+				{
+					return { mount, relative };
+				}
+			}
+			else if ( File::fileExists( mount->source / relative ) )
+			{
+				return { nullptr, mount->source / relative };
+			}
+		}
+
+		return { nullptr, path };
+	}
+}
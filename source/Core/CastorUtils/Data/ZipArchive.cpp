@@ -1,8 +1,12 @@
 #include "CastorUtils/Data/ZipArchive.hpp"
 
+#include "CastorUtils/Config/MultiThreadConfig.hpp"
 #include "CastorUtils/Log/Logger.hpp"
 #include "CastorUtils/Data/BinaryFile.hpp"
 #include "CastorUtils/Miscellaneous/Utils.hpp"
+#include "CastorUtils/Multithreading/TaskPool.hpp"
+
+#include <atomic>
 
 #ifdef WIN32
 #	undef HAVE_UNISTD_H
@@ -46,10 +50,22 @@ namespace castor
 
 			~ZipImpl()override
 			{
+				// Handles left open by an exception.
+				if ( m_zip )
+				{
+					zipClose( m_zip, nullptr );
+				}
+
+				if ( m_unzip )
+				{
+					unzClose( m_unzip );
+				}
 			}
 
 			void open( Path const & path, File::OpenMode mode )override
 			{
+				m_path = path;
+
 				if ( mode == File::OpenMode::eWrite )
 				{
 #ifdef USEWIN32IOAPI
@@ -215,7 +231,176 @@ namespace castor
 				return result;
 			}
 
+			ZipArchive::EntryArray listEntries()override
+			{
+				ZipArchive::EntryArray result;
+				m_positions.clear();
+				unz_global_info gi;
+				auto error = unzGetGlobalInfo( m_unzip, &gi );
+
+				if ( error != UNZ_OK )
+				{
+					CU_Exception( "Error in unzgetGlobalInfo: " + zlib::getError( error ) );
+				}
+
+				if ( gi.number_entry == 0 )
+				{
+					return result;
+				}
+
+				error = unzGoToFirstFile( m_unzip );
+
+				if ( error != UNZ_OK )
+				{
+					CU_Exception( "Error in unzGoToFirstFile: " + zlib::getError( error ) );
+				}
+
+				for ( uLong i = 0; i < gi.number_entry; ++i )
+				{
+					unz_file_info fileInfo;
+					auto name = doGetCurrentFileName( fileInfo );
+					auto last = name.back();
+
+					if ( last != '/' && last != '\\' )
+					{
+						unz_file_pos pos;
+						error = unzGetFilePos( m_unzip, &pos );
+
+						if ( error != UNZ_OK )
+						{
+							CU_Exception( "Error in unzGetFilePos: " + zlib::getError( error ) );
+						}
+
+						m_positions.push_back( pos );
+						result.push_back( { Path{ string::stringCast< xchar >( name ) }
+							, uint64_t( fileInfo.uncompressed_size )
+							, uint64_t( fileInfo.compressed_size ) } );
+					}
+
+					if ( ( i + 1 ) < gi.number_entry )
+					{
+						error = unzGoToNextFile( m_unzip );
+
+						if ( error != UNZ_OK )
+						{
+							CU_Exception( "Error in unzGoToNextFile: " + zlib::getError( error ) );
+						}
+					}
+				}
+
+				return result;
+			}
+
+			void readEntry( size_t index, ByteArray & data )override
+			{
+				auto pos = m_positions[index];
+				auto error = unzGoToFilePos( m_unzip, &pos );
+
+				if ( error != UNZ_OK )
+				{
+					CU_Exception( "Error in unzGoToFilePos: " + zlib::getError( error ) );
+				}
+
+				unz_file_info fileInfo;
+				error = unzGetCurrentFileInfo( m_unzip
+					, &fileInfo
+					, nullptr
+					, 0
+					, nullptr
+					, 0
+					, nullptr
+					, 0 );
+
+				if ( error != UNZ_OK )
+				{
+					CU_Exception( "Error in unzgetCurrentFileInfo: " + zlib::getError( error ) );
+				}
+
+				error = unzOpenCurrentFile( m_unzip );
+
+				if ( error != UNZ_OK )
+				{
+					CU_Exception( "Error in unzOpenCurrentFile: " + zlib::getError( error ) );
+				}
+
+				// The entry is inflated straight into the destination buffer.
+				data.resize( size_t( fileInfo.uncompressed_size ) );
+				size_t offset = 0u;
+
+				do
+				{
+					auto size = std::min( data.size() - offset, CHUNK );
+					error = size
+						? unzReadCurrentFile( m_unzip
+							, data.data() + offset
+							, static_cast< unsigned int >( size ) )
+						: 0;
+
+					if ( error > 0 )
+					{
+						offset += size_t( error );
+					}
+				}
+				while ( error > 0 );
+
+				auto closeError = unzCloseCurrentFile( m_unzip );
+
+				if ( error < 0 )
+				{
+					CU_Exception( "Error in unzReadCurrentFile: " + zlib::getError( error ) );
+				}
+
+				if ( closeError != UNZ_OK )
+				{
+					CU_Exception( "Error in unzCloseCurrentFile: " + zlib::getError( closeError ) );
+				}
+
+				data.resize( offset );
+			}
+
+			std::unique_ptr< ZipArchive::ZipImpl > openReader()const override
+			{
+				auto result = std::make_unique< ZipImpl >();
+				result->open( m_path, File::OpenMode::eRead );
+				result->m_positions = m_positions;
+				return result;
+			}
+
 		private:
+			std::string doGetCurrentFileName( unz_file_info & fileInfo )
+			{
+				auto error = unzGetCurrentFileInfo( m_unzip
+					, &fileInfo
+					, nullptr
+					, 0
+					, nullptr
+					, 0
+					, nullptr
+					, 0 );
+
+				if ( error != UNZ_OK )
+				{
+					CU_Exception( "Error in unzgetCurrentFileInfo: " + zlib::getError( error ) );
+				}
+
+				std::string result( size_t( fileInfo.size_filename ), '\0' );
+				error = unzGetCurrentFileInfo( m_unzip
+					, &fileInfo
+					, result.data()
+					, uLong( result.size() )
+					, nullptr
+					, 0
+					, nullptr
+					, 0 );
+
+				if ( error != UNZ_OK || result.empty() )
+				{
+					CU_Exception( "Error in unzgetCurrentFileInfo: " + zlib::getError( error ) );
+				}
+
+				return result;
+			}
+
 			void doInflateCurrentFile( Path const & outFolder, StringArray & result )
 			{
 				std::array< char, 256 > fileNameInZip;
@@ -367,6 +552,8 @@ namespace castor
 		private:
 			unzFile m_unzip;
 			zipFile m_zip;
+			Path m_path;
+			std::vector< unz_file_pos > m_positions;
 		};
 	}
 
@@ -494,6 +681,16 @@ namespace castor
 		: m_impl( std::make_unique< zlib::ZipImpl >() )
 	{
 		m_impl->open( path, mode );
+
+		if ( mode == File::OpenMode::eRead )
+		{
+			m_entries = m_impl->listEntries();
+
+			for ( size_t i = 0u; i < m_entries.size(); ++i )
+			{
+				m_index.emplace( m_entries[i].name, i );
+			}
+		}
 	}
 
 	ZipArchive::~ZipArchive()
@@ -574,11 +771,106 @@ namespace castor
 
 	bool ZipArchive::findFolder( String const & folder )
 	{
-		return m_impl->findFolder( folder );
+		if ( m_entries.empty() )
+		{
+			return m_impl->findFolder( folder );
+		}
+
+		auto prefix = Path{ folder } + Path::NativeSeparator;
+		return m_entries.end() != std::find_if( m_entries.begin()
+			, m_entries.end()
+			, [&prefix]( Entry const & lookup )
+			{
+				return lookup.name.find( prefix ) == 0u;
+			} );
 	}
 
 	bool ZipArchive::findFile( String const & file )
 	{
-		return m_impl->findFile( file );
+		if ( m_entries.empty() )
+		{
+			return m_impl->findFile( file );
+		}
+
+		return findEntry( Path{ file } ) != nullptr;
+	}
+
+	ZipArchive::Entry const * ZipArchive::findEntry( Path const & name )const
+	{
+		auto it = m_index.find( name );
+		return it == m_index.end()
+			? nullptr
+			: &m_entries[it->second];
+	}
+
+	bool ZipArchive::readFile( Path const & name
+		, ByteArray & data )
+	{
+		auto it = m_index.find( name );
+
+		if ( it == m_index.end() )
+		{
+			return false;
+		}
+
+		try
+		{
+			auto lock( makeUniqueLock( m_readMutex ) );
+			m_impl->readEntry( it->second, data );
+			return true;
+		}
+		catch ( std::exception & exc )
+		{
+			Logger::logError( exc.what() );
+		}
+
+		return false;
+	}
+
+	bool ZipArchive::readFiles( PathArray const & names
+		, std::vector< ByteArray > & data
+		, TaskPool & pool )
+	{
+		std::vector< size_t > indices;
+		indices.reserve( names.size() );
+
+		for ( auto & name : names )
+		{
+			auto it = m_index.find( name );
+
+			if ( it == m_index.end() )
+			{
+				Logger::logError( cuT( "File [" ) + name + cuT( "] not found in archive." ) );
+				return false;
+			}
+
+			indices.push_back( it->second );
+		}
+
+		data.resize( names.size() );
+		auto jobs = uint32_t( std::min( size_t( pool.getCount() ) + 1u, indices.size() ) );
+		std::atomic_bool result{ true };
+		pool.parallelFor( jobs
+			, [this, jobs, &indices, &data, &result]( uint32_t job )
+			{
+				try
+				{
+					// minizip handles can't be shared between threads.
+					auto reader = m_impl->openReader();
+
+					for ( size_t i = job; i < indices.size(); i += jobs )
+					{
+						reader->readEntry( indices[i], data[i] );
+					}
+
+					reader->close();
+				}
+				catch ( std::exception & exc )
+				{
+					Logger::logError( exc.what() );
+					result = false;
+				}
+			} );
+		return result;
 	}
 }
@@ -1,7 +1,7 @@
 #include "CastorUtils/FileParser/FileParser.hpp"
 
 #include "CastorUtils/FileParser/ParserParameter.hpp"
-#include "CastorUtils/Data/ZipArchive.hpp"
+#include "CastorUtils/Data/VirtualFileSystem.hpp"
 
 namespace castor
 {
@@ -313,30 +313,24 @@ namespace castor
 		}
 	}
 
-	void FileParser::processFile( String const & appName
+	void FileParser::processFile( String const & CU_UnusedParam( appName )
 		, Path path
 		, PreprocessedFile & preprocessed )
 	{
 		m_ignoreLevel = 0;
 		m_ignored = false;
+		auto & vfs = VirtualFileSystem::getSingleton();
 
 		if ( path.getExtension() == cuT( "zip" ) )
 		{
+			// The archive is read in place, its files are reached through <archive path>/<file path>.
 			auto pathFile = path;
-			ZipArchive archive{ path, File::OpenMode::eRead };
-			path = File::getUserDirectory() / ( cuT( "." ) + appName ) / pathFile.getFileName();
-			bool carryOn = true;
 
-			if ( !File::directoryExists( path ) )
-			{
-				carryOn = archive.inflate( path );
-			}
-
-			if ( carryOn )
+			if ( vfs.mountArchive( pathFile ) )
 			{
 				PathArray files;
 
-				if ( File::listDirectoryFiles( path, files, true ) )
+				if ( vfs.listFiles( pathFile, files, true ) )
 				{
 					auto it = std::find_if( files.begin()
 						, files.end()
@@ -372,11 +366,10 @@ namespace castor
 			}
 		}
 
-		if ( TextFile file{ path, File::OpenMode::eRead } )
-		{
-			String content;
-			file.copyToString( content );
+		String content;
 
+		if ( vfs.readFile( path, content ) )
+		{
 			if ( !content.empty() )
 			{
 				m_logger.logInfo( cuT( "FileParser : Preprocessing file [" ) + path.getFileName( true ) + cuT( "]." ) );
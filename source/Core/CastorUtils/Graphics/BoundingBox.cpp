@@ -1,6 +1,7 @@
 #include "CastorUtils/Graphics/BoundingBox.hpp"
 
 #include "CastorUtils/Design/ArrayView.hpp"
+#include "CastorUtils/Math/SimdBatch.hpp"
 
 CU_ImplementSmartPtr( castor, BoundingBox )
 
@@ -79,10 +80,7 @@ namespace castor
 		};
 
 		// Express object box in transformed coordinates.
-		for ( auto & corner : corners )
-		{
-			corner = transformations * corner;
-		}
+		simd::transform( transformations, corners, corners, 8u );
 
 		// Retrieve axis aligned box boundaries.
 		min = corners[0];
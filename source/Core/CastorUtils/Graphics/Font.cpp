@@ -116,10 +116,19 @@ namespace castor
 
 			~SFreeTypeFontImpl()override
 			{
+				if ( m_library )
+				{
+					cleanup();
+				}
 			}
 
 			void initialise()override
 			{
+				if ( m_library )
+				{
+					return;
+				}
+
 				CHECK_FT_ERR( FT_Init_FreeType, &m_library );
 				CHECK_FT_ERR( FT_New_Face, m_library, string::stringCast< char >( m_path ).c_str(), 0, &m_face );
 				CHECK_FT_ERR( FT_Select_Charmap, m_face, FT_ENCODING_UNICODE );
@@ -128,6 +137,11 @@ namespace castor
 
 			void cleanup()override
 			{
+				if ( !m_library )
+				{
+					return;
+				}
+
 				CHECK_FT_ERR( FT_Done_Face, m_face );
 				CHECK_FT_ERR( FT_Done_FreeType, m_library );
 				m_library = nullptr;
@@ -220,18 +234,17 @@ namespace castor
 				}
 
 				font.setFaceName( pathFile.getFileName() );
+				// The face stays opened, other glyphs being rasterised on first use.
 				font.getGlyphLoader().initialise();
-				uint8_t const min = std::numeric_limits< uint8_t >::lowest();
-				uint8_t const max = std::numeric_limits< uint8_t >::max();
 
-				// We load the glyphs
-				for ( uint8_t c = min; c < max; c++ )
+				// We load the Latin-1 glyphs.
+				auto lock( makeUniqueLock( font.m_glyphsMutex ) );
+
+				for ( char32_t c = 0u; c < char32_t( 0x100 ); ++c )
 				{
-					char tmp[] { char( c ), 0, 0, 0 };
-					font.doLoadGlyph( string::utf8::toUtf8( tmp ) );
+					font.doLoadGlyph( c );
 				}
 
-				font.getGlyphLoader().cleanup();
 				result = true;
 			}
 			catch ( std::runtime_error & exc )
@@ -266,9 +279,9 @@ namespace castor
 
 	void Font::loadGlyph( char32_t c32 )
 	{
+		auto lock( makeUniqueLock( m_glyphsMutex ) );
 		m_glyphLoader->initialise();
 		doLoadGlyph( c32 );
-		m_glyphLoader->cleanup();
 	}
 
 	TextMetrics Font::getTextMetrics( std::u32string const & v
@@ -374,7 +387,7 @@ namespace castor
 			}
 			else
 			{
-				auto & glyph = getGlyphAt( c );
+				auto & glyph = doGetGlyph( c );
 
 				if ( c == U' ' || c == U'\t' )
 				{
@@ -421,24 +434,37 @@ namespace castor
 
 	Glyph const & Font::doLoadGlyph( char32_t c )
 	{
-		auto it = std::find_if( m_loadedGlyphs.begin()
-			, m_loadedGlyphs.end()
-			, [c]( Glyph const & lookup )
+		auto it = m_glyphIndices.find( c );
+
+		if ( it == m_glyphIndices.end() )
 		{
-			return lookup.getCharacter() == c;
-		} );
+			auto & glyph = m_loadedGlyphs.emplace_back( m_glyphLoader->loadGlyph( c ) );
+			it = m_glyphIndices.emplace( c, m_loadedGlyphs.size() - 1u ).first;
+			m_maxSize->x = std::max( m_maxSize->x, int32_t( glyph.getSize().getWidth() ) );
+			m_maxSize->y = std::max( m_maxSize->y, int32_t( glyph.getSize().getHeight() ) );
+			m_maxRange->x = std::min( m_maxRange->x, glyph.getBearing().y() );
+			m_maxRange->y = std::max( m_maxRange->y, glyph.getBearing().y() );
+		}
+
+		return m_loadedGlyphs[it->second];
+	}
+
+	Glyph const & Font::doGetGlyph( char32_t c )
+	{
+		auto lock( makeUniqueLock( m_glyphsMutex ) );
 
-		if ( it == m_loadedGlyphs.end() )
+		if ( auto it = m_glyphIndices.find( c );
+			it != m_glyphIndices.end() )
 		{
-			m_loadedGlyphs.push_back( m_glyphLoader->loadGlyph( c ) );
-			it = std::next( m_loadedGlyphs.begin()
-				, ptrdiff_t( m_loadedGlyphs.size() - 1u ) );
-			m_maxSize->x = std::max( m_maxSize->x, int32_t( it->getSize().getWidth() ) );
-			m_maxSize->y = std::max( m_maxSize->y, int32_t( it->getSize().getHeight() ) );
-			m_maxRange->x = std::min( m_maxRange->x, it->getBearing().y() );
-			m_maxRange->y = std::max( m_maxRange->y, it->getBearing().y() );
+			return m_loadedGlyphs[it->second];
 		}
 
-		return *it;
+		if ( !hasGlyphLoader() )
+		{
+			throw std::range_error( "Font subscript out of range" );
+		}
+
+		m_glyphLoader->initialise();
+		return doLoadGlyph( c );
 	}
 }
@@ -1,8 +1,8 @@
 #include "CastorUtils/Graphics/ImageLoader.hpp"
 
-#include "CastorUtils/Data/BinaryFile.hpp"
 #include "CastorUtils/Data/LoaderException.hpp"
 #include "CastorUtils/Data/Path.hpp"
+#include "CastorUtils/Data/VirtualFileSystem.hpp"
 #include "CastorUtils/Graphics/ImageLayout.hpp"
 
 namespace castor
@@ -155,21 +155,15 @@ namespace castor
 		}
 
 		ByteArray data;
-		{
-			BinaryFile file{ path, File::OpenMode::eRead };
-			auto size = file.getLength();
 
-			if ( !size )
-			{
-				CU_LoaderError( "Can't load image: Empty file" );
-			}
-
-			data.resize( size_t( size ) );
+		if ( !VirtualFileSystem::getSingleton().readFile( path, data ) )
+		{
+			CU_LoaderError( "Can't load image: Couldn't read image file" );
+		}
 
-			if ( file.readArray( data.data(), data.size() ) < data.size() )
-			{
-				CU_LoaderError( "Can't load image: Couldn't read image file" );
-			}
+		if ( data.empty() )
+		{
+			CU_LoaderError( "Can't load image: Empty file" );
 		}
 
 		try
@@ -204,7 +204,8 @@ namespace castor
 			, uint32_t dstAlign
 			, VkExtent3D const & extent
 			, uint32_t layers
-			, uint32_t levels )
+			, uint32_t levels
+			, TaskPool * pool )
 		{
 			srcAlign = ( srcAlign
 				? srcAlign
@@ -252,7 +253,8 @@ namespace castor
 						, srcLevelSize
 						, dstFormat
 						, dstLevel
-						, dstLevelSize );
+						, dstLevelSize
+						, pool );
 					srcLevelStart += srcLevelSize;
 					dstLevelStart += dstLevelSize;
 					written += dstLevelSize;
@@ -603,7 +605,8 @@ namespace castor
 						? VkExtent3D{ extent.width, extent.height, 1u }
 						: extent )
 					, m_layers
-					, m_levels );
+					, m_levels
+					, options ? options->pool : nullptr );
 			}
 		}
 	}
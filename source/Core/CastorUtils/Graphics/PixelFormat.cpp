@@ -3,6 +3,7 @@
 #include "CastorUtils/Graphics/Image.hpp"
 #include "CastorUtils/Graphics/PixelBuffer.hpp"
 #include "CastorUtils/Graphics/PxBufferCompression.hpp"
+#include "CastorUtils/Graphics/PxBufferConversion.hpp"
 
 #include <ashes/common/Format.hpp>
 
@@ -631,8 +632,22 @@ namespace castor
 		, uint32_t srcSize
 		, PixelFormat dstFormat
 		, uint8_t * dstBuffer
-		, uint32_t dstSize )
+		, uint32_t dstSize
+		, TaskPool * pool )
 	{
+		if ( srcFormat != dstFormat
+			&& convertBufferBulk( srcDimensions
+				, srcFormat
+				, srcBuffer
+				, srcSize
+				, dstFormat
+				, dstBuffer
+				, dstSize
+				, pool ) )
+		{
+			return;
+		}
+
 		switch ( srcFormat )
 		{
 #define CUPF_ENUM_VALUE( name, value, components, alpha, colour, depth, stencil, compressed ) case PixelFormat::e##name:\
@@ -0,0 +1,452 @@
+#include "CastorUtils/Graphics/PxBufferConversion.hpp"
+
+#include "CastorUtils/Multithreading/TaskPool.hpp"
+
+#include "CastorUtils/Config/BeginExternHeaderGuard.hpp"
+#if CU_UseSSE2
+#	include <emmintrin.h>
+#endif
+#include <cstring>
+#include <limits>
+#include "CastorUtils/Config/EndExternHeaderGuard.hpp"
+
+namespace castor
+{
+	namespace pxconv
+	{
+		// The kernels reproduce the per pixel conversion, as done by PixelConverter:
+		// - sRGB and UNORM 8 bits formats share the same storage, and are converted as is.
+		// - 8 bits components are converted to float without normalisation.
+		// - Missing alpha is read as the max value of the source components type.
+		// - 16 bits float formats are stored as SNORM16, from float: int16_t( v * 32768.0f ).
+		using Kernel = void( * )( uint8_t const *, uint8_t *, uint32_t );
+
+		static uint32_t constexpr MinChunkPixels = 64u * 1024u;
+
+		enum class Layout8
+		{
+			eNone,
+			eRGB,
+			eBGR,
+			eRGBA,
+			eBGRA,
+		};
+
+		static Layout8 getLayout8( PixelFormat format )
+		{
+			switch ( format )
+			{
+			case PixelFormat::eR8G8B8_UNORM:
+			case PixelFormat::eR8G8B8_SRGB:
+				return Layout8::eRGB;
+			case PixelFormat::eB8G8R8_UNORM:
+			case PixelFormat::eB8G8R8_SRGB:
+				return Layout8::eBGR;
+			case PixelFormat::eR8G8B8A8_UNORM:
+			case PixelFormat::eR8G8B8A8_SRGB:
+				return Layout8::eRGBA;
+			case PixelFormat::eB8G8R8A8_UNORM:
+			case PixelFormat::eB8G8R8A8_SRGB:
+				return Layout8::eBGRA;
+			default:
+				return Layout8::eNone;
+			}
+		}
+
+		static uint32_t getSize( Layout8 layout )
+		{
+			return ( layout == Layout8::eRGB || layout == Layout8::eBGR )
+				? 3u
+				: 4u;
+		}
+
+		static bool isBGR( Layout8 layout )
+		{
+			return layout == Layout8::eBGR || layout == Layout8::eBGRA;
+		}
+
+		//*****************************************************************************************
+
+#if CU_UseSSE2
+
+		// Swaps bytes 0 and 2 of each 32 bits lane.
+		static __m128i swapRB( __m128i value )
+		{
+			auto ga = _mm_and_si128( value, _mm_set1_epi32( int( 0xFF00FF00u ) ) );
+			auto rb = _mm_and_si128( value, _mm_set1_epi32( 0x00FF00FF ) );
+			return _mm_or_si128( ga
+				, _mm_or_si128( _mm_srli_epi32( rb, 16 ), _mm_slli_epi32( rb, 16 ) ) );
+		}
+
+#endif
+
+		template< uint32_t SizeT >
+		static void copy8( uint8_t const * src
+			, uint8_t * dst
+			, uint32_t count )
+		{
+			std::memcpy( dst, src, size_t( count ) * SizeT );
+		}
+
+		template< uint32_t SrcSizeT, uint32_t DstSizeT, bool SwapT >
+		static void convert8( uint8_t const * src
+			, uint8_t * dst
+			, uint32_t count )
+		{
+			uint32_t i = 0u;
+
+#if CU_UseSSE2
+			if constexpr ( SrcSizeT == 4u && DstSizeT == 4u && SwapT )
+			{
+				for ( ; i + 4u <= count; i += 4u )
+				{
+					auto value = _mm_loadu_si128( reinterpret_cast< __m128i const * >( src ) );
+					_mm_storeu_si128( reinterpret_cast< __m128i * >( dst ), swapRB( value ) );
+					src += 16u;
+					dst += 16u;
+				}
+			}
+#endif
+
+			for ( ; i < count; ++i )
+			{
+				dst[0] = src[SwapT ? 2u : 0u];
+				dst[1] = src[1];
+				dst[2] = src[SwapT ? 0u : 2u];
+
+				if constexpr ( DstSizeT == 4u )
+				{
+					if constexpr ( SrcSizeT == 4u )
+					{
+						dst[3] = src[3];
+					}
+					else
+					{
+						dst[3] = std::numeric_limits< uint8_t >::max();
+					}
+				}
+
+				src += SrcSizeT;
+				dst += DstSizeT;
+			}
+		}
+
+		template< uint32_t SrcSizeT, bool SwapT >
+		static void convert8ToF32( uint8_t const * src
+			, uint8_t * dst
+			, uint32_t count )
+		{
+			auto result = reinterpret_cast< float * >( dst );
+			uint32_t i = 0u;
+
+#if CU_UseSSE2
+			if constexpr ( SrcSizeT == 4u )
+			{
+				auto zero = _mm_setzero_si128();
+
+				for ( ; i + 4u <= count; i += 4u )
+				{
+					auto value = _mm_loadu_si128( reinterpret_cast< __m128i const * >( src ) );
+
+					if constexpr ( SwapT )
+					{
+						value = swapRB( value );
+					}
+
+					auto lo = _mm_unpacklo_epi8( value, zero );
+					auto hi = _mm_unpackhi_epi8( value, zero );
+					_mm_storeu_ps( result + 0u, _mm_cvtepi32_ps( _mm_unpacklo_epi16( lo, zero ) ) );
+					_mm_storeu_ps( result + 4u, _mm_cvtepi32_ps( _mm_unpackhi_epi16( lo, zero ) ) );
+					_mm_storeu_ps( result + 8u, _mm_cvtepi32_ps( _mm_unpacklo_epi16( hi, zero ) ) );
+					_mm_storeu_ps( result + 12u, _mm_cvtepi32_ps( _mm_unpackhi_epi16( hi, zero ) ) );
+					src += 16u;
+					result += 16u;
+				}
+			}
+#endif
+
+			for ( ; i < count; ++i )
+			{
+				result[0] = float( src[SwapT ? 2u : 0u] );
+				result[1] = float( src[1] );
+				result[2] = float( src[SwapT ? 0u : 2u] );
+
+				if constexpr ( SrcSizeT == 4u )
+				{
+					result[3] = float( src[3] );
+				}
+				else
+				{
+					result[3] = float( std::numeric_limits< uint8_t >::max() );
+				}
+
+				src += SrcSizeT;
+				result += 4u;
+			}
+		}
+
+		static void convertR32FToRGBA32F( uint8_t const * src
+			, uint8_t * dst
+			, uint32_t count )
+		{
+			auto source = reinterpret_cast< float const * >( src );
+			auto result = reinterpret_cast< float * >( dst );
+			uint32_t i = 0u;
+
+#if CU_UseSSE2
+			auto zero = _mm_setzero_ps();
+			auto za = _mm_setr_ps( 0.0f, std::numeric_limits< float >::max(), 0.0f, std::numeric_limits< float >::max() );
+
+			for ( ; i + 4u <= count; i += 4u )
+			{
+				auto r = _mm_loadu_ps( source );
+				auto rlo = _mm_unpacklo_ps( r, zero );
+				auto rhi = _mm_unpackhi_ps( r, zero );
+				_mm_storeu_ps( result + 0u, _mm_movelh_ps( rlo, za ) );
+				_mm_storeu_ps( result + 4u, _mm_movehl_ps( za, rlo ) );
+				_mm_storeu_ps( result + 8u, _mm_movelh_ps( rhi, za ) );
+				_mm_storeu_ps( result + 12u, _mm_movehl_ps( za, rhi ) );
+				source += 4u;
+				result += 16u;
+			}
+#endif
+
+			for ( ; i < count; ++i )
+			{
+				result[0] = *source;
+				result[1] = 0.0f;
+				result[2] = 0.0f;
+				result[3] = std::numeric_limits< float >::max();
+				++source;
+				result += 4u;
+			}
+		}
+
+		static void convertRGBA32FToR32F( uint8_t const * src
+			, uint8_t * dst
+			, uint32_t count )
+		{
+			auto source = reinterpret_cast< float const * >( src );
+			auto result = reinterpret_cast< float * >( dst );
+			uint32_t i = 0u;
+
+#if CU_UseSSE2
+			for ( ; i + 4u <= count; i += 4u )
+			{
+				auto p01 = _mm_shuffle_ps( _mm_loadu_ps( source + 0u ), _mm_loadu_ps( source + 4u ), _MM_SHUFFLE( 0, 0, 0, 0 ) );
+				auto p23 = _mm_shuffle_ps( _mm_loadu_ps( source + 8u ), _mm_loadu_ps( source + 12u ), _MM_SHUFFLE( 0, 0, 0, 0 ) );
+				_mm_storeu_ps( result, _mm_shuffle_ps( p01, p23, _MM_SHUFFLE( 2, 0, 2, 0 ) ) );
+				source += 16u;
+				result += 4u;
+			}
+#endif
+
+			for ( ; i < count; ++i )
+			{
+				*result = source[0];
+				source += 4u;
+				++result;
+			}
+		}
+
+		static void convertRGBA32FToRGBA16F( uint8_t const * src
+			, uint8_t * dst
+			, uint32_t count )
+		{
+			auto source = reinterpret_cast< float const * >( src );
+			auto result = reinterpret_cast< int16_t * >( dst );
+			uint32_t i = 0u;
+			count *= 4u;
+
+#if CU_UseSSE2
+			auto scale = _mm_set1_ps( 32768.0f );
+
+			for ( ; i + 8u <= count; i += 8u )
+			{
+				// Keep the low 16 bits of the 32 bits integers, as the scalar cast does,
+				// then the saturating pack is exact.
+				auto lo = _mm_cvttps_epi32( _mm_mul_ps( _mm_loadu_ps( source + 0u ), scale ) );
+				auto hi = _mm_cvttps_epi32( _mm_mul_ps( _mm_loadu_ps( source + 4u ), scale ) );
+				lo = _mm_srai_epi32( _mm_slli_epi32( lo, 16 ), 16 );
+				hi = _mm_srai_epi32( _mm_slli_epi32( hi, 16 ), 16 );
+				_mm_storeu_si128( reinterpret_cast< __m128i * >( result ), _mm_packs_epi32( lo, hi ) );
+				source += 8u;
+				result += 8u;
+			}
+#endif
+
+			for ( ; i < count; ++i )
+			{
+				*result = int16_t( *source * 32768.0f );
+				++source;
+				++result;
+			}
+		}
+
+		static void convertRGBA16FToRGBA32F( uint8_t const * src
+			, uint8_t * dst
+			, uint32_t count )
+		{
+			auto source = reinterpret_cast< int16_t const * >( src );
+			auto result = reinterpret_cast< float * >( dst );
+			uint32_t i = 0u;
+			count *= 4u;
+
+#if CU_UseSSE2
+			for ( ; i + 8u <= count; i += 8u )
+			{
+				auto value = _mm_loadu_si128( reinterpret_cast< __m128i const * >( source ) );
+				auto lo = _mm_srai_epi32( _mm_unpacklo_epi16( value, value ), 16 );
+				auto hi = _mm_srai_epi32( _mm_unpackhi_epi16( value, value ), 16 );
+				_mm_storeu_ps( result + 0u, _mm_cvtepi32_ps( lo ) );
+				_mm_storeu_ps( result + 4u, _mm_cvtepi32_ps( hi ) );
+				source += 8u;
+				result += 8u;
+			}
+#endif
+
+			for ( ; i < count; ++i )
+			{
+				*result = float( *source );
+				++source;
+				++result;
+			}
+		}
+
+		//*****************************************************************************************
+
+		template< uint32_t SrcSizeT, uint32_t DstSizeT >
+		static Kernel getKernel8( bool swap )
+		{
+			return swap
+				? &convert8< SrcSizeT, DstSizeT, true >
+				: &convert8< SrcSizeT, DstSizeT, false >;
+		}
+
+		template< uint32_t SrcSizeT >
+		static Kernel getKernel8ToF32( bool swap )
+		{
+			return swap
+				? &convert8ToF32< SrcSizeT, true >
+				: &convert8ToF32< SrcSizeT, false >;
+		}
+
+		static Kernel findKernel( PixelFormat srcFormat
+			, PixelFormat dstFormat )
+		{
+			auto srcLayout = getLayout8( srcFormat );
+
+			if ( srcLayout != Layout8::eNone )
+			{
+				auto swap = isBGR( srcLayout ) != isBGR( getLayout8( dstFormat ) );
+				auto srcSize = getSize( srcLayout );
+
+				if ( dstFormat == PixelFormat::eR32G32B32A32_SFLOAT )
+				{
+					return srcSize == 3u
+						? getKernel8ToF32< 3u >( isBGR( srcLayout ) )
+						: getKernel8ToF32< 4u >( isBGR( srcLayout ) );
+				}
+
+				auto dstLayout = getLayout8( dstFormat );
+
+				// Not supported by the per pixel conversion.
+				if ( dstLayout == Layout8::eNone
+					|| dstFormat == PixelFormat::eB8G8R8A8_SRGB )
+				{
+					return nullptr;
+				}
+
+				auto dstSize = getSize( dstLayout );
+
+				if ( srcLayout == dstLayout )
+				{
+					return srcSize == 3u
+						? &copy8< 3u >
+						: &copy8< 4u >;
+				}
+
+				if ( srcSize == 3u )
+				{
+					return dstSize == 3u
+						? getKernel8< 3u, 3u >( swap )
+						: getKernel8< 3u, 4u >( swap );
+				}
+
+				return dstSize == 3u
+					? getKernel8< 4u, 3u >( swap )
+					: getKernel8< 4u, 4u >( swap );
+			}
+
+			if ( srcFormat == PixelFormat::eR32_SFLOAT
+				&& dstFormat == PixelFormat::eR32G32B32A32_SFLOAT )
+			{
+				return &convertR32FToRGBA32F;
+			}
+
+			if ( srcFormat == PixelFormat::eR32G32B32A32_SFLOAT
+				&& dstFormat == PixelFormat::eR32_SFLOAT )
+			{
+				return &convertRGBA32FToR32F;
+			}
+
+			if ( srcFormat == PixelFormat::eR32G32B32A32_SFLOAT
+				&& dstFormat == PixelFormat::eR16G16B16A16_SFLOAT )
+			{
+				return &convertRGBA32FToRGBA16F;
+			}
+
+			if ( srcFormat == PixelFormat::eR16G16B16A16_SFLOAT
+				&& dstFormat == PixelFormat::eR32G32B32A32_SFLOAT )
+			{
+				return &convertRGBA16FToRGBA32F;
+			}
+
+			return nullptr;
+		}
+	}
+
+	//*********************************************************************************************
+
+	bool convertBufferBulk( Size const & srcDimensions
+		, PixelFormat srcFormat
+		, uint8_t const * srcBuffer
+		, uint32_t srcSize
+		, PixelFormat dstFormat
+		, uint8_t * dstBuffer
+		, uint32_t dstSize
+		, TaskPool * pool )
+	{
+		auto kernel = pxconv::findKernel( srcFormat, dstFormat );
+
+		if ( !kernel )
+		{
+			return false;
+		}
+
+		auto srcPixelSize = uint32_t( getBytesPerPixel( srcFormat ) );
+		auto dstPixelSize = uint32_t( getBytesPerPixel( dstFormat ) );
+		auto count = srcSize / srcPixelSize;
+		CU_Require( count == dstSize / dstPixelSize );
+		// Chunks are made of whole rows, the buffer can hold several layers or levels though.
+		auto rowSize = std::max( 1u, srcDimensions.getWidth() );
+		auto chunkSize = std::max( 1u, pxconv::MinChunkPixels / rowSize ) * rowSize;
+		auto chunks = ( count + chunkSize - 1u ) / chunkSize;
+
+		if ( !pool || chunks <= 1u )
+		{
+			kernel( srcBuffer, dstBuffer, count );
+			return true;
+		}
+
+		pool->parallelFor( chunks
+			, [&]( uint32_t chunk )
+			{
+				auto first = chunk * chunkSize;
+				kernel( srcBuffer + size_t( first ) * srcPixelSize
+					, dstBuffer + size_t( first ) * dstPixelSize
+					, std::min( chunkSize, count - first ) );
+			} );
+		return true;
+	}
+}
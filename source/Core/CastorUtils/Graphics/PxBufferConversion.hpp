@@ -0,0 +1,47 @@
+/*
+See LICENSE file in root folder
+*/
+#ifndef ___CU_PxBufferConversion___
+#define ___CU_PxBufferConversion___
+
+#include "CastorUtils/Graphics/PixelFormat.hpp"
+
+namespace castor
+{
+	/**
+	 *\~english
+	 *\brief		Converts a buffer through a dedicated bulk kernel, if one exists for the given formats pair.
+	 *\remarks		The results are bit-exact with the ones of the per pixel conversion.
+	 *\param[in]	srcDimensions	The source dimensions, used to split the buffer in rows chunks.
+	 *\param[in]	srcFormat		The source format.
+	 *\param[in]	srcBuffer		The source buffer.
+	 *\param[in]	srcSize			The source size.
+	 *\param[in]	dstFormat		The destination format.
+	 *\param[in]	dstBuffer		The destination buffer.
+	 *\param[in]	dstSize			The destination size.
+	 *\param[in]	pool			If not null, the rows chunks of big buffers are converted in parallel.
+	 *\return		\p false if no kernel exists for the formats pair, nothing has been converted then.
+	 *\~french
+	 *\brief		Convertit un buffer via un noyau dédié, s'il en existe un pour la paire de formats donnée.
+	 *\remarks		Les résultats sont identiques, au bit près, à ceux de la conversion pixel par pixel.
+	 *\param[in]	srcDimensions	Les dimensions de la source, utilisées pour découper le buffer en blocs de lignes.
+	 *\param[in]	srcFormat		Le format de la source.
+	 *\param[in]	srcBuffer		Le buffer source.
+	 *\param[in]	srcSize			La taille de la source.
+	 *\param[in]	dstFormat		Le format de la destination.
+	 *\param[in]	dstBuffer		Le buffer destination.
+	 *\param[in]	dstSize			La taille de la destination.
+	 *\param[in]	pool			Si non nul, les blocs de lignes des gros buffers sont convertis en parallèle.
+	 *\return		\p false si aucun noyau n'existe pour la paire de formats, rien n'a alors été converti.
+	 */
+	bool convertBufferBulk( Size const & srcDimensions
+		, PixelFormat srcFormat
+		, uint8_t const * srcBuffer
+		, uint32_t srcSize
+		, PixelFormat dstFormat
+		, uint8_t * dstBuffer
+		, uint32_t dstSize
+		, TaskPool * pool );
+}
+
+#endif
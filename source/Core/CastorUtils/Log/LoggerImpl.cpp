@@ -2,31 +2,45 @@
 
 #include "CastorUtils/Log/LoggerConsole.hpp"
 #include "CastorUtils/Log/Logger.hpp"
-#include "CastorUtils/Data/TextFile.hpp"
+#include "CastorUtils/Data/File.hpp"
 #include "CastorUtils/Miscellaneous/Utils.hpp"
 
 #include "CastorUtils/Config/MultiThreadConfig.hpp"
 
+#include <ctime>
+
 namespace castor
 {
 	LoggerImpl::LoggerImpl( LoggerImpl && rhs )
 		: m_parent{ rhs.m_parent }
 		, m_console{ std::move( rhs.m_console ) }
 		, m_logFilePath{ std::move( rhs.m_logFilePath ) }
+		, m_fileIndex{ rhs.m_fileIndex }
+		, m_files{ rhs.m_files }
 		, m_mapCallbacks{ std::move( rhs.m_mapCallbacks ) }
 	{
 		rhs.m_console = nullptr;
+		rhs.m_files = {};
 	}
 
 	LoggerImpl & LoggerImpl::operator=( LoggerImpl && rhs )
 	{
+		doCloseFiles();
 		m_console = std::move( rhs.m_console );
 		m_logFilePath = std::move( rhs.m_logFilePath );
+		m_fileIndex = rhs.m_fileIndex;
+		m_files = rhs.m_files;
 		m_mapCallbacks = std::move( rhs.m_mapCallbacks );
 		rhs.m_console = nullptr;
+		rhs.m_files = {};
 		return *this;
 	}
 
+	LoggerImpl::~LoggerImpl()noexcept
+	{
+		doCloseFiles();
+	}
+
 	LoggerImpl::LoggerImpl( ProgramConsole & console
 		, LogType CU_UnusedParam( level )
 		, LoggerInstance & parent )
@@ -68,6 +82,15 @@ namespace castor
 			m_logFilePath[size_t( logType )] = logFilePath;
 		}
 
+		// The files stay opened between two writes, levels sharing a path share a handle.
+		doCloseFiles();
+
+		for ( size_t i = 0u; i < m_fileIndex.size(); ++i )
+		{
+			m_fileIndex[i] = size_t( std::distance( m_logFilePath.begin()
+				, std::find( m_logFilePath.begin(), m_logFilePath.end(), m_logFilePath[i] ) ) );
+		}
+
 		FILE * file;
 		castor::fileOpen( file, makePath( logFilePath ), "w" );
 
@@ -87,75 +110,52 @@ namespace castor
 		doPrintMessage( logLevel, string::stringCast< xchar >( message ), newLine );
 	}
 
-	void LoggerImpl::logMessageQueue( MessageQueue const & queue )
+	void LoggerImpl::logRecords( LogRecordArray const & records )
 	{
-		std::time_t endTime = std::chrono::system_clock::to_time_t( std::chrono::system_clock::now() );
-		std::string time = std::ctime( &endTime );
-		string::replace( time, "\n", std::string{} );
-		String timeStamp = string::stringCast< xchar >( time );
-		StringStream logs[size_t( LogType::eCount )]
+		auto lock( makeUniqueLock( m_mutexFiles ) );
+
+		for ( auto & record : records )
 		{
-			makeStringStream(),
-			makeStringStream(),
-			makeStringStream(),
-			makeStringStream(),
-			makeStringStream(),
-		};
-
-		try
+			auto & buffer = m_buffers[m_fileIndex[size_t( record.type )]];
+			auto & timeStamp = doGetTimeStamp( record.time );
+			auto text = record.text;
+			size_t end;
+
+			while ( ( end = text.find( '\n' ) ) != std::string_view::npos )
+			{
+				doLogLine( timeStamp, text.substr( 0u, end ), buffer, record.type, true );
+				text.remove_prefix( end + 1u );
+			}
+
+			doLogLine( timeStamp, text, buffer, record.type, record.newLine );
+		}
+
+		for ( size_t i = 0u; i < m_buffers.size(); ++i )
 		{
-			for ( auto & message : queue )
+			auto & buffer = m_buffers[i];
+
+			if ( buffer.empty() )
 			{
-				StringStream & stream = logs[size_t( message.m_type )];
-				String toLog = message.m_message;
-
-				if ( toLog.find( cuT( '\n' ) ) != String::npos )
-				{
-					StringArray array = string::split( toLog, cuT( "\n" ), uint32_t( std::count( toLog.begin(), toLog.end(), cuT( '\n' ) ) + 1 ) );
-					auto it = array.begin();
-
-					for ( size_t i = 0; i < array.size() - 1; ++i )
-					{
-						doLogLine( timeStamp, *it, stream, message.m_type, true );
-						++it;
-					}
-
-					doLogLine( timeStamp, *it, stream, message.m_type, message.m_newLine );
-				}
-				else
-				{
-					doLogLine( timeStamp, toLog, stream, message.m_type, message.m_newLine );
-				}
+				continue;
 			}
 
+			if ( !m_files[i] )
 			{
-				auto lock( makeUniqueLock( m_mutexFiles ) );
-				size_t i = 0;
-
-				for ( auto const & stream : logs )
-				{
-					String text = stream.str();
-
-					if ( !text.empty() )
-					{
-						try
-						{
-							TextFile file{ Path{ m_logFilePath[i] }, File::OpenMode::eAppend };
-							file.writeText( text );
-						}
-						catch ( Exception & exc )
-						{
-							printf( "Unexpected exception while writing log messages: %s", exc.what() );
-						}
-					}
-
-					++i;
-				}
+				castor::fileOpen( m_files[i], makePath( m_logFilePath[i] ), "a" );
 			}
-		}
-		catch ( std::exception & /*exc*/ )
-		{
-			//m_console->print( cuT( "Couldn't open log file : " ) + string::stringCast< xchar >( exc.what() ), true );
+
+			if ( m_files[i] )
+			{
+				fwrite( buffer.data(), 1u, buffer.size(), m_files[i] );
+				fflush( m_files[i] );
+			}
+			else
+			{
+				printf( "Couldn't open log file: %s\n", string::stringCast< char >( m_logFilePath[i] ).c_str() );
+			}
+
+			// Keeps the capacity, for the next batch.
+			buffer.clear();
 		}
 	}
 
@@ -186,24 +186,62 @@ namespace castor
 		m_console->print( line, newLine );
 	}
 
-	void LoggerImpl::doLogLine( String const & timestamp, String const & line, StringStream & stream, LogType logLevel, bool newLine )
+	void LoggerImpl::doLogLine( String const & timestamp, std::string_view line, std::string & buffer, LogType logLevel, bool newLine )
 	{
+		m_line.assign( line.data(), line.size() );
+
 #if defined( NDEBUG )
-		doPrintLine( line, logLevel, newLine );
+		doPrintLine( m_line, logLevel, newLine );
 #endif
 
 		{
 			auto lock( makeUniqueLock( m_mutexCallbacks ) );
 
-			if ( !m_mapCallbacks.empty() )
+			for ( auto & it : m_mapCallbacks )
 			{
-				for ( auto it : m_mapCallbacks )
-				{
-					it.second( line, logLevel, newLine );
-				}
+				it.second( m_line, logLevel, newLine );
 			}
 		}
 
-		stream << timestamp << cuT( " - " ) << m_parent.getHeader( uint8_t( logLevel ) ) << line << ( newLine ? "\n" : "" );
+		buffer += timestamp;
+		buffer += " - ";
+		buffer += m_parent.getHeader( uint8_t( logLevel ) );
+		buffer += line;
+
+		if ( newLine )
+		{
+			buffer += '\n';
+		}
+	}
+
+	String const & LoggerImpl::doGetTimeStamp( int64_t time )
+	{
+		auto second = time / 1000000000;
+
+		if ( second != m_timeStampSecond )
+		{
+			// Same format as std::ctime, without the trailing new line.
+			auto seconds = std::time_t( second );
+			std::tm tm{};
+			getLocaltime( &tm, &seconds );
+			char buffer[64]{};
+			auto size = std::strftime( buffer, sizeof( buffer ), "%a %b %e %H:%M:%S %Y", &tm );
+			m_timeStamp.assign( buffer, size );
+			m_timeStampSecond = second;
+		}
+
+		return m_timeStamp;
+	}
+
+	void LoggerImpl::doCloseFiles()
+	{
+		for ( auto & file : m_files )
+		{
+			if ( file )
+			{
+				fclose( file );
+				file = nullptr;
+			}
+		}
 	}
 }
@@ -1,17 +1,42 @@
 #include "CastorUtils/Log/LoggerInstance.hpp"
 
 #include "CastorUtils/Log/LoggerImpl.hpp"
+#include "CastorUtils/Log/LogRecordBuffer.hpp"
 
 #include "CastorUtils/Config/MultiThreadConfig.hpp"
 #include "CastorUtils/Data/File.hpp"
 
+#include <algorithm>
+
 namespace castor
 {
+	namespace logger
+	{
+		struct ThreadBuffer
+		{
+			uint64_t instance;
+			std::shared_ptr< LogRecordBuffer > buffer;
+		};
+
+		static std::atomic_uint64_t instanceCount{};
+		static thread_local std::vector< ThreadBuffer > threadBuffers;
+
+		static int64_t getTime()
+		{
+			return std::chrono::duration_cast< std::chrono::nanoseconds >( std::chrono::system_clock::now().time_since_epoch() ).count();
+		}
+	}
+
+	//*********************************************************************************************
+
 	LoggerInstance::LoggerInstance( LoggerInstance && rhs )
-		: m_logLevel{ std::move( rhs.m_logLevel ) }
+		: m_id{ rhs.m_id }
+		, m_logLevel{ std::move( rhs.m_logLevel ) }
 		, m_impl{ std::move( rhs.m_impl ) }
 		, m_headers{ std::move( rhs.m_headers ) }
-		, m_queue{ std::move( rhs.m_queue ) }
+		, m_buffers{ std::move( rhs.m_buffers ) }
+		, m_overflow{ std::move( rhs.m_overflow ) }
+		, m_dropped{ rhs.m_dropped.load() }
 		, m_logThread{ std::move( rhs.m_logThread ) }
 		, m_initialised{ rhs.m_initialised.load() }
 		, m_stopped{ rhs.m_stopped.load() }
@@ -24,10 +49,13 @@ namespace castor
 
 	LoggerInstance & LoggerInstance::operator=( LoggerInstance && rhs )
 	{
+		m_id = rhs.m_id;
 		m_logLevel = std::move( rhs.m_logLevel );
 		m_impl = std::move( rhs.m_impl );
 		m_headers = std::move( rhs.m_headers );
-		m_queue = std::move( rhs.m_queue );
+		m_buffers = std::move( rhs.m_buffers );
+		m_overflow = std::move( rhs.m_overflow );
+		m_dropped = rhs.m_dropped.load();
 		m_logThread = std::move( rhs.m_logThread );
 		m_initialised = rhs.m_initialised.load();
 		m_stopped = rhs.m_stopped.load();
@@ -45,7 +73,8 @@ namespace castor
 
 	LoggerInstance::LoggerInstance( ProgramConsole & console
 		, LogType logType )
-		: m_logLevel{ logType }
+		: m_id{ ++logger::instanceCount }
+		, m_logLevel{ logType }
 		, m_impl{ console, logType, *this }
 		, m_headers
 		{
@@ -83,7 +112,7 @@ namespace castor
 
 	void LoggerInstance::lockedLogTrace( LoggerInstance::my_string const & msg )
 	{
-		doLockedPushMessage( LogType::eTrace, msg, true );
+		doPushMessage( LogType::eTrace, msg, true );
 	}
 
 	void LoggerInstance::logTrace( LoggerInstance::my_string const & msg )
@@ -101,7 +130,7 @@ namespace castor
 
 	void LoggerInstance::lockedLogTraceNoLF( LoggerInstance::my_string const & msg )
 	{
-		doLockedPushMessage( LogType::eTrace, msg, false );
+		doPushMessage( LogType::eTrace, msg, false );
 	}
 
 	void LoggerInstance::logTraceNoLF( LoggerInstance::my_string const & msg )
@@ -119,7 +148,7 @@ namespace castor
 	
 	void LoggerInstance::lockedLogDebugNoLF( LoggerInstance::my_string const & msg )
 	{
-		doLockedPushMessage( LogType::eDebug, msg, false );
+		doPushMessage( LogType::eDebug, msg, false );
 	}
 	
 	void LoggerInstance::logDebugNoLF( LoggerInstance::my_string const & msg )
@@ -137,7 +166,7 @@ namespace castor
 
 	void LoggerInstance::lockedLogDebug( LoggerInstance::my_string const & msg )
 	{
-		doLockedPushMessage( LogType::eDebug, msg, true );
+		doPushMessage( LogType::eDebug, msg, true );
 	}
 
 	void LoggerInstance::logDebug( LoggerInstance::my_string const & msg )
@@ -155,7 +184,7 @@ namespace castor
 
 	void LoggerInstance::lockedLogInfoNoLF( LoggerInstance::my_string const & msg )
 	{
-		doLockedPushMessage( LogType::eInfo, msg, false );
+		doPushMessage( LogType::eInfo, msg, false );
 	}
 
 	void LoggerInstance::logInfoNoLF( LoggerInstance::my_string const & msg )
@@ -172,7 +201,7 @@ namespace castor
 
 	void LoggerInstance::lockedLogInfo( LoggerInstance::my_string const & msg )
 	{
-		doLockedPushMessage( LogType::eInfo, msg, true );
+		doPushMessage( LogType::eInfo, msg, true );
 	}
 
 	void LoggerInstance::logInfo( LoggerInstance::my_string const & msg )
@@ -189,7 +218,7 @@ namespace castor
 
 	void LoggerInstance::lockedLogWarningNoLF( LoggerInstance::my_string const & msg )
 	{
-		doLockedPushMessage( LogType::eWarning, msg, false );
+		doPushMessage( LogType::eWarning, msg, false );
 	}
 
 	void LoggerInstance::logWarningNoLF( LoggerInstance::my_string const & msg )
@@ -206,7 +235,7 @@ namespace castor
 
 	void LoggerInstance::lockedLogWarning( LoggerInstance::my_string const & msg )
 	{
-		doLockedPushMessage( LogType::eWarning, msg, true );
+		doPushMessage( LogType::eWarning, msg, true );
 	}
 
 	void LoggerInstance::logWarning( LoggerInstance::my_string const & msg )
@@ -223,7 +252,7 @@ namespace castor
 
 	void LoggerInstance::lockedLogErrorNoLF( LoggerInstance::my_string const & msg )
 	{
-		doLockedPushMessage( LogType::eError, msg, false );
+		doPushMessage( LogType::eError, msg, false );
 	}
 
 	void LoggerInstance::logErrorNoLF( LoggerInstance::my_string const & msg )
@@ -240,7 +269,7 @@ namespace castor
 
 	void LoggerInstance::lockedLogError( LoggerInstance::my_string const & msg )
 	{
-		doLockedPushMessage( LogType::eError, msg );
+		doPushMessage( LogType::eError, msg );
 	}
 
 	void LoggerInstance::logError( LoggerInstance::my_string const & msg )
@@ -257,23 +286,85 @@ namespace castor
 
 	void LoggerInstance::pushMessage( LogType logLevel, std::string const & message, bool newLine )
 	{
-		auto lock( makeUniqueLock( m_mutexQueue ) );
-		doLockedPushMessage( logLevel, message, newLine );
+		doPushMessage( logLevel, message, newLine );
 	}
 
 	void LoggerInstance::flushQueue()
 	{
-		MessageQueue queue;
+		// Single consumer of the record buffers.
+		auto flushLock( makeUniqueLock( m_mutexFlush ) );
+		std::vector< LogRecordBufferPtr > buffers;
+		MessageQueue overflow;
+		{
+			auto lock( makeUniqueLock( m_mutexBuffers ) );
+			buffers = m_buffers;
+		}
+		{
+			auto lock( makeUniqueLock( m_mutexOverflow ) );
+			std::swap( overflow, m_overflow );
+		}
+
+		std::vector< uint64_t > positions;
+		positions.reserve( buffers.size() );
+		uint64_t dropped{};
+		m_records.clear();
+
+		for ( auto & buffer : buffers )
+		{
+			dropped += buffer->exchangeDropped();
+			positions.push_back( buffer->read( [this]( LogRecord const & record )
+				{
+					m_records.push_back( record );
+				} ) );
+		}
+
+		for ( auto & message : overflow )
+		{
+			m_records.push_back( { message.m_time, message.m_type, message.m_newLine, message.m_message } );
+		}
+
+		std::string droppedMessage;
+
+		if ( dropped )
+		{
+			m_dropped += dropped;
+
+			if ( LogType::eWarning >= m_logLevel )
+			{
+				droppedMessage = "Logger: " + std::to_string( dropped ) + " message(s) dropped, their thread's buffer was full.";
+				m_records.push_back( { logger::getTime(), LogType::eWarning, true, droppedMessage } );
+			}
+		}
 
+		if ( !m_records.empty() )
 		{
-			auto lock( makeUniqueLock( m_mutexQueue ) );
-			std::swap( queue, m_queue );
+			// Each buffer is already sorted, this only interleaves the threads.
+			std::stable_sort( m_records.begin()
+				, m_records.end()
+				, []( LogRecord const & lhs, LogRecord const & rhs )
+				{
+					return lhs.time < rhs.time;
+				} );
+			m_impl.logRecords( m_records );
+			m_records.clear();
 		}
 
-		if ( !queue.empty() )
+		for ( size_t i = 0u; i < buffers.size(); ++i )
 		{
-			m_impl.logMessageQueue( queue );
+			buffers[i]->release( positions[i] );
 		}
+
+		buffers.clear();
+		auto lock( makeUniqueLock( m_mutexBuffers ) );
+		// Only the logger still references the buffers of the ended threads.
+		m_buffers.erase( std::remove_if( m_buffers.begin()
+				, m_buffers.end()
+				, []( LogRecordBufferPtr const & lookup )
+				{
+					return lookup.use_count() == 1
+						&& lookup->isEmpty();
+				} )
+			, m_buffers.end() );
 	}
 
 	void LoggerInstance::doInitialiseThread()
@@ -288,7 +379,16 @@ namespace castor
 				while ( !m_stopped )
 				{
 					flushQueue();
-					std::this_thread::sleep_for( Milliseconds( 100 ) );
+					// Producers wake the thread up when a buffer gets half full,
+					// a missed notification only delays the flush until the timeout.
+					auto lock( makeUniqueLock( m_mutexWake ) );
+					m_wake.wait_for( lock
+						, Milliseconds( 100 )
+						, [this]()
+						{
+							return m_wakeRequested || m_stopped;
+						} );
+					m_wakeRequested = false;
 				}
 
 				if ( m_initialised )
@@ -304,7 +404,11 @@ namespace castor
 	{
 		if ( !m_stopped )
 		{
-			m_stopped = true;
+			{
+				auto lock( makeUniqueLock( m_mutexWake ) );
+				m_stopped = true;
+			}
+			m_wake.notify_one();
 
 			while ( !m_threadEnded )
 			{
@@ -315,14 +419,71 @@ namespace castor
 		}
 	}
 
-	void LoggerInstance::doLockedPushMessage( LogType logLevel, std::string const & message, bool newLine )
+	void LoggerInstance::doPushMessage( LogType logLevel, std::string const & message, bool newLine )
 	{
-		if ( logLevel >= m_logLevel )
+		if ( logLevel < m_logLevel )
 		{
+			return;
+		}
+
 #if !defined( NDEBUG )
+		{
+			auto lock( makeUniqueLock( m_mutexPrint ) );
 			m_impl.printMessage( logLevel, message, newLine );
+		}
 #endif
-			m_queue.push_back( { logLevel, message, newLine } );
+
+		LogRecord record{ logger::getTime(), logLevel, newLine, message };
+		auto & buffer = doGetThreadBuffer();
+		bool wake{};
+
+		if ( buffer.fits( message.size() ) )
+		{
+			wake = !buffer.push( record )
+				|| buffer.isHalfFull();
+		}
+		else
+		{
+			auto lock( makeUniqueLock( m_mutexOverflow ) );
+			m_overflow.push_back( { logLevel, message, newLine, record.time } );
+			wake = true;
+		}
+
+		if ( wake && !m_wakeRequested.exchange( true ) )
+		{
+			m_wake.notify_one();
+		}
+	}
+
+	LogRecordBuffer & LoggerInstance::doGetThreadBuffer()
+	{
+		auto & threadBuffers = logger::threadBuffers;
+		auto it = std::find_if( threadBuffers.begin()
+			, threadBuffers.end()
+			, [this]( logger::ThreadBuffer const & lookup )
+			{
+				return lookup.instance == m_id;
+			} );
+
+		if ( it != threadBuffers.end() )
+		{
+			return *it->buffer;
+		}
+
+		// First message from this thread, drop the buffers of the destroyed loggers.
+		threadBuffers.erase( std::remove_if( threadBuffers.begin()
+				, threadBuffers.end()
+				, []( logger::ThreadBuffer const & lookup )
+				{
+					return lookup.buffer.use_count() == 1;
+				} )
+			, threadBuffers.end() );
+		auto buffer = std::make_shared< LogRecordBuffer >( ThreadBufferSize );
+		{
+			auto lock( makeUniqueLock( m_mutexBuffers ) );
+			m_buffers.push_back( buffer );
 		}
+		threadBuffers.push_back( { m_id, buffer } );
+		return *buffer;
 	}
 }
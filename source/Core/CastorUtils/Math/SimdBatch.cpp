@@ -0,0 +1,100 @@
+#include "CastorUtils/Math/SimdBatch.hpp"
+
+#include "CastorUtils/Math/SimdKernels.hpp"
+
+namespace castor::simd
+{
+	static_assert( sizeof( Matrix4x4f ) == 16u * sizeof( float ) );
+	static_assert( sizeof( Point3f ) == 3u * sizeof( float ) );
+	static_assert( sizeof( Point4f ) == 4u * sizeof( float ) );
+
+	void multiply( Matrix4x4f const & lhs
+		, Matrix4x4f const * rhs
+		, Matrix4x4f * result
+		, size_t count )
+	{
+		// Copied, in case it is one of the results.
+		Matrix4x4f const left{ lhs };
+
+		for ( size_t i = 0u; i < count; ++i )
+		{
+			mulMtx4( left.constPtr(), rhs[i].constPtr(), result[i].ptr() );
+		}
+	}
+
+	void multiply( Matrix4x4f const * lhs
+		, Matrix4x4f const * rhs
+		, Matrix4x4f * result
+		, size_t count )
+	{
+		for ( size_t i = 0u; i < count; ++i )
+		{
+			mulMtx4( lhs[i].constPtr(), rhs[i].constPtr(), result[i].ptr() );
+		}
+	}
+
+	void invert( Matrix4x4f const * input
+		, Matrix4x4f * result
+		, size_t count )
+	{
+		for ( size_t i = 0u; i < count; ++i )
+		{
+			invertMtx4( input[i].constPtr(), result[i].ptr() );
+		}
+	}
+
+	void transform( Matrix4x4f const & matrix
+		, Point3f const * input
+		, Point3f * result
+		, size_t count )
+	{
+		if ( count )
+		{
+			transformPoints3( matrix.constPtr(), input->constPtr(), result->ptr(), count );
+		}
+	}
+
+	void transform( Matrix4x4f const & matrix
+		, Point4f const * input
+		, Point4f * result
+		, size_t count )
+	{
+		if ( count )
+		{
+			transformPoints4( matrix.constPtr(), input->constPtr(), result->ptr(), count );
+		}
+	}
+
+	void multiply( Quaternion const * lhs
+		, Quaternion const * rhs
+		, Quaternion * result
+		, size_t count )
+	{
+		for ( size_t i = 0u; i < count; ++i )
+		{
+			mulQuat( lhs[i].constPtr(), rhs[i].constPtr(), result[i].ptr() );
+		}
+	}
+
+	void slerp( Quaternion const * lhs
+		, Quaternion const * rhs
+		, float factor
+		, Quaternion * result
+		, size_t count )
+	{
+		for ( size_t i = 0u; i < count; ++i )
+		{
+			slerpQuat( lhs[i].constPtr(), rhs[i].constPtr(), factor, result[i].ptr() );
+		}
+	}
+
+	void toMatrix( Quaternion const * input
+		, Matrix4x4f * result
+		, size_t count )
+	{
+		for ( size_t i = 0u; i < count; ++i )
+		{
+			quatToMtx4( input[i].constPtr(), result[i].ptr() );
+		}
+	}
+}
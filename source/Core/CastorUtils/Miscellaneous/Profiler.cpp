@@ -0,0 +1,337 @@
+#include "CastorUtils/Miscellaneous/Profiler.hpp"
+
+#include "CastorUtils/Config/MultiThreadConfig.hpp"
+#include "CastorUtils/Log/Logger.hpp"
+
+#include <fstream>
+#include <iomanip>
+
+namespace castor
+{
+	namespace prof
+	{
+		static uint32_t constexpr FramesThreadId = 0u;
+		static uint32_t constexpr GpuThreadId = 1u;
+		static uint32_t constexpr FirstThreadId = 2u;
+
+		static void writeString( std::ostream & stream
+			, std::string_view text )
+		{
+			stream << '"';
+
+			for ( auto c : text )
+			{
+				switch ( c )
+				{
+				case '"':
+					stream << "\\\"";
+					break;
+				case '\\':
+					stream << "\\\\";
+					break;
+				default:
+					if ( uint8_t( c ) < 0x20u )
+					{
+						stream << ' ';
+					}
+					else
+					{
+						stream << c;
+					}
+					break;
+				}
+			}
+
+			stream << '"';
+		}
+
+		static void writeTime( std::ostream & stream
+			, int64_t time )
+		{
+			// Trace event times are in microseconds.
+			stream << ( time / 1000 ) << '.' << std::setw( 3 ) << std::setfill( '0' ) << ( time % 1000 ) << std::setfill( ' ' );
+		}
+
+		static void writeThreadName( std::ostream & stream
+			, uint32_t thread
+			, std::string_view name )
+		{
+			stream << ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" << thread << ",\"args\":{\"name\":";
+			writeString( stream, name );
+			stream << "}}";
+			stream << ",\n{\"name\":\"thread_sort_index\",\"ph\":\"M\",\"pid\":0,\"tid\":" << thread << ",\"args\":{\"sort_index\":" << thread << "}}";
+		}
+
+		static void writeZone( std::ostream & stream
+			, uint32_t thread
+			, std::string_view category
+			, std::string_view name
+			, int64_t begin
+			, int64_t duration
+			, uint32_t depth )
+		{
+			stream << ",\n{\"name\":";
+			writeString( stream, name );
+			stream << ",\"cat\":\"" << category << "\",\"ph\":\"X\",\"pid\":0,\"tid\":" << thread << ",\"ts\":";
+			writeTime( stream, begin );
+			stream << ",\"dur\":";
+			writeTime( stream, duration );
+			stream << ",\"args\":{\"depth\":" << depth << "}}";
+		}
+	}
+
+	//*********************************************************************************************
+
+	Profiler::Profiler()
+		: m_epoch{ Clock::now() }
+		, m_frames( FramesCount )
+	{
+	}
+
+	Profiler::~Profiler()noexcept = default;
+
+	Profiler & Profiler::getSingleton()
+	{
+		static Profiler result;
+		return result;
+	}
+
+	void Profiler::setEnabled( bool enable )
+	{
+		auto lock( makeUniqueLock( m_mutex ) );
+
+		if ( m_captureRemaining )
+		{
+			// The state is restored at the end of the capture.
+			m_enabledBeforeCapture = enable;
+			return;
+		}
+
+		m_enabled = enable;
+	}
+
+	void Profiler::setThreadName( String const & name )
+	{
+		auto & thread = doGetThreadZones();
+		auto lock( makeUniqueLock( thread.mutex ) );
+		thread.name = name;
+	}
+
+	uint32_t Profiler::beginZone()
+	{
+		return doGetThreadZones().depth++;
+	}
+
+	void Profiler::endZone( char const * name
+		, int64_t begin
+		, uint32_t depth )
+	{
+		auto end = now();
+		auto & thread = doGetThreadZones();
+		thread.depth = depth;
+		auto lock( makeUniqueLock( thread.mutex ) );
+
+		if ( thread.zones.empty() )
+		{
+			thread.zones.resize( ZonesPerThread );
+		}
+
+		thread.zones[thread.next % ZonesPerThread] = { name, begin, end, depth };
+		++thread.next;
+	}
+
+	void Profiler::beginFrame()
+	{
+		if ( !isEnabled() )
+		{
+			return;
+		}
+
+		auto lock( makeUniqueLock( m_mutex ) );
+		auto & frame = m_frames[m_frameIndex % FramesCount];
+		frame.index = m_frameIndex++;
+		frame.begin = now();
+		frame.end = frame.begin;
+		frame.gpuZones.clear();
+		m_inFrame = true;
+	}
+
+	void Profiler::endFrame()
+	{
+		Path capturePath;
+		uint32_t captureCount{};
+		{
+			auto lock( makeUniqueLock( m_mutex ) );
+
+			if ( !m_inFrame )
+			{
+				return;
+			}
+
+			m_frames[( m_frameIndex - 1u ) % FramesCount].end = now();
+			m_inFrame = false;
+
+			if ( m_captureRemaining && --m_captureRemaining == 0u )
+			{
+				m_enabled = m_enabledBeforeCapture;
+				capturePath = m_capturePath;
+				captureCount = m_captureCount;
+			}
+		}
+
+		if ( captureCount )
+		{
+			doWriteCapture( capturePath, captureCount );
+		}
+	}
+
+	void Profiler::addGpuZone( String const & name
+		, Nanoseconds duration )
+	{
+		auto lock( makeUniqueLock( m_mutex ) );
+
+		if ( m_inFrame )
+		{
+			m_frames[( m_frameIndex - 1u ) % FramesCount].gpuZones.push_back( { name, duration.count() } );
+		}
+	}
+
+	void Profiler::captureFrames( Path const & file
+		, uint32_t frameCount )
+	{
+		auto lock( makeUniqueLock( m_mutex ) );
+
+		if ( !m_captureRemaining )
+		{
+			m_enabledBeforeCapture = m_enabled;
+		}
+
+		m_capturePath = file;
+		m_captureCount = std::max( 1u, std::min( frameCount, uint32_t( FramesCount - 1u ) ) );
+		// The frame in progress is incomplete, it isn't part of the capture.
+		m_captureRemaining = m_captureCount + ( m_inFrame ? 1u : 0u );
+		m_enabled = true;
+	}
+
+	bool Profiler::writeChromeTrace( std::ostream & stream
+		, uint32_t frameCount )const
+	{
+		std::vector< Frame > frames;
+		std::vector< ThreadZonesPtr > threads;
+		{
+			auto lock( makeUniqueLock( m_mutex ) );
+			// The frame in progress is incomplete, it isn't exported.
+			auto completed = m_inFrame
+				? m_frameIndex - 1u
+				: m_frameIndex;
+			auto count = std::min( { uint64_t( frameCount ), completed, uint64_t( FramesCount - 1u ) } );
+
+			for ( auto index = completed - count; index < completed; ++index )
+			{
+				frames.push_back( m_frames[index % FramesCount] );
+			}
+
+			threads = m_threads;
+		}
+
+		if ( frames.empty() )
+		{
+			return false;
+		}
+
+		auto rangeBegin = frames.front().begin;
+		auto rangeEnd = frames.back().end;
+		stream << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+		stream << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":0,\"args\":{\"name\":\"Castor3D\"}}";
+		prof::writeThreadName( stream, prof::FramesThreadId, "Frames" );
+		prof::writeThreadName( stream, prof::GpuThreadId, "GPU passes" );
+
+		for ( auto & frame : frames )
+		{
+			prof::writeZone( stream, prof::FramesThreadId, "frame", "Frame " + std::to_string( frame.index ), frame.begin, frame.end - frame.begin, 0u );
+			// Only the passes durations are known, they are laid out one after the other from the frame start.
+			auto begin = frame.begin;
+
+			for ( auto & zone : frame.gpuZones )
+			{
+				prof::writeZone( stream, prof::GpuThreadId, "gpu", zone.name, begin, zone.duration, 0u );
+				begin += zone.duration;
+			}
+		}
+
+		std::vector< Zone > zones;
+
+		for ( auto & thread : threads )
+		{
+			String name;
+			zones.clear();
+			{
+				auto lock( makeUniqueLock( thread->mutex ) );
+				name = thread->name;
+				auto count = std::min( thread->next, ZonesPerThread );
+
+				for ( size_t i = thread->next - count; i < thread->next; ++i )
+				{
+					auto & zone = thread->zones[i % ZonesPerThread];
+
+					if ( zone.end >= rangeBegin
+						&& zone.begin <= rangeEnd )
+					{
+						zones.push_back( zone );
+					}
+				}
+			}
+
+			if ( zones.empty() )
+			{
+				continue;
+			}
+
+			prof::writeThreadName( stream, thread->id, name.empty()
+				? "Thread " + std::to_string( thread->id - prof::FirstThreadId )
+				: name );
+
+			for ( auto & zone : zones )
+			{
+				prof::writeZone( stream, thread->id, "cpu", zone.name, zone.begin, zone.end - zone.begin, zone.depth );
+			}
+		}
+
+		stream << "\n]}\n";
+		return bool( stream );
+	}
+
+	Profiler::ThreadZones & Profiler::doGetThreadZones()
+	{
+		static thread_local ThreadZonesPtr result;
+
+		if ( !result )
+		{
+			// The zones storage is only allocated when the thread records its first zone.
+			auto thread = std::make_shared< ThreadZones >();
+			auto lock( makeUniqueLock( m_mutex ) );
+			thread->id = uint32_t( m_threads.size() ) + prof::FirstThreadId;
+			m_threads.push_back( thread );
+			result = std::move( thread );
+		}
+
+		return *result;
+	}
+
+	void Profiler::doWriteCapture( Path const & path
+		, uint32_t frameCount )const
+	{
+		std::ofstream file{ path };
+
+		if ( !file )
+		{
+			Logger::logError( cuT( "Profiler: Couldn't open capture file [" ) + path + cuT( "]." ) );
+			return;
+		}
+
+		if ( writeChromeTrace( file, frameCount ) )
+		{
+			Logger::logInfo( cuT( "Profiler: Captured " ) + string::toString( frameCount ) + cuT( " frame(s) to [" ) + path + cuT( "]." ) );
+		}
+	}
+}
@@ -0,0 +1,168 @@
+#include "CastorUtils/Multithreading/TaskPool.hpp"
+
+#include "CastorUtils/Config/MultiThreadConfig.hpp"
+#include "CastorUtils/Miscellaneous/Profiler.hpp"
+
+namespace castor
+{
+	namespace tskpool
+	{
+		static thread_local TaskPool const * currentPool = nullptr;
+
+		struct PoolScope
+		{
+			explicit PoolScope( TaskPool const * pool )
+				: previous{ currentPool }
+			{
+				currentPool = pool;
+			}
+
+			~PoolScope()noexcept
+			{
+				currentPool = previous;
+			}
+
+			PoolScope( PoolScope const & ) = delete;
+			PoolScope & operator=( PoolScope const & ) = delete;
+
+			TaskPool const * previous;
+		};
+	}
+
+	TaskPool::TaskPool( uint32_t count )
+	{
+		m_workers.reserve( count );
+
+		for ( uint32_t i = 0u; i < count; ++i )
+		{
+			m_workers.emplace_back( [this]()
+				{
+					doRun();
+				} );
+		}
+	}
+
+	TaskPool::~TaskPool()noexcept
+	{
+		{
+			auto lock( makeUniqueLock( m_mutex ) );
+			m_stopped = true;
+		}
+		m_start.notify_all();
+
+		for ( auto & worker : m_workers )
+		{
+			worker.join();
+		}
+	}
+
+	void TaskPool::parallelFor( uint32_t count
+		, Task const & task )
+	{
+		if ( count == 0u )
+		{
+			return;
+		}
+
+		if ( m_workers.empty()
+			|| count == 1u
+			|| tskpool::currentPool == this )
+		{
+			for ( uint32_t i = 0u; i < count; ++i )
+			{
+				task( i );
+			}
+
+			return;
+		}
+
+		auto runLock( makeUniqueLock( m_runMutex ) );
+		{
+			auto lock( makeUniqueLock( m_mutex ) );
+			m_task = &task;
+			m_count = count;
+			m_next = 0u;
+			m_exception = nullptr;
+			m_running = uint32_t( m_workers.size() );
+			++m_generation;
+		}
+		m_start.notify_all();
+		doProcess();
+
+		auto lock( makeUniqueLock( m_mutex ) );
+		m_end.wait( lock, [this]()
+			{
+				return m_running == 0u;
+			} );
+		m_task = nullptr;
+
+		if ( m_exception )
+		{
+			auto exception = m_exception;
+			m_exception = nullptr;
+			std::rethrow_exception( exception );
+		}
+	}
+
+	void TaskPool::doRun()
+	{
+		Profiler::getSingleton().setThreadName( cuT( "TaskPool worker" ) );
+		uint64_t generation{ 0u };
+
+		while ( true )
+		{
+			{
+				auto lock( makeUniqueLock( m_mutex ) );
+				m_start.wait( lock, [this, &generation]()
+					{
+						return m_stopped || m_generation != generation;
+					} );
+
+				if ( m_stopped )
+				{
+					return;
+				}
+
+				generation = m_generation;
+			}
+
+			doProcess();
+			bool last{};
+			{
+				auto lock( makeUniqueLock( m_mutex ) );
+				last = ( --m_running == 0u );
+			}
+
+			if ( last )
+			{
+				m_end.notify_one();
+			}
+		}
+	}
+
+	void TaskPool::doProcess()
+	{
+		CU_ProfileZone( "TaskPool::process" );
+		tskpool::PoolScope scope{ this };
+		auto index = m_next++;
+
+		while ( index < m_count )
+		{
+			try
+			{
+				( *m_task )( index );
+			}
+			catch ( ... )
+			{
+				auto lock( makeUniqueLock( m_mutex ) );
+
+				if ( !m_exception )
+				{
+					m_exception = std::current_exception();
+				}
+			}
+
+			index = m_next++;
+		}
+	}
+}
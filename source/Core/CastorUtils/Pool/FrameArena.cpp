@@ -0,0 +1,104 @@
+#include "CastorUtils/Pool/FrameArena.hpp"
+
+namespace castor
+{
+	FrameArena::FrameArena( size_t blockSize
+		, std::pmr::memory_resource * upstream )
+		: m_upstream{ upstream }
+		, m_blockSize{ blockSize }
+	{
+		doAllocateBlock( m_blockSize );
+		m_upstreamAllocationCount = 0u;
+	}
+
+	FrameArena::~FrameArena()noexcept
+	{
+		doReleaseBlocks();
+	}
+
+	void FrameArena::reset()
+	{
+		if ( m_blocks.size() > 1u )
+		{
+			auto capacity = m_capacity;
+			doReleaseBlocks();
+			doAllocateBlock( capacity );
+		}
+
+		m_current = 0u;
+		m_offset = 0u;
+		m_allocationCount = 0u;
+		m_allocatedSize = 0u;
+		m_upstreamAllocationCount = 0u;
+	}
+
+	void * FrameArena::do_allocate( size_t bytes
+		, size_t alignment )
+	{
+		++m_allocationCount;
+		m_allocatedSize += bytes;
+
+		while ( m_current < m_blocks.size() )
+		{
+			if ( auto result = doAllocate( m_blocks[m_current], bytes, alignment ) )
+			{
+				return result;
+			}
+
+			++m_current;
+			m_offset = 0u;
+		}
+
+		// The extra size makes sure the allocation fits, whatever the block address.
+		doAllocateBlock( std::max( m_blockSize, bytes + alignment ) );
+		m_current = m_blocks.size() - 1u;
+		return doAllocate( m_blocks[m_current], bytes, alignment );
+	}
+
+	void FrameArena::do_deallocate( void * CU_UnusedParam( ptr )
+		, size_t CU_UnusedParam( bytes )
+		, size_t CU_UnusedParam( alignment ) )
+	{
+		// Memory is only reclaimed by reset().
+	}
+
+	bool FrameArena::do_is_equal( std::pmr::memory_resource const & other )const noexcept
+	{
+		return this == &other;
+	}
+
+	void FrameArena::doAllocateBlock( size_t size )
+	{
+		auto data = static_cast< std::byte * >( m_upstream->allocate( size, alignof( std::max_align_t ) ) );
+		m_blocks.push_back( { data, size } );
+		m_capacity += size;
+		++m_upstreamAllocationCount;
+	}
+
+	void * FrameArena::doAllocate( Block const & block
+		, size_t bytes
+		, size_t alignment )
+	{
+		auto address = reinterpret_cast< uintptr_t >( block.data ) + m_offset;
+		auto offset = m_offset + size_t( ( ( address + alignment - 1u ) & ~uintptr_t( alignment - 1u ) ) - address );
+
+		if ( offset + bytes > block.size )
+		{
+			return nullptr;
+		}
+
+		m_offset = offset + bytes;
+		return block.data + offset;
+	}
+
+	void FrameArena::doReleaseBlocks()
+	{
+		for ( auto & block : m_blocks )
+		{
+			m_upstream->deallocate( block.data, block.size, alignof( std::max_align_t ) );
+		}
+
+		m_blocks.clear();
+		m_capacity = 0u;
+	}
+}
@@ -31,6 +31,7 @@ namespace castor
 				result = writeName( file, "parent", geometry.getParent()->getName() )
 					&& writeOpt( file, cuT( "cast_shadows" ), geometry.isShadowCaster(), true )
 					&& writeOpt( file, cuT( "receive_shadows" ), geometry.isShadowReceiver(), true )
+					&& writeOpt( file, cuT( "occluder" ), geometry.isOccluder(), false )
 					&& writeName( file, cuT( "mesh" ), mesh->getName() );
 
 				if ( result )
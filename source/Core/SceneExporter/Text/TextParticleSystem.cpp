@@ -28,6 +28,7 @@ namespace castor
 		{
 			result = writeName( file, "parent", obj.getParent()->getName() )
 				&& write( file, cuT( "particles_count" ), obj.getMaxParticlesCount() )
+				&& writeOpt( file, cuT( "seed" ), obj.getSeed(), 0u )
 				&& writeNamedSub( file, cuT( "dimensions" ), obj.getDimensions() )
 				&& writeName( file, cuT( "material" ), obj.getMaterial()->getName() );
 
@@ -388,6 +388,11 @@ namespace castor
 					result = writeNamedSub( file, cuT( "ambient_light" ), scene.getAmbientLight() )
 						&& writeNamedSub( file, cuT( "background_colour" ), scene.getBackgroundColour() )
 						&& write( file, cuT( "lpv_indirect_attenuation" ), scene.getLpvIndirectAttenuation() )
+						&& writeOpt( file, cuT( "lod_bias" ), scene.getLodBias(), 0.0f )
+						&& writeOpt( file, cuT( "shadow_lod_bias" ), scene.getShadowLodBias(), 1.0f )
+						&& writeOpt( file, cuT( "shadow_update_budget" ), scene.getShadowUpdateBudget(), 0u )
+						&& writeOpt( file, cuT( "directional_shadow_fitting" ), scene.isDirectionalShadowFitted(), false )
+						&& writeOpt( file, cuT( "directional_shadow_reuse_tolerance" ), scene.getDirectionalShadowReuseTolerance(), 0.0f )
 						&& txtscn::writeIncludedView( file, scene.getFontView(), cuT( "Fonts" ), m_options.sceneFontsFile, *this, txtscn::writable< castor::Font >, m_options.rootFolder )
 						&& txtscn::writeInclude( file, m_options.sceneTexturesFile, *this )
 						&& txtscn::writeInclude( file, m_options.sceneSamplersFile, *this )
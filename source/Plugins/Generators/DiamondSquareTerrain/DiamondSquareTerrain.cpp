@@ -132,10 +132,12 @@ namespace diamond_square_terrain
 			Matrix heightMap{ size };
 			auto max = size - 1;
 			auto engine = gen::createRandomEngine( disableRandomSeed );
+			auto & pool = mesh.getEngine()->getTaskPool();
 			generateHeightMap( island
 				, engine
 				, max
 				, size
+				, pool
 				, heightMap );
 
 			auto zeroPoint = heightRange.percent( 0.0f );
@@ -147,33 +149,47 @@ namespace diamond_square_terrain
 				return s * ( float( v ) - float( max ) / 2.0f );
 			};
 
-			std::map< uint32_t, uint32_t > vertexMap;
-			uint32_t index{};
-
-			for ( auto z = 1u; z < max; z++ )
-			{
-				for ( auto x = 1u; x < max; x++ )
+			// The vertices are laid out row by row, in [1, max[ on both axes.
+			auto rowSize = max - 1u;
+			submeshBuffers.positions.resize( size_t( rowSize ) * rowSize );
+			submeshBuffers.texcoords0.resize( size_t( rowSize ) * rowSize );
+			parallelForRows( pool
+				, rowSize
+				, rowSize
+				, [&]( uint32_t begin, uint32_t end )
 				{
-					vertexMap.emplace( heightMap.getIndex( x, z ), index++ );
-					submeshBuffers.positions.emplace_back( transform( x, xScale ), heightRange.value( heightMap( x, z ) ), transform( z, zScale ) );
-					submeshBuffers.texcoords0.emplace_back( float( x ) / uScale, float( z ) / vScale, 0.0f );
-				}
-			}
-
-			castor3d::FaceArray faces;
-
-			for ( auto y = 1u; y < max - 2; y++ )
-			{
-				for ( auto x = 1u; x < max - 2; x++ )
+					for ( auto z = begin + 1u; z <= end; z++ )
+					{
+						for ( auto x = 1u; x < max; x++ )
+						{
+							auto index = ( z - 1u ) * rowSize + ( x - 1u );
+							submeshBuffers.positions[index] = castor::Point3f{ transform( x, xScale ), heightRange.value( heightMap( x, z ) ), transform( z, zScale ) };
+							submeshBuffers.texcoords0[index] = castor::Point3f{ float( x ) / uScale, float( z ) / vScale, 0.0f };
+						}
+					}
+				} );
+
+			auto quadsRowSize = max > 3u ? max - 3u : 0u;
+			castor3d::FaceArray faces( size_t( quadsRowSize ) * quadsRowSize * 2u );
+			parallelForRows( pool
+				, quadsRowSize
+				, quadsRowSize
+				, [&]( uint32_t begin, uint32_t end )
 				{
-					faces.emplace_back( heightMap.getIndex( x, y, size - 2 )
-						, heightMap.getIndex( x, y + 1, size - 2 )
-						, heightMap.getIndex( x + 1, y, size - 2 ) );
-					faces.emplace_back( heightMap.getIndex( x + 1, y, size - 2 )
-						, heightMap.getIndex( x, y + 1, size - 2 )
-						, heightMap.getIndex( x + 1, y + 1, size - 2 ) );
-				}
-			}
+					for ( auto y = begin + 1u; y <= end; y++ )
+					{
+						for ( auto x = 1u; x <= quadsRowSize; x++ )
+						{
+							auto index = 2u * ( ( y - 1u ) * quadsRowSize + ( x - 1u ) );
+							faces[index] = castor3d::Face{ heightMap.getIndex( x, y, size - 2 )
+								, heightMap.getIndex( x, y + 1, size - 2 )
+								, heightMap.getIndex( x + 1, y, size - 2 ) };
+							faces[index + 1u] = castor3d::Face{ heightMap.getIndex( x + 1, y, size - 2 )
+								, heightMap.getIndex( x, y + 1, size - 2 )
+								, heightMap.getIndex( x + 1, y + 1, size - 2 ) };
+						}
+					}
+				} );
 
 			submeshBuffers.normals.resize( submeshBuffers.positions.size() );
 			submeshBuffers.tangents.resize( submeshBuffers.positions.size() );
@@ -193,7 +209,7 @@ namespace diamond_square_terrain
 				, heightMap
 				, m_biomes
 				, faces
-				, vertexMap
+				, pool
 				, submeshBuffers );
 
 			auto submesh = mesh.createSubmesh();
@@ -4,8 +4,10 @@ See LICENSE file in root folder
 #ifndef ___C3D_DiamondSquareTerrainPrerequisites_H___
 #define ___C3D_DiamondSquareTerrainPrerequisites_H___
 
+#include <CastorUtils/Exception/Assertion.hpp>
 #include <CastorUtils/Math/Point.hpp>
 #include <CastorUtils/Math/Range.hpp>
+#include <CastorUtils/Multithreading/TaskPool.hpp>
 
 #include <random>
 #include <vector>
@@ -58,33 +60,25 @@ namespace diamond_square_terrain
 
 		float & operator[]( uint32_t index )
 		{
-			if ( index >= m_map.size() )
-			{
-				static float dummy = -1;
-				return dummy;
-			}
-
+			CU_Require( index < m_map.size() );
 			return m_map[index];
 		}
 
 		float & operator()( uint32_t x, uint32_t y )
 		{
+			CU_Require( x < m_size && y < m_size );
 			return operator[]( getIndex( x, y ) );
 		}
 
 		float const & operator[]( uint32_t index )const
 		{
-			if ( index >= m_map.size() )
-			{
-				static float dummy = -1;
-				return dummy;
-			}
-
+			CU_Require( index < m_map.size() );
 			return m_map[index];
 		}
 
 		float const & operator()( uint32_t x, uint32_t y )const
 		{
+			CU_Require( x < m_size && y < m_size );
 			return operator[]( getIndex( x, y ) );
 		}
 
@@ -92,6 +86,32 @@ namespace diamond_square_terrain
 		std::vector< float > m_map;
 		uint32_t m_size;
 	};
+
+	// Minimal cells count processed by one task.
+	static uint32_t constexpr MinCellsPerTask = 16u * 1024u;
+
+	/**
+	 *\~english
+	 *\brief		Calls \p function( begin, end ) on chunks of the rows in [0, count), in parallel.
+	 *\param[in]	rowSize	The cells count of a row, used to size the chunks.
+	 *\~french
+	 *\brief		Appelle \p function( begin, end ) sur des blocs des lignes dans [0, count), en parallèle.
+	 *\param[in]	rowSize	Le nombre de cellules d'une ligne, utilisé pour dimensionner les blocs.
+	 */
+	template< typename FuncT >
+	void parallelForRows( castor::TaskPool & pool
+		, uint32_t count
+		, uint32_t rowSize
+		, FuncT const & function )
+	{
+		auto rowsPerTask = std::max( 1u, MinCellsPerTask / std::max( 1u, rowSize ) );
+		pool.parallelFor( ( count + rowsPerTask - 1u ) / rowsPerTask
+			, [&function, count, rowsPerTask]( uint32_t index )
+			{
+				function( index * rowsPerTask
+					, std::min( count, ( index + 1u ) * rowsPerTask ) );
+			} );
+	}
 }
 
 #endif
@@ -162,36 +162,62 @@ namespace diamond_square_terrain
 		}
 
 		static Matrix generateNoiseMap( std::default_random_engine engine
-			, uint32_t width )
+			, uint32_t width
+			, castor::TaskPool & pool )
 		{
 			Matrix result{ width };
 			auto fractal = castor::makeFractalNoise( castor3d::getMipLevels( { width, width, 1u }, VK_FORMAT_R8G8B8A8_UNORM )
 				, castor::PerlinNoiseT< double >{ engine } );
+			auto rowsPerTask = std::max( 1u, MinCellsPerTask / width );
+			std::vector< castor::Range< float > > ranges( ( width + rowsPerTask - 1u ) / rowsPerTask
+				, castor::Range< float >{ 0.0f, 1.0f } );
+			parallelForRows( pool
+				, width
+				, width
+				, [&result, &fractal, &ranges, width, rowsPerTask]( uint32_t begin, uint32_t end )
+				{
+					auto yMin = std::numeric_limits< float >::max();
+					auto yMax = std::numeric_limits< float >::lowest();
+
+					for ( auto x = begin; x < end; x++ )
+					{
+						for ( auto y = 0u; y < width; y++ )
+						{
+							auto nx = float( x ) / float( width );
+							auto ny = float( y ) / float( width );
+							auto v = float( fractal.noise( nx, ny, 0.0f ) );
+							result( x, y ) = v;
+							yMin = std::min( v, yMin );
+							yMax = std::max( v, yMax );
+						}
+					}
+
+					ranges[begin / rowsPerTask] = castor::makeRange( yMin, yMax );
+				} );
+
 			auto yMin = std::numeric_limits< float >::max();
 			auto yMax = std::numeric_limits< float >::lowest();
 
-			for ( auto x = 0u; x < width; x++ )
+			for ( auto & range : ranges )
 			{
-				for ( auto y = 0u; y < width; y++ )
-				{
-					auto nx = float( x ) / float( width );
-					auto ny = float( y ) / float( width );
-					auto v = float( fractal.noise( nx, ny, 0.0f ) );
-					result( x, y ) = v;
-					yMin = std::min( v, yMin );
-					yMax = std::max( v, yMax );
-				}
+				yMin = std::min( range.getMin(), yMin );
+				yMax = std::max( range.getMax(), yMax );
 			}
 
 			auto range = castor::makeRange( yMin, yMax );
-
-			for ( auto x = 0u; x < width; x++ )
-			{
-				for ( auto y = 0u; y < width; y++ )
+			parallelForRows( pool
+				, width
+				, width
+				, [&result, &range, width]( uint32_t begin, uint32_t end )
 				{
-					result( x, y ) = range.percent( result( x, y ) ) - 0.5f;
-				}
-			}
+					for ( auto x = begin; x < end; x++ )
+					{
+						for ( auto y = 0u; y < width; y++ )
+						{
+							result( x, y ) = range.percent( result( x, y ) ) - 0.5f;
+						}
+					}
+				} );
 
 			return result;
 		}
@@ -205,7 +231,7 @@ namespace diamond_square_terrain
 		, Matrix const & heightMap
 		, Biomes biomes
 		, castor3d::FaceArray const & faces
-		, std::map< uint32_t, uint32_t > const & vertexMap
+		, castor::TaskPool & pool
 		, castor3d::SubmeshAnimationBuffer & submesh )
 	{
 		bool areMaterial = !biomes.empty();
@@ -290,50 +316,56 @@ namespace diamond_square_terrain
 		}
 
 		auto ranges = buildBlendRanges( biomes );
-		auto noiseMap = biomes::generateNoiseMap( engine, size );
+		auto noiseMap = biomes::generateNoiseMap( engine, size, pool );
 		auto & normals = submesh.normals;
+		// The vertices are laid out row by row, in [1, max[ on both axes.
+		auto rowSize = max - 1u;
+		auto process = [&]( auto & values
+			, auto getValue )
+		{
+			values.resize( size_t( rowSize ) * rowSize );
+			parallelForRows( pool
+				, rowSize
+				, rowSize
+				, [&]( uint32_t begin, uint32_t end )
+				{
+					for ( auto z = begin + 1u; z <= end; z++ )
+					{
+						for ( auto x = 1u; x < max; x++ )
+						{
+							auto vertex = ( z - 1u ) * rowSize + ( x - 1u );
+							auto height = biomes::alterHeight( heightMap( x, z ) + heatOffset
+								, zeroPoint
+								, x, z
+								, noiseMap );
+							auto steepness = std::abs( normals[vertex]->z );
+							values[vertex] = getValue( height, steepness );
+						}
+					}
+				} );
+		};
 
 		if ( areMaterial )
 		{
-			auto & passMasks = submesh.passMasks;
-
-			for ( auto z = 1u; z < max; z++ )
-			{
-				for ( auto x = 1u; x < max; x++ )
+			process( submesh.passMasks
+				, [&ranges, &biomes]( float height, float steepness )
 				{
-					auto index = heightMap.getIndex( x, z );
-					auto height = biomes::alterHeight( heightMap[index] + heatOffset
-						, zeroPoint
-						, x, z
-						, noiseMap );
-					auto steepness = std::abs( normals[vertexMap.find( index )->second]->z );
-					passMasks.push_back( biomes::getPassMasks( height
+					return biomes::getPassMasks( height
 						, steepness
 						, ranges
-						, biomes ) );
-				}
-			}
+						, biomes );
+				} );
 		}
 		else
 		{
-			auto & colours = submesh.colours;
-
-			for ( auto z = 1u; z < max; z++ )
-			{
-				for ( auto x = 1u; x < max; x++ )
+			process( submesh.colours
+				, [&ranges, &biomes]( float height, float steepness )
 				{
-					auto index = heightMap.getIndex( x, z );
-					auto height = biomes::alterHeight( heightMap[index] + heatOffset
-						, zeroPoint
-						, x, z
-						, noiseMap );
-					auto steepness = std::abs( normals[vertexMap.find( index )->second]->z );
-					colours.push_back( biomes::getColour( height
+					return biomes::getColour( height
 						, steepness
 						, ranges
-						, biomes ) );
-				}
-			}
+						, biomes );
+				} );
 		}
 	}
 }
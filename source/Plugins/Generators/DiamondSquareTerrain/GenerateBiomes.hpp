@@ -100,7 +100,7 @@ namespace diamond_square_terrain
 		, Matrix const & heightMap
 		, Biomes biomes
 		, castor3d::FaceArray const & faces
-		, std::map< uint32_t, uint32_t > const & vertexMap
+		, castor::TaskPool & pool
 		, castor3d::SubmeshAnimationBuffer & submesh );
 }
 
@@ -2,83 +2,221 @@
 
 namespace diamond_square_terrain
 {
+	namespace hm
+	{
+		// Tiles size, in steps, used by the diamond and square passes.
+		static uint32_t constexpr TileSize = 64u;
+
+		// The random values only depend on the seed and the written cell, not on the processing order,
+		// so that the results are reproducible whatever the threads count.
+		static float random( uint32_t seed
+			, uint32_t level
+			, uint32_t pass
+			, uint32_t x
+			, uint32_t y )
+		{
+			auto hash = seed
+				^ ( x * 0x8da6b343u )
+				^ ( y * 0xd8163841u )
+				^ ( ( level * 4u + pass ) * 0xcb1ab31fu );
+			hash ^= hash >> 16u;
+			hash *= 0x85ebca6bu;
+			hash ^= hash >> 13u;
+			hash *= 0xc2b2ae35u;
+			hash ^= hash >> 16u;
+			// 24 bits mantissa, in [-1, 1[.
+			return float( hash >> 8u ) / float( 1u << 23u ) - 1.0f;
+		}
+
+		/**
+		 *\~english
+		 *\brief		Calls \p function( i, j ) for each i and j in [first, end), by \p step, processing tiles in parallel.
+		 *\param[in]	dependent	Tells if the iterations read the cells written by the previous ones.
+		 *							In that case, the tiles are processed by waves (tiles of the same wave don't depend on each other),
+		 *							giving the same results as the serial loops.
+		 *\~french
+		 *\brief		Appelle \p function( i, j ) pour chaque i et j dans [first, end), par \p step, en traitant les tuiles en parallèle.
+		 *\param[in]	dependent	Dit si les itérations lisent les cellules écrites par les précédentes.
+		 *							Dans ce cas, les tuiles sont traitées par vagues (les tuiles d'une même vague ne dépendent pas les unes des autres),
+		 *							ce qui donne les mêmes résultats que les boucles séquentielles.
+		 */
+		template< typename FuncT >
+		static void forEachTile( castor::TaskPool & pool
+			, uint32_t first
+			, uint32_t end
+			, uint32_t step
+			, bool dependent
+			, FuncT const & function )
+		{
+			if ( first >= end )
+			{
+				return;
+			}
+
+			auto steps = ( end - first + step - 1u ) / step;
+
+			if ( !dependent )
+			{
+				auto tiles = ( steps + TileSize - 1u ) / TileSize;
+				pool.parallelFor( tiles * tiles
+					, [&function, first, step, steps, tiles]( uint32_t index )
+					{
+						auto ti = index / tiles;
+						auto tj = index % tiles;
+
+						for ( auto si = ti * TileSize; si < std::min( steps, ( ti + 1u ) * TileSize ); ++si )
+						{
+							for ( auto sj = tj * TileSize; sj < std::min( steps, ( tj + 1u ) * TileSize ); ++sj )
+							{
+								function( first + si * step, first + sj * step );
+							}
+						}
+					} );
+				return;
+			}
+
+			// An iteration depends on the previous one on its row, and on the row above, up to the next column.
+			// In the skewed space (i, k = i + j), all these dependencies go to lower or equal coordinates,
+			// hence the tiles of that space are processed by waves of same ti + tk, keeping the serial loops order.
+			auto tilesI = ( steps + TileSize - 1u ) / TileSize;
+			auto tilesK = ( 2u * steps - 1u + TileSize - 1u ) / TileSize;
+			std::vector< std::pair< uint32_t, uint32_t > > wave;
+
+			for ( auto w = 0u; w < tilesI + tilesK - 1u; ++w )
+			{
+				wave.clear();
+
+				for ( auto ti = ( w >= tilesK ? w - tilesK + 1u : 0u ); ti < tilesI && ti <= w; ++ti )
+				{
+					wave.emplace_back( ti, w - ti );
+				}
+
+				pool.parallelFor( uint32_t( wave.size() )
+					, [&function, &wave, first, step, steps]( uint32_t index )
+					{
+						auto [ti, tk] = wave[index];
+
+						for ( auto si = ti * TileSize; si < std::min( steps, ( ti + 1u ) * TileSize ); ++si )
+						{
+							auto kBegin = std::max( si, tk * TileSize );
+							auto kEnd = std::min( si + steps, ( tk + 1u ) * TileSize );
+
+							for ( auto k = kBegin; k < kEnd; ++k )
+							{
+								function( first + si * step, first + ( k - si ) * step );
+							}
+						}
+					} );
+			}
+		}
+
+		static void rescale( castor::TaskPool & pool
+			, uint32_t max
+			, Matrix & heightMap )
+		{
+			auto count = max + 1u;
+			auto rowsPerTask = std::max( 1u, MinCellsPerTask / count );
+			std::vector< castor::Range< float > > ranges( ( count + rowsPerTask - 1u ) / rowsPerTask
+				, castor::Range< float >{ 0.0f, 1.0f } );
+			parallelForRows( pool
+				, count
+				, count
+				, [&heightMap, &ranges, count, rowsPerTask]( uint32_t begin, uint32_t end )
+				{
+					auto yMin = std::numeric_limits< float >::max();
+					auto yMax = std::numeric_limits< float >::lowest();
+
+					for ( auto z = begin; z < end; z++ )
+					{
+						for ( auto x = 0u; x < count; x++ )
+						{
+							yMin = std::min( yMin, heightMap( x, z ) );
+							yMax = std::max( yMax, heightMap( x, z ) );
+						}
+					}
+
+					ranges[begin / rowsPerTask] = castor::makeRange( yMin, yMax );
+				} );
+
+			auto yMin = std::numeric_limits< float >::max();
+			auto yMax = std::numeric_limits< float >::lowest();
+
+			for ( auto & range : ranges )
+			{
+				yMin = std::min( yMin, range.getMin() );
+				yMax = std::max( yMax, range.getMax() );
+			}
+
+			auto range = castor::makeRange( yMin, yMax );
+			parallelForRows( pool
+				, count
+				, count
+				, [&heightMap, &range, count]( uint32_t begin, uint32_t end )
+				{
+					for ( auto z = begin; z < end; z++ )
+					{
+						for ( auto x = 0u; x < count; x++ )
+						{
+							heightMap( x, z ) = range.percent( heightMap( x, z ) );
+						}
+					}
+				} );
+		}
+	}
+
 	void generateHeightMap( bool island
 		, std::default_random_engine engine
 		, uint32_t max
 		, uint32_t size
+		, castor::TaskPool & pool
 		, Matrix & heightMap )
 	{
-		std::function< void( uint32_t, uint32_t, uint32_t, uint32_t, float, uint32_t ) > divide = [&heightMap
-			, &engine
-			, &divide]( uint32_t x1
-				, uint32_t y1
-				, uint32_t x2
-				, uint32_t y2
-				, float range
-				, uint32_t level )
-		{
-			std::uniform_real_distribution< float > distribution{ -1.0f, 1.0f };
+		auto seed = uint32_t( engine() );
+		auto range = 1.0f;
 
-			if ( level < 1 ) return;
+		for ( auto level = size; level >= 1u; level /= 2u )
+		{
+			// Above level 1, the diamonds only read the corners, and the squares the corners and the centers,
+			// so all tiles are independent.
+			// At level 1, the written cells are read by the next iterations.
+			auto dependent = level == 1u;
 
 			// diamonds
-			for ( unsigned i = x1 + level; i < x2; i += level )
-			{
-				for ( unsigned j = y1 + level; j < y2; j += level )
+			hm::forEachTile( pool
+				, 1u + level
+				, max
+				, level
+				, dependent
+				, [&heightMap, seed, level, range]( uint32_t i, uint32_t j )
 				{
 					float a = heightMap( i - level, j - level );
 					float b = heightMap( i, j - level );
 					float c = heightMap( i - level, j );
 					float d = heightMap( i, j );
-					heightMap( i - level / 2u, j - level / 2u ) = ( a + b + c + d ) / 4 + distribution( engine ) * range;
-				}
-			}
+					heightMap( i - level / 2u, j - level / 2u ) = ( a + b + c + d ) / 4 + hm::random( seed, level, 0u, i, j ) * range;
+				} );
 
 			// squares
-			for ( unsigned i = x1 + 2u * level; i < x2; i += level )
-			{
-				for ( unsigned j = y1 + 2u * level; j < y2; j += level )
+			hm::forEachTile( pool
+				, 1u + 2u * level
+				, max
+				, level
+				, dependent
+				, [&heightMap, seed, level, range]( uint32_t i, uint32_t j )
 				{
 					float a = heightMap( i - level, j - level );
 					float b = heightMap( i, j - level );
 					float c = heightMap( i - level, j );
 					float d = heightMap( i - level / 2, j - level / 2u );
 
-					heightMap( i - level, j - level / 2u ) = ( a + c + d + heightMap( i - 3 * level / 2u, j - level / 2u ) ) / 4 + distribution( engine ) * range;
-					heightMap( i - level / 2u, j - level ) = ( a + b + d + heightMap( i - level / 2u, j - 3 * level / 2u ) ) / 4 + distribution( engine ) * range;
-				}
-			}
-
-			divide( x1, y1, x2, y2, range / 2.0f, level / 2u );
-		};
-
-		divide( 1u, 1u, max, max, 1.0f, size );
-
-		auto rescale = [&heightMap, max]()
-		{
-			auto yMin = std::numeric_limits< float >::max();
-			auto yMax = std::numeric_limits< float >::lowest();
+					heightMap( i - level, j - level / 2u ) = ( a + c + d + heightMap( i - 3 * level / 2u, j - level / 2u ) ) / 4 + hm::random( seed, level, 1u, i, j ) * range;
+					heightMap( i - level / 2u, j - level ) = ( a + b + d + heightMap( i - level / 2u, j - 3 * level / 2u ) ) / 4 + hm::random( seed, level, 2u, i, j ) * range;
+				} );
 
-			for ( auto z = 0u; z <= max; z++ )
-			{
-				for ( auto x = 0u; x <= max; x++ )
-				{
-					yMin = std::min( yMin, heightMap( x, z ) );
-					yMax = std::max( yMax, heightMap( x, z ) );
-				}
-			}
-
-			auto range = castor::makeRange( yMin, yMax );
+			range /= 2.0f;
+		}
 
-			for ( auto z = 0u; z <= max; z++ )
-			{
-				for ( auto x = 0u; x <= max; x++ )
-				{
-					heightMap( x, z ) = range.percent( heightMap( x, z ) );
-				}
-			}
-		};
-		rescale();
+		hm::rescale( pool, max, heightMap );
 
 		if ( island )
 		{
@@ -92,15 +230,21 @@ namespace diamond_square_terrain
 				return 1.0f - sqrt( distX * distX + distZ * distZ ) / maxDist;
 			};
 
-			for ( auto z = 0u; z <= max; z++ )
-			{
-				for ( auto x = 0u; x <= max; x++ )
+			parallelForRows( pool
+				, max + 1u
+				, max + 1u
+				, [&heightMap, &distance, max]( uint32_t begin, uint32_t end )
 				{
-					heightMap( x, z ) = float( heightMap( x, z ) * distance( x, z ) );
-				}
-			}
+					for ( auto z = begin; z < end; z++ )
+					{
+						for ( auto x = 0u; x <= max; x++ )
+						{
+							heightMap( x, z ) = float( heightMap( x, z ) * distance( x, z ) );
+						}
+					}
+				} );
 
-			rescale();
+			hm::rescale( pool, max, heightMap );
 		}
 	}
 }
@@ -12,6 +12,7 @@ namespace diamond_square_terrain
 		, std::default_random_engine engine
 		, uint32_t max
 		, uint32_t size
+		, castor::TaskPool & pool
 		, Matrix & heightMap );
 }
 
@@ -35,6 +35,8 @@ namespace toon::shader
 			auto profiles = castor::makeArrayView( reinterpret_cast< ToonProfileData * >( buffer.getPtr() ), castor3d::MaxMaterialsCount );
 			auto & data = profiles[pass.getId() - 1u];
 			edges->fillProfileBuffer( data );
+			buffer.markDirty( ( pass.getId() - 1u ) * sizeof( ToonProfileData )
+				, sizeof( ToonProfileData ) );
 		}
 	}
 
@@ -15,19 +15,142 @@
 #include <Castor3D/Scene/Scene.hpp>
 #include <Castor3D/Scene/SceneNode.hpp>
 
+#include <CastorUtils/Data/VirtualFileSystem.hpp>
 #include <CastorUtils/Design/ArrayView.hpp>
 
 #include <CastorUtils/Config/BeginExternHeaderGuard.hpp>
+#include <assimp/IOStream.hpp>
+#include <assimp/IOSystem.hpp>
 #include <assimp/material.h>
 #include <assimp/postprocess.h>
 #include <CastorUtils/Config/EndExternHeaderGuard.hpp>
 
+#include <cstring>
+
 namespace c3d_assimp
 {
 	//*********************************************************************************************
 
 	namespace file
 	{
+		class VfsIOStream
+			: public Assimp::IOStream
+		{
+		public:
+			explicit VfsIOStream( castor::ByteArray data )
+				: m_data{ std::move( data ) }
+			{
+			}
+
+			size_t Read( void * buffer
+				, size_t size
+				, size_t count )override
+			{
+				if ( !size )
+				{
+					return 0u;
+				}
+
+				count = std::min( count, ( m_data.size() - m_position ) / size );
+				std::memcpy( buffer, m_data.data() + m_position, count * size );
+				m_position += count * size;
+				return count;
+			}
+
+			size_t Write( void const * CU_UnusedParam( buffer )
+				, size_t CU_UnusedParam( size )
+				, size_t CU_UnusedParam( count ) )override
+			{
+				return 0u;
+			}
+
+			aiReturn Seek( size_t offset
+				, aiOrigin origin )override
+			{
+				std::ptrdiff_t base{};
+
+				switch ( origin )
+				{
+				case aiOrigin_SET:
+					base = 0;
+					break;
+				case aiOrigin_CUR:
+					base = std::ptrdiff_t( m_position );
+					break;
+				case aiOrigin_END:
+					base = std::ptrdiff_t( m_data.size() );
+					break;
+				default:
+					return aiReturn_FAILURE;
+				}
+
+				// Relative offsets can be negative, they are passed wrapped in the size_t.
+				auto position = base + std::ptrdiff_t( offset );
+
+				if ( position < 0
+					|| size_t( position ) > m_data.size() )
+				{
+					return aiReturn_FAILURE;
+				}
+
+				m_position = size_t( position );
+				return aiReturn_SUCCESS;
+			}
+
+			size_t Tell()const override
+			{
+				return m_position;
+			}
+
+			size_t FileSize()const override
+			{
+				return m_data.size();
+			}
+
+			void Flush()override
+			{
+			}
+
+		private:
+			castor::ByteArray m_data;
+			size_t m_position{};
+		};
+
+		// Lets Assimp read models, and their side files, from mounted archives.
+		class VfsIOSystem
+			: public Assimp::IOSystem
+		{
+		public:
+			bool Exists( char const * file )const override
+			{
+				return castor::VirtualFileSystem::getSingleton().fileExists( castor::Path{ file } );
+			}
+
+			char getOsSeparator()const override
+			{
+				return char( castor::Path::NativeSeparator );
+			}
+
+			Assimp::IOStream * Open( char const * file
+				, char const * mode )override
+			{
+				castor::ByteArray data;
+
+				if ( std::string_view{ mode }.find_first_of( "wa+" ) != std::string_view::npos
+					|| !castor::VirtualFileSystem::getSingleton().readFile( castor::Path{ file }, data ) )
+				{
+					return nullptr;
+				}
+
+				return new VfsIOStream{ std::move( data ) };
+			}
+
+			void Close( Assimp::IOStream * stream )override
+			{
+				delete stream;
+			}
+		};
+
 		static aiScene const * loadScene( Assimp::Importer & importer
 			, castor::Path const & filePath
 			, castor3d::Parameters const & parameters )
@@ -69,6 +192,8 @@ namespace c3d_assimp
 
 			try
 			{
+				// The importer takes ownership of the IO handler.
+				importer.SetIOHandler( new VfsIOSystem );
 				auto result = importer.ReadFile( castor::string::stringCast< char >( filePath ), importFlags );
 
 				if ( !result )
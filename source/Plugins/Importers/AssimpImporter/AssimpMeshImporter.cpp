@@ -381,12 +381,11 @@ namespace c3d_assimp
 
 		if ( !aiMesh.HasNormals() )
 		{
-			mapping->computeNormals();
-			mapping->computeTangents();
+			doComputeTangentSpace( submesh, true );
 		}
 		else if ( !aiMesh.HasTangentsAndBitangents() )
 		{
-			mapping->computeTangents();
+			doComputeTangentSpace( submesh, false );
 		}
 	}
 
@@ -410,9 +409,7 @@ namespace c3d_assimp
 					vertex = transform * vertex;
 				}
 
-				auto indexMapping = submesh->getIndexMapping();
-				indexMapping->computeNormals();
-				indexMapping->computeTangents();
+				doComputeTangentSpace( *submesh, true );
 			}
 		}
 
@@ -888,15 +888,14 @@ namespace c3d_gltf
 					tangents->getData().resize( submesh.getPositions().size() );
 				}
 
-				mapping->computeNormals();
-				mapping->computeTangents();
+				doComputeTangentSpace( submesh, true );
 			}
 			else if ( !submesh.hasComponent( castor3d::TangentsComponent::Name )
 				&& submesh.hasComponent( castor3d::Texcoords0Component::Name ) )
 			{
 				auto tangents = submesh.createComponent< castor3d::TangentsComponent >();
 				tangents->getData().resize( submesh.getPositions().size() );
-				mapping->computeTangents();
+				doComputeTangentSpace( submesh, false );
 			}
 
 			submesh.setIndexMapping( std::move( mapping ) );
@@ -933,9 +932,7 @@ namespace c3d_gltf
 					vertex = matrixAcc * vertex;
 				}
 
-				auto indexMapping = submesh->getIndexMapping();
-				indexMapping->computeNormals();
-				indexMapping->computeTangents();
+				doComputeTangentSpace( *submesh, true );
 			}
 		}
 
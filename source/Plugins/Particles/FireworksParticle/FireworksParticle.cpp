@@ -9,8 +9,6 @@
 
 #include <ashespp/Buffer/VertexBuffer.hpp>
 
-#include <random>
-
 namespace fireworks
 {
 	//*********************************************************************************************
@@ -54,14 +52,19 @@ namespace fireworks
 			ParticleUpdater( castor3d::ParticleSystem const & system
 				, castor3d::ParticleDeclaration const & inputs
 				, castor3d::ParticleEmitterArray & emitters );
+
+			using castor3d::ParticleUpdater::update;
 			void update( castor::Milliseconds const & time
-				, castor3d::Particle & particle )override;
+				, castor3d::ParticlePool & particles
+				, uint32_t first
+				, uint32_t count
+				, castor3d::ParticleRandom & random )override;
 
 		private:
-			castor3d::ParticleDeclaration::const_iterator m_type;
-			castor3d::ParticleDeclaration::const_iterator m_position;
-			castor3d::ParticleDeclaration::const_iterator m_velocity;
-			castor3d::ParticleDeclaration::const_iterator m_age;
+			uint32_t m_type;
+			uint32_t m_position;
+			uint32_t m_velocity;
+			uint32_t m_age;
 		};
 
 		//*****************************************************************************************
@@ -82,25 +85,25 @@ namespace fireworks
 		constexpr castor::Milliseconds g_shellLifetime = 10000_ms;
 		constexpr castor::Milliseconds g_secondaryShellLifetime = 2500_ms;
 
-		inline float getRandomFloat()
+		inline float getRandomFloat( castor3d::ParticleRandom & random )
 		{
-			static std::minstd_rand device;
 			std::uniform_real_distribution< float > distribution{ -1.0f, 1.0f };
-			return distribution( device );
+			return distribution( random );
 		}
 
-		inline castor::Point3f doGetRandomDirection()
+		inline castor::Point3f doGetRandomDirection( castor3d::ParticleRandom & random )
 		{
-			return castor::Point3f{ getRandomFloat(), getRandomFloat(), getRandomFloat() };
+			return castor::Point3f{ getRandomFloat( random ), getRandomFloat( random ), getRandomFloat( random ) };
 		}
 
 		inline void doUpdateLauncher( ParticleEmitter & emitter
+			, castor3d::ParticleRandom & random
 			, castor::Coords3f & position
 			, float & age )
 		{
 			if ( age >= float( g_launcherCooldown.count() ) )
 			{
-				castor::Point3f velocity{ doGetRandomDirection() * 5.0f };
+				castor::Point3f velocity{ doGetRandomDirection( random ) * 5.0f };
 				velocity[1] = std::max( velocity[1] * 7.0f, 10.0f );
 				emitter.emit( castor::Point3f{ position }
 					, velocity
@@ -109,58 +112,44 @@ namespace fireworks
 			}
 		}
 
-		inline void doUpdateShell( ParticleEmitter & emitter
-			, castor::Milliseconds const & time
+		inline void doExplodeShell( ParticleEmitter & emitter
+			, castor3d::ParticleRandom & random
 			, float & type
 			, castor::Coords3f & position
 			, castor::Coords3f & velocity
 			, float & age )
 		{
-			auto deltaS = float( time.count() ) / 1000.0f;
-			castor::Point3f delta{ deltaS, deltaS, deltaS };
-			castor::Point3f deltaP = delta * velocity;
-			castor::Point3f deltaV = delta * castor::Point3f{ 0.0f, -0.981f, 0.0f };
-
-			if ( age < float( g_shellLifetime.count() ) )
+			for ( int i = 1; i < 10; ++i )
 			{
-				position += deltaP;
-				velocity += deltaV;
+				emitter.emit( castor::Point3f{ position }
+					, ( doGetRandomDirection( random ) * 5.0f ) + velocity / 2.0f
+					, 0.0f );
 			}
-			else
-			{
-				for ( int i = 1; i < 10; ++i )
-				{
-					emitter.emit( castor::Point3f{ position }
-						, ( doGetRandomDirection() * 5.0f ) + velocity / 2.0f
-						, 0.0f );
-				}
 
-				// Turn this shell to a secondary shell, to decrease the holes in buffer
-				type = g_secondaryShell;
-				velocity = ( doGetRandomDirection() * 5.0f ) + velocity / 2.0f;
-				age = 0.0f;
-			}
+			// Turn this shell to a secondary shell, to decrease the holes in buffer
+			type = g_secondaryShell;
+			velocity = ( doGetRandomDirection( random ) * 5.0f ) + velocity / 2.0f;
+			age = 0.0f;
 		}
 
-		inline void doUpdateSecondaryShell( castor::Milliseconds const & time
-			, float & type
-			, castor::Coords3f & position
-			, castor::Coords3f & velocity
-			, float & age )
+		inline uint32_t doFindElement( castor3d::ParticleDeclaration const & inputs
+			, castor::String const & name
+			, castor3d::ParticleFormat format )
 		{
-			if ( age < float( g_secondaryShellLifetime.count() ) )
-			{
-				auto deltaS = float( time.count() ) / 1000.0f;
-				castor::Point3f delta{ deltaS, deltaS, deltaS };
-				castor::Point3f deltaP = delta * velocity;
-				castor::Point3f deltaV = delta * castor::Point3f{ 0.0f, -0.981f, 0.0f };
-				position += deltaP;
-				velocity += deltaV;
-			}
-			else
+			auto it = std::find_if( inputs.begin()
+				, inputs.end()
+				, [&name]( castor3d::ParticleElementDeclaration const & element )
+				{
+					return element.m_name == name;
+				} );
+
+			if ( it == inputs.end()
+				|| it->m_dataType != format )
 			{
-				type = g_launcher;
+				CU_Exception( "All particle data offsets couldn't be found." );
 			}
+
+			return uint32_t( std::distance( inputs.begin(), it ) );
 		}
 
 		//*****************************************************************************************
@@ -204,75 +193,77 @@ namespace fireworks
 			, castor3d::ParticleDeclaration const & inputs
 			, castor3d::ParticleEmitterArray & emitters )
 			: castor3d::ParticleUpdater{ system, inputs, emitters }
-			, m_type{ std::find_if( inputs.begin()
-				, inputs.end()
-				, []( castor3d::ParticleElementDeclaration const & element )
-				{
-					return element.m_name == cuT( "type" );
-				} ) }
-			, m_position{ std::find_if( inputs.begin()
-				, inputs.end()
-				, []( castor3d::ParticleElementDeclaration const & element )
-				{
-					return element.m_name == cuT( "position" );
-				} ) }
-			, m_velocity{ std::find_if( inputs.begin()
-				, inputs.end()
-				, []( castor3d::ParticleElementDeclaration const & element )
-				{
-					return element.m_name == cuT( "velocity" );
-				} ) }
-			, m_age{ std::find_if( inputs.begin()
-				, inputs.end()
-				, []( castor3d::ParticleElementDeclaration const & element )
-				{
-					return element.m_name == cuT( "age" );
-				} ) }
+			, m_type{ doFindElement( inputs, cuT( "type" ), castor3d::ParticleFormat::eFloat ) }
+			, m_position{ doFindElement( inputs, cuT( "position" ), castor3d::ParticleFormat::eVec3f ) }
+			, m_velocity{ doFindElement( inputs, cuT( "velocity" ), castor3d::ParticleFormat::eVec3f ) }
+			, m_age{ doFindElement( inputs, cuT( "age" ), castor3d::ParticleFormat::eFloat ) }
 		{
-			if ( m_type == inputs.end()
-				|| m_position == inputs.end()
-				|| m_velocity == inputs.end()
-				|| m_age == inputs.end() )
-			{
-				CU_Exception( "All particle data offsets couldn't be found." );
-			}
 		}
 
 		void ParticleUpdater::update( castor::Milliseconds const & time
-			, castor3d::Particle & particle )
+			, castor3d::ParticlePool & particles
+			, uint32_t first
+			, uint32_t count
+			, castor3d::ParticleRandom & random )
 		{
-			castor::Coords3f pos{ reinterpret_cast< float * >( particle.getData() + m_position->m_offset ) };
-			castor::Coords3f vel{ reinterpret_cast< float * >( particle.getData() + m_velocity->m_offset ) };
-			float * age{ reinterpret_cast< float * >( particle.getData() + m_age->m_offset ) };
-			float * type{ reinterpret_cast< float * >( particle.getData() + m_type->m_offset ) };
-			*age += float( time.count() );
-
-			if ( *type == g_launcher )
-			{
-				doUpdateLauncher( static_cast< ParticleEmitter & >( *m_emitters[size_t( g_shell )] )
-					, pos
-					, *age );
-				auto worldPosition = m_system.getParent()->getDerivedPosition();
-				pos[0] = worldPosition[0];
-				pos[1] = worldPosition[1];
-				pos[2] = worldPosition[2];
-			}
-			else if ( *type == g_shell )
+			auto types = particles.getData< float >( m_type );
+			auto positions = particles.getData< float >( m_position );
+			auto velocities = particles.getData< float >( m_velocity );
+			auto ages = particles.getData< float >( m_age );
+			auto const elapsed = float( time.count() );
+			auto const deltaS = elapsed / 1000.0f;
+			auto const end = first + count;
+
+			// Branchless ageing and ballistic integration, over whole element arrays.
+			for ( auto i = first; i < end; ++i )
 			{
-				doUpdateShell( static_cast< ParticleEmitter & >( *m_emitters[size_t( g_secondaryShell )] )
-					, time
-					, *type
-					, pos
-					, vel
-					, *age );
+				auto age = ages[i] + elapsed;
+				auto type = types[i];
+				auto moving = ( type == g_shell && age < float( g_shellLifetime.count() ) )
+					|| ( type == g_secondaryShell && age < float( g_secondaryShellLifetime.count() ) );
+				auto delta = moving ? deltaS : 0.0f;
+				auto position = positions + 3u * i;
+				auto velocity = velocities + 3u * i;
+				position[0] += delta * velocity[0];
+				position[1] += delta * velocity[1];
+				position[2] += delta * velocity[2];
+				velocity[1] -= delta * 0.981f;
+				ages[i] = age;
 			}
-			else
+
+			// State changes, which may emit new particles.
+			for ( auto i = first; i < end; ++i )
 			{
-				doUpdateSecondaryShell( time
-					, *type
-					, pos
-					, vel
-					, *age );
+				castor::Coords3f pos{ positions + 3u * i };
+
+				if ( types[i] == g_launcher )
+				{
+					doUpdateLauncher( static_cast< ParticleEmitter & >( *m_emitters[size_t( g_shell )] )
+						, random
+						, pos
+						, ages[i] );
+					auto worldPosition = m_system.getParent()->getDerivedPosition();
+					pos[0] = worldPosition[0];
+					pos[1] = worldPosition[1];
+					pos[2] = worldPosition[2];
+				}
+				else if ( types[i] == g_shell )
+				{
+					if ( ages[i] >= float( g_shellLifetime.count() ) )
+					{
+						castor::Coords3f vel{ velocities + 3u * i };
+						doExplodeShell( static_cast< ParticleEmitter & >( *m_emitters[size_t( g_secondaryShell )] )
+							, random
+							, types[i]
+							, pos
+							, vel
+							, ages[i] );
+					}
+				}
+				else if ( ages[i] >= float( g_secondaryShellLifetime.count() ) )
+				{
+					types[i] = g_launcher;
+				}
 			}
 		}
 	}
@@ -303,14 +294,19 @@ namespace fireworks
 
 	void ParticleSystem::doPackParticles()
 	{
-		for ( auto i = 1u; i < m_firstUnused && m_firstUnused > 1u; ++i )
-		{
-			auto & particle = m_particles[i];
+		// The first particle is the launcher, and is kept alive.
+		auto types = m_particles.getData< float >( eType );
+		auto i = 1u;
 
-			if ( particle.getValue< castor3d::ParticleFormat::eFloat >( eType ) == 0.0f )
+		while ( i < m_particles.size() )
+		{
+			if ( types[i] == g_launcher )
+			{
+				m_particles.remove( i );
+			}
+			else
 			{
-				particle = std::move( m_particles[m_firstUnused - 1] );
-				--m_firstUnused;
+				++i;
 			}
 		}
 	}
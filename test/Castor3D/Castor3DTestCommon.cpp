@@ -479,6 +479,16 @@ namespace Testing
 		auto lhsData = lhs.getFaces();
 		auto rhsData = rhs.getFaces();
 		auto result = CT_EQUAL( lhsData, rhsData );
+		auto & lhsLods = lhs.getLods();
+		auto & rhsLods = rhs.getLods();
+		result = result && CT_EQUAL( lhsLods.size(), rhsLods.size() );
+
+		for ( size_t i = 0u; result && i < lhsLods.size(); ++i )
+		{
+			result = CT_EQUAL( lhsLods[i].error, rhsLods[i].error );
+			result = result && CT_EQUAL( lhsLods[i].faces, rhsLods[i].faces );
+		}
+
 		return result;
 	}
 
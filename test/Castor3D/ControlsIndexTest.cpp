@@ -0,0 +1,133 @@
+#include "ControlsIndexTest.hpp"
+
+#include <Castor3D/Gui/ControlsIndex.hpp>
+
+#include <random>
+
+using namespace castor;
+using namespace castor3d;
+
+namespace Testing
+{
+	namespace ctrlidx
+	{
+		static auto acceptAll = []( uint32_t )
+		{
+			return true;
+		};
+
+		// The hit-test, as the controls manager did it before the index.
+		static uint32_t pickLinear( std::vector< ControlsIndex::Rect > const & rects
+			, Position const & position )
+		{
+			for ( auto index = uint32_t( rects.size() ); index > 0u; --index )
+			{
+				if ( ControlsIndex::contains( rects[index - 1u], position ) )
+				{
+					return index - 1u;
+				}
+			}
+
+			return ControlsIndex::InvalidIndex;
+		}
+	}
+
+	//*********************************************************************************************
+
+	ControlsIndexTest::ControlsIndexTest( Engine & engine )
+		: C3DTestCase{ "ControlsIndexTest", engine }
+	{
+	}
+
+	void ControlsIndexTest::doRegisterTests()
+	{
+		doRegisterTest( "ControlsIndexTest::Empty", std::bind( &ControlsIndexTest::Empty, this ) );
+		doRegisterTest( "ControlsIndexTest::ZOrder", std::bind( &ControlsIndexTest::ZOrder, this ) );
+		doRegisterTest( "ControlsIndexTest::Filter", std::bind( &ControlsIndexTest::Filter, this ) );
+		doRegisterTest( "ControlsIndexTest::LargeExtent", std::bind( &ControlsIndexTest::LargeExtent, this ) );
+		doRegisterTest( "ControlsIndexTest::Random", std::bind( &ControlsIndexTest::Random, this ) );
+	}
+
+	void ControlsIndexTest::Empty()
+	{
+		ControlsIndex empty;
+		CT_EQUAL( empty.getSize(), 0u );
+		CT_EQUAL( empty.pick( Position{ 10, 10 }, ctrlidx::acceptAll ), ControlsIndex::InvalidIndex );
+		// Empty rectangles are never hit.
+		ControlsIndex index{ { { Position{ 0, 0 }, Size{ 0u, 100u } }
+			, { Position{ 0, 0 }, Size{ 100u, 0u } } } };
+		CT_EQUAL( index.getSize(), 2u );
+		CT_EQUAL( index.getCellsCount(), 0u );
+		CT_EQUAL( index.pick( Position{ 0, 0 }, ctrlidx::acceptAll ), ControlsIndex::InvalidIndex );
+	}
+
+	void ControlsIndexTest::ZOrder()
+	{
+		// A window, a panel in it, and a button in the panel.
+		ControlsIndex index{ { { Position{ 100, 100 }, Size{ 400u, 300u } }
+			, { Position{ 120, 140 }, Size{ 200u, 200u } }
+			, { Position{ 130, 150 }, Size{ 50u, 20u } } } };
+		CT_EQUAL( index.pick( Position{ 135, 155 }, ctrlidx::acceptAll ), 2u );
+		CT_EQUAL( index.pick( Position{ 200, 300 }, ctrlidx::acceptAll ), 1u );
+		CT_EQUAL( index.pick( Position{ 450, 350 }, ctrlidx::acceptAll ), 0u );
+		// The right and bottom borders are excluded.
+		CT_EQUAL( index.pick( Position{ 500, 200 }, ctrlidx::acceptAll ), ControlsIndex::InvalidIndex );
+		CT_EQUAL( index.pick( Position{ 200, 400 }, ctrlidx::acceptAll ), ControlsIndex::InvalidIndex );
+		CT_EQUAL( index.pick( Position{ 99, 200 }, ctrlidx::acceptAll ), ControlsIndex::InvalidIndex );
+		CT_EQUAL( index.pick( Position{ -50, -50 }, ctrlidx::acceptAll ), ControlsIndex::InvalidIndex );
+	}
+
+	void ControlsIndexTest::Filter()
+	{
+		ControlsIndex index{ { { Position{ 0, 0 }, Size{ 100u, 100u } }
+			, { Position{ 10, 10 }, Size{ 50u, 50u } }
+			, { Position{ 20, 20 }, Size{ 10u, 10u } } } };
+		// The rejected rectangles let the ones behind be hit.
+		CT_EQUAL( index.pick( Position{ 25, 25 }, []( uint32_t lookup ){ return lookup != 2u; } ), 1u );
+		CT_EQUAL( index.pick( Position{ 25, 25 }, []( uint32_t lookup ){ return lookup == 0u; } ), 0u );
+		CT_EQUAL( index.pick( Position{ 25, 25 }, []( uint32_t ){ return false; } ), ControlsIndex::InvalidIndex );
+	}
+
+	void ControlsIndexTest::LargeExtent()
+	{
+		ControlsIndex index{ { { Position{ -100'000, -100'000 }, Size{ 10u, 10u } }
+			, { Position{ 100'000, 100'000 }, Size{ 10u, 10u } }
+			, { Position{ 0, 0 }, Size{ 10u, 10u } } } };
+		// The cells grow, to keep a bounded grid.
+		CT_CHECK( index.getCellSize() > ControlsIndex::DefaultCellSize );
+		CT_CHECK( index.getCellsCount() <= ControlsIndex::MaxCellsPerAxis * ControlsIndex::MaxCellsPerAxis );
+		CT_EQUAL( index.pick( Position{ -99'995, -99'995 }, ctrlidx::acceptAll ), 0u );
+		CT_EQUAL( index.pick( Position{ 100'005, 100'005 }, ctrlidx::acceptAll ), 1u );
+		CT_EQUAL( index.pick( Position{ 5, 5 }, ctrlidx::acceptAll ), 2u );
+		CT_EQUAL( index.pick( Position{ 50, 50 }, ctrlidx::acceptAll ), ControlsIndex::InvalidIndex );
+	}
+
+	void ControlsIndexTest::Random()
+	{
+		std::mt19937 engine{ 42u };
+		std::uniform_int_distribution< int32_t > position{ -100, 1920 };
+		std::uniform_int_distribution< uint32_t > size{ 0u, 300u };
+		std::vector< ControlsIndex::Rect > rects;
+
+		for ( uint32_t i = 0u; i < 2000u; ++i )
+		{
+			rects.push_back( { Position{ position( engine ), position( engine ) }
+				, Size{ size( engine ), size( engine ) } } );
+		}
+
+		ControlsIndex index{ rects, 32u };
+		uint32_t mismatches{};
+
+		for ( uint32_t i = 0u; i < 5000u; ++i )
+		{
+			Position point{ position( engine ), position( engine ) };
+
+			if ( index.pick( point, ctrlidx::acceptAll ) != ctrlidx::pickLinear( rects, point ) )
+			{
+				++mismatches;
+			}
+		}
+
+		CT_EQUAL( mismatches, 0u );
+	}
+}
@@ -0,0 +1,27 @@
+/* See LICENSE file in root folder */
+#ifndef ___C3DT_CONTROLS_INDEX_TEST_H___
+#define ___C3DT_CONTROLS_INDEX_TEST_H___
+
+#include "Castor3DTestPrerequisites.hpp"
+
+namespace Testing
+{
+	class ControlsIndexTest
+		: public C3DTestCase
+	{
+	public:
+		explicit ControlsIndexTest( castor3d::Engine & engine );
+
+	private:
+		void doRegisterTests()override;
+
+	private:
+		void Empty();
+		void ZOrder();
+		void Filter();
+		void LargeExtent();
+		void Random();
+	};
+}
+
+#endif
@@ -0,0 +1,82 @@
+#include "DiamondSquareTerrainTest.hpp"
+
+#include <DiamondSquareTerrain/GenerateHeightMap.hpp>
+
+using namespace diamond_square_terrain;
+
+namespace Testing
+{
+	namespace dsterrain
+	{
+		// Up to 1024 cells wide, so that the level 1 passes are split over several tiles waves.
+		static uint32_t constexpr MaxDetail = 10u;
+		static uint32_t constexpr WorkersCount = 4u;
+
+		static Matrix generate( bool island
+			, uint32_t detail
+			, uint32_t workers )
+		{
+			auto size = 1u << detail;
+			castor::TaskPool pool{ workers };
+			Matrix result{ size };
+			generateHeightMap( island
+				, std::default_random_engine{}
+				, size - 1u
+				, size
+				, pool
+				, result );
+			return result;
+		}
+
+		static bool areEqual( Matrix const & lhs
+			, Matrix const & rhs
+			, uint32_t detail )
+		{
+			auto size = 1u << detail;
+
+			for ( uint32_t i = 0u; i < size * size; ++i )
+			{
+				if ( lhs[i] != rhs[i] )
+				{
+					return false;
+				}
+			}
+
+			return true;
+		}
+	}
+
+	//*********************************************************************************************
+
+	DiamondSquareTerrainTest::DiamondSquareTerrainTest( castor3d::Engine & engine )
+		: C3DTestCase{ "DiamondSquareTerrainTest", engine }
+	{
+	}
+
+	void DiamondSquareTerrainTest::doRegisterTests()
+	{
+		doRegisterTest( "DiamondSquareTerrainTest::HeightMap", std::bind( &DiamondSquareTerrainTest::HeightMap, this ) );
+		doRegisterTest( "DiamondSquareTerrainTest::Island", std::bind( &DiamondSquareTerrainTest::Island, this ) );
+	}
+
+	void DiamondSquareTerrainTest::HeightMap()
+	{
+		for ( uint32_t detail = 2u; detail <= dsterrain::MaxDetail; ++detail )
+		{
+			// The same seed gives the same terrain, whatever the workers count.
+			auto serial = dsterrain::generate( false, detail, 1u );
+			auto parallel = dsterrain::generate( false, detail, dsterrain::WorkersCount );
+			CT_CHECK( dsterrain::areEqual( serial, parallel, detail ) );
+		}
+	}
+
+	void DiamondSquareTerrainTest::Island()
+	{
+		for ( uint32_t detail = 2u; detail <= dsterrain::MaxDetail; ++detail )
+		{
+			auto serial = dsterrain::generate( true, detail, 1u );
+			auto parallel = dsterrain::generate( true, detail, dsterrain::WorkersCount );
+			CT_CHECK( dsterrain::areEqual( serial, parallel, detail ) );
+		}
+	}
+}
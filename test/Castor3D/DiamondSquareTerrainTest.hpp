@@ -0,0 +1,24 @@
+/* See LICENSE file in root folder */
+#ifndef ___C3DT_DIAMOND_SQUARE_TERRAIN_TEST_H___
+#define ___C3DT_DIAMOND_SQUARE_TERRAIN_TEST_H___
+
+#include "Castor3DTestPrerequisites.hpp"
+
+namespace Testing
+{
+	class DiamondSquareTerrainTest
+		: public C3DTestCase
+	{
+	public:
+		explicit DiamondSquareTerrainTest( castor3d::Engine & engine );
+
+	private:
+		void doRegisterTests()override;
+
+	private:
+		void HeightMap();
+		void Island();
+	};
+}
+
+#endif
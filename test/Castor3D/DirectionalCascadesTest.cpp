@@ -0,0 +1,292 @@
+#include "DirectionalCascadesTest.hpp"
+
+#include <Castor3D/Scene/Light/DirectionalLight.hpp>
+
+#include <CastorUtils/Math/TransformationMatrix.hpp>
+
+#include <cmath>
+
+using namespace castor;
+using namespace castor3d;
+
+namespace Testing
+{
+	namespace dircasc
+	{
+		static uint32_t constexpr TextureSize = 2048u;
+		static uint32_t constexpr CascadesCount = 4u;
+		static float constexpr NearClip = 0.1f;
+		static float constexpr FarClip = 100.0f;
+
+		struct Viewer
+		{
+			Matrix4x4f view;
+			Matrix4x4f projection;
+		};
+
+		// Same matrices as a Camera's, with reversed depth.
+		static Viewer makeViewer( Point3f const & position
+			, Point3f const & target )
+		{
+			return { matrix::lookAt( position, target, Point3f{ 0.0f, 1.0f, 0.0f } )
+				, matrix::reverseDepth( matrix::perspective( Angle::fromDegrees( 45.0f ), 16.0f / 9.0f, NearClip, FarClip ) ) };
+		}
+
+		static Point3f getLightDirection()
+		{
+			return point::getNormalised( Point3f{ 0.3f, -1.0f, 0.4f } );
+		}
+
+		static uint32_t compute( Viewer const & viewer
+			, DirectionalCascadesConfig const & config
+			, std::vector< BoundingBox > const & casters
+			, std::vector< BoundingBox > const & receivers
+			, std::vector< DirectionalLightCascade > & cascades )
+		{
+			return computeDirectionalCascades( viewer.view
+				, viewer.projection
+				, NearClip
+				, FarClip
+				, getLightDirection()
+				, TextureSize
+				, config
+				, casters
+				, receivers
+				, cascades );
+		}
+
+		// The cascades computation, as it was before the fitting and reuse options.
+		static std::vector< DirectionalLightCascade > computeReference( Viewer const & viewer
+			, Point3f const & lightDirection )
+		{
+			std::vector< DirectionalLightCascade > result( CascadesCount );
+			Point3f up{ 0.0f, 1.0f, 0.0f };
+			Point3f right( point::getNormalised( point::cross( up, lightDirection ) ) );
+			up = point::getNormalised( point::cross( lightDirection, right ) );
+			auto const lightViewMatrix = matrix::lookAt( Point3f{}, lightDirection, up );
+			auto const cameraVP = matrix::reverseDepth( viewer.projection ) * viewer.view;
+			auto const invCameraVP = cameraVP.getInverse();
+			float clipRange = FarClip - NearClip;
+			float ratio = FarClip / NearClip;
+			std::vector< float > cascadeSplits( CascadesCount, 0.0f );
+
+			for ( uint32_t i = 0; i < CascadesCount; i++ )
+			{
+				float p = float( i + 1 ) / float( CascadesCount );
+				float log = NearClip * std::pow( ratio, p );
+				float uniform = NearClip + clipRange * p;
+				float d = 0.95f * ( log - uniform ) + uniform;
+				cascadeSplits[i] = ( d - NearClip ) / clipRange;
+			}
+
+			std::array< Point3f, 8u > frustumCorners
+			{
+				Point3f( -1.0f, +1.0f, -1.0f ),
+				Point3f( +1.0f, +1.0f, -1.0f ),
+				Point3f( +1.0f, -1.0f, -1.0f ),
+				Point3f( -1.0f, -1.0f, -1.0f ),
+				Point3f( -1.0f, +1.0f, +1.0f ),
+				Point3f( +1.0f, +1.0f, +1.0f ),
+				Point3f( +1.0f, -1.0f, +1.0f ),
+				Point3f( -1.0f, -1.0f, +1.0f ),
+			};
+
+			for ( auto & frustumCorner : frustumCorners )
+			{
+				auto invCorner = invCameraVP * Point4f{ frustumCorner->x, frustumCorner->y, frustumCorner->z, 1.0f };
+				frustumCorner = Point3f{ invCorner / invCorner->w };
+			}
+
+			float prevSplitDist = 0.0;
+
+			for ( uint32_t cascadeIdx = 0; cascadeIdx < CascadesCount; ++cascadeIdx )
+			{
+				float splitDist = cascadeSplits[cascadeIdx];
+				auto cascadeFrustum = frustumCorners;
+
+				for ( uint32_t i = 0; i < 4; ++i )
+				{
+					auto cornerRay = cascadeFrustum[i + 4] - cascadeFrustum[i];
+					auto nearCornerRay = cornerRay * prevSplitDist;
+					auto farCornerRay = cornerRay * splitDist;
+					cascadeFrustum[i + 4] = lightViewMatrix * ( cascadeFrustum[i] + farCornerRay );
+					cascadeFrustum[i] = lightViewMatrix * ( cascadeFrustum[i] + nearCornerRay );
+				}
+
+				Point3f frustumCenter{ 0, 0, 0 };
+				for ( auto frustumCorner : cascadeFrustum )
+				{
+					frustumCenter += frustumCorner;
+				}
+				frustumCenter /= float( cascadeFrustum.size() );
+
+				float radius = 0.0f;
+				for ( auto frustumCorner : cascadeFrustum )
+				{
+					float distance = float( point::length( frustumCorner - frustumCenter ) );
+					radius = std::max( radius, distance );
+				}
+				radius = std::ceil( radius * 16.0f ) / 16.0f;
+
+				Point3f frustumRadius{ radius, radius, radius };
+				Point3f maxExtents = frustumCenter + frustumRadius;
+				Point3f minExtents = frustumCenter - frustumRadius;
+				auto extent = maxExtents - minExtents;
+				auto texelSize = extent / float( TextureSize );
+				minExtents = point::getFloored( minExtents / texelSize ) * texelSize;
+				maxExtents = point::getFloored( maxExtents / texelSize ) * texelSize;
+				auto ext = float( fabs( frustumCenter->z - minExtents->z ) );
+				ext = std::max( ext, FarClip * 0.5f );
+				minExtents->z = frustumCenter->z - ext;
+				maxExtents->z = frustumCenter->z + ext;
+
+				auto & cascade = result[cascadeIdx];
+				cascade.viewMatrix = lightViewMatrix;
+				cascade.projMatrix = matrix::reverseDepth( matrix::ortho( minExtents->x, maxExtents->x
+					, minExtents->y, maxExtents->y
+					, minExtents->z, maxExtents->z ) );
+				cascade.viewProjMatrix = cascade.projMatrix * cascade.viewMatrix;
+				cascade.splitDepthScale->x = ( NearClip + splitDist * clipRange ) * -1.0f;
+				cascade.splitDepthScale->y = -cascade.splitDepthScale->x / clipRange;
+				prevSplitDist = splitDist;
+			}
+
+			return result;
+		}
+
+		static BoundingBox toLightSpace( BoundingBox const & box )
+		{
+			return box.getAxisAligned( getDirectionalLightView( getLightDirection() ) );
+		}
+
+		static bool isOnTexelGrid( float value
+			, float texelSize )
+		{
+			auto texels = value / texelSize;
+			return std::abs( texels - std::round( texels ) ) < 1.0e-2f;
+		}
+	}
+
+	//*********************************************************************************************
+
+	DirectionalCascadesTest::DirectionalCascadesTest( Engine & engine )
+		: C3DTestCase{ "DirectionalCascadesTest", engine }
+	{
+	}
+
+	void DirectionalCascadesTest::doRegisterTests()
+	{
+		doRegisterTest( "DirectionalCascadesTest::Reference", std::bind( &DirectionalCascadesTest::Reference, this ) );
+		doRegisterTest( "DirectionalCascadesTest::TexelSnapping", std::bind( &DirectionalCascadesTest::TexelSnapping, this ) );
+		doRegisterTest( "DirectionalCascadesTest::Reuse", std::bind( &DirectionalCascadesTest::Reuse, this ) );
+		doRegisterTest( "DirectionalCascadesTest::Fitting", std::bind( &DirectionalCascadesTest::Fitting, this ) );
+	}
+
+	void DirectionalCascadesTest::Reference()
+	{
+		// Without options, the cascades are the same as before, and are all modified on first computation.
+		for ( auto & viewer : { dircasc::makeViewer( { 0.0f, 5.0f, -10.0f }, {} )
+			, dircasc::makeViewer( { 12.5f, 2.0f, 3.0f }, { 0.0f, 1.0f, 20.0f } ) } )
+		{
+			std::vector< DirectionalLightCascade > cascades( dircasc::CascadesCount );
+			auto modified = dircasc::compute( viewer, {}, {}, {}, cascades );
+			CT_EQUAL( modified, ( 1u << dircasc::CascadesCount ) - 1u );
+			auto reference = dircasc::computeReference( viewer, dircasc::getLightDirection() );
+
+			for ( uint32_t i = 0u; i < dircasc::CascadesCount; ++i )
+			{
+				CT_CHECK( cascades[i].viewMatrix == reference[i].viewMatrix );
+				CT_CHECK( cascades[i].projMatrix == reference[i].projMatrix );
+				CT_CHECK( cascades[i].viewProjMatrix == reference[i].viewProjMatrix );
+				CT_CHECK( cascades[i].splitDepthScale == reference[i].splitDepthScale );
+			}
+
+			// Same input, nothing modified.
+			CT_EQUAL( dircasc::compute( viewer, {}, {}, {}, cascades ), 0u );
+		}
+	}
+
+	void DirectionalCascadesTest::TexelSnapping()
+	{
+		// Translating the camera keeps the cascades sizes, and moves them by whole texels.
+		std::vector< DirectionalLightCascade > lhs( dircasc::CascadesCount );
+		std::vector< DirectionalLightCascade > rhs( dircasc::CascadesCount );
+		dircasc::compute( dircasc::makeViewer( { 0.0f, 5.0f, -10.0f }, {} ), {}, {}, {}, lhs );
+		dircasc::compute( dircasc::makeViewer( { 0.137f, 5.0f, -9.871f }, { 0.137f, 0.0f, 0.129f } ), {}, {}, {}, rhs );
+
+		for ( uint32_t i = 0u; i < dircasc::CascadesCount; ++i )
+		{
+			auto lhsSize = lhs[i].maxExtents - lhs[i].minExtents;
+			auto rhsSize = rhs[i].maxExtents - rhs[i].minExtents;
+			CT_EQUAL( lhsSize->x, rhsSize->x );
+			CT_EQUAL( lhsSize->y, rhsSize->y );
+			auto texelSize = lhsSize->x / float( dircasc::TextureSize );
+			CT_CHECK( dircasc::isOnTexelGrid( rhs[i].minExtents->x - lhs[i].minExtents->x, texelSize ) );
+			CT_CHECK( dircasc::isOnTexelGrid( rhs[i].minExtents->y - lhs[i].minExtents->y, texelSize ) );
+		}
+	}
+
+	void DirectionalCascadesTest::Reuse()
+	{
+		DirectionalCascadesConfig config{ false, 0.1f };
+		std::vector< DirectionalLightCascade > cascades( dircasc::CascadesCount );
+		CT_EQUAL( dircasc::compute( dircasc::makeViewer( { 0.0f, 5.0f, -10.0f }, {} ), config, {}, {}, cascades ), ( 1u << dircasc::CascadesCount ) - 1u );
+		auto previous = cascades;
+
+		// Small moves stay within the margin, the cascades are kept.
+		CT_EQUAL( dircasc::compute( dircasc::makeViewer( { 0.01f, 5.0f, -10.0f }, { 0.01f, 0.0f, 0.0f } ), config, {}, {}, cascades ), 0u );
+		CT_CHECK( cascades == previous );
+
+		// Without tolerance, the same move updates the near cascade.
+		auto updated = previous;
+		dircasc::compute( dircasc::makeViewer( { 0.0f, 5.0f, -10.0f }, {} ), {}, {}, {}, updated );
+		CT_CHECK( ( dircasc::compute( dircasc::makeViewer( { 0.01f, 5.0f, -10.0f }, { 0.01f, 0.0f, 0.0f } ), {}, {}, {}, updated ) & 1u ) != 0u );
+
+		// Larger moves update the cascades, which contain the new slices.
+		auto modified = dircasc::compute( dircasc::makeViewer( { 30.0f, 5.0f, -10.0f }, { 30.0f, 0.0f, 0.0f } ), config, {}, {}, cascades );
+		CT_CHECK( modified != 0u );
+		CT_CHECK( cascades != previous );
+		std::vector< DirectionalLightCascade > exact( dircasc::CascadesCount );
+		dircasc::compute( dircasc::makeViewer( { 30.0f, 5.0f, -10.0f }, { 30.0f, 0.0f, 0.0f } ), {}, {}, {}, exact );
+
+		for ( uint32_t i = 0u; i < dircasc::CascadesCount; ++i )
+		{
+			CT_CHECK( cascades[i].minExtents->x <= exact[i].minExtents->x );
+			CT_CHECK( cascades[i].minExtents->y <= exact[i].minExtents->y );
+			CT_CHECK( cascades[i].maxExtents->x >= exact[i].maxExtents->x - 1.0e-3f );
+			CT_CHECK( cascades[i].maxExtents->y >= exact[i].maxExtents->y - 1.0e-3f );
+		}
+	}
+
+	void DirectionalCascadesTest::Fitting()
+	{
+		auto viewer = dircasc::makeViewer( { 0.0f, 5.0f, -10.0f }, {} );
+		auto receiver = dircasc::toLightSpace( BoundingBox{ Point3f{ -1.0f, -0.1f, -1.0f }, Point3f{ 1.0f, 0.1f, 1.0f } } );
+		auto caster = dircasc::toLightSpace( BoundingBox{ Point3f{ -0.5f, 2.0f, -0.5f }, Point3f{ 0.5f, 3.0f, 0.5f } } );
+		std::vector< DirectionalLightCascade > fitted( dircasc::CascadesCount );
+		std::vector< DirectionalLightCascade > unfitted( dircasc::CascadesCount );
+		dircasc::compute( viewer, { true, 0.0f }, { caster }, { receiver }, fitted );
+		dircasc::compute( viewer, {}, {}, {}, unfitted );
+
+		// The near cascade doesn't hold the receiver, it is left as is.
+		CT_CHECK( fitted[0] == unfitted[0] );
+
+		// The cascade holding the receiver shrinks around it, by a power of two.
+		auto & cascade = fitted[2];
+		auto fittedSize = cascade.maxExtents->x - cascade.minExtents->x;
+		auto unfittedSize = unfitted[2].maxExtents->x - unfitted[2].minExtents->x;
+		CT_CHECK( fittedSize < unfittedSize * 0.5f );
+		auto ratio = std::log2( unfittedSize / fittedSize );
+		CT_CHECK( std::abs( ratio - std::round( ratio ) ) < 1.0e-2f );
+		CT_CHECK( cascade.minExtents->x <= receiver.getMin()->x );
+		CT_CHECK( cascade.minExtents->y <= receiver.getMin()->y );
+		CT_CHECK( cascade.maxExtents->x >= receiver.getMax()->x );
+		CT_CHECK( cascade.maxExtents->y >= receiver.getMax()->y );
+		CT_CHECK( dircasc::isOnTexelGrid( cascade.minExtents->x, fittedSize / float( dircasc::TextureSize ) ) );
+
+		// Its depth range holds the receiver and the caster above it.
+		CT_CHECK( cascade.minExtents->z <= std::min( receiver.getMin()->z, caster.getMin()->z ) );
+		CT_CHECK( cascade.maxExtents->z >= std::max( receiver.getMax()->z, caster.getMax()->z ) );
+		CT_CHECK( cascade.maxExtents->z - cascade.minExtents->z < unfitted[2].maxExtents->z - unfitted[2].minExtents->z );
+	}
+}
@@ -0,0 +1,26 @@
+/* See LICENSE file in root folder */
+#ifndef ___C3DT_DIRECTIONAL_CASCADES_TEST_H___
+#define ___C3DT_DIRECTIONAL_CASCADES_TEST_H___
+
+#include "Castor3DTestPrerequisites.hpp"
+
+namespace Testing
+{
+	class DirectionalCascadesTest
+		: public C3DTestCase
+	{
+	public:
+		explicit DirectionalCascadesTest( castor3d::Engine & engine );
+
+	private:
+		void doRegisterTests()override;
+
+	private:
+		void Reference();
+		void TexelSnapping();
+		void Reuse();
+		void Fitting();
+	};
+}
+
+#endif
@@ -0,0 +1,99 @@
+#include "MemRangesTest.hpp"
+
+#include <Castor3D/Buffer/BufferModule.hpp>
+
+using namespace castor;
+using namespace castor3d;
+
+namespace Testing
+{
+	namespace memrng
+	{
+		static bool areEqual( MemRangeArray const & lhs
+			, MemRangeArray const & rhs )
+		{
+			return lhs.size() == rhs.size()
+				&& std::equal( lhs.begin(), lhs.end(), rhs.begin()
+					, []( MemRange const & l, MemRange const & r )
+					{
+						return l.begin == r.begin
+							&& l.end == r.end;
+					} );
+		}
+	}
+
+	//*********************************************************************************************
+
+	MemRangesTest::MemRangesTest( Engine & engine )
+		: C3DTestCase{ "MemRangesTest", engine }
+	{
+	}
+
+	void MemRangesTest::doRegisterTests()
+	{
+		doRegisterTest( "MemRangesTest::Empty", std::bind( &MemRangesTest::Empty, this ) );
+		doRegisterTest( "MemRangesTest::Adjacent", std::bind( &MemRangesTest::Adjacent, this ) );
+		doRegisterTest( "MemRangesTest::Overlapping", std::bind( &MemRangesTest::Overlapping, this ) );
+		doRegisterTest( "MemRangesTest::Disjoint", std::bind( &MemRangesTest::Disjoint, this ) );
+		doRegisterTest( "MemRangesTest::MergeDistance", std::bind( &MemRangesTest::MergeDistance, this ) );
+		doRegisterTest( "MemRangesTest::Unsorted", std::bind( &MemRangesTest::Unsorted, this ) );
+	}
+
+	void MemRangesTest::Empty()
+	{
+		MemRangeArray ranges;
+		mergeRanges( ranges, 0u );
+		CT_CHECK( ranges.empty() );
+		ranges.push_back( { 16u, 32u } );
+		mergeRanges( ranges, 0u );
+		CT_CHECK( memrng::areEqual( ranges, { { 16u, 32u } } ) );
+	}
+
+	void MemRangesTest::Adjacent()
+	{
+		// Consecutive markDirty calls, one element after the other.
+		MemRangeArray ranges{ { 0u, 16u }, { 16u, 32u }, { 32u, 48u } };
+		mergeRanges( ranges, 0u );
+		CT_CHECK( memrng::areEqual( ranges, { { 0u, 48u } } ) );
+	}
+
+	void MemRangesTest::Overlapping()
+	{
+		MemRangeArray ranges{ { 0u, 32u }, { 16u, 48u } };
+		mergeRanges( ranges, 0u );
+		CT_CHECK( memrng::areEqual( ranges, { { 0u, 48u } } ) );
+		// A range fully included in another one doesn't shrink it.
+		ranges = { { 0u, 64u }, { 16u, 32u }, { 48u, 80u } };
+		mergeRanges( ranges, 0u );
+		CT_CHECK( memrng::areEqual( ranges, { { 0u, 80u } } ) );
+		// The same range marked dirty twice.
+		ranges = { { 16u, 32u }, { 16u, 32u } };
+		mergeRanges( ranges, 0u );
+		CT_CHECK( memrng::areEqual( ranges, { { 16u, 32u } } ) );
+	}
+
+	void MemRangesTest::Disjoint()
+	{
+		MemRangeArray ranges{ { 0u, 16u }, { 32u, 48u }, { 128u, 256u } };
+		mergeRanges( ranges, 0u );
+		CT_CHECK( memrng::areEqual( ranges, { { 0u, 16u }, { 32u, 48u }, { 128u, 256u } } ) );
+	}
+
+	void MemRangesTest::MergeDistance()
+	{
+		// Gaps up to the merge distance are uploaded with their surrounding ranges.
+		MemRangeArray ranges{ { 0u, 16u }, { 80u, 96u }, { 161u, 176u } };
+		mergeRanges( ranges, 64u );
+		CT_CHECK( memrng::areEqual( ranges, { { 0u, 96u }, { 161u, 176u } } ) );
+		ranges = { { 0u, 16u }, { 80u, 96u }, { 161u, 176u } };
+		mergeRanges( ranges, 65u );
+		CT_CHECK( memrng::areEqual( ranges, { { 0u, 176u } } ) );
+	}
+
+	void MemRangesTest::Unsorted()
+	{
+		MemRangeArray ranges{ { 128u, 144u }, { 0u, 16u }, { 144u, 160u }, { 8u, 24u }, { 64u, 72u } };
+		mergeRanges( ranges, 0u );
+		CT_CHECK( memrng::areEqual( ranges, { { 0u, 24u }, { 64u, 72u }, { 128u, 160u } } ) );
+	}
+}
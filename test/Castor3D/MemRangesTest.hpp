@@ -0,0 +1,28 @@
+/* See LICENSE file in root folder */
+#ifndef ___C3DT_MEM_RANGES_TEST_H___
+#define ___C3DT_MEM_RANGES_TEST_H___
+
+#include "Castor3DTestPrerequisites.hpp"
+
+namespace Testing
+{
+	class MemRangesTest
+		: public C3DTestCase
+	{
+	public:
+		explicit MemRangesTest( castor3d::Engine & engine );
+
+	private:
+		void doRegisterTests()override;
+
+	private:
+		void Empty();
+		void Adjacent();
+		void Overlapping();
+		void Disjoint();
+		void MergeDistance();
+		void Unsorted();
+	};
+}
+
+#endif
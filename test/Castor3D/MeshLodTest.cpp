@@ -0,0 +1,158 @@
+#include "MeshLodTest.hpp"
+
+#include <Castor3D/Engine.hpp>
+#include <Castor3D/Binary/BinaryMesh.hpp>
+#include <Castor3D/Miscellaneous/Parameter.hpp>
+#include <Castor3D/Model/Mesh/MeshFactory.hpp>
+#include <Castor3D/Model/Mesh/MeshGenerator.hpp>
+#include <Castor3D/Model/Mesh/Submesh/Submesh.hpp>
+#include <Castor3D/Model/Mesh/Submesh/Component/Face.hpp>
+#include <Castor3D/Model/Mesh/Submesh/Component/TriFaceMapping.hpp>
+#include <Castor3D/Render/Frustum.hpp>
+#include <Castor3D/Render/RenderLoop.hpp>
+#include <Castor3D/Render/Viewport.hpp>
+#include <Castor3D/Scene/Scene.hpp>
+
+#include <CastorUtils/Data/BinaryFile.hpp>
+#include <CastorUtils/Math/TransformationMatrix.hpp>
+
+using namespace castor;
+using namespace castor3d;
+
+namespace Testing
+{
+	namespace meshlod
+	{
+		static MeshRPtr createMesh( Engine & engine
+			, Scene & scene
+			, String const & name )
+		{
+			auto result = scene.addNewMesh( name, scene );
+			Parameters parameters;
+			parameters.add( cuT( "width" ), cuT( "1.0" ) );
+			parameters.add( cuT( "height" ), cuT( "1.0" ) );
+			parameters.add( cuT( "depth" ), cuT( "1.0" ) );
+			engine.getMeshFactory().create( cuT( "cube" ) )->generate( *result, parameters );
+			return result;
+		}
+
+		// Gives the first cube face 4 triangles, and 2 reduced levels of detail, using its 4 vertices.
+		static TriFaceMapping & setLods( Mesh & mesh )
+		{
+			auto & mapping = *mesh.getSubmesh( 0u )->getComponent< TriFaceMapping >();
+			mapping.setData( FaceArray{ Face{ 0u, 1u, 2u }, Face{ 0u, 2u, 3u }, Face{ 1u, 2u, 3u }, Face{ 0u, 1u, 3u } } );
+			std::vector< TriFaceMapping::Lod > lods;
+			lods.push_back( TriFaceMapping::Lod{ FaceArray{ Face{ 0u, 1u, 2u }, Face{ 0u, 2u, 3u } }, 0.01f } );
+			lods.push_back( TriFaceMapping::Lod{ FaceArray{ Face{ 0u, 1u, 2u } }, 0.1f } );
+			mapping.setLods( std::move( lods ) );
+			return mapping;
+		}
+	}
+
+	MeshLodTest::MeshLodTest( Engine & engine )
+		: C3DTestCase{ "MeshLodTest", engine }
+	{
+	}
+
+	void MeshLodTest::doRegisterTests()
+	{
+		doRegisterTest( "MeshLodTest::SelectLod", std::bind( &MeshLodTest::SelectLod, this ) );
+		doRegisterTest( "MeshLodTest::LodIndexRange", std::bind( &MeshLodTest::LodIndexRange, this ) );
+		doRegisterTest( "MeshLodTest::BinaryLods", std::bind( &MeshLodTest::BinaryLods, this ) );
+		doRegisterTest( "MeshLodTest::PixelsPerUnit", std::bind( &MeshLodTest::PixelsPerUnit, this ) );
+	}
+
+	void MeshLodTest::SelectLod()
+	{
+		Scene scene{ cuT( "LodScene" ), m_engine };
+		auto mesh = meshlod::createMesh( m_engine, scene, cuT( "LodCube" ) );
+		auto & mapping = *mesh->getSubmesh( 0u )->getComponent< TriFaceMapping >();
+		// Without reduced levels, the full detail is always selected.
+		CT_EQUAL( mapping.selectLod( 0.0f, 1.0f ), 0u );
+
+		meshlod::setLods( *mesh );
+		CT_EQUAL( mapping.getLodsCount(), 2u );
+		CT_EQUAL( mapping.getLodsElementsCount(), 3u );
+		// The coarsest level whose error, in pixels, is tolerable.
+		CT_EQUAL( mapping.selectLod( 0.0f, 1.0f ), 2u );
+		CT_EQUAL( mapping.selectLod( 5.0f, 1.0f ), 2u );
+		CT_EQUAL( mapping.selectLod( 50.0f, 1.0f ), 1u );
+		CT_EQUAL( mapping.selectLod( 500.0f, 1.0f ), 0u );
+		CT_EQUAL( mapping.selectLod( 500.0f, 10.0f ), 1u );
+
+		scene.cleanup();
+		m_engine.getRenderLoop().renderSyncFrame();
+	}
+
+	void MeshLodTest::LodIndexRange()
+	{
+		Scene scene{ cuT( "LodScene" ), m_engine };
+		auto mesh = meshlod::createMesh( m_engine, scene, cuT( "LodCube" ) );
+		auto & mapping = meshlod::setLods( *mesh );
+		// The levels indices follow the full detail ones.
+		auto range = mapping.getLodIndexRange( 0u );
+		CT_EQUAL( range[0], 0u );
+		CT_EQUAL( range[1], 12u );
+		range = mapping.getLodIndexRange( 1u );
+		CT_EQUAL( range[0], 12u );
+		CT_EQUAL( range[1], 6u );
+		range = mapping.getLodIndexRange( 2u );
+		CT_EQUAL( range[0], 18u );
+		CT_EQUAL( range[1], 3u );
+		// Unknown levels fall back to the full detail.
+		range = mapping.getLodIndexRange( 3u );
+		CT_EQUAL( range[0], 0u );
+		CT_EQUAL( range[1], 12u );
+
+		scene.cleanup();
+		m_engine.getRenderLoop().renderSyncFrame();
+	}
+
+	void MeshLodTest::BinaryLods()
+	{
+		Scene scene{ cuT( "LodScene" ), m_engine };
+		String name = cuT( "LodCube" );
+		Path path{ name + cuT( ".cmsh" ) };
+		auto src = meshlod::createMesh( m_engine, scene, name );
+		meshlod::setLods( *src );
+		{
+			BinaryFile file{ path, File::OpenMode::eWrite };
+			CT_CHECK( BinaryWriter< Mesh >{}.write( *src, file ) );
+		}
+
+		auto dst = scene.createMesh( name + cuT( "_imp" ), scene );
+		CT_REQUIRE( dst != nullptr );
+		{
+			BinaryFile file{ path, File::OpenMode::eRead };
+			BinaryParser< Mesh > parser;
+			CT_CHECK( parser.parse( *dst, file ) );
+		}
+
+		CT_REQUIRE( dst->getSubmeshCount() == src->getSubmeshCount() );
+
+		for ( uint32_t i = 0u; i < src->getSubmeshCount(); ++i )
+		{
+			auto lhs = src->getSubmesh( i )->getComponent< TriFaceMapping >();
+			auto rhs = dst->getSubmesh( i )->getComponent< TriFaceMapping >();
+			CT_REQUIRE( rhs != nullptr );
+			CT_EQUAL( *lhs, *rhs );
+		}
+
+		CT_EQUAL( dst->getSubmesh( 0u )->getComponent< TriFaceMapping >()->getLodsCount(), 2u );
+		File::deleteFile( path );
+		scene.cleanup();
+		m_engine.getRenderLoop().renderSyncFrame();
+	}
+
+	void MeshLodTest::PixelsPerUnit()
+	{
+		Viewport viewport{ m_engine };
+		viewport.resize( Size{ 100u, 100u } );
+		Frustum frustum{ viewport };
+		frustum.update( matrix::perspective( Angle::fromDegrees( 90.0f ), 1.0f, 0.1f, 100.0f )
+			, Matrix4x4f{ 1.0f } );
+		// With a 90 degrees vertical field of view, the view height at a distance d is 2 * d.
+		CT_EQUAL( frustum.getPixelsPerUnit( Point3f{ 0.0f, 0.0f, -10.0f } ), 5.0f );
+		CT_EQUAL( frustum.getPixelsPerUnit( Point3f{ 3.0f, -2.0f, -50.0f } ), 1.0f );
+	}
+}
@@ -0,0 +1,26 @@
+/* See LICENSE file in root folder */
+#ifndef ___C3DT_MESH_LOD_TEST_H___
+#define ___C3DT_MESH_LOD_TEST_H___
+
+#include "Castor3DTestPrerequisites.hpp"
+
+namespace Testing
+{
+	class MeshLodTest
+		: public C3DTestCase
+	{
+	public:
+		explicit MeshLodTest( castor3d::Engine & engine );
+
+	private:
+		void doRegisterTests()override;
+
+	private:
+		void SelectLod();
+		void LodIndexRange();
+		void BinaryLods();
+		void PixelsPerUnit();
+	};
+}
+
+#endif
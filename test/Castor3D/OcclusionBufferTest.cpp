@@ -0,0 +1,178 @@
+#include "OcclusionBufferTest.hpp"
+
+#include <Castor3D/Model/Mesh/Submesh/Component/Face.hpp>
+#include <Castor3D/Render/Culling/OcclusionBuffer.hpp>
+
+#include <CastorUtils/Math/TransformationMatrix.hpp>
+
+using namespace castor;
+using namespace castor3d;
+
+namespace Testing
+{
+	namespace occbuf
+	{
+		static uint32_t constexpr Width = 256u;
+		static uint32_t constexpr Height = 128u;
+
+		// Camera at (0, 0, 5), looking at the origin, with the same projection as a Camera's.
+		static Matrix4x4f getViewProj()
+		{
+			return matrix::reverseDepth( matrix::perspective( Angle::fromDegrees( 60.0f ), 2.0f, 0.1f, 100.0f ) )
+				* matrix::lookAt( Point3f{ 0.0f, 0.0f, 5.0f }, Point3f{}, Point3f{ 0.0f, 1.0f, 0.0f } );
+		}
+
+		static Matrix4x4f getTransform( Point3f const & position
+			, Point3f const & scale )
+		{
+			Matrix4x4f result;
+			matrix::setTransform( result, position, scale, Quaternion::identity() );
+			return result;
+		}
+
+		// A [-1, 1] quad, in the XY plane.
+		static void addQuad( OcclusionBuffer & buffer
+			, Matrix4x4f const & transform )
+		{
+			Point3fArray positions{ Point3f{ -1.0f, -1.0f, 0.0f }
+				, Point3f{ 1.0f, -1.0f, 0.0f }
+				, Point3f{ 1.0f, 1.0f, 0.0f }
+				, Point3f{ -1.0f, 1.0f, 0.0f } };
+			FaceArray faces{ Face{ 0u, 1u, 2u }
+				, Face{ 0u, 2u, 3u } };
+			buffer.addOccluder( positions, faces, transform );
+		}
+
+		static BoundingBox makeBox( float halfSize )
+		{
+			return BoundingBox{ Point3f{ -halfSize, -halfSize, -halfSize }
+				, Point3f{ halfSize, halfSize, halfSize } };
+		}
+
+		// A 4x4 quad at the origin.
+		static void fillBuffer( OcclusionBuffer & buffer )
+		{
+			buffer.clear( getViewProj() );
+			addQuad( buffer, getTransform( Point3f{}, Point3f{ 2.0f, 2.0f, 1.0f } ) );
+			buffer.buildPyramid();
+		}
+	}
+
+	//*********************************************************************************************
+
+	OcclusionBufferTest::OcclusionBufferTest( Engine & engine )
+		: C3DTestCase{ "OcclusionBufferTest", engine }
+	{
+	}
+
+	void OcclusionBufferTest::doRegisterTests()
+	{
+		doRegisterTest( "OcclusionBufferTest::Empty", std::bind( &OcclusionBufferTest::Empty, this ) );
+		doRegisterTest( "OcclusionBufferTest::Occluded", std::bind( &OcclusionBufferTest::Occluded, this ) );
+		doRegisterTest( "OcclusionBufferTest::Visible", std::bind( &OcclusionBufferTest::Visible, this ) );
+		doRegisterTest( "OcclusionBufferTest::Pyramid", std::bind( &OcclusionBufferTest::Pyramid, this ) );
+		doRegisterTest( "OcclusionBufferTest::CameraPlane", std::bind( &OcclusionBufferTest::CameraPlane, this ) );
+	}
+
+	void OcclusionBufferTest::Empty()
+	{
+		OcclusionBuffer buffer{ occbuf::Width, occbuf::Height };
+		CT_EQUAL( buffer.getWidth(), occbuf::Width );
+		CT_EQUAL( buffer.getHeight(), occbuf::Height );
+		CT_EQUAL( buffer.getLevelsCount(), 9u );
+		buffer.clear( occbuf::getViewProj() );
+		buffer.buildPyramid();
+		CT_CHECK( !buffer.hasOccluders() );
+		CT_CHECK( !buffer.isOccluded( occbuf::makeBox( 0.5f ), occbuf::getTransform( Point3f{ 0.0f, 0.0f, -3.0f }, Point3f{ 1.0f, 1.0f, 1.0f } ) ) );
+		// An occluder outside of the screen writes nothing.
+		occbuf::addQuad( buffer, occbuf::getTransform( Point3f{ 0.0f, 0.0f, 10.0f }, Point3f{ 1.0f, 1.0f, 1.0f } ) );
+		buffer.buildPyramid();
+		CT_CHECK( !buffer.hasOccluders() );
+	}
+
+	void OcclusionBufferTest::Occluded()
+	{
+		OcclusionBuffer buffer{ occbuf::Width, occbuf::Height };
+		occbuf::fillBuffer( buffer );
+		CT_EQUAL( buffer.getTrianglesCount(), 2u );
+		auto box = occbuf::makeBox( 0.5f );
+		auto scale = Point3f{ 1.0f, 1.0f, 1.0f };
+		// Right behind the occluder.
+		CT_CHECK( buffer.isOccluded( box, occbuf::getTransform( Point3f{ 0.0f, 0.0f, -3.0f }, scale ) ) );
+		// Far behind, but smaller on screen.
+		CT_CHECK( buffer.isOccluded( box, occbuf::getTransform( Point3f{ 1.0f, -1.0f, -50.0f }, scale ) ) );
+		// Near a corner, still hidden.
+		CT_CHECK( buffer.isOccluded( box, occbuf::getTransform( Point3f{ 1.0f, 1.0f, -1.0f }, scale ) ) );
+	}
+
+	void OcclusionBufferTest::Visible()
+	{
+		OcclusionBuffer buffer{ occbuf::Width, occbuf::Height };
+		occbuf::fillBuffer( buffer );
+		auto box = occbuf::makeBox( 0.5f );
+		auto scale = Point3f{ 1.0f, 1.0f, 1.0f };
+		// In front of the occluder.
+		CT_CHECK( !buffer.isOccluded( box, occbuf::getTransform( Point3f{ 0.0f, 0.0f, 2.0f }, scale ) ) );
+		// Crossing the occluder.
+		CT_CHECK( !buffer.isOccluded( box, occbuf::getTransform( Point3f{ 0.0f, 0.0f, 0.0f }, scale ) ) );
+		// Beside the occluder.
+		CT_CHECK( !buffer.isOccluded( box, occbuf::getTransform( Point3f{ 6.0f, 0.0f, -3.0f }, scale ) ) );
+		// Partly behind the occluder.
+		CT_CHECK( !buffer.isOccluded( box, occbuf::getTransform( Point3f{ 2.5f, 0.0f, -3.0f }, scale ) ) );
+		// Larger than the occluder on screen.
+		CT_CHECK( !buffer.isOccluded( occbuf::makeBox( 4.0f ), occbuf::getTransform( Point3f{ 0.0f, 0.0f, -10.0f }, scale ) ) );
+		// Outside of the screen.
+		CT_CHECK( !buffer.isOccluded( box, occbuf::getTransform( Point3f{ 0.0f, 50.0f, -3.0f }, scale ) ) );
+	}
+
+	void OcclusionBufferTest::Pyramid()
+	{
+		OcclusionBuffer buffer{ occbuf::Width, occbuf::Height };
+		occbuf::fillBuffer( buffer );
+		// The occluder covers the buffer center.
+		CT_CHECK( buffer.getDepth( 0u, occbuf::Width / 2u, occbuf::Height / 2u ) > 0.0f );
+		CT_EQUAL( buffer.getDepth( 0u, 0u, 0u ), 0.0f );
+
+		for ( uint32_t level = 1u; level < buffer.getLevelsCount(); ++level )
+		{
+			auto parentWidth = occbuf::Width >> ( level - 1u );
+			auto parentHeight = std::max( 1u, occbuf::Height >> ( level - 1u ) );
+			bool conservative = true;
+
+			for ( uint32_t y = 0u; y < std::max( 1u, occbuf::Height >> level ); ++y )
+			{
+				for ( uint32_t x = 0u; x < ( occbuf::Width >> level ); ++x )
+				{
+					auto depth = buffer.getDepth( level, x, y );
+
+					for ( uint32_t i = 0u; i < 4u; ++i )
+					{
+						auto childX = std::min( 2u * x + ( i & 1u ), parentWidth - 1u );
+						auto childY = std::min( 2u * y + ( i >> 1u ), parentHeight - 1u );
+						conservative = conservative
+							&& depth <= buffer.getDepth( level - 1u, childX, childY );
+					}
+				}
+			}
+
+			CT_CHECK( conservative );
+		}
+
+		// The top level keeps the farthest depth, the empty one.
+		CT_EQUAL( buffer.getDepth( buffer.getLevelsCount() - 1u, 0u, 0u ), 0.0f );
+	}
+
+	void OcclusionBufferTest::CameraPlane()
+	{
+		OcclusionBuffer buffer{ occbuf::Width, occbuf::Height };
+		buffer.clear( occbuf::getViewProj() );
+		// In the camera plane, ignored.
+		occbuf::addQuad( buffer, occbuf::getTransform( Point3f{ 0.0f, 0.0f, 5.0f }, Point3f{ 2.0f, 2.0f, 2.0f } ) );
+		CT_CHECK( !buffer.hasOccluders() );
+		occbuf::addQuad( buffer, occbuf::getTransform( Point3f{}, Point3f{ 2.0f, 2.0f, 1.0f } ) );
+		buffer.buildPyramid();
+		CT_CHECK( buffer.hasOccluders() );
+		// A box around the camera is never occluded.
+		CT_CHECK( !buffer.isOccluded( occbuf::makeBox( 1.0f ), occbuf::getTransform( Point3f{ 0.0f, 0.0f, 5.0f }, Point3f{ 1.0f, 1.0f, 1.0f } ) ) );
+	}
+}
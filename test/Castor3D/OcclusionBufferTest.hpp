@@ -0,0 +1,27 @@
+/* See LICENSE file in root folder */
+#ifndef ___C3DT_OCCLUSION_BUFFER_TEST_H___
+#define ___C3DT_OCCLUSION_BUFFER_TEST_H___
+
+#include "Castor3DTestPrerequisites.hpp"
+
+namespace Testing
+{
+	class OcclusionBufferTest
+		: public C3DTestCase
+	{
+	public:
+		explicit OcclusionBufferTest( castor3d::Engine & engine );
+
+	private:
+		void doRegisterTests()override;
+
+	private:
+		void Empty();
+		void Occluded();
+		void Visible();
+		void Pyramid();
+		void CameraPlane();
+	};
+}
+
+#endif
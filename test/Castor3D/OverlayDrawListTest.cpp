@@ -0,0 +1,223 @@
+#include "OverlayDrawListTest.hpp"
+
+#include <Castor3D/Render/Overlays/OverlayDrawList.hpp>
+
+#include <map>
+#include <random>
+
+using namespace castor;
+using namespace castor3d;
+
+namespace Testing
+{
+	namespace ovdrwlst
+	{
+		// The draws are identified by their overlay index, which is set when filling the buffers.
+		static OverlayDrawData makeDraw( OverlayPipelineData const & pipelineData
+			, uint32_t id )
+		{
+			OverlayDrawData result{};
+			result.pipelineData = &pipelineData;
+			result.overlayIndex = id;
+			return result;
+		}
+
+		static std::vector< uint32_t > getIds( OverlayDrawList & list )
+		{
+			std::vector< uint32_t > result;
+
+			for ( auto & draw : list.getDraws() )
+			{
+				result.push_back( draw.overlayIndex );
+			}
+
+			return result;
+		}
+	}
+
+	//*********************************************************************************************
+
+	OverlayDrawListTest::OverlayDrawListTest( Engine & engine )
+		: C3DTestCase{ "OverlayDrawListTest", engine }
+	{
+	}
+
+	void OverlayDrawListTest::doRegisterTests()
+	{
+		doRegisterTest( "OverlayDrawListTest::Empty", std::bind( &OverlayDrawListTest::Empty, this ) );
+		doRegisterTest( "OverlayDrawListTest::Batches", std::bind( &OverlayDrawListTest::Batches, this ) );
+		doRegisterTest( "OverlayDrawListTest::Levels", std::bind( &OverlayDrawListTest::Levels, this ) );
+		doRegisterTest( "OverlayDrawListTest::Changes", std::bind( &OverlayDrawListTest::Changes, this ) );
+		doRegisterTest( "OverlayDrawListTest::Random", std::bind( &OverlayDrawListTest::Random, this ) );
+	}
+
+	void OverlayDrawListTest::Empty()
+	{
+		OverlayDrawList list;
+		// The first sort always reports a change, nothing has been recorded yet.
+		CT_CHECK( list.sort() );
+		CT_EQUAL( list.getDraws().size(), 0u );
+		CT_EQUAL( list.getBatches().size(), 0u );
+		list.clear();
+		CT_CHECK( !list.sort() );
+	}
+
+	void OverlayDrawListTest::Batches()
+	{
+		OverlayPipelineData a;
+		OverlayPipelineData b;
+		OverlayDrawList list;
+		list.add( 0u, ovdrwlst::makeDraw( a, 0u ) );
+		list.add( 0u, ovdrwlst::makeDraw( b, 1u ) );
+		list.add( 0u, ovdrwlst::makeDraw( a, 2u ) );
+		list.add( 0u, ovdrwlst::makeDraw( b, 3u ) );
+		list.add( 0u, ovdrwlst::makeDraw( a, 4u ) );
+		list.sort();
+		// Inside a level, the draws sharing a pipeline data are merged, in registration order.
+		CT_CHECK( ovdrwlst::getIds( list ) == ( std::vector< uint32_t >{ 0u, 2u, 4u, 1u, 3u } ) );
+		auto batches = list.getBatches();
+		CT_EQUAL( batches.size(), 2u );
+		CT_CHECK( batches[0].pipelineData == &a );
+		CT_EQUAL( batches[0].first, 0u );
+		CT_EQUAL( batches[0].offset, 0u );
+		CT_EQUAL( batches[0].count, 3u );
+		CT_CHECK( batches[1].pipelineData == &b );
+		CT_EQUAL( batches[1].first, 3u );
+		CT_EQUAL( batches[1].offset, 0u );
+		CT_EQUAL( batches[1].count, 2u );
+	}
+
+	void OverlayDrawListTest::Levels()
+	{
+		OverlayPipelineData a;
+		OverlayPipelineData b;
+		OverlayPipelineData c;
+		OverlayDrawList list;
+		// Registered out of levels order.
+		list.add( 2u, ovdrwlst::makeDraw( a, 0u ) );
+		list.add( 1u, ovdrwlst::makeDraw( a, 1u ) );
+		list.add( 1u, ovdrwlst::makeDraw( b, 2u ) );
+		list.add( 0u, ovdrwlst::makeDraw( c, 3u ) );
+		list.add( 0u, ovdrwlst::makeDraw( b, 4u ) );
+		list.add( 2u, ovdrwlst::makeDraw( c, 5u ) );
+		list.sort();
+		// Level 0: c, b. Level 1: b carries on, then a. Level 2: a carries on, then c.
+		CT_CHECK( ovdrwlst::getIds( list ) == ( std::vector< uint32_t >{ 3u, 4u, 2u, 1u, 0u, 5u } ) );
+		auto batches = list.getBatches();
+		CT_EQUAL( batches.size(), 4u );
+		CT_CHECK( batches[0].pipelineData == &c );
+		CT_EQUAL( batches[0].count, 1u );
+		CT_CHECK( batches[1].pipelineData == &b );
+		CT_EQUAL( batches[1].first, 1u );
+		CT_EQUAL( batches[1].count, 2u );
+		CT_CHECK( batches[2].pipelineData == &a );
+		CT_EQUAL( batches[2].first, 3u );
+		CT_EQUAL( batches[2].count, 2u );
+		// The second batch of a pipeline data follows the first one in its indirect buffer.
+		CT_CHECK( batches[3].pipelineData == &c );
+		CT_EQUAL( batches[3].first, 5u );
+		CT_EQUAL( batches[3].offset, 1u );
+		CT_EQUAL( batches[3].count, 1u );
+	}
+
+	void OverlayDrawListTest::Changes()
+	{
+		OverlayPipelineData a;
+		OverlayPipelineData b;
+		OverlayDrawList list;
+		auto fill = [&]( uint32_t count )
+		{
+			list.clear();
+
+			for ( uint32_t i = 0u; i < count; ++i )
+			{
+				list.add( i % 2u, ovdrwlst::makeDraw( ( i % 3u ) ? a : b, i ) );
+			}
+
+			return list.sort();
+		};
+		CT_CHECK( fill( 10u ) );
+		// Same draws, nothing to record again.
+		CT_CHECK( !fill( 10u ) );
+		CT_CHECK( !fill( 10u ) );
+		// An added draw changes a batch.
+		CT_CHECK( fill( 11u ) );
+		CT_CHECK( !fill( 11u ) );
+		// A removed draw too.
+		CT_CHECK( fill( 10u ) );
+		// A destroyed pipeline data forces a new record.
+		list.invalidate();
+		CT_CHECK( fill( 10u ) );
+		CT_CHECK( !fill( 10u ) );
+		// A draw moved to another level.
+		list.clear();
+
+		for ( uint32_t i = 0u; i < 10u; ++i )
+		{
+			list.add( ( i + 1u ) % 2u, ovdrwlst::makeDraw( ( i % 3u ) ? a : b, i ) );
+		}
+
+		CT_CHECK( list.sort() );
+	}
+
+	void OverlayDrawListTest::Random()
+	{
+		std::mt19937 engine{ 42u };
+		std::vector< OverlayPipelineData > pipelines( 6u );
+		OverlayDrawList list;
+
+		for ( uint32_t test = 0u; test < 50u; ++test )
+		{
+			std::uniform_int_distribution< uint32_t > count{ 0u, 200u };
+			std::uniform_int_distribution< uint32_t > level{ 0u, 8u };
+			std::uniform_int_distribution< size_t > pipeline{ 0u, pipelines.size() - 1u };
+			std::vector< uint32_t > levels;
+			list.clear();
+
+			for ( uint32_t i = count( engine ); i > 0u; --i )
+			{
+				levels.push_back( level( engine ) );
+				list.add( levels.back()
+					, ovdrwlst::makeDraw( pipelines[pipeline( engine )], uint32_t( levels.size() - 1u ) ) );
+			}
+
+			list.sort();
+			auto draws = list.getDraws();
+			auto batches = list.getBatches();
+			CT_EQUAL( draws.size(), levels.size() );
+			std::map< OverlayPipelineData const *, uint32_t > offsets;
+			uint32_t drawIndex{};
+
+			for ( auto & batch : batches )
+			{
+				CT_EQUAL( batch.first, drawIndex );
+				CT_CHECK( batch.count > 0u );
+				// Consecutive batches always use different pipeline data.
+				CT_CHECK( drawIndex == 0u || draws[drawIndex - 1u].pipelineData != batch.pipelineData );
+				// The batch draws are contiguous in the pipeline data's indirect buffer.
+				CT_EQUAL( batch.offset, offsets[batch.pipelineData] );
+				offsets[batch.pipelineData] += batch.count;
+
+				for ( uint32_t i = 0u; i < batch.count; ++i )
+				{
+					CT_CHECK( draws[drawIndex + i].pipelineData == batch.pipelineData );
+				}
+
+				drawIndex += batch.count;
+			}
+
+			CT_EQUAL( drawIndex, uint32_t( draws.size() ) );
+
+			for ( uint32_t i = 1u; i < draws.size(); ++i )
+			{
+				auto & prv = draws[i - 1u];
+				auto & cur = draws[i];
+				// The levels are drawn in order, and the registration order is kept for a given pipeline data.
+				CT_CHECK( levels[prv.overlayIndex] <= levels[cur.overlayIndex] );
+				CT_CHECK( levels[prv.overlayIndex] != levels[cur.overlayIndex]
+					|| prv.pipelineData != cur.pipelineData
+					|| prv.overlayIndex < cur.overlayIndex );
+			}
+		}
+	}
+}
@@ -0,0 +1,27 @@
+/* See LICENSE file in root folder */
+#ifndef ___C3DT_OVERLAY_DRAW_LIST_TEST_H___
+#define ___C3DT_OVERLAY_DRAW_LIST_TEST_H___
+
+#include "Castor3DTestPrerequisites.hpp"
+
+namespace Testing
+{
+	class OverlayDrawListTest
+		: public C3DTestCase
+	{
+	public:
+		explicit OverlayDrawListTest( castor3d::Engine & engine );
+
+	private:
+		void doRegisterTests()override;
+
+	private:
+		void Empty();
+		void Batches();
+		void Levels();
+		void Changes();
+		void Random();
+	};
+}
+
+#endif
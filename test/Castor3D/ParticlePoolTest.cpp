@@ -0,0 +1,173 @@
+#include "ParticlePoolTest.hpp"
+
+#include <Castor3D/Scene/ParticleSystem/Particle.hpp>
+#include <Castor3D/Scene/ParticleSystem/ParticleDeclaration.hpp>
+#include <Castor3D/Scene/ParticleSystem/ParticlePool.hpp>
+
+using namespace castor;
+using namespace castor3d;
+
+namespace Testing
+{
+	namespace ptclpool
+	{
+		static uint32_t constexpr Capacity = 8u;
+		static uint32_t constexpr Position = 0u;
+		static uint32_t constexpr Id = 1u;
+		static uint32_t constexpr Lifetime = 2u;
+
+		static ParticleDeclaration makeDeclaration()
+		{
+			ParticleDeclaration result;
+			result.push_back( ParticleElementDeclaration{ cuT( "position" ), ElementUsage::eUnknown, ParticleFormat::eVec3f, result.stride() } );
+			result.push_back( ParticleElementDeclaration{ cuT( "id" ), ElementUsage::eUnknown, ParticleFormat::eFloat, result.stride() } );
+			result.push_back( ParticleElementDeclaration{ cuT( "lifetime" ), ElementUsage::eUnknown, ParticleFormat::eFloat, result.stride() } );
+			return result;
+		}
+
+		static Particle makeParticle( ParticleDeclaration const & declaration
+			, uint32_t id )
+		{
+			Particle result{ declaration };
+			auto value = float( id );
+			result.setValue< ParticleFormat::eVec3f >( Position, Point3f{ value, value * 2.0f, value * 3.0f } );
+			result.setValue< ParticleFormat::eFloat >( Id, value );
+			result.setValue< ParticleFormat::eFloat >( Lifetime, value * 0.5f );
+			return result;
+		}
+
+		static void fill( ParticlePool & pool
+			, ParticleDeclaration const & declaration
+			, uint32_t count )
+		{
+			for ( uint32_t i = 0u; i < count; ++i )
+			{
+				pool.emplace( makeParticle( declaration, i ) );
+			}
+		}
+
+		// Retrieves the ids of the alive particles, in pool order.
+		static std::vector< float > getIds( ParticlePool const & pool )
+		{
+			auto ids = pool.getData< float >( Id );
+			return std::vector< float >( ids, ids + pool.size() );
+		}
+
+		// Checks that all the elements of the particle at given index belong to the same particle.
+		static bool isConsistent( ParticlePool const & pool
+			, uint32_t index )
+		{
+			auto id = pool.getData< float >( Id )[index];
+			auto & position = pool.getData< Point3f >( Position )[index];
+			auto lifetime = pool.getData< float >( Lifetime )[index];
+			return position == Point3f{ id, id * 2.0f, id * 3.0f }
+				&& lifetime == id * 0.5f;
+		}
+	}
+
+	//*********************************************************************************************
+
+	ParticlePoolTest::ParticlePoolTest( Engine & engine )
+		: C3DTestCase{ "ParticlePoolTest", engine }
+	{
+	}
+
+	void ParticlePoolTest::doRegisterTests()
+	{
+		doRegisterTest( "ParticlePoolTest::Emplace", std::bind( &ParticlePoolTest::Emplace, this ) );
+		doRegisterTest( "ParticlePoolTest::RemoveMiddle", std::bind( &ParticlePoolTest::RemoveMiddle, this ) );
+		doRegisterTest( "ParticlePoolTest::RemoveLast", std::bind( &ParticlePoolTest::RemoveLast, this ) );
+		doRegisterTest( "ParticlePoolTest::Pack", std::bind( &ParticlePoolTest::Pack, this ) );
+	}
+
+	void ParticlePoolTest::Emplace()
+	{
+		auto declaration = ptclpool::makeDeclaration();
+		ParticlePool pool{ declaration };
+		pool.initialise( ptclpool::Capacity, {} );
+		CT_EQUAL( pool.size(), 0u );
+		CT_EQUAL( pool.capacity(), ptclpool::Capacity );
+		ptclpool::fill( pool, declaration, ptclpool::Capacity );
+		CT_EQUAL( pool.size(), ptclpool::Capacity );
+		// The pool is full.
+		CT_CHECK( !pool.emplace( ptclpool::makeParticle( declaration, ptclpool::Capacity ) ) );
+		CT_EQUAL( pool.size(), ptclpool::Capacity );
+		Particle particle{ declaration };
+		pool.load( 3u, particle );
+		CT_EQUAL( particle.getValue< ParticleFormat::eFloat >( ptclpool::Id ), 3.0f );
+		CT_EQUAL( particle.getValue< ParticleFormat::eFloat >( ptclpool::Lifetime ), 1.5f );
+		CT_CHECK( particle.getValue< ParticleFormat::eVec3f >( ptclpool::Position ) == ( Point3f{ 3.0f, 6.0f, 9.0f } ) );
+	}
+
+	void ParticlePoolTest::RemoveMiddle()
+	{
+		auto declaration = ptclpool::makeDeclaration();
+		ParticlePool pool{ declaration };
+		pool.initialise( ptclpool::Capacity, {} );
+		ptclpool::fill( pool, declaration, 5u );
+		// The last particle takes the place of the removed one.
+		pool.remove( 1u );
+		CT_EQUAL( pool.size(), 4u );
+		CT_CHECK( ptclpool::getIds( pool ) == ( std::vector< float >{ 0.0f, 4.0f, 2.0f, 3.0f } ) );
+		pool.remove( 0u );
+		CT_EQUAL( pool.size(), 3u );
+		CT_CHECK( ptclpool::getIds( pool ) == ( std::vector< float >{ 3.0f, 4.0f, 2.0f } ) );
+
+		for ( uint32_t i = 0u; i < pool.size(); ++i )
+		{
+			CT_CHECK( ptclpool::isConsistent( pool, i ) );
+		}
+
+		// Freed slots are reused by the next emplacements.
+		CT_CHECK( pool.emplace( ptclpool::makeParticle( declaration, 7u ) ) );
+		CT_CHECK( ptclpool::getIds( pool ) == ( std::vector< float >{ 3.0f, 4.0f, 2.0f, 7.0f } ) );
+		CT_CHECK( ptclpool::isConsistent( pool, 3u ) );
+	}
+
+	void ParticlePoolTest::RemoveLast()
+	{
+		auto declaration = ptclpool::makeDeclaration();
+		ParticlePool pool{ declaration };
+		pool.initialise( ptclpool::Capacity, {} );
+		ptclpool::fill( pool, declaration, 3u );
+		pool.remove( 2u );
+		CT_EQUAL( pool.size(), 2u );
+		CT_CHECK( ptclpool::getIds( pool ) == ( std::vector< float >{ 0.0f, 1.0f } ) );
+		pool.remove( 1u );
+		pool.remove( 0u );
+		CT_EQUAL( pool.size(), 0u );
+		CT_CHECK( pool.emplace( ptclpool::makeParticle( declaration, 5u ) ) );
+		CT_CHECK( ptclpool::getIds( pool ) == ( std::vector< float >{ 5.0f } ) );
+		CT_CHECK( ptclpool::isConsistent( pool, 0u ) );
+	}
+
+	void ParticlePoolTest::Pack()
+	{
+		auto declaration = ptclpool::makeDeclaration();
+		ParticlePool pool{ declaration };
+		pool.initialise( ptclpool::Capacity, {} );
+		ptclpool::fill( pool, declaration, 6u );
+		pool.remove( 2u );
+		pool.remove( pool.size() - 1u );
+		auto stride = declaration.stride();
+		// One more particle than the alive ones, to check nothing is written past them.
+		std::vector< uint8_t > buffer( size_t( stride ) * ( pool.size() + 1u ), uint8_t{ 0xFF } );
+		pool.pack( buffer.data() );
+		std::vector< float > ids{ 0.0f, 1.0f, 5.0f, 3.0f };
+		CT_EQUAL( pool.size(), uint32_t( ids.size() ) );
+
+		for ( uint32_t i = 0u; i < pool.size(); ++i )
+		{
+			// The packed particle is the same as the interleaved one.
+			auto particle = ptclpool::makeParticle( declaration, uint32_t( ids[i] ) );
+			CT_CHECK( std::memcmp( buffer.data() + size_t( i ) * stride, particle.getData(), stride ) == 0 );
+		}
+
+		CT_CHECK( std::all_of( buffer.begin() + ptrdiff_t( stride ) * pool.size()
+			, buffer.end()
+			, []( uint8_t value )
+			{
+				return value == 0xFF;
+			} ) );
+	}
+}
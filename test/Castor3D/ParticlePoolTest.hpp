@@ -0,0 +1,26 @@
+/* See LICENSE file in root folder */
+#ifndef ___C3DT_PARTICLE_POOL_TEST_H___
+#define ___C3DT_PARTICLE_POOL_TEST_H___
+
+#include "Castor3DTestPrerequisites.hpp"
+
+namespace Testing
+{
+	class ParticlePoolTest
+		: public C3DTestCase
+	{
+	public:
+		explicit ParticlePoolTest( castor3d::Engine & engine );
+
+	private:
+		void doRegisterTests()override;
+
+	private:
+		void Emplace();
+		void RemoveMiddle();
+		void RemoveLast();
+		void Pack();
+	};
+}
+
+#endif
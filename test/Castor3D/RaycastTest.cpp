@@ -0,0 +1,203 @@
+#include "RaycastTest.hpp"
+
+#include <Castor3D/Engine.hpp>
+#include <Castor3D/Miscellaneous/Parameter.hpp>
+#include <Castor3D/Model/Mesh/MeshFactory.hpp>
+#include <Castor3D/Model/Mesh/MeshGenerator.hpp>
+#include <Castor3D/Model/Mesh/Submesh/Submesh.hpp>
+#include <Castor3D/Model/Mesh/Submesh/TriangleBvh.hpp>
+#include <Castor3D/Model/Mesh/Submesh/Component/Face.hpp>
+#include <Castor3D/Render/Ray.hpp>
+#include <Castor3D/Scene/Geometry.hpp>
+#include <Castor3D/Scene/Scene.hpp>
+#include <Castor3D/Scene/SceneNode.hpp>
+
+#include <random>
+
+using namespace castor;
+using namespace castor3d;
+
+namespace Testing
+{
+	namespace raycast
+	{
+		static SceneNodeRPtr createNode( Scene & scene
+			, String const & name
+			, Point3f const & position )
+		{
+			auto node = scene.addSceneNode( name
+				, scene.createSceneNode( name
+					, scene
+					, scene.getObjectRootNode()
+					, position
+					, Quaternion::identity()
+					, Point3f{ 1.0f, 1.0f, 1.0f }
+					, false ) );
+			node->update();
+			return node;
+		}
+	}
+
+	//*********************************************************************************************
+
+	RaycastTest::RaycastTest( Engine & engine )
+		: C3DTestCase{ "RaycastTest", engine }
+	{
+	}
+
+	void RaycastTest::doRegisterTests()
+	{
+		doRegisterTest( "RaycastTest::Triangle", std::bind( &RaycastTest::Triangle, this ) );
+		doRegisterTest( "RaycastTest::BoxSlabs", std::bind( &RaycastTest::BoxSlabs, this ) );
+		doRegisterTest( "RaycastTest::TriangleBvh", std::bind( &RaycastTest::TriangleBvh, this ) );
+		doRegisterTest( "RaycastTest::SceneRaycast", std::bind( &RaycastTest::SceneRaycast, this ) );
+	}
+
+	void RaycastTest::Triangle()
+	{
+		Point3f pt1{ 0.0f, 0.0f, 0.0f };
+		Point3f pt2{ 1.0f, 0.0f, 0.0f };
+		Point3f pt3{ 0.0f, 1.0f, 0.0f };
+		float distance{};
+		Point2f barycentrics;
+		Ray ray{ Point3f{ 0.25f, 0.5f, -2.0f }, Point3f{ 0.0f, 0.0f, 1.0f } };
+		CT_CHECK( ray.intersects( pt1, pt2, pt3, distance, barycentrics ) == Intersection::eIn );
+		CT_EQUAL( distance, 2.0f );
+		CT_EQUAL( barycentrics[0], 0.25f );
+		CT_EQUAL( barycentrics[1], 0.5f );
+		// Both windings are hit.
+		CT_CHECK( ray.intersects( pt1, pt3, pt2, distance ) == Intersection::eIn );
+		// Outside the triangle, on the pt2/pt3 edge side.
+		Ray outside{ Point3f{ 0.75f, 0.5f, -2.0f }, Point3f{ 0.0f, 0.0f, 1.0f } };
+		CT_CHECK( outside.intersects( pt1, pt2, pt3, distance ) == Intersection::eOut );
+		// Behind the ray origin.
+		Ray behind{ Point3f{ 0.25f, 0.25f, 2.0f }, Point3f{ 0.0f, 0.0f, 1.0f } };
+		CT_CHECK( behind.intersects( pt1, pt2, pt3, distance ) == Intersection::eOut );
+	}
+
+	void RaycastTest::BoxSlabs()
+	{
+		BoundingBox box{ Point3f{ -1.0f, -1.0f, -1.0f }, Point3f{ 1.0f, 1.0f, 1.0f } };
+		float distance{};
+		CT_CHECK( Ray( Point3f{ 0.0f, 0.0f, -5.0f }, Point3f{ 0.0f, 0.0f, 1.0f } ).intersects( box, distance ) == Intersection::eIn );
+		CT_EQUAL( distance, 4.0f );
+		// From inside, the exit point is reported.
+		CT_CHECK( Ray( Point3f{ 0.0f, 0.0f, 0.0f }, Point3f{ 1.0f, 0.0f, 0.0f } ).intersects( box, distance ) == Intersection::eIn );
+		CT_EQUAL( distance, 1.0f );
+		CT_CHECK( Ray( Point3f{ 0.0f, 2.0f, -5.0f }, Point3f{ 0.0f, 0.0f, 1.0f } ).intersects( box, distance ) == Intersection::eOut );
+		CT_CHECK( Ray( Point3f{ 0.0f, 0.0f, 5.0f }, Point3f{ 0.0f, 0.0f, 1.0f } ).intersects( box, distance ) == Intersection::eOut );
+		CT_CHECK( Ray( Point3f{ -5.0f, -5.0f, -5.0f }, Point3f{ 1.0f, 1.0f, 1.0f } ).intersects( box, distance ) == Intersection::eIn );
+		CT_EQUAL( distance, float( ( 5.0 - 1.0 ) * std::sqrt( 3.0 ) ) );
+	}
+
+	void RaycastTest::TriangleBvh()
+	{
+		std::mt19937 engine{ 42u };
+		std::uniform_real_distribution< float > centers{ -10.0f, 10.0f };
+		std::uniform_real_distribution< float > offsets{ -0.5f, 0.5f };
+		Point3fArray positions;
+		FaceArray faces;
+
+		for ( uint32_t i = 0u; i < 5000u; ++i )
+		{
+			Point3f center{ centers( engine ), centers( engine ), centers( engine ) };
+			auto index = uint32_t( positions.size() );
+
+			for ( uint32_t j = 0u; j < 3u; ++j )
+			{
+				positions.push_back( center + Point3f{ offsets( engine ), offsets( engine ), offsets( engine ) } );
+			}
+
+			faces.emplace_back( index, index + 1u, index + 2u );
+		}
+
+		castor3d::TriangleBvh bvh{ positions, faces };
+		CT_EQUAL( bvh.getTrianglesCount(), uint32_t( faces.size() ) );
+		uint32_t hits{};
+
+		for ( uint32_t i = 0u; i < 500u; ++i )
+		{
+			Ray ray{ Point3f{ centers( engine ), centers( engine ), -20.0f }
+				, Point3f{ offsets( engine ), offsets( engine ), 1.0f } };
+			// Reference: all the triangles.
+			float nearest = std::numeric_limits< float >::max();
+			uint32_t nearestFace{ ~0u };
+
+			for ( uint32_t j = 0u; j < uint32_t( faces.size() ); ++j )
+			{
+				float distance{};
+
+				if ( ray.intersects( positions[faces[j][0]], positions[faces[j][1]], positions[faces[j][2]], distance ) == Intersection::eIn
+					&& distance < nearest )
+				{
+					nearest = distance;
+					nearestFace = j;
+				}
+			}
+
+			castor3d::TriangleBvh::Hit hit;
+			auto found = bvh.intersect( ray.m_origin, ray.m_direction, std::numeric_limits< float >::max(), hit );
+			CT_EQUAL( found, nearestFace != ~0u );
+
+			if ( found )
+			{
+				++hits;
+				CT_EQUAL( hit.face, nearestFace );
+				CT_EQUAL( hit.distance, nearest );
+			}
+		}
+
+		CT_CHECK( hits > 0u );
+	}
+
+	void RaycastTest::SceneRaycast()
+	{
+		Scene scene{ cuT( "RaycastScene" ), m_engine };
+		auto mesh = scene.addNewMesh( cuT( "RaycastCube" ), scene );
+		Parameters parameters;
+		parameters.add( cuT( "width" ), cuT( "1.0" ) );
+		parameters.add( cuT( "height" ), cuT( "1.0" ) );
+		parameters.add( cuT( "depth" ), cuT( "1.0" ) );
+		m_engine.getMeshFactory().create( cuT( "cube" ) )->generate( *mesh, parameters );
+		auto nearNode = raycast::createNode( scene, cuT( "Near" ), Point3f{ 0.0f, 0.0f, 10.0f } );
+		auto farNode = raycast::createNode( scene, cuT( "Far" ), Point3f{ 0.0f, 0.0f, 20.0f } );
+		auto nearGeometry = scene.addGeometry( scene.createGeometry( cuT( "Near" ), scene, *nearNode, mesh ) );
+		scene.addGeometry( scene.createGeometry( cuT( "Far" ), scene, *farNode, mesh ) );
+
+		RaycastHit hit;
+		CT_CHECK( scene.raycast( Ray{ Point3f{ 0.0f, 0.0f, 0.0f }, Point3f{ 0.0f, 0.0f, 1.0f } }, hit ) );
+		CT_CHECK( hit.geometry == nearGeometry );
+		CT_EQUAL( hit.distance, 9.5f );
+		CT_CHECK( hit.barycentrics[0] >= 0.0f && hit.barycentrics[1] >= 0.0f );
+		CT_CHECK( hit.barycentrics[0] + hit.barycentrics[1] <= 1.0f );
+		// Beyond the max distance.
+		CT_CHECK( !scene.raycast( Ray{ Point3f{ 0.0f, 0.0f, 0.0f }, Point3f{ 0.0f, 0.0f, 1.0f } }, hit, 5.0f ) );
+		// Between both cubes, the far one is hit.
+		CT_CHECK( scene.raycast( Ray{ Point3f{ 0.0f, 0.0f, 15.0f }, Point3f{ 0.0f, 0.0f, 1.0f } }, hit ) );
+		CT_EQUAL( hit.distance, 4.5f );
+		CT_CHECK( !scene.raycast( Ray{ Point3f{ 2.0f, 0.0f, 0.0f }, Point3f{ 0.0f, 0.0f, 1.0f } }, hit ) );
+
+		// The batched queries give the same results as the single ones.
+		std::vector< Ray > rays;
+
+		for ( uint32_t i = 0u; i < 1000u; ++i )
+		{
+			auto x = float( i % 40u ) / 20.0f - 1.0f;
+			auto y = float( i / 40u ) / 12.5f - 1.0f;
+			rays.emplace_back( Point3f{ x, y, 0.0f }, Point3f{ 0.0f, 0.0f, 1.0f } );
+		}
+
+		std::vector< RaycastHit > hits;
+		scene.raycast( rays, hits );
+		CT_EQUAL( hits.size(), rays.size() );
+
+		for ( size_t i = 0u; i < rays.size(); ++i )
+		{
+			RaycastHit single;
+			CT_EQUAL( scene.raycast( rays[i], single ), bool( hits[i] ) );
+			CT_CHECK( single.geometry == hits[i].geometry );
+			CT_CHECK( single.submesh == hits[i].submesh );
+			CT_EQUAL( single.face, hits[i].face );
+		}
+	}
+}
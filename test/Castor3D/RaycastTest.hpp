@@ -0,0 +1,26 @@
+/* See LICENSE file in root folder */
+#ifndef ___C3DT_RAYCAST_TEST_H___
+#define ___C3DT_RAYCAST_TEST_H___
+
+#include "Castor3DTestPrerequisites.hpp"
+
+namespace Testing
+{
+	class RaycastTest
+		: public C3DTestCase
+	{
+	public:
+		explicit RaycastTest( castor3d::Engine & engine );
+
+	private:
+		void doRegisterTests()override;
+
+	private:
+		void Triangle();
+		void BoxSlabs();
+		void TriangleBvh();
+		void SceneRaycast();
+	};
+}
+
+#endif
@@ -0,0 +1,153 @@
+#include "ShadowMapSchedulerTest.hpp"
+
+#include <Castor3D/Render/ShadowMap/ShadowMapScheduler.hpp>
+
+#include <algorithm>
+
+using namespace castor;
+using namespace castor3d;
+
+namespace Testing
+{
+	namespace shdsched
+	{
+		static ShadowMapScheduler::RequestArray makeRequests( uint32_t count
+			, uint32_t cost
+			, bool outOfDate )
+		{
+			ShadowMapScheduler::RequestArray result;
+
+			for ( uint32_t i = 0u; i < count; ++i )
+			{
+				ShadowMapScheduler::Request request;
+				request.id = i;
+				request.cost = cost;
+				request.priority = float( i + 1u );
+				request.outOfDate = outOfDate;
+				result.push_back( request );
+			}
+
+			return result;
+		}
+
+		static uint32_t countRendered( ShadowMapScheduler::RequestArray const & requests )
+		{
+			return uint32_t( std::count_if( requests.begin()
+				, requests.end()
+				, []( ShadowMapScheduler::Request const & request )
+				{
+					return request.render;
+				} ) );
+		}
+	}
+
+	//*********************************************************************************************
+
+	ShadowMapSchedulerTest::ShadowMapSchedulerTest( Engine & engine )
+		: C3DTestCase{ "ShadowMapSchedulerTest", engine }
+	{
+	}
+
+	void ShadowMapSchedulerTest::doRegisterTests()
+	{
+		doRegisterTest( "ShadowMapSchedulerTest::FirstFrame", std::bind( &ShadowMapSchedulerTest::FirstFrame, this ) );
+		doRegisterTest( "ShadowMapSchedulerTest::Cached", std::bind( &ShadowMapSchedulerTest::Cached, this ) );
+		doRegisterTest( "ShadowMapSchedulerTest::Budget", std::bind( &ShadowMapSchedulerTest::Budget, this ) );
+		doRegisterTest( "ShadowMapSchedulerTest::Aging", std::bind( &ShadowMapSchedulerTest::Aging, this ) );
+		doRegisterTest( "ShadowMapSchedulerTest::Mandatory", std::bind( &ShadowMapSchedulerTest::Mandatory, this ) );
+	}
+
+	void ShadowMapSchedulerTest::FirstFrame()
+	{
+		// The layers never drawn are drawn, whatever the budget.
+		ShadowMapScheduler scheduler{ 1u };
+		auto requests = shdsched::makeRequests( 4u, 6u, false );
+		scheduler.schedule( requests );
+		CT_EQUAL( shdsched::countRendered( requests ), 4u );
+		CT_EQUAL( scheduler.getCounts().requested, 4u );
+		CT_EQUAL( scheduler.getCounts().rendered, 4u );
+		CT_EQUAL( scheduler.getCounts().deferred, 0u );
+		CT_EQUAL( scheduler.getCounts().cached, 0u );
+	}
+
+	void ShadowMapSchedulerTest::Cached()
+	{
+		ShadowMapScheduler scheduler{ 0u };
+		auto requests = shdsched::makeRequests( 4u, 1u, true );
+		scheduler.schedule( requests );
+		requests[2].outOfDate = false;
+		scheduler.schedule( requests );
+		CT_CHECK( !requests[2].render );
+		CT_EQUAL( shdsched::countRendered( requests ), 3u );
+		CT_EQUAL( scheduler.getCounts().cached, 1u );
+		// A layer that disappears is forgotten, and drawn when it comes back.
+		auto removed = requests.back();
+		requests.pop_back();
+		scheduler.schedule( requests );
+		removed.outOfDate = false;
+		requests.push_back( removed );
+		scheduler.schedule( requests );
+		CT_CHECK( requests.back().render );
+	}
+
+	void ShadowMapSchedulerTest::Budget()
+	{
+		ShadowMapScheduler scheduler{ 2u };
+		auto requests = shdsched::makeRequests( 4u, 1u, true );
+		scheduler.schedule( requests );
+		scheduler.schedule( requests );
+		// The two highest priorities fit in the budget.
+		CT_CHECK( !requests[0].render );
+		CT_CHECK( !requests[1].render );
+		CT_CHECK( requests[2].render );
+		CT_CHECK( requests[3].render );
+		CT_EQUAL( scheduler.getCounts().rendered, 2u );
+		CT_EQUAL( scheduler.getCounts().deferred, 2u );
+		// A redraw exceeding the budget is still done if it is the only one.
+		ShadowMapScheduler small{ 1u };
+		auto expensive = shdsched::makeRequests( 2u, 6u, true );
+		small.schedule( expensive );
+		small.schedule( expensive );
+		CT_EQUAL( shdsched::countRendered( expensive ), 1u );
+		CT_CHECK( expensive[1].render );
+	}
+
+	void ShadowMapSchedulerTest::Aging()
+	{
+		// Each out of date layer is drawn within MaxDeferredFrames frames, whatever its priority.
+		ShadowMapScheduler scheduler{ 1u };
+		auto requests = shdsched::makeRequests( 4u, 1u, true );
+		requests[0].priority = 0.001f;
+		scheduler.schedule( requests );
+		std::vector< uint32_t > waited( requests.size(), 0u );
+		uint32_t maxWaited{};
+
+		for ( uint32_t frame = 0u; frame < 4u * ShadowMapScheduler::MaxDeferredFrames; ++frame )
+		{
+			scheduler.schedule( requests );
+			CT_EQUAL( shdsched::countRendered( requests ), 1u );
+
+			for ( size_t i = 0u; i < requests.size(); ++i )
+			{
+				waited[i] = requests[i].render ? 0u : waited[i] + 1u;
+				maxWaited = std::max( maxWaited, waited[i] );
+			}
+		}
+
+		CT_CHECK( maxWaited <= ShadowMapScheduler::MaxDeferredFrames );
+	}
+
+	void ShadowMapSchedulerTest::Mandatory()
+	{
+		ShadowMapScheduler scheduler{ 1u };
+		auto requests = shdsched::makeRequests( 3u, 1u, true );
+		scheduler.schedule( requests );
+		requests[0].mandatory = true;
+		requests[1].mandatory = true;
+		scheduler.schedule( requests );
+		CT_CHECK( requests[0].render );
+		CT_CHECK( requests[1].render );
+		CT_CHECK( !requests[2].render );
+		CT_EQUAL( scheduler.getCounts().deferred, 1u );
+	}
+}
@@ -0,0 +1,27 @@
+/* See LICENSE file in root folder */
+#ifndef ___C3DT_SHADOW_MAP_SCHEDULER_TEST_H___
+#define ___C3DT_SHADOW_MAP_SCHEDULER_TEST_H___
+
+#include "Castor3DTestPrerequisites.hpp"
+
+namespace Testing
+{
+	class ShadowMapSchedulerTest
+		: public C3DTestCase
+	{
+	public:
+		explicit ShadowMapSchedulerTest( castor3d::Engine & engine );
+
+	private:
+		void doRegisterTests()override;
+
+	private:
+		void FirstFrame();
+		void Cached();
+		void Budget();
+		void Aging();
+		void Mandatory();
+	};
+}
+
+#endif
@@ -0,0 +1,395 @@
+#include "TextLayoutTest.hpp"
+
+#include <Castor3D/Overlay/TextLayout.hpp>
+
+#include <random>
+#include <thread>
+
+using namespace castor;
+using namespace castor3d;
+
+namespace Testing
+{
+	namespace txtlayout
+	{
+		static std::unique_ptr< Font > loadFont( Path const & folder )
+		{
+			// The Latin-1 glyphs are loaded with the font.
+			return std::make_unique< Font >( cuT( "Arial" ), 24u, folder / cuT( "arial.ttf" ) );
+		}
+
+		static bool areEqual( TextChar const & lhs, TextChar const & rhs )
+		{
+			return lhs.size == rhs.size
+				&& lhs.bearing == rhs.bearing
+				&& lhs.left == rhs.left
+				&& lhs.word == rhs.word
+				&& lhs.index == rhs.index;
+		}
+
+		static bool areEqual( TextWord const & lhs, TextWord const & rhs )
+		{
+			return lhs.range == rhs.range
+				&& lhs.left == rhs.left
+				&& lhs.width == rhs.width
+				&& lhs.charBegin == rhs.charBegin
+				&& lhs.charEnd == rhs.charEnd
+				&& lhs.line == rhs.line;
+		}
+
+		static bool areEqual( TextLine const & lhs, TextLine const & rhs )
+		{
+			return lhs.position == rhs.position
+				&& lhs.range == rhs.range
+				&& lhs.width == rhs.width
+				&& lhs.wordBegin == rhs.wordBegin
+				&& lhs.wordEnd == rhs.wordEnd
+				&& lhs.charBegin == rhs.charBegin
+				&& lhs.charEnd == rhs.charEnd;
+		}
+
+		template< typename ValueT >
+		static bool areEqual( ArrayView< ValueT const > const & lhs
+			, ArrayView< ValueT const > const & rhs )
+		{
+			return lhs.size() == rhs.size()
+				&& std::equal( lhs.begin(), lhs.end(), rhs.begin()
+					, []( ValueT const & l, ValueT const & r )
+					{
+						return areEqual( l, r );
+					} );
+		}
+
+		// Compares an updated layout with a layout computed from scratch.
+		static bool isSameAsFresh( Font const & font
+			, TextLayout const & layout
+			, std::u32string const & caption
+			, TextLayout::Config const & config )
+		{
+			TextLayout fresh;
+			fresh.update( font, caption, config );
+			return areEqual( layout.getChars(), fresh.getChars() )
+				&& areEqual( layout.getWords(), fresh.getWords() )
+				&& areEqual( layout.getLines(), fresh.getLines() )
+				&& layout.getCharCodes() == fresh.getCharCodes()
+				&& layout.getMaxRange() == fresh.getMaxRange()
+				&& layout.getTopOffset() == fresh.getTopOffset();
+		}
+	}
+
+	//*********************************************************************************************
+
+	TextLayoutTest::TextLayoutTest( Engine & engine )
+		: C3DTestCase{ "TextLayoutTest", engine }
+	{
+	}
+
+	void TextLayoutTest::doRegisterTests()
+	{
+		doRegisterTest( "TextLayoutTest::Words", std::bind( &TextLayoutTest::Words, this ) );
+		doRegisterTest( "TextLayoutTest::Paragraphs", std::bind( &TextLayoutTest::Paragraphs, this ) );
+		doRegisterTest( "TextLayoutTest::Incremental", std::bind( &TextLayoutTest::Incremental, this ) );
+		doRegisterTest( "TextLayoutTest::Options", std::bind( &TextLayoutTest::Options, this ) );
+		doRegisterTest( "TextLayoutTest::Wrapping", std::bind( &TextLayoutTest::Wrapping, this ) );
+		doRegisterTest( "TextLayoutTest::Random", std::bind( &TextLayoutTest::Random, this ) );
+		doRegisterTest( "TextLayoutTest::Glyphs", std::bind( &TextLayoutTest::Glyphs, this ) );
+		doRegisterTest( "TextLayoutTest::ConcurrentGlyphs", std::bind( &TextLayoutTest::ConcurrentGlyphs, this ) );
+		doRegisterTest( "TextLayoutTest::FontRange", std::bind( &TextLayoutTest::FontRange, this ) );
+	}
+
+	void TextLayoutTest::Words()
+	{
+		auto font = txtlayout::loadFont( m_testDataFolder );
+		TextLayout layout;
+		CT_CHECK( layout.update( *font, U"Hello World", {} ) );
+		// The spaces don't produce chars.
+		CT_EQUAL( layout.getChars().size(), 10u );
+		CT_CHECK( layout.getCharCodes() == U"HelloWorld" );
+		CT_EQUAL( layout.getWords().size(), 2u );
+		CT_EQUAL( layout.getLines().size(), 1u );
+		CT_EQUAL( layout.getChars()[5].word, 1u );
+		CT_EQUAL( layout.getChars()[5].index, 5u );
+		CT_EQUAL( layout.getChars()[5].left, 0.0f );
+		CT_EQUAL( layout.getWords()[1].charBegin, 5u );
+		CT_EQUAL( layout.getWords()[1].charEnd, 10u );
+		CT_CHECK( layout.getWords()[1].left > layout.getWords()[0].width );
+		CT_EQUAL( layout.getLines()[0].charEnd, 10u );
+		CT_EQUAL( layout.getLines()[0].wordEnd, 2u );
+	}
+
+	void TextLayoutTest::Paragraphs()
+	{
+		auto font = txtlayout::loadFont( m_testDataFolder );
+		TextLayout layout;
+		layout.update( *font, U"ab\ncd ef\ngh", {} );
+		CT_EQUAL( layout.getChars().size(), 8u );
+		CT_EQUAL( layout.getWords().size(), 4u );
+		CT_EQUAL( layout.getLines().size(), 3u );
+		auto lines = layout.getLines();
+		CT_CHECK( lines[1].position->y > lines[0].position->y );
+		CT_CHECK( lines[2].position->y > lines[1].position->y );
+		CT_EQUAL( lines[1].wordBegin, 1u );
+		CT_EQUAL( lines[1].wordEnd, 3u );
+		CT_EQUAL( lines[1].charBegin, 2u );
+		CT_EQUAL( lines[1].charEnd, 6u );
+		CT_EQUAL( layout.getWords()[3].line, 2u );
+		CT_EQUAL( layout.getChars()[6].word, 3u );
+		// Each line starts at the left.
+		CT_EQUAL( layout.getWords()[3].left, 0.0f );
+	}
+
+	void TextLayoutTest::Incremental()
+	{
+		auto font = txtlayout::loadFont( m_testDataFolder );
+		TextLayout::Config config;
+		config.size = { 400.0f, 300.0f };
+		TextLayout layout;
+		std::u32string caption{ U"FPS: 60\nCPU: 12.5 ms\nGPU: 8.2 ms\nObjects: 1024" };
+		CT_CHECK( layout.update( *font, caption, config ) );
+		CT_EQUAL( layout.getLaidOutParagraphs(), 4u );
+
+		// Nothing changed.
+		CT_CHECK( !layout.update( *font, caption, config ) );
+		CT_EQUAL( layout.getLaidOutParagraphs(), 0u );
+
+		// Only the changed counter is laid out again.
+		caption = U"FPS: 60\nCPU: 9.75 ms\nGPU: 8.2 ms\nObjects: 1024";
+		CT_CHECK( layout.update( *font, caption, config ) );
+		CT_EQUAL( layout.getLaidOutParagraphs(), 1u );
+		CT_CHECK( txtlayout::isSameAsFresh( *font, layout, caption, config ) );
+
+		// Removed and added paragraphs.
+		caption = U"FPS: 60\nCPU: 9.75 ms";
+		CT_CHECK( layout.update( *font, caption, config ) );
+		CT_EQUAL( layout.getLaidOutParagraphs(), 0u );
+		CT_CHECK( txtlayout::isSameAsFresh( *font, layout, caption, config ) );
+		caption = U"FPS: 60\nCPU: 9.75 ms\n\nDraw calls: 12";
+		CT_CHECK( layout.update( *font, caption, config ) );
+		CT_EQUAL( layout.getLaidOutParagraphs(), 2u );
+		CT_CHECK( txtlayout::isSameAsFresh( *font, layout, caption, config ) );
+	}
+
+	void TextLayoutTest::Options()
+	{
+		auto font = txtlayout::loadFont( m_testDataFolder );
+		TextLayout::Config config;
+		config.size = { 400.0f, 300.0f };
+		config.vAlign = VAlign::eTop;
+		std::u32string caption{ U"First line\nSecond line" };
+		TextLayout layout;
+		layout.update( *font, caption, config );
+
+		// The vertical alignment only moves the text.
+		auto top = layout.getTopOffset();
+		config.vAlign = VAlign::eBottom;
+		CT_CHECK( layout.update( *font, caption, config ) );
+		CT_EQUAL( layout.getLaidOutParagraphs(), 0u );
+		CT_CHECK( layout.getTopOffset() > top );
+		CT_CHECK( txtlayout::isSameAsFresh( *font, layout, caption, config ) );
+
+		// Without wrapping nor horizontal alignment, the width is not used.
+		config.size = { 200.0f, 300.0f };
+		layout.update( *font, caption, config );
+		CT_EQUAL( layout.getLaidOutParagraphs(), 0u );
+
+		// The horizontal alignment moves each line.
+		config.hAlign = HAlign::eRight;
+		layout.update( *font, caption, config );
+		CT_EQUAL( layout.getLaidOutParagraphs(), 2u );
+		CT_CHECK( txtlayout::isSameAsFresh( *font, layout, caption, config ) );
+
+		for ( auto & line : layout.getLines() )
+		{
+			CT_EQUAL( line.position->x + line.width, 200.0f );
+		}
+
+		config.size = { 300.0f, 300.0f };
+		layout.update( *font, caption, config );
+		CT_EQUAL( layout.getLaidOutParagraphs(), 2u );
+
+		// The line spacing modes give the same height to all the lines.
+		config.lineSpacingMode = TextLineSpacingMode::eMaxLineHeight;
+		layout.update( *font, U"ace\nBdf", config );
+		auto lines = layout.getLines();
+		CT_CHECK( lines[0].range == lines[1].range );
+		CT_CHECK( txtlayout::isSameAsFresh( *font, layout, U"ace\nBdf", config ) );
+	}
+
+	void TextLayoutTest::Wrapping()
+	{
+		auto font = txtlayout::loadFont( m_testDataFolder );
+		TextLayout::Config config;
+		config.size = { 120.0f, 300.0f };
+		std::u32string caption{ U"The quick brown fox jumps over the lazy dog" };
+		TextLayout layout;
+
+		layout.update( *font, caption, config );
+		CT_EQUAL( layout.getLines().size(), 1u );
+
+		config.wrappingMode = TextWrappingMode::eBreakWords;
+		layout.update( *font, caption, config );
+		CT_EQUAL( layout.getLaidOutParagraphs(), 1u );
+		CT_CHECK( layout.getLines().size() > 1u );
+		CT_EQUAL( layout.getWords().size(), 9u );
+
+		// A glyph advance can go a bit further than its bounds.
+		for ( auto & line : layout.getLines() )
+		{
+			CT_CHECK( line.width <= config.size->x + float( font->getHeight() ) );
+		}
+
+		config.wrappingMode = TextWrappingMode::eBreak;
+		layout.update( *font, caption, config );
+		CT_CHECK( layout.getLines().size() > 1u );
+		// Words cut at the end of a line are split in two words.
+		CT_CHECK( layout.getWords().size() >= 9u );
+	}
+
+	void TextLayoutTest::Random()
+	{
+		auto font = txtlayout::loadFont( m_testDataFolder );
+		std::mt19937 engine{ 42u };
+		std::uniform_int_distribution< uint32_t > edit{ 0u, 9u };
+		std::uniform_int_distribution< uint32_t > length{ 0u, 24u };
+		std::uniform_int_distribution< uint32_t > letter{ 0u, 27u };
+		auto randomParagraph = [&]()
+		{
+			std::u32string result;
+			auto count = length( engine );
+
+			for ( uint32_t i = 0u; i < count; ++i )
+			{
+				auto value = letter( engine );
+				result += value >= 26u
+					? U' '
+					: char32_t( ( i % 2u ? U'a' : U'A' ) + value );
+			}
+
+			return result;
+		};
+
+		for ( auto wrappingMode : { TextWrappingMode::eNone, TextWrappingMode::eBreak, TextWrappingMode::eBreakWords } )
+		{
+			for ( auto lineSpacingMode : { TextLineSpacingMode::eOwnHeight, TextLineSpacingMode::eMaxLineHeight, TextLineSpacingMode::eMaxFontHeight } )
+			{
+				TextLayout::Config config;
+				config.size = { 150.0f, 400.0f };
+				config.wrappingMode = wrappingMode;
+				config.lineSpacingMode = lineSpacingMode;
+				config.hAlign = HAlign::eCenter;
+				std::vector< std::u32string > paragraphs( 6u );
+				TextLayout layout;
+				bool same = true;
+
+				for ( uint32_t step = 0u; step < 200u && same; ++step )
+				{
+					auto action = edit( engine );
+					auto index = uint32_t( engine() % paragraphs.size() );
+
+					if ( action == 0u && paragraphs.size() > 1u )
+					{
+						paragraphs.erase( std::next( paragraphs.begin(), index ) );
+					}
+					else if ( action == 1u )
+					{
+						paragraphs.insert( std::next( paragraphs.begin(), index ), randomParagraph() );
+					}
+					else
+					{
+						paragraphs[index] = randomParagraph();
+					}
+
+					std::u32string caption;
+
+					for ( size_t i = 0u; i < paragraphs.size(); ++i )
+					{
+						caption += ( i == 0u ? U"" : U"\n" ) + paragraphs[i];
+					}
+
+					layout.update( *font, caption, config );
+					same = txtlayout::isSameAsFresh( *font, layout, caption, config );
+				}
+
+				CT_CHECK( same );
+			}
+		}
+	}
+
+	void TextLayoutTest::Glyphs()
+	{
+		auto font = txtlayout::loadFont( m_testDataFolder );
+		CT_CHECK( font->hasGlyphAt( U'A' ) );
+		CT_CHECK( font->hasGlyphAt( U'\u00E9' ) );
+		CT_CHECK( !font->hasGlyphAt( U'\u20AC' ) );
+		auto & glyph = font->getGlyphAt( U'A' );
+		// Glyphs outside of Latin-1 are loaded on demand.
+		CT_CHECK_NOTHROW( font->getTextMetrics( U"\u00E9t\u00E9 \u20AC", 0u, false ) );
+		CT_CHECK( font->hasGlyphAt( U'\u20AC' ) );
+		// Loading new glyphs doesn't move the existing ones.
+		CT_CHECK( &glyph == &font->getGlyphAt( U'A' ) );
+		TextLayout layout;
+		CT_CHECK( layout.update( *font, U"\u00E9t\u00E9 \u20AC", {} ) );
+		CT_EQUAL( layout.getChars().size(), 4u );
+	}
+
+	void TextLayoutTest::ConcurrentGlyphs()
+	{
+		auto font = txtlayout::loadFont( m_testDataFolder );
+		// Cyrillic glyphs, not preloaded.
+		std::u32string text;
+
+		for ( char32_t c = 0x0410; c < 0x0450; ++c )
+		{
+			text += c;
+		}
+
+		// Glyphs are loaded by the atlas while the metrics are computed from another thread.
+		std::thread loader{ [&font, &text]()
+			{
+				for ( auto it = text.rbegin(); it != text.rend(); ++it )
+				{
+					font->loadGlyph( *it );
+				}
+			} };
+		TextMetrics metrics;
+		CT_CHECK_NOTHROW( metrics = font->getTextMetrics( text, 0u, false ) );
+		loader.join();
+		CT_EQUAL( metrics.lines.size(), 1u );
+
+		for ( auto c : text )
+		{
+			CT_CHECK( font->hasGlyphAt( c ) );
+		}
+	}
+
+	void TextLayoutTest::FontRange()
+	{
+		auto font = txtlayout::loadFont( m_testDataFolder );
+		TextLayout::Config config;
+		config.lineSpacingMode = TextLineSpacingMode::eMaxFontHeight;
+		std::u32string caption{ U"First line\nSecond line" };
+		TextLayout layout;
+		layout.update( *font, caption, config );
+
+		// Loads glyphs until one extends the font's max range.
+		auto range = font->getMaxRange();
+
+		for ( char32_t c = 0x0100; c < 0x0500 && range == font->getMaxRange(); ++c )
+		{
+			font->loadGlyph( c );
+		}
+
+		CT_CHECK( range != font->getMaxRange() );
+		// The unchanged paragraphs use the new range too.
+		CT_CHECK( layout.update( *font, caption, config ) );
+		CT_EQUAL( layout.getLaidOutParagraphs(), 2u );
+		CT_CHECK( txtlayout::isSameAsFresh( *font, layout, caption, config ) );
+
+		// In the other modes, the font's max range is not used.
+		config.lineSpacingMode = TextLineSpacingMode::eOwnHeight;
+		layout.update( *font, caption, config );
+		font->loadGlyph( 0x2000 );
+		layout.update( *font, caption, config );
+		CT_EQUAL( layout.getLaidOutParagraphs(), 0u );
+	}
+}
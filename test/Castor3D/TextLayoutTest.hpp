@@ -0,0 +1,31 @@
+/* See LICENSE file in root folder */
+#ifndef ___C3DT_TEXT_LAYOUT_TEST_H___
+#define ___C3DT_TEXT_LAYOUT_TEST_H___
+
+#include "Castor3DTestPrerequisites.hpp"
+
+namespace Testing
+{
+	class TextLayoutTest
+		: public C3DTestCase
+	{
+	public:
+		explicit TextLayoutTest( castor3d::Engine & engine );
+
+	private:
+		void doRegisterTests()override;
+
+	private:
+		void Words();
+		void Paragraphs();
+		void Incremental();
+		void Options();
+		void Wrapping();
+		void Random();
+		void Glyphs();
+		void ConcurrentGlyphs();
+		void FontRange();
+	};
+}
+
+#endif
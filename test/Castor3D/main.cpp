@@ -1,7 +1,20 @@
 #include "Castor3DTestPrerequisites.hpp"
 
 #include "BinaryExportTest.hpp"
+#include "ControlsIndexTest.hpp"
+#if defined( CASTOR_HAS_DIAMOND_SQUARE_TERRAIN )
+#	include "DiamondSquareTerrainTest.hpp"
+#endif
+#include "DirectionalCascadesTest.hpp"
+#include "MemRangesTest.hpp"
+#include "MeshLodTest.hpp"
+#include "OcclusionBufferTest.hpp"
+#include "OverlayDrawListTest.hpp"
+#include "ParticlePoolTest.hpp"
+#include "RaycastTest.hpp"
 #include "SceneExportTest.hpp"
+#include "ShadowMapSchedulerTest.hpp"
+#include "TextLayoutTest.hpp"
 
 #include <Castor3D/Engine.hpp>
 #include <Castor3D/Cache/PluginCache.hpp>
@@ -144,6 +157,19 @@ int main( int argc, char const * argv[] )
 		// Test cases.
 		Testing::registerType( std::make_unique< Testing::BinaryExportTest >( *engine ) );
 		Testing::registerType( std::make_unique< Testing::SceneExportTest >( *engine ) );
+		Testing::registerType( std::make_unique< Testing::RaycastTest >( *engine ) );
+		Testing::registerType( std::make_unique< Testing::ShadowMapSchedulerTest >( *engine ) );
+		Testing::registerType( std::make_unique< Testing::DirectionalCascadesTest >( *engine ) );
+		Testing::registerType( std::make_unique< Testing::OcclusionBufferTest >( *engine ) );
+		Testing::registerType( std::make_unique< Testing::ControlsIndexTest >( *engine ) );
+		Testing::registerType( std::make_unique< Testing::TextLayoutTest >( *engine ) );
+		Testing::registerType( std::make_unique< Testing::OverlayDrawListTest >( *engine ) );
+		Testing::registerType( std::make_unique< Testing::MemRangesTest >( *engine ) );
+		Testing::registerType( std::make_unique< Testing::ParticlePoolTest >( *engine ) );
+		Testing::registerType( std::make_unique< Testing::MeshLodTest >( *engine ) );
+#if defined( CASTOR_HAS_DIAMOND_SQUARE_TERRAIN )
+		Testing::registerType( std::make_unique< Testing::DiamondSquareTerrainTest >( *engine ) );
+#endif
 
 		// Tests loop.
 		BENCHLOOP( count, result );
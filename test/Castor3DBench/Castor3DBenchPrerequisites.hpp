@@ -0,0 +1,30 @@
+/* See LICENSE file in root folder */
+#ifndef ___C3DB_BenchPrerequisites___
+#define ___C3DB_BenchPrerequisites___
+
+#include <Benchmark.hpp>
+
+#include <Castor3D/Castor3DModule.hpp>
+#include <Castor3D/Render/RenderModule.hpp>
+
+namespace Testing
+{
+	///
+	/// \struct SceneBenchConfig
+	///
+	/// The synthetic scene built by the benchmarks.
+	///
+	struct SceneBenchConfig
+	{
+		// Nodes holding a geometry each.
+		uint32_t nodes{ 4096u };
+		// Point lights, attached to their own node.
+		uint32_t lights{ 64u };
+		// Skinned geometries, each in its own animated objects group.
+		uint32_t skeletons{ 32u };
+		// One geometry node out of movingStride is moved each frame.
+		uint32_t movingStride{ 8u };
+	};
+}
+
+#endif
@@ -0,0 +1,126 @@
+#include "GuiBench.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+using namespace castor;
+using namespace castor3d;
+
+namespace Testing
+{
+	namespace guibench
+	{
+		static uint32_t constexpr Calls = 100u;
+		static uint32_t constexpr Windows = 64u;
+		static uint32_t constexpr PanelsPerWindow = 8u;
+		static uint32_t constexpr ButtonsPerPanel = 16u;
+		static uint32_t constexpr HitTests = 1024u;
+		static int32_t constexpr ScreenWidth = 1920;
+		static int32_t constexpr ScreenHeight = 1080;
+
+		static void addChildren( std::vector< ControlsIndex::Rect > & rects
+			, ControlsIndex::Rect const & parent
+			, uint32_t count
+			, uint32_t depth )
+		{
+			// The children are laid out on a grid inside their parent, with a margin.
+			auto columns = uint32_t( std::ceil( std::sqrt( float( count ) ) ) );
+			auto rows = ( count + columns - 1u ) / columns;
+			Size size{ parent.size.getWidth() / columns, parent.size.getHeight() / rows };
+
+			for ( uint32_t i = 0u; i < count; ++i )
+			{
+				ControlsIndex::Rect rect{ Position{ parent.position.x() + int32_t( ( i % columns ) * size.getWidth() + 2u )
+						, parent.position.y() + int32_t( ( i / columns ) * size.getHeight() + 2u ) }
+					, Size{ size.getWidth() - 4u, size.getHeight() - 4u } };
+				rects.push_back( rect );
+
+				if ( depth == 0u )
+				{
+					addChildren( rects, rect, ButtonsPerPanel, depth + 1u );
+				}
+			}
+		}
+	}
+
+	//*********************************************************************************************
+
+	GuiBench::GuiBench()
+		: BenchCase{ "GuiBench" }
+	{
+		std::mt19937 engine{ 42u };
+		std::uniform_int_distribution< int32_t > x{ -100, guibench::ScreenWidth - 300 };
+		std::uniform_int_distribution< int32_t > y{ -100, guibench::ScreenHeight - 200 };
+		std::uniform_int_distribution< uint32_t > width{ 240u, 640u };
+		std::uniform_int_distribution< uint32_t > height{ 160u, 480u };
+		m_rects.reserve( guibench::Windows * ( 1u + guibench::PanelsPerWindow * ( 1u + guibench::ButtonsPerPanel ) ) );
+
+		for ( uint32_t i = 0u; i < guibench::Windows; ++i )
+		{
+			ControlsIndex::Rect window{ Position{ x( engine ), y( engine ) }
+				, Size{ width( engine ), height( engine ) } };
+			m_rects.push_back( window );
+			guibench::addChildren( m_rects, window, guibench::PanelsPerWindow, 0u );
+		}
+
+		std::uniform_int_distribution< int32_t > px{ 0, guibench::ScreenWidth - 1 };
+		std::uniform_int_distribution< int32_t > py{ 0, guibench::ScreenHeight - 1 };
+		m_positions.reserve( guibench::HitTests );
+
+		for ( uint32_t i = 0u; i < guibench::HitTests; ++i )
+		{
+			m_positions.emplace_back( px( engine ), py( engine ) );
+		}
+
+		m_index = ControlsIndex{ m_rects };
+	}
+
+	GuiBench::~GuiBench()
+	{
+	}
+
+	void GuiBench::Execute()
+	{
+		BENCHMARK( LinearHitTest, guibench::Calls );
+		BENCHMARK( IndexedHitTest, guibench::Calls );
+		BENCHMARK( IndexBuild, guibench::Calls );
+	}
+
+	void GuiBench::LinearHitTest()
+	{
+		// What the controls manager did before the index: copy the z-ordered list under lock, then scan it front to back.
+		for ( auto & position : m_positions )
+		{
+			std::vector< ControlsIndex::Rect > rects;
+			{
+				std::lock_guard< std::mutex > lock{ m_mutex };
+				rects = m_rects;
+			}
+			auto it = std::find_if( rects.rbegin()
+				, rects.rend()
+				, [&position]( ControlsIndex::Rect const & rect )
+				{
+					return ControlsIndex::contains( rect, position );
+				} );
+			doNotOptimizeAway( it );
+		}
+	}
+
+	void GuiBench::IndexedHitTest()
+	{
+		for ( auto & position : m_positions )
+		{
+			doNotOptimizeAway( m_index.pick( position
+				, []( uint32_t )
+				{
+					return true;
+				} ) );
+		}
+	}
+
+	void GuiBench::IndexBuild()
+	{
+		doNotOptimizeAway( ControlsIndex{ m_rects } );
+	}
+}
@@ -0,0 +1,40 @@
+/* See LICENSE file in root folder */
+#ifndef ___C3DB_GuiBench___
+#define ___C3DB_GuiBench___
+
+#include "Castor3DBenchPrerequisites.hpp"
+
+#include <Castor3D/Gui/ControlsIndex.hpp>
+
+#include <mutex>
+
+namespace Testing
+{
+	///
+	/// \class GuiBench
+	///
+	/// Measures the controls hit-tests, over a synthetic controls tree
+	/// (windows holding panels holding buttons), given back to front.
+	///
+	class GuiBench
+		: public BenchCase
+	{
+	public:
+		GuiBench();
+		~GuiBench()override;
+		void Execute()override;
+
+	private:
+		void LinearHitTest();
+		void IndexedHitTest();
+		void IndexBuild();
+
+	private:
+		std::vector< castor3d::ControlsIndex::Rect > m_rects;
+		std::vector< castor::Position > m_positions;
+		std::mutex m_mutex;
+		castor3d::ControlsIndex m_index;
+	};
+}
+
+#endif
@@ -0,0 +1,124 @@
+#include "LoadingBench.hpp"
+
+#include <Castor3D/Engine.hpp>
+#include <Castor3D/Binary/BinaryMesh.hpp>
+#include <Castor3D/Binary/BinarySkeleton.hpp>
+#include <Castor3D/Model/Mesh/Mesh.hpp>
+#include <Castor3D/Model/Skeleton/Skeleton.hpp>
+#include <Castor3D/Render/RenderLoop.hpp>
+#include <Castor3D/Scene/Scene.hpp>
+#include <Castor3D/Scene/SceneFileParser.hpp>
+
+#include <CastorUtils/Data/BinaryFile.hpp>
+
+using namespace castor;
+using namespace castor3d;
+
+namespace Testing
+{
+	namespace ldbench
+	{
+		static uint32_t constexpr ParseCalls = 20u;
+		static uint32_t constexpr LoadCalls = 100u;
+	}
+
+	//*********************************************************************************************
+
+	LoadingBench::LoadingBench( Engine & engine )
+		: BenchCase{ "LoadingBench" }
+		, m_engine{ engine }
+		, m_dataFolder{ Engine::getDataDirectory() / cuT( "Castor3DBench" ) / cuT( "data" ) }
+	{
+	}
+
+	LoadingBench::~LoadingBench()
+	{
+	}
+
+	void LoadingBench::Execute()
+	{
+		BENCHMARK_PREPARED( ParseSimpleScene, cleanupScene, ldbench::ParseCalls );
+		BENCHMARK_PREPARED( ParseInstancedScene, cleanupScene, ldbench::ParseCalls );
+		cleanupScene();
+
+		m_scene = castor::makeUnique< Scene >( cuT( "LoadingBench" ), m_engine );
+		BENCHMARK( LoadSimpleMesh, ldbench::LoadCalls );
+		BENCHMARK( LoadSkinnedMesh, ldbench::LoadCalls );
+		m_scene->cleanup();
+		m_engine.getRenderLoop().renderSyncFrame();
+		m_scene.reset();
+	}
+
+	void LoadingBench::doParseScene( String const & name )
+	{
+		SceneFileParser parser{ m_engine };
+
+		if ( !parser.parseFile( m_dataFolder / name )
+			|| parser.scenesBegin() == parser.scenesEnd() )
+		{
+			CU_Exception( "Couldn't parse scene file" );
+		}
+
+		m_parsed = parser.scenesBegin()->second;
+	}
+
+	void LoadingBench::doLoadMesh( String const & name )
+	{
+		// The mesh isn't added to the scene cache, it is destroyed right after its loading.
+		auto mesh = m_scene->createMesh( name, *m_scene );
+		BinaryFile mshFile{ m_dataFolder / ( name + cuT( ".cmsh" ) ), File::OpenMode::eRead };
+
+		if ( !BinaryParser< Mesh >().parse( *mesh, mshFile ) )
+		{
+			CU_Exception( "Couldn't load mesh" );
+		}
+
+		auto sklPath = m_dataFolder / ( name + cuT( ".cskl" ) );
+
+		if ( File::fileExists( sklPath ) )
+		{
+			mesh->computeContainers();
+			auto skeleton = m_scene->createSkeleton( name, *m_scene );
+			BinaryFile sklFile{ sklPath, File::OpenMode::eRead };
+
+			if ( !BinaryParser< Skeleton >().parse( *skeleton, sklFile ) )
+			{
+				CU_Exception( "Couldn't load skeleton" );
+			}
+		}
+	}
+
+	void LoadingBench::cleanupScene()
+	{
+		if ( !m_parsed )
+		{
+			return;
+		}
+
+		m_engine.getRenderLoop().renderSyncFrame();
+		m_parsed->cleanup();
+		m_engine.getRenderLoop().renderSyncFrame();
+		m_engine.removeScene( m_parsed->getName() );
+		m_parsed = {};
+	}
+
+	void LoadingBench::ParseSimpleScene()
+	{
+		doParseScene( cuT( "light_directional.cscn" ) );
+	}
+
+	void LoadingBench::ParseInstancedScene()
+	{
+		doParseScene( cuT( "instancing.cscn" ) );
+	}
+
+	void LoadingBench::LoadSimpleMesh()
+	{
+		doLoadMesh( cuT( "SimpleTestMesh" ) );
+	}
+
+	void LoadingBench::LoadSkinnedMesh()
+	{
+		doLoadMesh( cuT( "AnimTestMesh" ) );
+	}
+}
@@ -0,0 +1,41 @@
+/* See LICENSE file in root folder */
+#ifndef ___C3DB_LoadingBench___
+#define ___C3DB_LoadingBench___
+
+#include "Castor3DBenchPrerequisites.hpp"
+
+namespace Testing
+{
+	///
+	/// \class LoadingBench
+	///
+	/// Measures the scene files parsing, and the CMSH meshes loading.
+	///
+	class LoadingBench
+		: public BenchCase
+	{
+	public:
+		explicit LoadingBench( castor3d::Engine & engine );
+		~LoadingBench()override;
+		void Execute()override;
+
+	private:
+		void doParseScene( castor::String const & name );
+		void doLoadMesh( castor::String const & name );
+
+		void cleanupScene();
+
+		void ParseSimpleScene();
+		void ParseInstancedScene();
+		void LoadSimpleMesh();
+		void LoadSkinnedMesh();
+
+	private:
+		castor3d::Engine & m_engine;
+		castor::Path m_dataFolder;
+		castor3d::SceneRPtr m_parsed{};
+		castor3d::SceneUPtr m_scene;
+	};
+}
+
+#endif
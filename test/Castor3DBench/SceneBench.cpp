@@ -0,0 +1,302 @@
+#include "SceneBench.hpp"
+
+#include <Castor3D/Engine.hpp>
+#include <Castor3D/Binary/BinaryMesh.hpp>
+#include <Castor3D/Binary/BinarySkeleton.hpp>
+#include <Castor3D/Cache/AnimatedObjectGroupCache.hpp>
+#include <Castor3D/Cache/GeometryCache.hpp>
+#include <Castor3D/Cache/LightCache.hpp>
+#include <Castor3D/Cache/SceneNodeCache.hpp>
+#include <Castor3D/Event/Frame/GpuFunctorEvent.hpp>
+#include <Castor3D/Event/Frame/FrameListener.hpp>
+#include <Castor3D/Miscellaneous/Parameter.hpp>
+#include <Castor3D/Model/Mesh/Mesh.hpp>
+#include <Castor3D/Model/Mesh/MeshFactory.hpp>
+#include <Castor3D/Model/Mesh/MeshGenerator.hpp>
+#include <Castor3D/Model/Mesh/Submesh/Submesh.hpp>
+#include <Castor3D/Model/Skeleton/Skeleton.hpp>
+#include <Castor3D/Render/RenderLoop.hpp>
+#include <Castor3D/Render/Viewport.hpp>
+#include <Castor3D/Render/Culling/FrustumCuller.hpp>
+#include <Castor3D/Scene/Camera.hpp>
+#include <Castor3D/Scene/Geometry.hpp>
+#include <Castor3D/Scene/Scene.hpp>
+#include <Castor3D/Scene/SceneNode.hpp>
+#include <Castor3D/Scene/Animation/AnimatedObjectGroup.hpp>
+#include <Castor3D/Scene/Light/Light.hpp>
+
+#include <CastorUtils/Data/BinaryFile.hpp>
+
+using namespace castor;
+using namespace castor3d;
+
+namespace Testing
+{
+	namespace scnbench
+	{
+		static uint32_t constexpr Calls = 100u;
+
+		static Path getDataFolder()
+		{
+			return Engine::getDataDirectory() / cuT( "Castor3DBench" ) / cuT( "data" );
+		}
+
+		static Point3f getGridPosition( uint32_t index
+			, uint32_t count )
+		{
+			auto side = uint32_t( std::ceil( std::cbrt( float( count ) ) ) );
+			return Point3f{ float( index % side ) * 4.0f
+				, float( ( index / side ) % side ) * 4.0f
+				, float( index / ( side * side ) ) * 4.0f };
+		}
+
+		static SceneNodeRPtr createNode( Scene & scene
+			, String const & name
+			, Point3f const & position )
+		{
+			auto node = scene.createSceneNode( name
+				, scene
+				, scene.getObjectRootNode()
+				, position
+				, Quaternion::identity()
+				, Point3f{ 1.0f, 1.0f, 1.0f }
+				, false );
+			return scene.addSceneNode( name, node );
+		}
+
+		static void initialiseSubmeshes( Mesh & mesh )
+		{
+			for ( auto & submesh : mesh )
+			{
+				mesh.getScene()->getListener().postEvent( makeGpuInitialiseEvent( *submesh ) );
+			}
+		}
+	}
+
+	//*********************************************************************************************
+
+	SceneBench::SceneBench( Engine & engine
+		, SceneBenchConfig config )
+		: BenchCase{ "SceneBench" }
+		, m_engine{ engine }
+		, m_config{ std::move( config ) }
+	{
+	}
+
+	SceneBench::~SceneBench()
+	{
+	}
+
+	void SceneBench::Execute()
+	{
+		doCreateScene();
+		BENCHMARK_PREPARED( MarkDirty, prepareFrame, scnbench::Calls );
+		BENCHMARK_PREPARED( SceneUpdate, prepareMovedFrame, scnbench::Calls );
+		BENCHMARK_PREPARED( SceneCulling, prepareCulledFrame, scnbench::Calls );
+		BENCHMARK_PREPARED( Animations, prepareFrame, scnbench::Calls );
+		doDestroyScene();
+	}
+
+	void SceneBench::doCreateScene()
+	{
+		m_scene = m_engine.addNewScene( cuT( "SceneBench" ), m_engine );
+		doCreateMeshes();
+		doCreateGeometries();
+		doCreateLights();
+		doCreateAnimated();
+		doCreateCamera();
+		m_scene->initialise();
+		// Processes the initialisation events, and creates the render nodes.
+		m_engine.getRenderLoop().renderSyncFrame();
+		m_engine.getRenderLoop().renderSyncFrame();
+		m_culler = castor::makeUniqueDerived< SceneCuller, FrustumCuller >( *m_scene, *m_camera );
+		prepareFrame();
+		// The first culler update culls the whole scene.
+		m_culler->update( *m_updater );
+	}
+
+	void SceneBench::doDestroyScene()
+	{
+		m_culler.reset();
+		m_updater.reset();
+		m_nodes.clear();
+		m_engine.getRenderLoop().renderSyncFrame();
+		m_scene->cleanup();
+		m_engine.getRenderLoop().renderSyncFrame();
+		m_engine.removeScene( m_scene->getName() );
+		m_scene = {};
+		m_cube = {};
+		m_skinned = {};
+		m_camera = {};
+	}
+
+	void SceneBench::doCreateMeshes()
+	{
+		auto cube = m_scene->createMesh( cuT( "BenchCube" ), *m_scene );
+		Parameters parameters;
+		parameters.add( cuT( "width" ), cuT( "1.0" ) );
+		parameters.add( cuT( "height" ), cuT( "1.0" ) );
+		parameters.add( cuT( "depth" ), cuT( "1.0" ) );
+		m_engine.getMeshFactory().create( cuT( "cube" ) )->generate( *cube, parameters );
+		m_cube = m_scene->addMesh( cube->getName(), cube, true );
+		scnbench::initialiseSubmeshes( *m_cube );
+
+		auto name = String{ cuT( "AnimTestMesh" ) };
+		auto skinned = m_scene->createMesh( name, *m_scene );
+		BinaryFile mshFile{ scnbench::getDataFolder() / ( name + cuT( ".cmsh" ) ), File::OpenMode::eRead };
+
+		if ( !BinaryParser< Mesh >().parse( *skinned, mshFile ) )
+		{
+			CU_Exception( "Couldn't load skinned mesh" );
+		}
+
+		skinned->computeContainers();
+		auto skeleton = m_scene->addNewSkeleton( name, *m_scene );
+		BinaryFile sklFile{ scnbench::getDataFolder() / ( name + cuT( ".cskl" ) ), File::OpenMode::eRead };
+
+		if ( !BinaryParser< Skeleton >().parse( *skeleton, sklFile ) )
+		{
+			CU_Exception( "Couldn't load skeleton" );
+		}
+
+		skinned->setSkeleton( skeleton );
+		m_skinned = m_scene->addMesh( skinned->getName(), skinned, true );
+		scnbench::initialiseSubmeshes( *m_skinned );
+	}
+
+	void SceneBench::doCreateGeometries()
+	{
+		m_nodes.reserve( m_config.nodes );
+
+		for ( uint32_t i = 0u; i < m_config.nodes; ++i )
+		{
+			auto name = cuT( "Geometry" ) + string::toString( i );
+			auto node = scnbench::createNode( *m_scene
+				, name
+				, scnbench::getGridPosition( i, m_config.nodes ) );
+			m_scene->addGeometry( m_scene->createGeometry( name
+				, *m_scene
+				, *node
+				, m_cube ) );
+			m_nodes.push_back( node );
+		}
+	}
+
+	void SceneBench::doCreateLights()
+	{
+		for ( uint32_t i = 0u; i < m_config.lights; ++i )
+		{
+			auto name = cuT( "Light" ) + string::toString( i );
+			auto node = scnbench::createNode( *m_scene
+				, name
+				, scnbench::getGridPosition( i * m_config.nodes / std::max( 1u, m_config.lights ), m_config.nodes ) );
+			auto light = m_scene->createLight( name
+				, *m_scene
+				, *node
+				, m_scene->getLightsFactory()
+				, LightType::ePoint );
+			m_scene->addLight( name, light, true );
+		}
+	}
+
+	void SceneBench::doCreateAnimated()
+	{
+		auto skeleton = m_skinned->getSkeleton();
+
+		for ( uint32_t i = 0u; i < m_config.skeletons; ++i )
+		{
+			auto name = cuT( "Skinned" ) + string::toString( i );
+			auto node = scnbench::createNode( *m_scene
+				, name
+				, Point3f{ float( i ) * 4.0f, -8.0f, 0.0f } );
+			auto geometry = m_scene->addGeometry( m_scene->createGeometry( name
+				, *m_scene
+				, *node
+				, m_skinned ) );
+			auto group = m_scene->addNewAnimatedObjectGroup( name, *m_scene );
+			group->addObject( *skeleton, *m_skinned, *geometry, name );
+
+			for ( auto & animation : skeleton->getAnimations() )
+			{
+				group->addAnimation( animation.first );
+				group->setAnimationLooped( animation.first, true );
+				group->startAnimation( animation.first );
+			}
+		}
+	}
+
+	void SceneBench::doCreateCamera()
+	{
+		Viewport viewport{ m_engine };
+		viewport.resize( Size{ 1920u, 1080u } );
+		viewport.setPerspective( Angle::fromDegrees( 60.0f ), 1920.0f / 1080.0f, 0.1f, 1000.0f );
+		auto node = m_scene->addNewSceneNode( cuT( "BenchCameraNode" ), *m_scene );
+		node->attachTo( *m_scene->getCameraRootNode() );
+		// Looks at the grid centre, from outside of it, so that a part of the geometries are culled.
+		node->setPosition( scnbench::getGridPosition( m_config.nodes / 2u, m_config.nodes ) - Point3f{ 0.0f, 0.0f, 40.0f } );
+		m_camera = m_scene->addNewCamera( cuT( "BenchCamera" )
+			, *m_scene
+			, *node
+			, std::move( viewport ) );
+		m_camera->update();
+	}
+
+	void SceneBench::doNewFrame()
+	{
+		m_updater = std::make_unique< CpuUpdater >();
+		m_updater->tslf = 16_ms;
+		m_updater->camera = m_camera;
+	}
+
+	void SceneBench::doMoveNodes( uint32_t stride )
+	{
+		auto offset = ( m_frame++ % 2u ) == 0u
+			? Point3f{ 0.0f, 0.1f, 0.0f }
+			: Point3f{ 0.0f, -0.1f, 0.0f };
+
+		for ( size_t i = m_frame % stride; i < m_nodes.size(); i += stride )
+		{
+			m_nodes[i]->translate( offset );
+		}
+	}
+
+	void SceneBench::prepareFrame()
+	{
+		// Consumes the pending dirty objects.
+		doNewFrame();
+		m_scene->update( *m_updater );
+		doNewFrame();
+	}
+
+	void SceneBench::prepareMovedFrame()
+	{
+		prepareFrame();
+		doMoveNodes( m_config.movingStride );
+	}
+
+	void SceneBench::prepareCulledFrame()
+	{
+		prepareMovedFrame();
+		m_scene->update( *m_updater );
+	}
+
+	void SceneBench::MarkDirty()
+	{
+		doMoveNodes( 1u );
+	}
+
+	void SceneBench::SceneUpdate()
+	{
+		m_scene->update( *m_updater );
+	}
+
+	void SceneBench::SceneCulling()
+	{
+		m_culler->update( *m_updater );
+	}
+
+	void SceneBench::Animations()
+	{
+		m_scene->getAnimatedObjectGroupCache().update( *m_updater );
+	}
+}
@@ -0,0 +1,58 @@
+/* See LICENSE file in root folder */
+#ifndef ___C3DB_SceneBench___
+#define ___C3DB_SceneBench___
+
+#include "Castor3DBenchPrerequisites.hpp"
+
+namespace Testing
+{
+	///
+	/// \class SceneBench
+	///
+	/// Measures the CPU frame update of a synthetic scene: dirty marking,
+	/// scene update, frustum culling and skeleton animations.
+	///
+	class SceneBench
+		: public BenchCase
+	{
+	public:
+		SceneBench( castor3d::Engine & engine
+			, SceneBenchConfig config );
+		~SceneBench()override;
+		void Execute()override;
+
+	private:
+		void doCreateScene();
+		void doDestroyScene();
+		void doCreateMeshes();
+		void doCreateGeometries();
+		void doCreateLights();
+		void doCreateAnimated();
+		void doCreateCamera();
+		void doNewFrame();
+		void doMoveNodes( uint32_t stride );
+
+		void prepareFrame();
+		void prepareMovedFrame();
+		void prepareCulledFrame();
+
+		void MarkDirty();
+		void SceneUpdate();
+		void SceneCulling();
+		void Animations();
+
+	private:
+		castor3d::Engine & m_engine;
+		SceneBenchConfig m_config;
+		castor3d::SceneRPtr m_scene{};
+		castor3d::MeshResPtr m_cube{};
+		castor3d::MeshResPtr m_skinned{};
+		castor3d::CameraRPtr m_camera{};
+		std::vector< castor3d::SceneNodeRPtr > m_nodes;
+		castor3d::SceneCullerUPtr m_culler;
+		std::unique_ptr< castor3d::CpuUpdater > m_updater;
+		uint32_t m_frame{};
+	};
+}
+
+#endif
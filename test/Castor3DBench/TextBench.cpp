@@ -0,0 +1,85 @@
+#include "TextBench.hpp"
+
+#include <Castor3D/Engine.hpp>
+
+#include <CastorUtils/Graphics/Font.hpp>
+
+using namespace castor;
+using namespace castor3d;
+
+namespace Testing
+{
+	namespace txtbench
+	{
+		static uint32_t constexpr Calls = 1000u;
+		static uint32_t constexpr Lines = 16u;
+		static uint32_t constexpr Frames = 64u;
+
+		static std::u32string getCaption( uint32_t frame )
+		{
+			// Only the first line changes every frame, like a frame time counter.
+			std::u32string result;
+
+			for ( uint32_t i = 0u; i < Lines; ++i )
+			{
+				auto value = castor::string::toU32String( i == 0u ? frame : i * 17u );
+				result += U"Counter " + value + U": " + value + U" ms, averaged over the last frames";
+
+				if ( i + 1u < Lines )
+				{
+					result += U'\n';
+				}
+			}
+
+			return result;
+		}
+	}
+
+	//*********************************************************************************************
+
+	TextBench::TextBench()
+		: BenchCase{ "TextBench" }
+		, m_font{ std::make_unique< Font >( cuT( "Arial" )
+			, 24u
+			, Engine::getDataDirectory() / cuT( "Castor3DBench" ) / cuT( "data" ) / cuT( "arial.ttf" ) ) }
+	{
+		m_config.size = { 600.0f, 800.0f };
+		m_config.wrappingMode = TextWrappingMode::eBreakWords;
+		m_captions.reserve( txtbench::Frames );
+
+		for ( uint32_t i = 0u; i < txtbench::Frames; ++i )
+		{
+			m_captions.push_back( txtbench::getCaption( i ) );
+		}
+
+		m_layout.update( *m_font, m_captions.front(), m_config );
+	}
+
+	TextBench::~TextBench()
+	{
+	}
+
+	void TextBench::Execute()
+	{
+		BENCHMARK( FullLayout, txtbench::Calls );
+		BENCHMARK( CounterLayout, txtbench::Calls );
+		BENCHMARK( UnchangedLayout, txtbench::Calls );
+	}
+
+	void TextBench::FullLayout()
+	{
+		// What the text overlay did before the layout cache: lay out the whole text.
+		TextLayout layout;
+		doNotOptimizeAway( layout.update( *m_font, m_captions[++m_frame % txtbench::Frames], m_config ) );
+	}
+
+	void TextBench::CounterLayout()
+	{
+		doNotOptimizeAway( m_layout.update( *m_font, m_captions[++m_frame % txtbench::Frames], m_config ) );
+	}
+
+	void TextBench::UnchangedLayout()
+	{
+		doNotOptimizeAway( m_layout.update( *m_font, m_captions[m_frame % txtbench::Frames], m_config ) );
+	}
+}
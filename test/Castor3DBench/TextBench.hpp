@@ -0,0 +1,39 @@
+/* See LICENSE file in root folder */
+#ifndef ___C3DB_TextBench___
+#define ___C3DB_TextBench___
+
+#include "Castor3DBenchPrerequisites.hpp"
+
+#include <Castor3D/Overlay/TextLayout.hpp>
+
+namespace Testing
+{
+	///
+	/// \class TextBench
+	///
+	/// Measures the text overlays layout, over a HUD like text
+	/// (some lines of frequently updated counters).
+	///
+	class TextBench
+		: public BenchCase
+	{
+	public:
+		TextBench();
+		~TextBench()override;
+		void Execute()override;
+
+	private:
+		void FullLayout();
+		void CounterLayout();
+		void UnchangedLayout();
+
+	private:
+		std::unique_ptr< castor::Font > m_font;
+		castor3d::TextLayout::Config m_config;
+		castor3d::TextLayout m_layout;
+		std::vector< std::u32string > m_captions;
+		uint32_t m_frame{};
+	};
+}
+
+#endif
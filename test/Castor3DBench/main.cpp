@@ -0,0 +1,181 @@
+#include "GuiBench.hpp"
+#include "LoadingBench.hpp"
+#include "SceneBench.hpp"
+#include "TextBench.hpp"
+
+#include <Castor3D/Engine.hpp>
+#include <Castor3D/Cache/PluginCache.hpp>
+
+#include <BenchManager.hpp>
+
+#include <CastorUtils/Log/Logger.hpp>
+#include <CastorUtils/Data/File.hpp>
+
+#include <cstring>
+
+using namespace castor;
+using namespace castor3d;
+
+namespace
+{
+	castor::PathArray listPluginsFiles( castor::Path const & folder )
+	{
+		static castor::String castor3DLibPrefix{ CU_LibPrefix + castor::String{ cuT( "castor3d" ) } };
+		castor::PathArray files;
+		castor::File::listDirectoryFiles( folder, files );
+		castor::PathArray result;
+		castor::String endRel = "." + castor::String{ CU_SharedLibExt };
+		castor::String endDbg = "d" + endRel;
+
+		// Exclude debug plug-in in release builds, and release plug-ins in debug builds
+		for ( auto file : files )
+		{
+			auto fileName = file.getFileName( true );
+			bool res = castor::string::endsWith( fileName, endDbg );
+#if defined( NDEBUG )
+			res = castor::string::endsWith( fileName, endRel ) && !res;
+#endif
+			if ( res && fileName.find( castor3DLibPrefix ) == 0u )
+			{
+				result.push_back( file );
+			}
+		}
+
+		return result;
+	}
+
+	void loadPlugins( Engine & engine )
+	{
+		for ( auto file : listPluginsFiles( castor3d::Engine::getPluginsDirectory() ) )
+		{
+			if ( !engine.getPluginCache().loadPlugin( file ) )
+			{
+				castor::Logger::logWarning( cuT( "Couldn't load plug-in " ) + file.getFileName() );
+			}
+		}
+
+		Logger::logInfo( cuT( "Plugins loaded" ) );
+	}
+
+	std::unique_ptr< Engine > initialiseCastor()
+	{
+		if ( !File::directoryExists( Engine::getEngineDirectory() ) )
+		{
+			File::directoryCreate( Engine::getEngineDirectory() );
+		}
+
+		castor3d::EngineConfig config{ cuT( "Castor3DBench" )
+			, Version{ Castor3DBench_VERSION_MAJOR, Castor3DBench_VERSION_MINOR, Castor3DBench_VERSION_BUILD } };
+		std::unique_ptr< Engine > result = std::make_unique< Engine >( std::move( config ) );
+		loadPlugins( *result );
+
+		// The test renderer has no GPU behind it, only the CPU side of the engine is exercised.
+		if ( !result->loadRenderer( "test" ) )
+		{
+			CU_Exception( "Couldn't load renderer." );
+		}
+
+		result->initialise( 1, false );
+		return result;
+	}
+
+	struct Options
+	{
+		uint32_t count{ 1u };
+		std::string results;
+		Testing::SceneBenchConfig scene;
+	};
+
+	bool parseOptions( int argc
+		, char const * argv[]
+		, Options & options )
+	{
+		for ( int i = 1; i < argc; ++i )
+		{
+			auto option = std::string{ argv[i] };
+
+			if ( option == "-h" || option == "--help" || i + 1 == argc )
+			{
+				std::cout << "Usage: Castor3DBench [options]" << std::endl;
+				std::cout << "  -c, --count <n>       Benchmarks runs count (default 1)" << std::endl;
+				std::cout << "  -o, --output <file>   JSON results file (default Castor3DBench.json, next to the executable)" << std::endl;
+				std::cout << "  -n, --nodes <n>       Scene geometries count (default " << options.scene.nodes << ")" << std::endl;
+				std::cout << "  -l, --lights <n>      Scene lights count (default " << options.scene.lights << ")" << std::endl;
+				std::cout << "  -s, --skeletons <n>   Scene animated skeletons count (default " << options.scene.skeletons << ")" << std::endl;
+				return false;
+			}
+
+			auto value = std::string{ argv[++i] };
+
+			if ( option == "-c" || option == "--count" )
+			{
+				options.count = uint32_t( std::max( 1, std::stoi( value ) ) );
+			}
+			else if ( option == "-o" || option == "--output" )
+			{
+				options.results = value;
+			}
+			else if ( option == "-n" || option == "--nodes" )
+			{
+				options.scene.nodes = uint32_t( std::max( 1, std::stoi( value ) ) );
+			}
+			else if ( option == "-l" || option == "--lights" )
+			{
+				options.scene.lights = uint32_t( std::max( 0, std::stoi( value ) ) );
+			}
+			else if ( option == "-s" || option == "--skeletons" )
+			{
+				options.scene.skeletons = uint32_t( std::max( 0, std::stoi( value ) ) );
+			}
+			else
+			{
+				std::cout << "Unknown option " << option << std::endl;
+				return false;
+			}
+		}
+
+		return true;
+	}
+}
+
+int main( int argc, char const * argv[] )
+{
+	Options options;
+
+	if ( !parseOptions( argc, argv, options ) )
+	{
+		return EXIT_FAILURE;
+	}
+
+	if ( options.results.empty() )
+	{
+		options.results = castor::File::getExecutableDirectory() / cuT( "Castor3DBench.json" );
+	}
+
+	int result = EXIT_SUCCESS;
+	castor::Logger::initialise( castor::LogType::eWarning );
+	Logger::setFileName( castor::File::getExecutableDirectory() / cuT( "Castor3DBench.log" ) );
+	{
+		std::unique_ptr< Engine > engine = initialiseCastor();
+		Testing::registerType( std::make_unique< Testing::SceneBench >( *engine, options.scene ) );
+		Testing::registerType( std::make_unique< Testing::LoadingBench >( *engine ) );
+		Testing::registerType( std::make_unique< Testing::GuiBench >() );
+		Testing::registerType( std::make_unique< Testing::TextBench >() );
+
+		for ( uint32_t i = 0u; i < options.count; ++i )
+		{
+			Testing::BenchManager::ExecuteBenchs();
+		}
+
+		Testing::BenchManager::BenchsSummary();
+
+		if ( !Testing::BenchManager::writeResults( options.results ) )
+		{
+			result = EXIT_FAILURE;
+		}
+
+		engine->cleanup();
+	}
+	Logger::cleanup();
+	return result;
+}
@@ -3,6 +3,7 @@
 #include "UnitTest.hpp"
 
 #include <algorithm>
+#include <fstream>
 
 namespace Testing
 {
@@ -75,6 +76,47 @@ namespace Testing
 		}
 	}
 
+	void BenchManager::writeResults( std::ostream & stream )
+	{
+		stream << "{\n\t\"unit\": \"ns\",\n\t\"benchmarks\": [";
+		std::string sep = "\n";
+
+		for ( auto & bench : m_benchs )
+		{
+			for ( auto & result : bench->getResults() )
+			{
+				stream << sep << "\t\t{ \"case\": \"" << bench->getName() << "\""
+					<< ", \"name\": \"" << result.name << "\""
+					<< ", \"calls\": " << result.calls
+					<< ", \"total\": " << result.total.count()
+					<< ", \"mean\": " << result.mean.count()
+					<< ", \"min\": " << result.min.count()
+					<< ", \"p50\": " << result.p50.count()
+					<< ", \"p90\": " << result.p90.count()
+					<< ", \"p99\": " << result.p99.count()
+					<< ", \"max\": " << result.max.count()
+					<< " }";
+				sep = ",\n";
+			}
+		}
+
+		stream << "\n\t]\n}\n";
+	}
+
+	bool BenchManager::writeResults( std::string const & fileName )
+	{
+		std::ofstream file{ fileName };
+
+		if ( !file )
+		{
+			std::cout << "Couldn't open benchmarks results file " << fileName << std::endl;
+			return false;
+		}
+
+		writeResults( file );
+		return bool( file );
+	}
+
 	uint32_t BenchManager::ExecuteTests()
 	{
 		uint32_t errCount = 0;
@@ -15,6 +15,11 @@ namespace Testing
 		static void registerType( TestCasePtr test );
 		static void ExecuteBenchs();
 		static void BenchsSummary();
+		///
+		/// \brief Writes the results of all the executed benchmarks, as JSON, times in nanoseconds.
+		///
+		static void writeResults( std::ostream & stream );
+		static bool writeResults( std::string const & fileName );
 		static uint32_t ExecuteTests();
 
 	private:
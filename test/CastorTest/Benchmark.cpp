@@ -2,9 +2,52 @@
 
 namespace Testing
 {
+	namespace bench
+	{
+		static std::chrono::nanoseconds getPercentile( std::vector< std::chrono::nanoseconds > const & sorted
+			, uint32_t percentile )
+		{
+			// Nearest rank.
+			auto rank = ( sorted.size() * percentile + 99u ) / 100u;
+			return sorted[std::max< size_t >( rank, 1u ) - 1u];
+		}
+
+		static BenchResult computeResult( std::string const & name
+			, std::vector< std::chrono::nanoseconds > & times )
+		{
+			BenchResult result;
+			result.name = name;
+			result.calls = times.size();
+
+			if ( times.empty() )
+			{
+				return result;
+			}
+
+			std::sort( times.begin(), times.end() );
+
+			for ( auto & time : times )
+			{
+				result.total += time;
+			}
+
+			result.mean = result.total / times.size();
+			result.min = times.front();
+			result.p50 = getPercentile( times, 50u );
+			result.p90 = getPercentile( times, 90u );
+			result.p99 = getPercentile( times, 99u );
+			result.max = times.back();
+			return result;
+		}
+
+		static double toMs( std::chrono::nanoseconds time )
+		{
+			return double( time.count() ) / 1000000.0;
+		}
+	}
+
 	BenchCase::BenchCase( std::string const & name )
 		: m_name( name )
-		, m_totalExecutions( 0 )
 	{
 	}
 
@@ -12,7 +55,7 @@ namespace Testing
 	{
 	}
 
-	void BenchCase::doBench( std::string name, CallbackBench bench, uint64_t ui64Calls )
+	void BenchCase::doBench( std::string name, CallbackBench bench, uint64_t ui64Calls, CallbackBench prepare )
 	{
 		std::stringstream benchSep;
 		benchSep.width( BENCH_TITLE_WIDTH );
@@ -21,30 +64,38 @@ namespace Testing
 
 		try
 		{
-			m_cumulativeTimes = std::chrono::nanoseconds{};
-			m_totalExecutions = 0;
+			m_times.clear();
+			m_times.reserve( ui64Calls );
 
 			for ( uint64_t i = 0; i < ui64Calls; i++ )
 			{
+				if ( prepare )
+				{
+					prepare();
+				}
+
 				m_saved = clock::now();
 				bench();
-				m_cumulativeTimes += std::chrono::duration_cast< std::chrono::nanoseconds >( clock::now() - m_saved );
-				m_totalExecutions++;
+				m_times.push_back( std::chrono::duration_cast< std::chrono::nanoseconds >( clock::now() - m_saved ) );
 			}
 
+			auto result = bench::computeResult( name, m_times );
 			std::stringstream stream;
 			stream.precision( 4 );
 			stream << "*	" << name << " global results :" << std::endl;
 			stream << "*		- Executed " << ui64Calls << " times" << std::endl;
-			stream << "*		- Total time : " << float( std::chrono::duration_cast< std::chrono::milliseconds >( m_cumulativeTimes ).count() ) / 1000.0 << "s" << std::endl;
-			stream << "*		- Average time : " << std::chrono::duration_cast< std::chrono::milliseconds >( m_cumulativeTimes / m_totalExecutions ).count() << "ms" << std::endl;
-			stream << benchSep.rdbuf() << std::endl;
+			stream << "*		- Total time : " << bench::toMs( result.total ) / 1000.0 << "s" << std::endl;
+			stream << "*		- Average time : " << bench::toMs( result.mean ) << "ms" << std::endl;
+			stream << "*		- Min/P50/P90/P99/Max : " << bench::toMs( result.min )
+				<< "/" << bench::toMs( result.p50 )
+				<< "/" << bench::toMs( result.p90 )
+				<< "/" << bench::toMs( result.p99 )
+				<< "/" << bench::toMs( result.max ) << "ms" << std::endl;
+			stream << benchSep.str() << std::endl;
 			m_summary += stream.str();
+			m_results.push_back( std::move( result ) );
 			std::cout << "*	Bench ended for: " << name.c_str() << std::endl;
-			std::cout << "*		- Executed " << ui64Calls << " times" << std::endl;
-			std::cout << "*		- Total time : " << float( std::chrono::duration_cast< std::chrono::milliseconds >( m_cumulativeTimes ).count() ) / 1000.0 << "s" << std::endl;
-			std::cout << "*		- Average time : " << std::chrono::duration_cast< std::chrono::milliseconds >( m_cumulativeTimes / m_totalExecutions ).count() << "ms" << std::endl;
-			std::cout << benchSep.str() << std::endl;
+			std::cout << stream.str().substr( stream.str().find( '\n' ) + 1u );
 		}
 		catch ( ... )
 		{
@@ -28,6 +28,24 @@ namespace Testing
 		}
 	}
 
+	///
+	/// \struct BenchResult
+	///
+	/// The per call times distribution of a benchmark.
+	///
+	struct BenchResult
+	{
+		std::string name;
+		uint64_t calls{};
+		std::chrono::nanoseconds total{};
+		std::chrono::nanoseconds mean{};
+		std::chrono::nanoseconds min{};
+		std::chrono::nanoseconds p50{};
+		std::chrono::nanoseconds p90{};
+		std::chrono::nanoseconds p99{};
+		std::chrono::nanoseconds max{};
+	};
+
 	class BenchCase
 	{
 		typedef std::function< void() > CallbackBench;
@@ -41,19 +59,33 @@ namespace Testing
 			return m_summary;
 		}
 
+		inline std::string const & getName()const
+		{
+			return m_name;
+		}
+
+		inline std::vector< BenchResult > const & getResults()const
+		{
+			return m_results;
+		}
+
 	protected:
-		void doBench( std::string name, CallbackBench bench, uint64_t ui64Calls );
+		///
+		/// \param prepare If set, called before each call to \p bench, out of the measured time.
+		///
+		void doBench( std::string name, CallbackBench bench, uint64_t ui64Calls, CallbackBench prepare = nullptr );
 
 	private:
 		using clock = std::chrono::high_resolution_clock;
 		clock::time_point m_saved;
 		std::string m_name;
-		std::chrono::nanoseconds m_cumulativeTimes{};
-		uint64_t m_totalExecutions;
+		std::vector< std::chrono::nanoseconds > m_times;
+		std::vector< BenchResult > m_results;
 		std::string m_summary;
 	};
 
 #	define BENCHMARK( Name, Calls ) doBench( #Name, [&](){ Name(); }, Calls )
+#	define BENCHMARK_PREPARED( Name, Prepare, Calls ) doBench( #Name, [&](){ Name(); }, Calls, [&](){ Prepare(); } )
 }
 
 #endif
@@ -0,0 +1,105 @@
+#include "CastorUtilsFrameArenaTest.hpp"
+
+#include <CastorUtils/Pool/FrameArena.hpp>
+
+#include <map>
+
+using namespace castor;
+
+namespace Testing
+{
+	CastorUtilsFrameArenaTest::CastorUtilsFrameArenaTest()
+		: TestCase( "CastorUtilsFrameArenaTest" )
+	{
+	}
+
+	void CastorUtilsFrameArenaTest::doRegisterTests()
+	{
+		doRegisterTest( "CastorUtilsFrameArenaTest::Alignment", std::bind( &CastorUtilsFrameArenaTest::Alignment, this ) );
+		doRegisterTest( "CastorUtilsFrameArenaTest::Growth", std::bind( &CastorUtilsFrameArenaTest::Growth, this ) );
+		doRegisterTest( "CastorUtilsFrameArenaTest::Reset", std::bind( &CastorUtilsFrameArenaTest::Reset, this ) );
+		doRegisterTest( "CastorUtilsFrameArenaTest::Containers", std::bind( &CastorUtilsFrameArenaTest::Containers, this ) );
+	}
+
+	void CastorUtilsFrameArenaTest::Alignment()
+	{
+		FrameArena arena{ 1024u };
+
+		for ( size_t alignment = 1u; alignment <= 256u; alignment *= 2u )
+		{
+			CT_CHECK( arena.allocate( 1u, 1u ) != nullptr );
+			auto ptr = arena.allocate( 3u, alignment );
+			CT_EQUAL( reinterpret_cast< uintptr_t >( ptr ) % alignment, 0u );
+		}
+
+		CT_EQUAL( arena.getAllocationCount(), 18u );
+	}
+
+	void CastorUtilsFrameArenaTest::Growth()
+	{
+		FrameArena arena{ 64u };
+		CT_EQUAL( arena.getUpstreamAllocationCount(), 0u );
+		auto first = static_cast< uint8_t * >( arena.allocate( 48u, 1u ) );
+		auto second = static_cast< uint8_t * >( arena.allocate( 48u, 1u ) );
+		CT_CHECK( first != second );
+		CT_EQUAL( arena.getUpstreamAllocationCount(), 1u );
+		auto big = arena.allocate( 1000u, 16u );
+		CT_CHECK( big != nullptr );
+		CT_EQUAL( arena.getUpstreamAllocationCount(), 2u );
+		CT_CHECK( arena.getCapacity() >= 64u + 48u + 1000u );
+		CT_EQUAL( arena.getAllocatedSize(), 48u + 48u + 1000u );
+	}
+
+	void CastorUtilsFrameArenaTest::Reset()
+	{
+		FrameArena arena{ 64u };
+
+		for ( uint32_t i = 0u; i < 10u; ++i )
+		{
+			CT_CHECK( arena.allocate( 60u, 4u ) != nullptr );
+		}
+
+		CT_EQUAL( arena.getAllocationCount(), 10u );
+		auto capacity = arena.getCapacity();
+		arena.reset();
+		CT_EQUAL( arena.getAllocationCount(), 0u );
+		CT_EQUAL( arena.getAllocatedSize(), 0u );
+		CT_EQUAL( arena.getCapacity(), capacity );
+
+		// The blocks have been merged, so the same frame doesn't need any new block.
+		for ( uint32_t i = 0u; i < 10u; ++i )
+		{
+			CT_CHECK( arena.allocate( 60u, 4u ) != nullptr );
+		}
+
+		CT_EQUAL( arena.getUpstreamAllocationCount(), 0u );
+		CT_EQUAL( arena.getCapacity(), capacity );
+	}
+
+	void CastorUtilsFrameArenaTest::Containers()
+	{
+		FrameArena arena{ 4096u };
+
+		for ( uint32_t frame = 0u; frame < 3u; ++frame )
+		{
+			{
+				std::pmr::map< uint32_t, std::pmr::vector< uint32_t > > map{ &arena };
+
+				for ( uint32_t i = 0u; i < 16u; ++i )
+				{
+					auto & values = map[i % 4u];
+					values.push_back( i );
+					CT_CHECK( values.get_allocator().resource() == &arena );
+				}
+
+				CT_EQUAL( map.size(), 4u );
+				CT_EQUAL( map[3u].back(), 15u );
+				// At least one allocation per map node and per vector storage, whatever the vector growth policy.
+				CT_CHECK( arena.getAllocationCount() >= 2u * map.size() );
+			}
+
+			CT_EQUAL( arena.getUpstreamAllocationCount(), 0u );
+			arena.reset();
+		}
+	}
+}
@@ -0,0 +1,26 @@
+/* See LICENSE file in root folder */
+#ifndef ___CUT_FrameArenaTest_H___
+#define ___CUT_FrameArenaTest_H___
+
+#include "CastorUtilsTestPrerequisites.hpp"
+
+namespace Testing
+{
+	class CastorUtilsFrameArenaTest
+		: public TestCase
+	{
+	public:
+		CastorUtilsFrameArenaTest();
+
+	private:
+		void doRegisterTests() override;
+
+	private:
+		void Alignment();
+		void Growth();
+		void Reset();
+		void Containers();
+	};
+}
+
+#endif
@@ -0,0 +1,365 @@
+#include "CastorUtilsLoggerTest.hpp"
+
+#include <CastorUtils/Log/Logger.hpp>
+#include <CastorUtils/Log/LoggerInstance.hpp>
+#include <CastorUtils/Log/LogRecordBuffer.hpp>
+#include <CastorUtils/Miscellaneous/StringUtils.hpp>
+
+#include <condition_variable>
+#include <ctime>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <thread>
+
+using namespace castor;
+
+namespace Testing
+{
+	namespace logtest
+	{
+		static uint32_t constexpr ThreadCount = 4u;
+		static uint32_t constexpr MessageCount = 256u;
+
+		static std::string makeMessage( uint32_t thread
+			, uint32_t index )
+		{
+			return "Thread " + std::to_string( thread ) + " - Message " + std::to_string( index );
+		}
+
+		static void logFromThreads( std::function< void( std::string const & ) > log )
+		{
+			std::vector< std::thread > threads;
+
+			for ( uint32_t thread = 0u; thread < ThreadCount; ++thread )
+			{
+				threads.emplace_back( [&log, thread]()
+					{
+						for ( uint32_t index = 0u; index < MessageCount; ++index )
+						{
+							log( makeMessage( thread, index ) );
+						}
+					} );
+			}
+
+			for ( auto & thread : threads )
+			{
+				thread.join();
+			}
+		}
+	}
+
+	//*********************************************************************************************
+
+	CastorUtilsLoggerTest::CastorUtilsLoggerTest()
+		: TestCase( "CastorUtilsLoggerTest" )
+	{
+	}
+
+	void CastorUtilsLoggerTest::doRegisterTests()
+	{
+		doRegisterTest( "CastorUtilsLoggerTest::RecordBufferWrap", std::bind( &CastorUtilsLoggerTest::RecordBufferWrap, this ) );
+		doRegisterTest( "CastorUtilsLoggerTest::RecordBufferOverflow", std::bind( &CastorUtilsLoggerTest::RecordBufferOverflow, this ) );
+		doRegisterTest( "CastorUtilsLoggerTest::RecordBufferThreads", std::bind( &CastorUtilsLoggerTest::RecordBufferThreads, this ) );
+		doRegisterTest( "CastorUtilsLoggerTest::Delivery", std::bind( &CastorUtilsLoggerTest::Delivery, this ) );
+	}
+
+	void CastorUtilsLoggerTest::RecordBufferWrap()
+	{
+		LogRecordBuffer buffer{ 256u };
+		CT_EQUAL( buffer.getCapacity(), 256u );
+		CT_CHECK( buffer.fits( 100u ) );
+		CT_CHECK( !buffer.fits( 120u ) );
+		uint32_t pushed{};
+		uint32_t read{};
+
+		// Variable sizes, so that records regularly cross the buffer end.
+		for ( uint32_t i = 0u; i < 100u; ++i )
+		{
+			auto text = std::string( 1u + ( i * 7u ) % 40u, char( 'a' + i % 26u ) );
+			CT_CHECK( buffer.push( { int64_t( i ), LogType::eInfo, ( i % 2u ) == 0u, text } ) );
+			++pushed;
+			auto position = buffer.read( [&read, &text, this]( LogRecord const & record )
+				{
+					CT_EQUAL( record.time, int64_t( read ) );
+					CT_EQUAL( record.newLine, ( read % 2u ) == 0u );
+					CT_CHECK( record.type == LogType::eInfo );
+					CT_EQUAL( std::string{ record.text }, text );
+					++read;
+				} );
+			buffer.release( position );
+			CT_CHECK( buffer.isEmpty() );
+		}
+
+		CT_EQUAL( pushed, read );
+		CT_EQUAL( buffer.exchangeDropped(), 0u );
+	}
+
+	void CastorUtilsLoggerTest::RecordBufferOverflow()
+	{
+		LogRecordBuffer buffer{ 1024u };
+		std::string text( 16u, 'x' );
+		uint32_t pushed{};
+
+		while ( buffer.push( { 0, LogType::eWarning, true, text } ) )
+		{
+			++pushed;
+		}
+
+		// 16 bytes of header and 16 bytes of text per record.
+		CT_EQUAL( pushed, 1024u / 32u );
+		CT_CHECK( !buffer.push( { 0, LogType::eWarning, true, text } ) );
+		CT_EQUAL( buffer.exchangeDropped(), 2u );
+		CT_EQUAL( buffer.exchangeDropped(), 0u );
+
+		uint32_t read{};
+		buffer.release( buffer.read( [&read]( LogRecord const & )
+			{
+				++read;
+			} ) );
+		CT_EQUAL( read, pushed );
+		CT_CHECK( buffer.push( { 0, LogType::eWarning, true, text } ) );
+	}
+
+	void CastorUtilsLoggerTest::RecordBufferThreads()
+	{
+		LogRecordBuffer buffer{ 4096u };
+		uint32_t constexpr count = 100000u;
+		std::atomic_bool done{ false };
+		uint32_t pushed{};
+		std::thread producer{ [&buffer, &done, &pushed]()
+			{
+				for ( uint32_t i = 0u; i < count; ++i )
+				{
+					auto text = std::to_string( i );
+
+					if ( buffer.push( { int64_t( i ), LogType::eDebug, true, text } ) )
+					{
+						++pushed;
+					}
+				}
+
+				done = true;
+			} };
+		uint32_t read{};
+		int64_t last{ -1 };
+		bool ordered{ true };
+		bool valid{ true };
+
+		while ( !done || !buffer.isEmpty() )
+		{
+			buffer.release( buffer.read( [&]( LogRecord const & record )
+				{
+					ordered = ordered && record.time > last;
+					valid = valid && std::to_string( record.time ) == record.text;
+					last = record.time;
+					++read;
+				} ) );
+		}
+
+		producer.join();
+		CT_CHECK( ordered );
+		CT_CHECK( valid );
+		CT_EQUAL( read, pushed );
+		CT_EQUAL( buffer.exchangeDropped(), uint64_t( count - pushed ) );
+	}
+
+	void CastorUtilsLoggerTest::Delivery()
+	{
+		std::mutex mutex;
+		std::map< std::string, uint32_t > received;
+		std::vector< std::string > lines;
+		Path logFile{ cuT( "LoggerDelivery.log" ) };
+		{
+			auto logger = Logger::createInstance( LogType::eInfo );
+			logger->setFileName( logFile );
+			logger->registerCallback( [&mutex, &received, &lines]( String const & text, LogType, bool )
+				{
+					auto lock( makeUniqueLock( mutex ) );
+					++received[text.substr( 0u, text.find( cuT( " - " ) ) )];
+					lines.push_back( text );
+				}
+				, this );
+			logtest::logFromThreads( [&logger]( std::string const & message )
+				{
+					logger->logInfo( message );
+					// Below the logger level, must be filtered out.
+					logger->logDebug( message );
+				} );
+			logger->logWarning( "First line\nSecond line" );
+			logger->flushQueue();
+			CT_EQUAL( logger->getDroppedCount(), 0u );
+			logger->unregisterCallback( this );
+		}
+
+		auto lock( makeUniqueLock( mutex ) );
+
+		for ( uint32_t thread = 0u; thread < logtest::ThreadCount; ++thread )
+		{
+			CT_EQUAL( received[logtest::makeMessage( thread, 0u ).substr( 0u, 8u )], logtest::MessageCount );
+		}
+
+		CT_EQUAL( lines.size(), logtest::ThreadCount * logtest::MessageCount + 2u );
+		CT_EQUAL( lines[lines.size() - 2u], "First line" );
+		CT_EQUAL( lines[lines.size() - 1u], "Second line" );
+
+		// Each thread's messages are written in order.
+		std::map< std::string, uint32_t > next;
+
+		for ( auto & line : std::vector< std::string >{ lines.begin(), lines.end() - 2u } )
+		{
+			auto thread = line.substr( 0u, 8u );
+			auto index = uint32_t( std::stoul( line.substr( line.rfind( ' ' ) + 1u ) ) );
+			CT_EQUAL( index, next[thread] );
+			next[thread] = index + 1u;
+		}
+
+		std::ifstream file{ logFile };
+		std::string line;
+		size_t count{};
+
+		while ( std::getline( file, line ) )
+		{
+			++count;
+		}
+
+		CT_EQUAL( count, lines.size() );
+	}
+
+	//*********************************************************************************************
+
+	/**
+	*\brief
+	*	Reproduction of the previous logger backend, used as the benchmark reference:
+	*	a mutex guarded message queue, flushed by a polling thread that formats with
+	*	std::ctime, splits every message and builds one string stream per level.
+	*/
+	class CastorUtilsLoggerBench::LegacyLogger
+	{
+	public:
+		explicit LegacyLogger( Path const & path )
+			: m_path{ path }
+		{
+			std::ofstream{ m_path };
+			m_thread = std::thread( [this]()
+				{
+					while ( !m_stopped )
+					{
+						flush();
+						std::this_thread::sleep_for( Milliseconds( 100 ) );
+					}
+
+					flush();
+				} );
+		}
+
+		~LegacyLogger()
+		{
+			m_stopped = true;
+			m_thread.join();
+		}
+
+		void logInfo( std::string const & message )
+		{
+			auto lock( makeUniqueLock( m_mutex ) );
+			m_queue.push_back( { LogType::eInfo, message, true } );
+		}
+
+		void flush()
+		{
+			MessageQueue queue;
+			{
+				auto lock( makeUniqueLock( m_mutex ) );
+				std::swap( queue, m_queue );
+			}
+
+			if ( queue.empty() )
+			{
+				return;
+			}
+
+			std::time_t endTime = std::chrono::system_clock::to_time_t( std::chrono::system_clock::now() );
+			std::string time = std::ctime( &endTime );
+			string::replace( time, "\n", std::string{} );
+			StringStream logs[size_t( LogType::eCount )]
+			{
+				makeStringStream(),
+				makeStringStream(),
+				makeStringStream(),
+				makeStringStream(),
+				makeStringStream(),
+			};
+
+			for ( auto & message : queue )
+			{
+				auto & stream = logs[size_t( message.m_type )];
+				String toLog = message.m_message;
+
+				if ( toLog.find( cuT( '\n' ) ) != String::npos )
+				{
+					StringArray array = string::split( toLog, cuT( "\n" ), uint32_t( std::count( toLog.begin(), toLog.end(), cuT( '\n' ) ) + 1 ) );
+
+					for ( auto & line : array )
+					{
+						stream << time << cuT( " - " ) << cuT( "              " ) << line << "\n";
+					}
+				}
+				else
+				{
+					stream << time << cuT( " - " ) << cuT( "              " ) << toLog << ( message.m_newLine ? "\n" : "" );
+				}
+			}
+
+			for ( auto const & stream : logs )
+			{
+				std::ofstream file{ m_path, std::ios::app };
+				file << stream.str();
+			}
+		}
+
+	private:
+		Path m_path;
+		MessageQueue m_queue;
+		std::mutex m_mutex;
+		std::thread m_thread;
+		std::atomic_bool m_stopped{ false };
+	};
+
+	//*********************************************************************************************
+
+	CastorUtilsLoggerBench::CastorUtilsLoggerBench()
+		: BenchCase( "CastorUtilsLoggerBench" )
+		, m_legacy{ std::make_unique< LegacyLogger >( Path{ cuT( "LoggerBenchLegacy.log" ) } ) }
+		, m_logger{ Logger::createInstance( LogType::eInfo ) }
+	{
+		m_logger->setFileName( Path{ cuT( "LoggerBench.log" ) } );
+	}
+
+	CastorUtilsLoggerBench::~CastorUtilsLoggerBench()
+	{
+	}
+
+	void CastorUtilsLoggerBench::Execute()
+	{
+		BENCHMARK( LogLegacy, 100 );
+		BENCHMARK( LogRecordBuffers, 100 );
+	}
+
+	void CastorUtilsLoggerBench::LogLegacy()
+	{
+		logtest::logFromThreads( [this]( std::string const & message )
+			{
+				m_legacy->logInfo( message );
+			} );
+	}
+
+	void CastorUtilsLoggerBench::LogRecordBuffers()
+	{
+		logtest::logFromThreads( [this]( std::string const & message )
+			{
+				m_logger->logInfo( message );
+			} );
+	}
+
+	//*********************************************************************************************
+}
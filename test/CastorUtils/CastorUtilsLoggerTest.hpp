@@ -0,0 +1,48 @@
+/* See LICENSE file in root folder */
+#ifndef ___CUT_LoggerTest_H___
+#define ___CUT_LoggerTest_H___
+
+#include "CastorUtilsTestPrerequisites.hpp"
+
+#include <CastorTest/Benchmark.hpp>
+
+#include <CastorUtils/Log/LogModule.hpp>
+
+namespace Testing
+{
+	class CastorUtilsLoggerTest
+		: public TestCase
+	{
+	public:
+		CastorUtilsLoggerTest();
+
+	private:
+		void doRegisterTests() override;
+
+	private:
+		void RecordBufferWrap();
+		void RecordBufferOverflow();
+		void RecordBufferThreads();
+		void Delivery();
+	};
+
+	class CastorUtilsLoggerBench
+		: public BenchCase
+	{
+	public:
+		CastorUtilsLoggerBench();
+		~CastorUtilsLoggerBench()override;
+		void Execute()override;
+
+	private:
+		void LogLegacy();
+		void LogRecordBuffers();
+
+	private:
+		class LegacyLogger;
+		std::unique_ptr< LegacyLogger > m_legacy;
+		castor::LoggerInstancePtr m_logger;
+	};
+}
+
+#endif
@@ -4,11 +4,61 @@
 
 #include <CastorUtils/Pool/PoolManagedObject.hpp>
 #include <CastorUtils/Pool/ObjectPool.hpp>
+#include <CastorUtils/Pool/ObjectSlabPool.hpp>
 
 #include <algorithm>
 
 #pragma clang diagnostic ignored "-Wundefined-var-template"
 
+namespace Testing
+{
+	namespace SpawnDespawn
+	{
+		struct HeapObj
+			: public Obj
+		{
+			virtual ~HeapObj()noexcept = default;
+		};
+
+		struct PooledObj
+			: public Obj
+		{
+			virtual ~PooledObj()noexcept = default;
+
+			static castor::ObjectSlabPoolT< PooledObj > & getPool()
+			{
+				static castor::ObjectSlabPoolT< PooledObj > result;
+				return result;
+			}
+
+			static void * operator new( size_t size )
+			{
+				return getPool().allocate( size );
+			}
+
+			static void operator delete( void * memory, size_t size )
+			{
+				getPool().deallocate( memory, size );
+			}
+		};
+	}
+}
+
+namespace castor
+{
+	template<>
+	void Deleter< Testing::SpawnDespawn::HeapObj >::operator()( Testing::SpawnDespawn::HeapObj * pointer )noexcept
+	{
+		delete pointer;
+	}
+
+	template<>
+	void Deleter< Testing::SpawnDespawn::PooledObj >::operator()( Testing::SpawnDespawn::PooledObj * pointer )noexcept
+	{
+		delete pointer;
+	}
+}
+
 namespace Testing
 {
 	namespace Memory
@@ -92,6 +142,40 @@ namespace Testing
 		}
 	}
 
+	namespace SpawnDespawn
+	{
+		static uint32_t constexpr ObjectsCount = 10000u;
+		static uint32_t constexpr FramesCount = 200u;
+
+		template< typename ObjectT >
+		std::chrono::milliseconds run()
+		{
+			// Each frame despawns a tenth of the live objects, at random, and spawns them again.
+			std::vector< castor::UniquePtr< ObjectT > > objects;
+			objects.reserve( ObjectsCount );
+			std::mt19937 engine;
+			TimePoint time = Clock::now();
+
+			for ( uint32_t frame = 0u; frame < FramesCount; ++frame )
+			{
+				while ( objects.size() < ObjectsCount )
+				{
+					objects.push_back( castor::makeUnique< ObjectT >() );
+				}
+
+				for ( uint32_t i = 0u; i < ObjectsCount / 10u; ++i )
+				{
+					auto index = size_t( engine() % objects.size() );
+					std::swap( objects[index], objects.back() );
+					objects.pop_back();
+				}
+			}
+
+			objects.clear();
+			return std::chrono::duration_cast< std::chrono::milliseconds >( Clock::now() - time );
+		}
+	}
+
 	//*********************************************************************************************
 
 	CastorUtilsObjectsPoolTest::CastorUtilsObjectsPoolTest()
@@ -107,6 +191,7 @@ namespace Testing
 		doRegisterTest( "ScatteredMemoryPerformanceTest", std::bind( &CastorUtilsObjectsPoolTest::ScatteredMemoryPerformanceTest, this ) );
 		doRegisterTest( "VariableSizePerformanceTest", std::bind( &CastorUtilsObjectsPoolTest::VariableSizePerformanceTest, this ) );
 		doRegisterTest( "UniquePoolTest", std::bind( &CastorUtilsObjectsPoolTest::UniquePoolTest, this ) );
+		doRegisterTest( "SpawnDespawnPerformanceTest", std::bind( &CastorUtilsObjectsPoolTest::SpawnDespawnPerformanceTest, this ) );
 	}
 
 	void CastorUtilsObjectsPoolTest::ObjectPoolTest()
@@ -173,4 +258,20 @@ namespace Testing
 		UniqueObjectPool::Checks< castor::MemoryDataType::eFixed >();
 		UniqueObjectPool::Checks< castor::MemoryDataType::eFixedGrowing >();
 	}
+
+	void CastorUtilsObjectsPoolTest::SpawnDespawnPerformanceTest()
+	{
+		std::cout << "********************************************************************************" << std::endl << std::endl;
+		std::cout << "Spawn/Despawn Performance checks" << std::endl << std::endl;
+		auto heap = SpawnDespawn::run< SpawnDespawn::HeapObj >();
+		std::cout << "  castor::makeUnique : " << heap.count() << "ms" << std::endl;
+		auto pooled = SpawnDespawn::run< SpawnDespawn::PooledObj >();
+		std::cout << "  castor::ObjectSlabPoolT : " << pooled.count() << "ms" << std::endl << std::endl;
+		std::cout << "********************************************************************************" << std::endl;
+
+		auto & pool = SpawnDespawn::PooledObj::getPool();
+		CT_EQUAL( pool.getAllocatedCount(), 0u );
+		CT_CHECK( pool.getCapacity() >= SpawnDespawn::ObjectsCount );
+		CT_EQUAL( pool.getCapacity() % pool.getSlabSize(), 0u );
+	}
 }
@@ -23,6 +23,7 @@ namespace Testing
 		void ScatteredMemoryPerformanceTest();
 		void VariableSizePerformanceTest();
 		void UniquePoolTest();
+		void SpawnDespawnPerformanceTest();
 	};
 }
 
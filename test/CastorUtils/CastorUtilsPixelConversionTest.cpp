@@ -0,0 +1,328 @@
+#include "CastorUtilsPixelConversionTest.hpp"
+
+#include <CastorUtils/Miscellaneous/CpuInformations.hpp>
+
+#include <cstring>
+#include <random>
+
+namespace Testing
+{
+	//*********************************************************************************************
+
+	using castor::PixelFormat;
+	using castor::Size;
+
+	//*********************************************************************************************
+
+	namespace pxconvtest
+	{
+		static uint32_t constexpr BenchWidth = 1024u;
+		static uint32_t constexpr BenchHeight = 1024u;
+		static uint32_t constexpr Calls = 20u;
+
+		static std::mt19937 & getGenerator()
+		{
+			static std::mt19937 generator{ 42u };
+			return generator;
+		}
+
+		// Float components are kept in ]-1, 1[, where the per pixel conversions are well defined.
+		static castor::ByteArray randomBuffer( PixelFormat format
+			, uint32_t count )
+		{
+			castor::ByteArray result( size_t( count * getBytesPerPixel( format ) ) );
+
+			if ( format == PixelFormat::eR32_SFLOAT
+				|| format == PixelFormat::eR32G32B32A32_SFLOAT )
+			{
+				std::uniform_real_distribution< float > distribution( -0.999f, 0.999f );
+				auto data = reinterpret_cast< float * >( result.data() );
+
+				for ( size_t i = 0u; i < result.size() / sizeof( float ); ++i )
+				{
+					data[i] = distribution( getGenerator() );
+				}
+			}
+			else
+			{
+				std::uniform_int_distribution< uint32_t > distribution( 0u, 255u );
+
+				for ( auto & byte : result )
+				{
+					byte = uint8_t( distribution( getGenerator() ) );
+				}
+			}
+
+			return result;
+		}
+
+		template< PixelFormat PFSrc >
+		static void convertPerPixelT( Size const & size
+			, castor::ByteArray const & src
+			, PixelFormat dstFormat
+			, castor::ByteArray & dst )
+		{
+			uint8_t const * srcBuffer = src.data();
+			uint8_t * dstBuffer = dst.data();
+			castor::PixelDefinitionsT< PFSrc >::convert( nullptr
+				, size
+				, size
+				, srcBuffer
+				, uint32_t( src.size() )
+				, dstFormat
+				, dstBuffer
+				, uint32_t( dst.size() ) );
+		}
+
+		// The conversion path used before the bulk kernels.
+		static castor::ByteArray convertPerPixel( Size const & size
+			, PixelFormat srcFormat
+			, castor::ByteArray const & src
+			, PixelFormat dstFormat )
+		{
+			auto count = uint32_t( src.size() / getBytesPerPixel( srcFormat ) );
+			castor::ByteArray result( size_t( count * getBytesPerPixel( dstFormat ) ) );
+
+			switch ( srcFormat )
+			{
+			case PixelFormat::eR8G8B8_UNORM:
+				convertPerPixelT< PixelFormat::eR8G8B8_UNORM >( size, src, dstFormat, result );
+				break;
+			case PixelFormat::eR8G8B8_SRGB:
+				convertPerPixelT< PixelFormat::eR8G8B8_SRGB >( size, src, dstFormat, result );
+				break;
+			case PixelFormat::eB8G8R8_UNORM:
+				convertPerPixelT< PixelFormat::eB8G8R8_UNORM >( size, src, dstFormat, result );
+				break;
+			case PixelFormat::eB8G8R8_SRGB:
+				convertPerPixelT< PixelFormat::eB8G8R8_SRGB >( size, src, dstFormat, result );
+				break;
+			case PixelFormat::eR8G8B8A8_UNORM:
+				convertPerPixelT< PixelFormat::eR8G8B8A8_UNORM >( size, src, dstFormat, result );
+				break;
+			case PixelFormat::eR8G8B8A8_SRGB:
+				convertPerPixelT< PixelFormat::eR8G8B8A8_SRGB >( size, src, dstFormat, result );
+				break;
+			case PixelFormat::eB8G8R8A8_UNORM:
+				convertPerPixelT< PixelFormat::eB8G8R8A8_UNORM >( size, src, dstFormat, result );
+				break;
+			case PixelFormat::eB8G8R8A8_SRGB:
+				convertPerPixelT< PixelFormat::eB8G8R8A8_SRGB >( size, src, dstFormat, result );
+				break;
+			case PixelFormat::eR16G16B16A16_SFLOAT:
+				convertPerPixelT< PixelFormat::eR16G16B16A16_SFLOAT >( size, src, dstFormat, result );
+				break;
+			case PixelFormat::eR32_SFLOAT:
+				convertPerPixelT< PixelFormat::eR32_SFLOAT >( size, src, dstFormat, result );
+				break;
+			case PixelFormat::eR32G32B32A32_SFLOAT:
+				convertPerPixelT< PixelFormat::eR32G32B32A32_SFLOAT >( size, src, dstFormat, result );
+				break;
+			default:
+				break;
+			}
+
+			return result;
+		}
+
+		static castor::ByteArray convertBuffer( Size const & size
+			, PixelFormat srcFormat
+			, castor::ByteArray const & src
+			, PixelFormat dstFormat
+			, castor::TaskPool * pool )
+		{
+			auto count = uint32_t( src.size() / getBytesPerPixel( srcFormat ) );
+			castor::ByteArray result( size_t( count * getBytesPerPixel( dstFormat ) ) );
+			castor::convertBuffer( size
+				, srcFormat
+				, src.data()
+				, uint32_t( src.size() )
+				, dstFormat
+				, result.data()
+				, uint32_t( result.size() )
+				, pool );
+			return result;
+		}
+
+		static std::vector< std::pair< PixelFormat, PixelFormat > > getBulkPairs()
+		{
+			static std::array< PixelFormat, 8u > const formats8
+			{
+				PixelFormat::eR8G8B8_UNORM,
+				PixelFormat::eR8G8B8_SRGB,
+				PixelFormat::eB8G8R8_UNORM,
+				PixelFormat::eB8G8R8_SRGB,
+				PixelFormat::eR8G8B8A8_UNORM,
+				PixelFormat::eR8G8B8A8_SRGB,
+				PixelFormat::eB8G8R8A8_UNORM,
+				PixelFormat::eB8G8R8A8_SRGB,
+			};
+			std::vector< std::pair< PixelFormat, PixelFormat > > result;
+
+			for ( auto src : formats8 )
+			{
+				for ( auto dst : formats8 )
+				{
+					// eB8G8R8A8_SRGB is not supported as conversion destination.
+					if ( src != dst
+						&& dst != PixelFormat::eB8G8R8A8_SRGB )
+					{
+						result.emplace_back( src, dst );
+					}
+				}
+
+				result.emplace_back( src, PixelFormat::eR32G32B32A32_SFLOAT );
+			}
+
+			result.emplace_back( PixelFormat::eR32_SFLOAT, PixelFormat::eR32G32B32A32_SFLOAT );
+			result.emplace_back( PixelFormat::eR32G32B32A32_SFLOAT, PixelFormat::eR32_SFLOAT );
+			result.emplace_back( PixelFormat::eR32G32B32A32_SFLOAT, PixelFormat::eR16G16B16A16_SFLOAT );
+			result.emplace_back( PixelFormat::eR16G16B16A16_SFLOAT, PixelFormat::eR32G32B32A32_SFLOAT );
+			return result;
+		}
+	}
+
+	//*********************************************************************************************
+
+	CastorUtilsPixelConversionTest::CastorUtilsPixelConversionTest()
+		: TestCase( "CastorUtilsPixelConversionTest" )
+	{
+	}
+
+	void CastorUtilsPixelConversionTest::doRegisterTests()
+	{
+		doRegisterTest( "BitExactness", std::bind( &CastorUtilsPixelConversionTest::BitExactness, this ) );
+		doRegisterTest( "ParallelConversion", std::bind( &CastorUtilsPixelConversionTest::ParallelConversion, this ) );
+	}
+
+	void CastorUtilsPixelConversionTest::BitExactness()
+	{
+		// Odd dimensions, to go through the remainders of the kernels.
+		Size size{ 37u, 5u };
+
+		for ( auto & [srcFormat, dstFormat] : pxconvtest::getBulkPairs() )
+		{
+			auto src = pxconvtest::randomBuffer( srcFormat, size.getWidth() * size.getHeight() );
+			auto reference = pxconvtest::convertPerPixel( size, srcFormat, src, dstFormat );
+			auto result = pxconvtest::convertBuffer( size, srcFormat, src, dstFormat, nullptr );
+			CT_CHECK( result == reference );
+		}
+	}
+
+	void CastorUtilsPixelConversionTest::ParallelConversion()
+	{
+		// Big enough to be split in several rows chunks, with an incomplete last chunk.
+		Size size{ 333u, 517u };
+		castor::TaskPool pool{ 3u };
+
+		for ( auto & [srcFormat, dstFormat] : pxconvtest::getBulkPairs() )
+		{
+			auto src = pxconvtest::randomBuffer( srcFormat, size.getWidth() * size.getHeight() );
+			auto reference = pxconvtest::convertPerPixel( size, srcFormat, src, dstFormat );
+			auto result = pxconvtest::convertBuffer( size, srcFormat, src, dstFormat, &pool );
+			CT_CHECK( result == reference );
+		}
+	}
+
+	//*********************************************************************************************
+
+	CastorUtilsPixelConversionBench::CastorUtilsPixelConversionBench()
+		: BenchCase( "CastorUtilsPixelConversionBench" )
+		, m_pool{ std::max( 1u, castor::CpuInformations{}.getCoreCount() ) - 1u }
+		, m_rgb8{ pxconvtest::randomBuffer( PixelFormat::eR8G8B8_UNORM, pxconvtest::BenchWidth * pxconvtest::BenchHeight ) }
+		, m_rgba8{ pxconvtest::randomBuffer( PixelFormat::eR8G8B8A8_UNORM, pxconvtest::BenchWidth * pxconvtest::BenchHeight ) }
+		, m_rgba16f( size_t( pxconvtest::BenchWidth * pxconvtest::BenchHeight * getBytesPerPixel( PixelFormat::eR16G16B16A16_SFLOAT ) ) )
+		, m_rgba32f{ pxconvtest::randomBuffer( PixelFormat::eR32G32B32A32_SFLOAT, pxconvtest::BenchWidth * pxconvtest::BenchHeight ) }
+	{
+	}
+
+	void CastorUtilsPixelConversionBench::Execute()
+	{
+		BENCHMARK( RGB8ToRGBA8PerPixel, pxconvtest::Calls );
+		BENCHMARK( RGB8ToRGBA8Bulk, pxconvtest::Calls );
+		BENCHMARK( RGB8ToRGBA8Parallel, pxconvtest::Calls );
+		BENCHMARK( BGRA8ToRGBA8PerPixel, pxconvtest::Calls );
+		BENCHMARK( BGRA8ToRGBA8Bulk, pxconvtest::Calls );
+		BENCHMARK( BGRA8ToRGBA8Parallel, pxconvtest::Calls );
+		BENCHMARK( RGBA8ToRGBA32FPerPixel, pxconvtest::Calls );
+		BENCHMARK( RGBA8ToRGBA32FBulk, pxconvtest::Calls );
+		BENCHMARK( RGBA8ToRGBA32FParallel, pxconvtest::Calls );
+		BENCHMARK( RGBA32FToRGBA16FPerPixel, pxconvtest::Calls );
+		BENCHMARK( RGBA32FToRGBA16FBulk, pxconvtest::Calls );
+		BENCHMARK( RGBA32FToRGBA16FParallel, pxconvtest::Calls );
+	}
+
+	void CastorUtilsPixelConversionBench::RGB8ToRGBA8PerPixel()
+	{
+		auto result = pxconvtest::convertPerPixel( { pxconvtest::BenchWidth, pxconvtest::BenchHeight }, PixelFormat::eR8G8B8_UNORM, m_rgb8, PixelFormat::eR8G8B8A8_UNORM );
+		doNotOptimizeAway( result );
+	}
+
+	void CastorUtilsPixelConversionBench::RGB8ToRGBA8Bulk()
+	{
+		auto result = pxconvtest::convertBuffer( { pxconvtest::BenchWidth, pxconvtest::BenchHeight }, PixelFormat::eR8G8B8_UNORM, m_rgb8, PixelFormat::eR8G8B8A8_UNORM, nullptr );
+		doNotOptimizeAway( result );
+	}
+
+	void CastorUtilsPixelConversionBench::RGB8ToRGBA8Parallel()
+	{
+		auto result = pxconvtest::convertBuffer( { pxconvtest::BenchWidth, pxconvtest::BenchHeight }, PixelFormat::eR8G8B8_UNORM, m_rgb8, PixelFormat::eR8G8B8A8_UNORM, &m_pool );
+		doNotOptimizeAway( result );
+	}
+
+	void CastorUtilsPixelConversionBench::BGRA8ToRGBA8PerPixel()
+	{
+		auto result = pxconvtest::convertPerPixel( { pxconvtest::BenchWidth, pxconvtest::BenchHeight }, PixelFormat::eB8G8R8A8_UNORM, m_rgba8, PixelFormat::eR8G8B8A8_UNORM );
+		doNotOptimizeAway( result );
+	}
+
+	void CastorUtilsPixelConversionBench::BGRA8ToRGBA8Bulk()
+	{
+		auto result = pxconvtest::convertBuffer( { pxconvtest::BenchWidth, pxconvtest::BenchHeight }, PixelFormat::eB8G8R8A8_UNORM, m_rgba8, PixelFormat::eR8G8B8A8_UNORM, nullptr );
+		doNotOptimizeAway( result );
+	}
+
+	void CastorUtilsPixelConversionBench::BGRA8ToRGBA8Parallel()
+	{
+		auto result = pxconvtest::convertBuffer( { pxconvtest::BenchWidth, pxconvtest::BenchHeight }, PixelFormat::eB8G8R8A8_UNORM, m_rgba8, PixelFormat::eR8G8B8A8_UNORM, &m_pool );
+		doNotOptimizeAway( result );
+	}
+
+	void CastorUtilsPixelConversionBench::RGBA8ToRGBA32FPerPixel()
+	{
+		auto result = pxconvtest::convertPerPixel( { pxconvtest::BenchWidth, pxconvtest::BenchHeight }, PixelFormat::eR8G8B8A8_UNORM, m_rgba8, PixelFormat::eR32G32B32A32_SFLOAT );
+		doNotOptimizeAway( result );
+	}
+
+	void CastorUtilsPixelConversionBench::RGBA8ToRGBA32FBulk()
+	{
+		auto result = pxconvtest::convertBuffer( { pxconvtest::BenchWidth, pxconvtest::BenchHeight }, PixelFormat::eR8G8B8A8_UNORM, m_rgba8, PixelFormat::eR32G32B32A32_SFLOAT, nullptr );
+		doNotOptimizeAway( result );
+	}
+
+	void CastorUtilsPixelConversionBench::RGBA8ToRGBA32FParallel()
+	{
+		auto result = pxconvtest::convertBuffer( { pxconvtest::BenchWidth, pxconvtest::BenchHeight }, PixelFormat::eR8G8B8A8_UNORM, m_rgba8, PixelFormat::eR32G32B32A32_SFLOAT, &m_pool );
+		doNotOptimizeAway( result );
+	}
+
+	void CastorUtilsPixelConversionBench::RGBA32FToRGBA16FPerPixel()
+	{
+		m_rgba16f = pxconvtest::convertPerPixel( { pxconvtest::BenchWidth, pxconvtest::BenchHeight }, PixelFormat::eR32G32B32A32_SFLOAT, m_rgba32f, PixelFormat::eR16G16B16A16_SFLOAT );
+		doNotOptimizeAway( m_rgba16f );
+	}
+
+	void CastorUtilsPixelConversionBench::RGBA32FToRGBA16FBulk()
+	{
+		m_rgba16f = pxconvtest::convertBuffer( { pxconvtest::BenchWidth, pxconvtest::BenchHeight }, PixelFormat::eR32G32B32A32_SFLOAT, m_rgba32f, PixelFormat::eR16G16B16A16_SFLOAT, nullptr );
+		doNotOptimizeAway( m_rgba16f );
+	}
+
+	void CastorUtilsPixelConversionBench::RGBA32FToRGBA16FParallel()
+	{
+		m_rgba16f = pxconvtest::convertBuffer( { pxconvtest::BenchWidth, pxconvtest::BenchHeight }, PixelFormat::eR32G32B32A32_SFLOAT, m_rgba32f, PixelFormat::eR16G16B16A16_SFLOAT, &m_pool );
+		doNotOptimizeAway( m_rgba16f );
+	}
+
+	//*********************************************************************************************
+}
@@ -0,0 +1,56 @@
+/* See LICENSE file in root folder */
+#ifndef ___CUT_CastorUtilsPixelConversionTest___
+#define ___CUT_CastorUtilsPixelConversionTest___
+
+#include "CastorUtilsTestPrerequisites.hpp"
+
+#include <CastorUtils/Graphics/PixelFormat.hpp>
+#include <CastorUtils/Multithreading/TaskPool.hpp>
+
+namespace Testing
+{
+	class CastorUtilsPixelConversionTest
+		: public TestCase
+	{
+	public:
+		CastorUtilsPixelConversionTest();
+
+	private:
+		void doRegisterTests() override;
+
+	private:
+		void BitExactness();
+		void ParallelConversion();
+	};
+
+	class CastorUtilsPixelConversionBench
+		: public BenchCase
+	{
+	public:
+		CastorUtilsPixelConversionBench();
+		void Execute()override;
+
+	private:
+		void RGB8ToRGBA8PerPixel();
+		void RGB8ToRGBA8Bulk();
+		void RGB8ToRGBA8Parallel();
+		void BGRA8ToRGBA8PerPixel();
+		void BGRA8ToRGBA8Bulk();
+		void BGRA8ToRGBA8Parallel();
+		void RGBA8ToRGBA32FPerPixel();
+		void RGBA8ToRGBA32FBulk();
+		void RGBA8ToRGBA32FParallel();
+		void RGBA32FToRGBA16FPerPixel();
+		void RGBA32FToRGBA16FBulk();
+		void RGBA32FToRGBA16FParallel();
+
+	private:
+		castor::TaskPool m_pool;
+		castor::ByteArray m_rgb8;
+		castor::ByteArray m_rgba8;
+		castor::ByteArray m_rgba16f;
+		castor::ByteArray m_rgba32f;
+	};
+}
+
+#endif
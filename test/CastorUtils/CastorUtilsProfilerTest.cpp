@@ -0,0 +1,160 @@
+#include "CastorUtilsProfilerTest.hpp"
+
+#include <CastorUtils/Data/File.hpp>
+#include <CastorUtils/Miscellaneous/Profiler.hpp>
+
+#include <fstream>
+#include <sstream>
+#include <thread>
+
+using namespace castor;
+
+namespace Testing
+{
+	namespace proftest
+	{
+		static std::string recordFrame( std::function< void() > content )
+		{
+			auto & profiler = Profiler::getSingleton();
+			profiler.beginFrame();
+			content();
+			profiler.endFrame();
+			std::stringstream stream;
+			profiler.writeChromeTrace( stream, 1u );
+			return stream.str();
+		}
+
+		static bool contains( std::string const & trace
+			, std::string const & text )
+		{
+			return trace.find( text ) != std::string::npos;
+		}
+	}
+
+	//*********************************************************************************************
+
+	CastorUtilsProfilerTest::CastorUtilsProfilerTest()
+		: TestCase( "CastorUtilsProfilerTest" )
+	{
+	}
+
+	void CastorUtilsProfilerTest::doRegisterTests()
+	{
+		doRegisterTest( "CastorUtilsProfilerTest::Disabled", std::bind( &CastorUtilsProfilerTest::Disabled, this ) );
+		doRegisterTest( "CastorUtilsProfilerTest::Nesting", std::bind( &CastorUtilsProfilerTest::Nesting, this ) );
+		doRegisterTest( "CastorUtilsProfilerTest::Threads", std::bind( &CastorUtilsProfilerTest::Threads, this ) );
+		doRegisterTest( "CastorUtilsProfilerTest::GpuZones", std::bind( &CastorUtilsProfilerTest::GpuZones, this ) );
+		doRegisterTest( "CastorUtilsProfilerTest::Capture", std::bind( &CastorUtilsProfilerTest::Capture, this ) );
+	}
+
+	void CastorUtilsProfilerTest::Disabled()
+	{
+		auto & profiler = Profiler::getSingleton();
+		profiler.setEnabled( true );
+		proftest::recordFrame( [](){} );
+		profiler.setEnabled( false );
+		CT_CHECK( !profiler.isEnabled() );
+		// No frame is recorded, the trace is the one of the last enabled frame.
+		auto trace = proftest::recordFrame( []()
+			{
+				CU_ProfileZone( "DisabledZone" );
+			} );
+		CT_CHECK( !proftest::contains( trace, "DisabledZone" ) );
+	}
+
+	void CastorUtilsProfilerTest::Nesting()
+	{
+		auto & profiler = Profiler::getSingleton();
+		profiler.setEnabled( true );
+		auto trace = proftest::recordFrame( []()
+			{
+				CU_ProfileZone( "OuterZone" );
+				{
+					CU_ProfileZone( "InnerZone" );
+					std::this_thread::sleep_for( Milliseconds( 1 ) );
+				}
+			} );
+		profiler.setEnabled( false );
+		CT_CHECK( proftest::contains( trace, "\"traceEvents\"" ) );
+		CT_CHECK( proftest::contains( trace, "\"name\":\"OuterZone\",\"cat\":\"cpu\"" ) );
+		CT_CHECK( proftest::contains( trace, "\"name\":\"InnerZone\",\"cat\":\"cpu\"" ) );
+		auto outer = trace.find( "OuterZone" );
+		auto inner = trace.find( "InnerZone" );
+		// Zones are recorded when they end, children first.
+		CT_CHECK( inner < outer );
+		CT_CHECK( proftest::contains( trace.substr( inner ), "\"depth\":1" ) );
+		CT_CHECK( proftest::contains( trace.substr( outer ), "\"depth\":0" ) );
+		CT_CHECK( proftest::contains( trace, "\"name\":\"Frame " ) );
+	}
+
+	void CastorUtilsProfilerTest::Threads()
+	{
+		auto & profiler = Profiler::getSingleton();
+		profiler.setEnabled( true );
+		auto trace = proftest::recordFrame( []()
+			{
+				std::thread thread{ []()
+					{
+						Profiler::getSingleton().setThreadName( cuT( "Profiled \"worker\"" ) );
+						CU_ProfileZone( "WorkerZone" );
+					} };
+				CU_ProfileZone( "MainZone" );
+				thread.join();
+			} );
+		profiler.setEnabled( false );
+		CT_CHECK( proftest::contains( trace, "WorkerZone" ) );
+		CT_CHECK( proftest::contains( trace, "MainZone" ) );
+		CT_CHECK( proftest::contains( trace, "\"Profiled \\\"worker\\\"\"" ) );
+	}
+
+	void CastorUtilsProfilerTest::GpuZones()
+	{
+		auto & profiler = Profiler::getSingleton();
+		profiler.setEnabled( true );
+		auto trace = proftest::recordFrame( [&profiler]()
+			{
+				profiler.addGpuZone( cuT( "Opaque" ), Nanoseconds( 1500000 ) );
+				profiler.addGpuZone( cuT( "Transparent" ), Nanoseconds( 250000 ) );
+			} );
+		profiler.setEnabled( false );
+		CT_CHECK( proftest::contains( trace, "\"name\":\"Opaque\",\"cat\":\"gpu\"" ) );
+		CT_CHECK( proftest::contains( trace, "\"dur\":1500.000" ) );
+		CT_CHECK( proftest::contains( trace, "\"dur\":250.000" ) );
+	}
+
+	void CastorUtilsProfilerTest::Capture()
+	{
+		auto & profiler = Profiler::getSingleton();
+		Path file{ cuT( "ProfilerCapture.json" ) };
+
+		if ( File::fileExists( file ) )
+		{
+			File::deleteFile( file );
+		}
+
+		profiler.captureFrames( file, 2u );
+		CT_CHECK( profiler.isEnabled() );
+
+		for ( uint32_t i = 0u; i < 2u; ++i )
+		{
+			CT_CHECK( !File::fileExists( file ) );
+			proftest::recordFrame( []()
+				{
+					CU_ProfileZone( "CapturedZone" );
+				} );
+		}
+
+		CT_CHECK( !profiler.isEnabled() );
+		CT_CHECK( File::fileExists( file ) );
+		std::ifstream stream{ file };
+		std::string trace{ std::istreambuf_iterator< char >{ stream }, std::istreambuf_iterator< char >{} };
+		size_t count{};
+
+		for ( auto pos = trace.find( "CapturedZone" ); pos != std::string::npos; pos = trace.find( "CapturedZone", pos + 1u ) )
+		{
+			++count;
+		}
+
+		CT_EQUAL( count, 2u );
+	}
+}
@@ -0,0 +1,27 @@
+/* See LICENSE file in root folder */
+#ifndef ___CUT_ProfilerTest_H___
+#define ___CUT_ProfilerTest_H___
+
+#include "CastorUtilsTestPrerequisites.hpp"
+
+namespace Testing
+{
+	class CastorUtilsProfilerTest
+		: public TestCase
+	{
+	public:
+		CastorUtilsProfilerTest();
+
+	private:
+		void doRegisterTests() override;
+
+	private:
+		void Disabled();
+		void Nesting();
+		void Threads();
+		void GpuZones();
+		void Capture();
+	};
+}
+
+#endif
@@ -1,13 +1,17 @@
 #include "CastorUtilsSignalTest.hpp"
 
 #include <CastorUtils/Design/Signal.hpp>
+#include <CastorUtils/Design/ThreadSafeSignal.hpp>
 #include <CastorUtils/Exception/Exception.hpp>
 
+#include <atomic>
 #include <random>
+#include <thread>
 
 namespace Testing
 {
 	using castor::SignalT;
+	using castor::TSSignalT;
 
 	CastorUtilsSignalTest::CastorUtilsSignalTest()
 		: TestCase( "CastorUtilsSignalTest" )
@@ -19,6 +23,12 @@ namespace Testing
 		doRegisterTest( "Creation", std::bind( &CastorUtilsSignalTest::Creation, this ) );
 		doRegisterTest( "Assignment", std::bind( &CastorUtilsSignalTest::Assignment, this ) );
 		doRegisterTest( "MultipleSignalConnectionAssignment", std::bind( &CastorUtilsSignalTest::MultipleSignalConnectionAssignment, this ) );
+		doRegisterTest( "DisconnectDuringEmission", std::bind( &CastorUtilsSignalTest::DisconnectDuringEmission, this ) );
+		doRegisterTest( "ConnectDuringEmission", std::bind( &CastorUtilsSignalTest::ConnectDuringEmission, this ) );
+		doRegisterTest( "ThreadSafeEmission", std::bind( &CastorUtilsSignalTest::ThreadSafeEmission, this ) );
+		doRegisterTest( "ConcurrentEmission", std::bind( &CastorUtilsSignalTest::ConcurrentEmission, this ) );
+		doRegisterTest( "ConnectDuringThreadEmission", std::bind( &CastorUtilsSignalTest::ConnectDuringThreadEmission, this ) );
+		doRegisterTest( "ThreadSafeDisconnection", std::bind( &CastorUtilsSignalTest::ThreadSafeDisconnection, this ) );
 	}
 
 	void CastorUtilsSignalTest::Creation()
@@ -66,4 +76,186 @@ namespace Testing
 		CT_CHECK_THROW( signal2() );
 		CT_CHECK_THROW( signal1() );
 	}
+
+	void CastorUtilsSignalTest::DisconnectDuringEmission()
+	{
+		SignalT< std::function< void( uint32_t & ) > > signal;
+		SignalT< std::function< void( uint32_t & ) > >::connection conn2;
+		auto conn1 = signal.connect( [&conn2]( uint32_t & count )
+			{
+				++count;
+				conn2.disconnect();
+			} );
+		conn2 = signal.connect( []( uint32_t & count )
+			{
+				count += 10u;
+			} );
+		SignalT< std::function< void( uint32_t & ) > >::connection conn3;
+		conn3 = signal.connect( [&conn3]( uint32_t & count )
+			{
+				count += 100u;
+				conn3.disconnect();
+			} );
+		uint32_t count{};
+		signal( count );
+		CT_EQUAL( count, 101u );
+		signal( count );
+		CT_EQUAL( count, 102u );
+	}
+
+	void CastorUtilsSignalTest::ConnectDuringEmission()
+	{
+		SignalT< std::function< void( uint32_t & ) > > signal;
+		std::vector< SignalT< std::function< void( uint32_t & ) > >::connection > connections;
+		connections.push_back( signal.connect( [&signal, &connections]( uint32_t & count )
+			{
+				++count;
+				connections.push_back( signal.connect( []( uint32_t & count )
+					{
+						count += 10u;
+					} ) );
+			} ) );
+		uint32_t count{};
+		signal( count );
+		CT_EQUAL( count, 1u );
+		signal( count );
+		CT_EQUAL( count, 12u );
+		CT_EQUAL( connections.size(), 3u );
+	}
+
+	void CastorUtilsSignalTest::ThreadSafeEmission()
+	{
+		TSSignalT< std::function< void( std::atomic< uint32_t > & ) > > signal;
+		auto conn1 = signal.connect( []( std::atomic< uint32_t > & count )
+			{
+				++count;
+			} );
+		std::atomic< uint32_t > count{};
+		std::atomic_bool stop{ false };
+		std::thread emitter{ [&signal, &count, &stop]()
+			{
+				while ( !stop )
+				{
+					signal( count );
+				}
+			} };
+
+		for ( uint32_t i = 0u; i < 1000u; ++i )
+		{
+			auto conn2 = signal.connect( []( std::atomic< uint32_t > & count )
+				{
+					count += 2u;
+				} );
+		}
+
+		stop = true;
+		emitter.join();
+		count = 0u;
+		signal( count );
+		CT_EQUAL( count.load(), 1u );
+	}
+
+	void CastorUtilsSignalTest::ConcurrentEmission()
+	{
+		SignalT< std::function< void( std::atomic< uint32_t > & ) > > signal;
+		auto conn1 = signal.connect( []( std::atomic< uint32_t > & count )
+			{
+				++count;
+			} );
+		std::atomic< uint32_t > count{};
+		std::vector< std::thread > emitters;
+
+		for ( uint32_t i = 0u; i < 4u; ++i )
+		{
+			emitters.emplace_back( [&signal, &count]()
+				{
+					for ( uint32_t j = 0u; j < 1000u; ++j )
+					{
+						signal( count );
+					}
+				} );
+		}
+
+		for ( auto & emitter : emitters )
+		{
+			emitter.join();
+		}
+
+		CT_EQUAL( count.load(), 4000u );
+		// No emission is running anymore, the new connection is directly active.
+		auto conn2 = signal.connect( []( std::atomic< uint32_t > & count )
+			{
+				count += 10u;
+			} );
+		count = 0u;
+		signal( count );
+		CT_EQUAL( count.load(), 11u );
+		conn1.disconnect();
+		count = 0u;
+		signal( count );
+		CT_EQUAL( count.load(), 10u );
+	}
+
+	void CastorUtilsSignalTest::ConnectDuringThreadEmission()
+	{
+		SignalT< std::function< void( uint32_t & ) > > signal;
+		SignalT< std::function< void( uint32_t & ) > >::connection conn2;
+		auto conn1 = signal.connect( [&signal, &conn2]( uint32_t & count )
+			{
+				++count;
+
+				if ( !conn2 )
+				{
+					conn2 = signal.connect( []( uint32_t & count )
+						{
+							count += 10u;
+						} );
+				}
+			} );
+		uint32_t count{};
+		std::thread emitter{ [&signal, &count]()
+			{
+				signal( count );
+			} };
+		emitter.join();
+		CT_EQUAL( count, 1u );
+		// The function connected during the other thread's emission is active once it ends.
+		count = 0u;
+		signal( count );
+		CT_EQUAL( count, 11u );
+	}
+
+	void CastorUtilsSignalTest::ThreadSafeDisconnection()
+	{
+		TSSignalT< std::function< void( std::atomic< uint32_t > & ) > > signal;
+		auto conn1 = signal.connect( []( std::atomic< uint32_t > & count )
+			{
+				++count;
+			} );
+		std::vector< std::thread > threads;
+
+		for ( uint32_t i = 0u; i < 4u; ++i )
+		{
+			threads.emplace_back( [&signal]()
+				{
+					for ( uint32_t j = 0u; j < 1000u; ++j )
+					{
+						auto conn = signal.connect( []( std::atomic< uint32_t > & count )
+							{
+								count += 2u;
+							} );
+						conn.disconnect();
+					}
+				} );
+		}
+
+		for ( auto & thread : threads )
+		{
+			thread.join();
+		}
+
+		std::atomic< uint32_t > count{};
+		signal( count );
+		CT_EQUAL( count.load(), 1u );
+	}
 }
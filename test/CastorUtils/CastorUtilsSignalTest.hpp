@@ -19,6 +19,12 @@ namespace Testing
 		void Creation();
 		void Assignment();
 		void MultipleSignalConnectionAssignment();
+		void DisconnectDuringEmission();
+		void ConnectDuringEmission();
+		void ThreadSafeEmission();
+		void ConcurrentEmission();
+		void ConnectDuringThreadEmission();
+		void ThreadSafeDisconnection();
 	};
 }
 
@@ -0,0 +1,522 @@
+#include "CastorUtilsSimdTest.hpp"
+
+#include <CastorUtils/Math/SimdBatch.hpp>
+#include <CastorUtils/Math/TransformationMatrix.hpp>
+
+#include <random>
+
+namespace Testing
+{
+	//*********************************************************************************************
+
+	namespace matrix = castor::matrix;
+	namespace simd = castor::simd;
+	using castor::Angle;
+	using castor::Matrix4x4f;
+	using castor::Matrix4x4d;
+	using castor::Point3f;
+	using castor::Point3d;
+	using castor::Point4f;
+	using castor::Quaternion;
+
+	//*********************************************************************************************
+
+	namespace simdtest
+	{
+		static uint32_t constexpr BatchSize = 1024u;
+		static uint32_t constexpr Calls = 1000u;
+
+		static std::mt19937 & getGenerator()
+		{
+			static std::mt19937 generator{ 42u };
+			return generator;
+		}
+
+		static float random( float min, float max )
+		{
+			std::uniform_real_distribution< float > distribution( min, max );
+			return distribution( getGenerator() );
+		}
+
+		static Matrix4x4f randomMatrix()
+		{
+			Matrix4x4f result;
+
+			for ( uint32_t i = 0u; i < 16u; ++i )
+			{
+				result.ptr()[i] = random( -1.0f, 1.0f );
+			}
+
+			return result;
+		}
+
+		static Matrix4x4f randomInvertible()
+		{
+			auto result = randomMatrix();
+
+			for ( uint32_t i = 0u; i < 4u; ++i )
+			{
+				result[i][i] += 4.0f;
+			}
+
+			return result;
+		}
+
+		static Quaternion randomQuaternion()
+		{
+			Point3f axis{ random( -1.0f, 1.0f ), random( -1.0f, 1.0f ), random( -1.0f, 1.0f ) };
+			castor::point::normalise( axis );
+			return Quaternion::fromAxisAngle( axis, Angle::fromDegrees( random( -180.0f, 180.0f ) ) );
+		}
+
+		static bool near( double lhs, double rhs, double epsilon )
+		{
+			return std::abs( lhs - rhs ) <= epsilon * std::max( 1.0, std::abs( rhs ) );
+		}
+
+		template< typename LhsT, typename RhsT >
+		static bool near( castor::SquareMatrix< LhsT, 4 > const & lhs
+			, castor::SquareMatrix< RhsT, 4 > const & rhs
+			, double epsilon )
+		{
+			bool result = true;
+
+			for ( uint32_t i = 0u; i < 16u; ++i )
+			{
+				result = result && near( lhs.constPtr()[i], rhs.constPtr()[i], epsilon );
+			}
+
+			return result;
+		}
+
+		template< typename LhsT, typename RhsT, uint32_t CountT >
+		static bool near( castor::Point< LhsT, CountT > const & lhs
+			, castor::Point< RhsT, CountT > const & rhs
+			, double epsilon )
+		{
+			bool result = true;
+
+			for ( uint32_t i = 0u; i < CountT; ++i )
+			{
+				result = result && near( lhs[i], rhs[i], epsilon );
+			}
+
+			return result;
+		}
+
+		static bool near( Quaternion const & lhs
+			, Quaternion const & rhs
+			, double epsilon )
+		{
+			return near( lhs->x, rhs->x, epsilon )
+				&& near( lhs->y, rhs->y, epsilon )
+				&& near( lhs->z, rhs->z, epsilon )
+				&& near( lhs->w, rhs->w, epsilon );
+		}
+
+		// The scalar code replaced by the kernels, kept as reference.
+		template< typename T >
+		static void scalarMul( castor::SquareMatrix< T, 4 > const & lhs
+			, castor::SquareMatrix< T, 4 > const & rhs
+			, castor::SquareMatrix< T, 4 > & result )
+		{
+			for ( uint32_t c = 0u; c < 4u; ++c )
+			{
+				for ( uint32_t r = 0u; r < 4u; ++r )
+				{
+					result[c][r] = lhs[0][r] * rhs[c][0]
+						+ lhs[1][r] * rhs[c][1]
+						+ lhs[2][r] * rhs[c][2]
+						+ lhs[3][r] * rhs[c][3];
+				}
+			}
+		}
+
+		template< typename T >
+		static void scalarInvert( castor::SquareMatrix< T, 4 > const & input
+			, castor::SquareMatrix< T, 4 > & result )
+		{
+			auto s = [&input]( uint32_t c, uint32_t r )
+			{
+				return input[c][r];
+			};
+			T coef00 = s( 2, 2 ) * s( 3, 3 ) - s( 3, 2 ) * s( 2, 3 );
+			T coef02 = s( 1, 2 ) * s( 3, 3 ) - s( 3, 2 ) * s( 1, 3 );
+			T coef03 = s( 1, 2 ) * s( 2, 3 ) - s( 2, 2 ) * s( 1, 3 );
+			T coef04 = s( 2, 1 ) * s( 3, 3 ) - s( 3, 1 ) * s( 2, 3 );
+			T coef06 = s( 1, 1 ) * s( 3, 3 ) - s( 3, 1 ) * s( 1, 3 );
+			T coef07 = s( 1, 1 ) * s( 2, 3 ) - s( 2, 1 ) * s( 1, 3 );
+			T coef08 = s( 2, 1 ) * s( 3, 2 ) - s( 3, 1 ) * s( 2, 2 );
+			T coef10 = s( 1, 1 ) * s( 3, 2 ) - s( 3, 1 ) * s( 1, 2 );
+			T coef11 = s( 1, 1 ) * s( 2, 2 ) - s( 2, 1 ) * s( 1, 2 );
+			T coef12 = s( 2, 0 ) * s( 3, 3 ) - s( 3, 0 ) * s( 2, 3 );
+			T coef14 = s( 1, 0 ) * s( 3, 3 ) - s( 3, 0 ) * s( 1, 3 );
+			T coef15 = s( 1, 0 ) * s( 2, 3 ) - s( 2, 0 ) * s( 1, 3 );
+			T coef16 = s( 2, 0 ) * s( 3, 2 ) - s( 3, 0 ) * s( 2, 2 );
+			T coef18 = s( 1, 0 ) * s( 3, 2 ) - s( 3, 0 ) * s( 1, 2 );
+			T coef19 = s( 1, 0 ) * s( 2, 2 ) - s( 2, 0 ) * s( 1, 2 );
+			T coef20 = s( 2, 0 ) * s( 3, 1 ) - s( 3, 0 ) * s( 2, 1 );
+			T coef22 = s( 1, 0 ) * s( 3, 1 ) - s( 3, 0 ) * s( 1, 1 );
+			T coef23 = s( 1, 0 ) * s( 2, 1 ) - s( 2, 0 ) * s( 1, 1 );
+			castor::SquareMatrix< T, 4 > inverse;
+			inverse[0][0] = +( s( 1, 1 ) * coef00 - s( 1, 2 ) * coef04 + s( 1, 3 ) * coef08 );
+			inverse[0][1] = -( s( 0, 1 ) * coef00 - s( 0, 2 ) * coef04 + s( 0, 3 ) * coef08 );
+			inverse[0][2] = +( s( 0, 1 ) * coef02 - s( 0, 2 ) * coef06 + s( 0, 3 ) * coef10 );
+			inverse[0][3] = -( s( 0, 1 ) * coef03 - s( 0, 2 ) * coef07 + s( 0, 3 ) * coef11 );
+			inverse[1][0] = -( s( 1, 0 ) * coef00 - s( 1, 2 ) * coef12 + s( 1, 3 ) * coef16 );
+			inverse[1][1] = +( s( 0, 0 ) * coef00 - s( 0, 2 ) * coef12 + s( 0, 3 ) * coef16 );
+			inverse[1][2] = -( s( 0, 0 ) * coef02 - s( 0, 2 ) * coef14 + s( 0, 3 ) * coef18 );
+			inverse[1][3] = +( s( 0, 0 ) * coef03 - s( 0, 2 ) * coef15 + s( 0, 3 ) * coef19 );
+			inverse[2][0] = +( s( 1, 0 ) * coef04 - s( 1, 1 ) * coef12 + s( 1, 3 ) * coef20 );
+			inverse[2][1] = -( s( 0, 0 ) * coef04 - s( 0, 1 ) * coef12 + s( 0, 3 ) * coef20 );
+			inverse[2][2] = +( s( 0, 0 ) * coef06 - s( 0, 1 ) * coef14 + s( 0, 3 ) * coef22 );
+			inverse[2][3] = -( s( 0, 0 ) * coef07 - s( 0, 1 ) * coef15 + s( 0, 3 ) * coef23 );
+			inverse[3][0] = -( s( 1, 0 ) * coef08 - s( 1, 1 ) * coef16 + s( 1, 2 ) * coef20 );
+			inverse[3][1] = +( s( 0, 0 ) * coef08 - s( 0, 1 ) * coef16 + s( 0, 2 ) * coef20 );
+			inverse[3][2] = -( s( 0, 0 ) * coef10 - s( 0, 1 ) * coef18 + s( 0, 2 ) * coef22 );
+			inverse[3][3] = +( s( 0, 0 ) * coef11 - s( 0, 1 ) * coef19 + s( 0, 2 ) * coef23 );
+			T determinant = s( 0, 0 ) * inverse[0][0]
+				+ s( 0, 1 ) * inverse[1][0]
+				+ s( 0, 2 ) * inverse[2][0]
+				+ s( 0, 3 ) * inverse[3][0];
+
+			for ( uint32_t i = 0u; i < 16u; ++i )
+			{
+				result.ptr()[i] = inverse.constPtr()[i] / determinant;
+			}
+		}
+
+		static Point3f scalarTransform( Matrix4x4f const & mtx
+			, Point3f const & point )
+		{
+			return Point3f{ mtx[0][0] * point[0] + mtx[1][0] * point[1] + mtx[2][0] * point[2] + mtx[3][0]
+				, mtx[0][1] * point[0] + mtx[1][1] * point[1] + mtx[2][1] * point[2] + mtx[3][1]
+				, mtx[0][2] * point[0] + mtx[1][2] * point[1] + mtx[2][2] * point[2] + mtx[3][2] };
+		}
+	}
+
+	//*********************************************************************************************
+
+	CastorUtilsSimdTest::CastorUtilsSimdTest()
+		: TestCase( "CastorUtilsSimdTest" )
+	{
+	}
+
+	void CastorUtilsSimdTest::doRegisterTests()
+	{
+		doRegisterTest( "MatrixMultiplication", std::bind( &CastorUtilsSimdTest::MatrixMultiplication, this ) );
+		doRegisterTest( "MatrixInversion", std::bind( &CastorUtilsSimdTest::MatrixInversion, this ) );
+		doRegisterTest( "PointsTransform", std::bind( &CastorUtilsSimdTest::PointsTransform, this ) );
+		doRegisterTest( "QuaternionMultiplication", std::bind( &CastorUtilsSimdTest::QuaternionMultiplication, this ) );
+		doRegisterTest( "QuaternionSlerp", std::bind( &CastorUtilsSimdTest::QuaternionSlerp, this ) );
+		doRegisterTest( "QuaternionToMatrix", std::bind( &CastorUtilsSimdTest::QuaternionToMatrix, this ) );
+		doRegisterTest( "Aliasing", std::bind( &CastorUtilsSimdTest::Aliasing, this ) );
+	}
+
+	void CastorUtilsSimdTest::MatrixMultiplication()
+	{
+		std::vector< Matrix4x4f > lhs;
+		std::vector< Matrix4x4f > rhs;
+
+		for ( uint32_t i = 0u; i < 100u; ++i )
+		{
+			lhs.push_back( simdtest::randomMatrix() );
+			rhs.push_back( simdtest::randomMatrix() );
+		}
+
+		std::vector< Matrix4x4f > pairwise( lhs.size() );
+		simd::multiply( lhs.data(), rhs.data(), pairwise.data(), lhs.size() );
+		std::vector< Matrix4x4f > oneByMany( lhs.size() );
+		simd::multiply( lhs.front(), rhs.data(), oneByMany.data(), rhs.size() );
+
+		for ( size_t i = 0u; i < lhs.size(); ++i )
+		{
+			Matrix4x4d reference;
+			simdtest::scalarMul( Matrix4x4d{ lhs[i] }, Matrix4x4d{ rhs[i] }, reference );
+			CT_CHECK( simdtest::near( lhs[i] * rhs[i], reference, 1.0e-5 ) );
+			CT_CHECK( simdtest::near( pairwise[i], reference, 1.0e-5 ) );
+			simdtest::scalarMul( Matrix4x4d{ lhs.front() }, Matrix4x4d{ rhs[i] }, reference );
+			CT_CHECK( simdtest::near( oneByMany[i], reference, 1.0e-5 ) );
+		}
+	}
+
+	void CastorUtilsSimdTest::MatrixInversion()
+	{
+		std::vector< Matrix4x4f > input;
+
+		for ( uint32_t i = 0u; i < 100u; ++i )
+		{
+			input.push_back( simdtest::randomInvertible() );
+		}
+
+		std::vector< Matrix4x4f > batch( input.size() );
+		simd::invert( input.data(), batch.data(), input.size() );
+		Matrix4x4f identity{ 1.0f };
+
+		for ( size_t i = 0u; i < input.size(); ++i )
+		{
+			Matrix4x4d reference;
+			simdtest::scalarInvert( Matrix4x4d{ input[i] }, reference );
+			CT_CHECK( simdtest::near( input[i].getInverse(), reference, 1.0e-5 ) );
+			CT_CHECK( simdtest::near( batch[i], reference, 1.0e-5 ) );
+			CT_CHECK( simdtest::near( input[i] * batch[i], identity, 1.0e-5 ) );
+		}
+	}
+
+	void CastorUtilsSimdTest::PointsTransform()
+	{
+		auto mtx = simdtest::randomMatrix();
+		Matrix4x4d mtxd{ mtx };
+		// Odd counts, to go through the remainders of the batched kernels.
+		std::vector< Point3f > points3( 37u );
+		std::vector< Point4f > points4( 37u );
+
+		for ( size_t i = 0u; i < points3.size(); ++i )
+		{
+			points3[i] = Point3f{ simdtest::random( -10.0f, 10.0f ), simdtest::random( -10.0f, 10.0f ), simdtest::random( -10.0f, 10.0f ) };
+			points4[i] = Point4f{ points3[i][0], points3[i][1], points3[i][2], simdtest::random( 0.5f, 2.0f ) };
+		}
+
+		std::vector< Point3f > transformed3( points3.size() );
+		simd::transform( mtx, points3.data(), transformed3.data(), points3.size() );
+		std::vector< Point4f > transformed4( points4.size() );
+		simd::transform( mtx, points4.data(), transformed4.data(), points4.size() );
+
+		for ( size_t i = 0u; i < points3.size(); ++i )
+		{
+			Point3d point{ points3[i][0], points3[i][1], points3[i][2] };
+			Point3d reference{ mtxd[0][0] * point[0] + mtxd[1][0] * point[1] + mtxd[2][0] * point[2] + mtxd[3][0]
+				, mtxd[0][1] * point[0] + mtxd[1][1] * point[1] + mtxd[2][1] * point[2] + mtxd[3][1]
+				, mtxd[0][2] * point[0] + mtxd[1][2] * point[1] + mtxd[2][2] * point[2] + mtxd[3][2] };
+			CT_CHECK( simdtest::near( transformed3[i], reference, 1.0e-5 ) );
+			CT_CHECK( simdtest::near( mtx * points3[i], reference, 1.0e-5 ) );
+			CT_CHECK( simdtest::near( matrix::getTransformed( mtx, points3[i] )
+				, matrix::getTransformed( mtxd, point )
+				, 1.0e-4 ) );
+
+			auto w = double( points4[i][3] );
+			castor::Point4d reference4{ reference[0] + mtxd[3][0] * ( w - 1.0 )
+				, reference[1] + mtxd[3][1] * ( w - 1.0 )
+				, reference[2] + mtxd[3][2] * ( w - 1.0 )
+				, mtxd[0][3] * point[0] + mtxd[1][3] * point[1] + mtxd[2][3] * point[2] + mtxd[3][3] * w };
+			CT_CHECK( simdtest::near( transformed4[i], reference4, 1.0e-5 ) );
+			CT_CHECK( simdtest::near( mtx * points4[i], reference4, 1.0e-5 ) );
+		}
+	}
+
+	void CastorUtilsSimdTest::QuaternionMultiplication()
+	{
+		std::vector< Quaternion > lhs;
+		std::vector< Quaternion > rhs;
+
+		for ( uint32_t i = 0u; i < 100u; ++i )
+		{
+			lhs.push_back( simdtest::randomQuaternion() );
+			rhs.push_back( simdtest::randomQuaternion() );
+		}
+
+		std::vector< Quaternion > batch( lhs.size() );
+		simd::multiply( lhs.data(), rhs.data(), batch.data(), lhs.size() );
+
+		for ( size_t i = 0u; i < lhs.size(); ++i )
+		{
+			CT_CHECK( simdtest::near( batch[i], lhs[i] * rhs[i], 1.0e-5 ) );
+		}
+	}
+
+	void CastorUtilsSimdTest::QuaternionSlerp()
+	{
+		std::vector< Quaternion > lhs;
+		std::vector< Quaternion > rhs;
+
+		for ( uint32_t i = 0u; i < 100u; ++i )
+		{
+			lhs.push_back( simdtest::randomQuaternion() );
+			rhs.push_back( simdtest::randomQuaternion() );
+		}
+
+		// Opposite hemispheres, and nearly identical rotations.
+		Quaternion opposite{ lhs.front() };
+		opposite->x = -opposite->x;
+		opposite->y = -opposite->y;
+		opposite->z = -opposite->z;
+		opposite->w = -opposite->w;
+		lhs.push_back( lhs.front() );
+		rhs.push_back( opposite );
+		lhs.push_back( lhs.front() );
+		rhs.push_back( lhs.front() );
+
+		for ( auto factor : { 0.0f, 0.25f, 0.5f, 0.9f, 1.0f } )
+		{
+			std::vector< Quaternion > batch( lhs.size() );
+			simd::slerp( lhs.data(), rhs.data(), factor, batch.data(), lhs.size() );
+
+			for ( size_t i = 0u; i < lhs.size(); ++i )
+			{
+				CT_CHECK( simdtest::near( batch[i], lhs[i].slerp( rhs[i], factor ), 1.0e-5 ) );
+			}
+		}
+	}
+
+	void CastorUtilsSimdTest::QuaternionToMatrix()
+	{
+		std::vector< Quaternion > input;
+
+		for ( uint32_t i = 0u; i < 100u; ++i )
+		{
+			input.push_back( simdtest::randomQuaternion() );
+		}
+
+		std::vector< Matrix4x4f > batch( input.size() );
+		simd::toMatrix( input.data(), batch.data(), input.size() );
+
+		for ( size_t i = 0u; i < input.size(); ++i )
+		{
+			Matrix4x4f reference{ 1.0f };
+			matrix::setRotate( reference, input[i] );
+			CT_CHECK( simdtest::near( batch[i], reference, 1.0e-6 ) );
+		}
+	}
+
+	void CastorUtilsSimdTest::Aliasing()
+	{
+		auto lhs = simdtest::randomInvertible();
+		auto rhs = simdtest::randomInvertible();
+		auto product = lhs * rhs;
+		auto inPlace = lhs;
+		inPlace *= rhs;
+		CT_CHECK( simdtest::near( inPlace, product, 1.0e-6 ) );
+		inPlace = rhs;
+		simd::multiply( lhs, &inPlace, &inPlace, 1u );
+		CT_CHECK( simdtest::near( inPlace, product, 1.0e-6 ) );
+		inPlace = lhs;
+		simd::multiply( inPlace, &inPlace, &inPlace, 1u );
+		CT_CHECK( simdtest::near( inPlace, lhs * lhs, 1.0e-6 ) );
+
+		auto inverse = lhs.getInverse();
+		inPlace = lhs;
+		inPlace.invert();
+		CT_CHECK( simdtest::near( inPlace, inverse, 1.0e-6 ) );
+
+		Point3f points[2]{ Point3f{ 1.0f, 2.0f, 3.0f }, Point3f{ -4.0f, 5.0f, -6.0f } };
+		Point3f expected[2]{ lhs * points[0], lhs * points[1] };
+		simd::transform( lhs, points, points, 2u );
+		CT_CHECK( simdtest::near( points[0], expected[0], 1.0e-6 ) );
+		CT_CHECK( simdtest::near( points[1], expected[1], 1.0e-6 ) );
+	}
+
+	//*********************************************************************************************
+
+	CastorUtilsSimdBench::CastorUtilsSimdBench()
+		: BenchCase( "CastorUtilsSimdBench" )
+		, m_matrix{ simdtest::randomInvertible() }
+		, m_matrices( simdtest::BatchSize )
+		, m_transformed( simdtest::BatchSize )
+		, m_quaternions( simdtest::BatchSize )
+	{
+		for ( uint32_t i = 0u; i < simdtest::BatchSize; ++i )
+		{
+			m_lhs.push_back( simdtest::randomInvertible() );
+			m_rhs.push_back( simdtest::randomInvertible() );
+			m_points.push_back( Point3f{ simdtest::random( -10.0f, 10.0f ), simdtest::random( -10.0f, 10.0f ), simdtest::random( -10.0f, 10.0f ) } );
+			m_src.push_back( simdtest::randomQuaternion() );
+			m_dst.push_back( simdtest::randomQuaternion() );
+		}
+	}
+
+	void CastorUtilsSimdBench::Execute()
+	{
+		BENCHMARK( MultiplyScalar, simdtest::Calls );
+		BENCHMARK( MultiplySimd, simdtest::Calls );
+		BENCHMARK( InvertScalar, simdtest::Calls );
+		BENCHMARK( InvertSimd, simdtest::Calls );
+		BENCHMARK( TransformScalar, simdtest::Calls );
+		BENCHMARK( TransformSimd, simdtest::Calls );
+		BENCHMARK( SlerpScalar, simdtest::Calls );
+		BENCHMARK( SlerpSimd, simdtest::Calls );
+		BENCHMARK( ToMatrixScalar, simdtest::Calls );
+		BENCHMARK( ToMatrixSimd, simdtest::Calls );
+	}
+
+	void CastorUtilsSimdBench::MultiplyScalar()
+	{
+		for ( uint32_t i = 0u; i < simdtest::BatchSize; ++i )
+		{
+			simdtest::scalarMul( m_lhs[i], m_rhs[i], m_matrices[i] );
+		}
+
+		doNotOptimizeAway( m_matrices );
+	}
+
+	void CastorUtilsSimdBench::MultiplySimd()
+	{
+		simd::multiply( m_lhs.data(), m_rhs.data(), m_matrices.data(), simdtest::BatchSize );
+		doNotOptimizeAway( m_matrices );
+	}
+
+	void CastorUtilsSimdBench::InvertScalar()
+	{
+		for ( uint32_t i = 0u; i < simdtest::BatchSize; ++i )
+		{
+			simdtest::scalarInvert( m_lhs[i], m_matrices[i] );
+		}
+
+		doNotOptimizeAway( m_matrices );
+	}
+
+	void CastorUtilsSimdBench::InvertSimd()
+	{
+		simd::invert( m_lhs.data(), m_matrices.data(), simdtest::BatchSize );
+		doNotOptimizeAway( m_matrices );
+	}
+
+	void CastorUtilsSimdBench::TransformScalar()
+	{
+		for ( uint32_t i = 0u; i < simdtest::BatchSize; ++i )
+		{
+			m_transformed[i] = simdtest::scalarTransform( m_matrix, m_points[i] );
+		}
+
+		doNotOptimizeAway( m_transformed );
+	}
+
+	void CastorUtilsSimdBench::TransformSimd()
+	{
+		simd::transform( m_matrix, m_points.data(), m_transformed.data(), simdtest::BatchSize );
+		doNotOptimizeAway( m_transformed );
+	}
+
+	void CastorUtilsSimdBench::SlerpScalar()
+	{
+		for ( uint32_t i = 0u; i < simdtest::BatchSize; ++i )
+		{
+			m_quaternions[i] = m_src[i].slerp( m_dst[i], 0.3f );
+		}
+
+		doNotOptimizeAway( m_quaternions );
+	}
+
+	void CastorUtilsSimdBench::SlerpSimd()
+	{
+		simd::slerp( m_src.data(), m_dst.data(), 0.3f, m_quaternions.data(), simdtest::BatchSize );
+		doNotOptimizeAway( m_quaternions );
+	}
+
+	void CastorUtilsSimdBench::ToMatrixScalar()
+	{
+		for ( uint32_t i = 0u; i < simdtest::BatchSize; ++i )
+		{
+			matrix::setRotate( m_matrices[i], m_src[i] );
+		}
+
+		doNotOptimizeAway( m_matrices );
+	}
+
+	void CastorUtilsSimdBench::ToMatrixSimd()
+	{
+		simd::toMatrix( m_src.data(), m_matrices.data(), simdtest::BatchSize );
+		doNotOptimizeAway( m_matrices );
+	}
+
+	//*********************************************************************************************
+}
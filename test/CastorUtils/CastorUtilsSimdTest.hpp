@@ -0,0 +1,63 @@
+/* See LICENSE file in root folder */
+#ifndef ___CUT_CastorUtilsSimdTest___
+#define ___CUT_CastorUtilsSimdTest___
+
+#include "CastorUtilsTestPrerequisites.hpp"
+
+#include <CastorUtils/Math/Quaternion.hpp>
+#include <CastorUtils/Math/SquareMatrix.hpp>
+
+namespace Testing
+{
+	class CastorUtilsSimdTest
+		: public TestCase
+	{
+	public:
+		CastorUtilsSimdTest();
+
+	private:
+		void doRegisterTests() override;
+
+	private:
+		void MatrixMultiplication();
+		void MatrixInversion();
+		void PointsTransform();
+		void QuaternionMultiplication();
+		void QuaternionSlerp();
+		void QuaternionToMatrix();
+		void Aliasing();
+	};
+
+	class CastorUtilsSimdBench
+		: public BenchCase
+	{
+	public:
+		CastorUtilsSimdBench();
+		void Execute()override;
+
+	private:
+		void MultiplyScalar();
+		void MultiplySimd();
+		void InvertScalar();
+		void InvertSimd();
+		void TransformScalar();
+		void TransformSimd();
+		void SlerpScalar();
+		void SlerpSimd();
+		void ToMatrixScalar();
+		void ToMatrixSimd();
+
+	private:
+		castor::Matrix4x4f m_matrix;
+		std::vector< castor::Matrix4x4f > m_lhs;
+		std::vector< castor::Matrix4x4f > m_rhs;
+		std::vector< castor::Matrix4x4f > m_matrices;
+		std::vector< castor::Point3f > m_points;
+		std::vector< castor::Point3f > m_transformed;
+		std::vector< castor::Quaternion > m_src;
+		std::vector< castor::Quaternion > m_dst;
+		std::vector< castor::Quaternion > m_quaternions;
+	};
+}
+
+#endif
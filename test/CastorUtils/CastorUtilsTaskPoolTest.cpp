@@ -0,0 +1,102 @@
+#include "CastorUtilsTaskPoolTest.hpp"
+
+#include <CastorUtils/Multithreading/TaskPool.hpp>
+
+#include <atomic>
+#include <stdexcept>
+
+using namespace castor;
+
+namespace Testing
+{
+	CastorUtilsTaskPoolTest::CastorUtilsTaskPoolTest()
+		: TestCase( "CastorUtilsTaskPoolTest" )
+	{
+	}
+
+	void CastorUtilsTaskPoolTest::doRegisterTests()
+	{
+		doRegisterTest( "CastorUtilsTaskPoolTest::AllIndices", std::bind( &CastorUtilsTaskPoolTest::AllIndices, this ) );
+		doRegisterTest( "CastorUtilsTaskPoolTest::Repeated", std::bind( &CastorUtilsTaskPoolTest::Repeated, this ) );
+		doRegisterTest( "CastorUtilsTaskPoolTest::Nested", std::bind( &CastorUtilsTaskPoolTest::Nested, this ) );
+		doRegisterTest( "CastorUtilsTaskPoolTest::Exception", std::bind( &CastorUtilsTaskPoolTest::Exception, this ) );
+	}
+
+	void CastorUtilsTaskPoolTest::AllIndices()
+	{
+		static constexpr uint32_t count = 10000u;
+		TaskPool pool( 4u );
+		std::vector< std::atomic_int > visits( count );
+		pool.parallelFor( count
+			, [&visits]( uint32_t index )
+			{
+				visits[index]++;
+			} );
+
+		for ( auto & visit : visits )
+		{
+			CT_EQUAL( visit.load(), 1 );
+		}
+	}
+
+	void CastorUtilsTaskPoolTest::Repeated()
+	{
+		TaskPool pool( 3u );
+		std::atomic< uint32_t > total{ 0u };
+
+		for ( uint32_t i = 0u; i < 100u; ++i )
+		{
+			pool.parallelFor( 64u
+				, [&total]( uint32_t index )
+				{
+					total += index;
+				} );
+		}
+
+		CT_EQUAL( total.load(), 100u * ( 63u * 64u / 2u ) );
+	}
+
+	void CastorUtilsTaskPoolTest::Nested()
+	{
+		TaskPool pool( 2u );
+		std::atomic< uint32_t > total{ 0u };
+		pool.parallelFor( 8u
+			, [&pool, &total]( uint32_t )
+			{
+				pool.parallelFor( 8u
+					, [&total]( uint32_t )
+					{
+						++total;
+					} );
+			} );
+		CT_EQUAL( total.load(), 64u );
+	}
+
+	void CastorUtilsTaskPoolTest::Exception()
+	{
+		TaskPool pool( 2u );
+		std::atomic< uint32_t > total{ 0u };
+		bool thrown = false;
+
+		try
+		{
+			pool.parallelFor( 32u
+				, [&total]( uint32_t index )
+				{
+					++total;
+
+					if ( index == 5u )
+					{
+						throw std::runtime_error{ "TaskPool test" };
+					}
+				} );
+		}
+		catch ( std::runtime_error & )
+		{
+			thrown = true;
+		}
+
+		CT_CHECK( thrown );
+		CT_EQUAL( total.load(), 32u );
+	}
+}
@@ -0,0 +1,26 @@
+/* See LICENSE file in root folder */
+#ifndef ___CUT_TaskPoolTest_H___
+#define ___CUT_TaskPoolTest_H___
+
+#include "CastorUtilsTestPrerequisites.hpp"
+
+namespace Testing
+{
+	class CastorUtilsTaskPoolTest
+		: public TestCase
+	{
+	public:
+		CastorUtilsTaskPoolTest();
+
+	private:
+		void doRegisterTests() override;
+
+	private:
+		void AllIndices();
+		void Repeated();
+		void Nested();
+		void Exception();
+	};
+}
+
+#endif
@@ -3,6 +3,8 @@
 #include <CastorUtils/Data/ZipArchive.hpp>
 #include <CastorUtils/Data/BinaryFile.hpp>
 #include <CastorUtils/Data/TextFile.hpp>
+#include <CastorUtils/Data/VirtualFileSystem.hpp>
+#include <CastorUtils/Multithreading/TaskPool.hpp>
 
 #include <cstring>
 
@@ -18,6 +20,7 @@ namespace Testing
 	void CastorUtilsZipTest::doRegisterTests()
 	{
 		doRegisterTest( "ZipFile", std::bind( &CastorUtilsZipTest::ZipFile, this ) );
+		doRegisterTest( "ReadInPlace", std::bind( &CastorUtilsZipTest::ReadInPlace, this ) );
 	}
 
 	void CastorUtilsZipTest::ZipFile()
@@ -117,4 +120,113 @@ namespace Testing
 			std::cout << "	Couldn't create first folder" << std::endl;
 		}
 	}
+
+	void CastorUtilsZipTest::ReadInPlace()
+	{
+		Path folder1{ cuT( "vfs1" ) };
+		Path folder2{ folder1 / cuT( "vfs2" ) };
+
+		if ( !( File::directoryExists( folder1 ) || File::directoryCreate( folder1 ) )
+			|| !( File::directoryExists( folder2 ) || File::directoryCreate( folder2 ) ) )
+		{
+			std::cout << "	Couldn't create folders" << std::endl;
+			return;
+		}
+
+		Path binName = folder1 / cuT( "binFile.bin" );
+		Path txtName = folder2 / cuT( "txtFile.txt" );
+		Path zipName{ cuT( "vfsFile.zip" ) };
+
+		std::vector< uint8_t > inBinData( 100000u );
+		String inTxtData( cuT( "Coucou, comment allez-vous?" ) );
+
+		for ( size_t i = 0u; i < inBinData.size(); ++i )
+		{
+			inBinData[i] = uint8_t( ( i * 7u ) % 251u );
+		}
+
+		{
+			BinaryFile binary( binName, File::OpenMode::eWrite );
+			binary.writeArray( inBinData.data(), inBinData.size() );
+		}
+		{
+			TextFile text( txtName, File::OpenMode::eWrite );
+			text.writeText( inTxtData );
+		}
+		{
+			ZipArchive def( zipName, File::OpenMode::eWrite );
+			def.addFile( binName );
+			def.addFile( txtName );
+			def.deflate();
+		}
+
+		{
+			std::cout << "	Check the entry index" << std::endl;
+			ZipArchive archive( zipName, File::OpenMode::eRead );
+			CT_EQUAL( archive.getEntries().size(), 2u );
+			auto entry = archive.findEntry( binName );
+			CT_CHECK( entry != nullptr );
+			CT_CHECK( archive.findFile( txtName ) );
+			CT_CHECK( archive.findFolder( folder2 ) );
+			CT_CHECK( !archive.findFile( cuT( "missing.bin" ) ) );
+
+			if ( entry )
+			{
+				CT_EQUAL( entry->size, inBinData.size() );
+			}
+
+			std::cout << "	Read a file in place" << std::endl;
+			ByteArray outBinData;
+			CT_CHECK( archive.readFile( binName, outBinData ) );
+			CT_CHECK( outBinData == inBinData );
+
+			std::cout << "	Read files in parallel" << std::endl;
+			TaskPool pool{ 2u };
+			std::vector< ByteArray > contents;
+			CT_CHECK( archive.readFiles( { binName, txtName, binName }, contents, pool ) );
+			CT_EQUAL( contents.size(), 3u );
+			CT_CHECK( contents[0] == inBinData );
+			CT_CHECK( contents[2] == inBinData );
+			CT_EQUAL( String( contents[1].begin(), contents[1].end() ), inTxtData );
+		}
+
+		{
+			std::cout << "	Read through the virtual file system" << std::endl;
+			auto & vfs = VirtualFileSystem::getSingleton();
+			CT_CHECK( vfs.mountArchive( zipName ) );
+			CT_CHECK( vfs.mountArchive( zipName ) );
+			CT_CHECK( vfs.isMounted( zipName ) );
+			CT_CHECK( vfs.fileExists( zipName / txtName ) );
+			CT_CHECK( !vfs.fileExists( zipName / cuT( "missing.txt" ) ) );
+
+			PathArray files;
+			CT_CHECK( vfs.listFiles( zipName, files, true ) );
+			CT_EQUAL( files.size(), 2u );
+			CT_CHECK( vfs.listFiles( zipName, files, false ) );
+			CT_EQUAL( files.size(), 0u );
+			CT_CHECK( vfs.listFiles( zipName / folder1, files, false ) );
+			CT_EQUAL( files.size(), 1u );
+
+			String outTxtData;
+			CT_CHECK( vfs.readFile( zipName / txtName, outTxtData ) );
+			CT_EQUAL( outTxtData, inTxtData );
+
+			vfs.unmount( zipName );
+			CT_CHECK( !vfs.isMounted( zipName ) );
+			CT_CHECK( !vfs.fileExists( zipName / txtName ) );
+
+			std::cout << "	Read a mounted folder" << std::endl;
+			vfs.mountDirectory( Path{ cuT( "mounted" ) }, folder1 );
+			ByteArray outBinData;
+			CT_CHECK( vfs.readFile( Path{ cuT( "mounted" ) } / binName.getFileName( true ), outBinData ) );
+			CT_CHECK( outBinData == inBinData );
+			vfs.unmount( Path{ cuT( "mounted" ) } );
+		}
+
+		std::remove( string::stringCast< char >( binName ).c_str() );
+		std::remove( string::stringCast< char >( txtName ).c_str() );
+		std::remove( string::stringCast< char >( zipName ).c_str() );
+		File::directoryDelete( folder2 );
+		File::directoryDelete( folder1 );
+	}
 }
@@ -5,11 +5,17 @@
 #include "CastorUtilsMatrixTest.hpp"
 #include "CastorUtilsObjectsPoolTest.hpp"
 #include "CastorUtilsPixelBufferExtractTest.hpp"
+#include "CastorUtilsPixelConversionTest.hpp"
 #include "CastorUtilsPixelFormatTest.hpp"
+#include "CastorUtilsProfilerTest.hpp"
 #include "CastorUtilsQuaternionTest.hpp"
 #include "CastorUtilsSignalTest.hpp"
+#include "CastorUtilsSimdTest.hpp"
 #include "CastorUtilsSpeedTest.hpp"
 #include "CastorUtilsStringTest.hpp"
+#include "CastorUtilsTaskPoolTest.hpp"
+#include "CastorUtilsFrameArenaTest.hpp"
+#include "CastorUtilsLoggerTest.hpp"
 #include "CastorUtilsTextWriterTest.hpp"
 #include "CastorUtilsThreadPoolTest.hpp"
 #include "CastorUtilsUniqueTest.hpp"
@@ -47,6 +53,11 @@ int main( int argc, char const * argv[] )
 	Testing::registerType( std::make_unique< Testing::CastorUtilsSignalTest >() );
 	Testing::registerType( std::make_unique< Testing::CastorUtilsWorkerThreadTest >() );
 	Testing::registerType( std::make_unique< Testing::CastorUtilsThreadPoolTest >() );
+	Testing::registerType( std::make_unique< Testing::CastorUtilsTaskPoolTest >() );
+	Testing::registerType( std::make_unique< Testing::CastorUtilsFrameArenaTest >() );
+	Testing::registerType( std::make_unique< Testing::CastorUtilsLoggerTest >() );
+	Testing::registerType( std::make_unique< Testing::CastorUtilsLoggerBench >() );
+	Testing::registerType( std::make_unique< Testing::CastorUtilsProfilerTest >() );
 	Testing::registerType( std::make_unique< Testing::CastorUtilsArrayViewTest >() );
 	Testing::registerType( std::make_unique< Testing::CastorUtilsUniqueTest >() );
 	Testing::registerType( std::make_unique< Testing::CastorUtilsMatrixTest >() );
@@ -59,6 +70,10 @@ int main( int argc, char const * argv[] )
 	Testing::registerType( std::make_unique< Testing::CastorUtilsSpeedTest >() );
 	Testing::registerType( std::make_unique< Testing::CastorUtilsTextWriterTest >() );
 	Testing::registerType( std::make_unique< Testing::CastorUtilsPixelBufferExtractTest >() );
+	Testing::registerType( std::make_unique< Testing::CastorUtilsSimdTest >() );
+	Testing::registerType( std::make_unique< Testing::CastorUtilsSimdBench >() );
+	Testing::registerType( std::make_unique< Testing::CastorUtilsPixelConversionTest >() );
+	Testing::registerType( std::make_unique< Testing::CastorUtilsPixelConversionBench >() );
 	BENCHLOOP( iCount, iReturn );
 	castor::Logger::cleanup();
 	return int( iReturn );